@@ -0,0 +1,127 @@
+#if !defined(ARDUINO)
+#include "Arduino.h"
+#include "rtl8367c_sim.h"
+#include <stdarg.h>
+
+HardwareSerial Serial;
+
+static unsigned long long simMicros = 0;
+static uint8_t pinLevel[256];
+static void (*pinIsr[256])(void);
+static int pinIsrMode[256];
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    rtl8367c_sim *sim = rtl8367c_sim::attached();
+
+    if (sim && sim->ownsPin(pin))
+        sim->pinMode(pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    rtl8367c_sim *sim = rtl8367c_sim::attached();
+
+    if (sim && sim->ownsPin(pin))
+        sim->pinWrite(pin, val);
+    else
+        pinLevel[pin] = val ? HIGH : LOW;
+}
+
+int digitalRead(uint8_t pin)
+{
+    rtl8367c_sim *sim = rtl8367c_sim::attached();
+
+    if (sim && sim->ownsPin(pin))
+        return sim->pinRead(pin);
+
+    return pinLevel[pin];
+}
+
+void attachInterrupt(uint8_t interruptNum, void (*isr)(void), int mode)
+{
+    pinIsr[interruptNum] = isr;
+    pinIsrMode[interruptNum] = mode;
+}
+
+void detachInterrupt(uint8_t interruptNum)
+{
+    pinIsr[interruptNum] = NULL;
+}
+
+void hostPinDrive(uint8_t pin, uint8_t val)
+{
+    uint8_t prev = pinLevel[pin];
+    int edge;
+
+    pinLevel[pin] = val ? HIGH : LOW;
+    if ((prev == pinLevel[pin]) || (pinIsr[pin] == NULL))
+        return;
+
+    edge = pinLevel[pin] ? RISING : FALLING;
+    if ((pinIsrMode[pin] == CHANGE) || (pinIsrMode[pin] == edge))
+        pinIsr[pin]();
+}
+
+void delay(unsigned long ms)
+{
+    simMicros += (unsigned long long)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    simMicros += us;
+}
+
+unsigned long millis()
+{
+    return (unsigned long)(simMicros / 1000);
+}
+
+unsigned long micros()
+{
+    return (unsigned long)simMicros;
+}
+
+size_t HardwareSerial::print(const char *s)
+{
+    return fputs(s, stdout) < 0 ? 0 : strlen(s);
+}
+
+size_t HardwareSerial::print(char c)
+{
+    return fputc(c, stdout) < 0 ? 0 : 1;
+}
+
+size_t HardwareSerial::print(long n, int base)
+{
+    return base == HEX ? ::printf("%lx", n) : ::printf("%ld", n);
+}
+
+size_t HardwareSerial::print(unsigned long n, int base)
+{
+    return base == HEX ? ::printf("%lx", n) : ::printf("%lu", n);
+}
+
+size_t HardwareSerial::print(unsigned long long n, int base)
+{
+    return base == HEX ? ::printf("%llx", n) : ::printf("%llu", n);
+}
+
+size_t HardwareSerial::print(double n, int digits)
+{
+    return ::printf("%.*f", digits, n);
+}
+
+size_t HardwareSerial::printf(const char *format, ...)
+{
+    va_list args;
+    int len;
+
+    va_start(args, format);
+    len = vprintf(format, args);
+    va_end(args);
+
+    return len < 0 ? 0 : len;
+}
+#endif
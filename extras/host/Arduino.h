@@ -0,0 +1,73 @@
+#ifndef Arduino_h
+#define Arduino_h
+/*
+ * Minimal Arduino core for building the library on Linux.
+ * Pin accesses are routed to the attached rtl8367c_sim, time is simulated:
+ * delay()/delayMicroseconds() advance micros()/millis() without sleeping.
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+/* provided by the ESP32 core, the library relies on it */
+#define DISABLED 0x00
+
+#define DEC 10
+#define HEX 16
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+/* interrupt numbers are pin numbers, handlers run when hostPinDrive changes
+   the level of their pin */
+#define digitalPinToInterrupt(p) (p)
+void attachInterrupt(uint8_t interruptNum, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t interruptNum);
+
+/* host only: an external device (the simulated switch) drives an input pin */
+void hostPinDrive(uint8_t pin, uint8_t val);
+
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis();
+unsigned long micros();
+
+class HardwareSerial
+{
+public:
+    void begin(unsigned long) {}
+    size_t print(const char *s);
+    size_t print(char c);
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(unsigned long long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+    size_t println() { return print("\n"); }
+    template <typename T>
+    size_t println(T v) { return print(v) + println(); }
+    template <typename T>
+    size_t println(T v, int fmt) { return print(v, fmt) + println(); }
+    size_t printf(const char *format, ...);
+};
+
+extern HardwareSerial Serial;
+
+#endif
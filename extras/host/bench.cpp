@@ -0,0 +1,585 @@
+#if !defined(ARDUINO)
+/*
+ * SMI cost of the public API, measured against the simulated switch.
+ * "bus us" is simulated time (clock delays), "host us" is real time on this
+ * machine and only meaningful relative to other rows.
+ * Every row must return RT_ERR_OK and every CHECK must hold against the
+ * simulator's state, otherwise the bench reports FAIL and exits with 1.
+ */
+#include <chrono>
+#include "Arduino.h"
+#include "rtl8367.h"
+#include "rtl8367c_sim.h"
+
+#define SIM_SCK_PIN 18
+#define SIM_SDA_PIN 19
+#define SIM_INT_PIN 21
+
+static rtl8367c_sim sim;
+static rtl8367 sw(1);
+#ifdef RTL8367_L2_INDEX
+static rtl8367 coldSw(1);
+#endif
+static uint32_t failures;
+
+#define CHECK(cond)                                                  \
+    do                                                               \
+    {                                                                \
+        if (!(cond))                                                 \
+        {                                                            \
+            printf("  FAIL line %d: %s\n", __LINE__, #cond);          \
+            failures++;                                              \
+        }                                                            \
+    } while (0)
+
+#define BENCH(name, call)                                                                       \
+    do                                                                                          \
+    {                                                                                           \
+        unsigned long us0 = micros();                                                           \
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();            \
+        int32_t ret;                                                                            \
+        sim.clearStats();                                                                       \
+        ret = (call);                                                                           \
+        long long host = std::chrono::duration_cast<std::chrono::microseconds>(                 \
+                             std::chrono::steady_clock::now() - t0)                             \
+                             .count();                                                          \
+        printf("%-36s %6ld %8u %8u %10lu %10lld\n", name, (long)ret, sim.stats.reads,           \
+               sim.stats.writes, micros() - us0, host);                                         \
+        if (ret != RT_ERR_OK)                                                                   \
+        {                                                                                       \
+            printf("  FAIL line %d: %s returned %ld\n", __LINE__, name, (long)ret);              \
+            failures++;                                                                         \
+        }                                                                                       \
+    } while (0)
+
+/* per port VLAN ingress setup, the PVID registers hold two ports each */
+static int32_t provisionPorts(uint32_t pvid)
+{
+    rtk_port_t port;
+    int32_t ret;
+
+    for (port = UTP_PORT0; port <= UTP_PORT4; port = (rtk_port_t)(port + 1))
+    {
+        if ((ret = sw.rtk_vlan_portPvid_set(port, pvid, 0)) != RT_ERR_OK)
+            return ret;
+        if ((ret = sw.rtk_vlan_portAcceptFrameType_set(port, ACCEPT_FRAME_TYPE_ALL)) != RT_ERR_OK)
+            return ret;
+        if ((ret = sw.rtk_vlan_portIgrFilterEnable_set(port, ENABLED)) != RT_ERR_OK)
+            return ret;
+    }
+
+    return RT_ERR_OK;
+}
+
+#ifdef RTL8367_REG_BATCH
+static int32_t provisionPortsBatched(uint32_t pvid)
+{
+    int32_t ret;
+
+    sw.beginRegBatch();
+    ret = provisionPorts(pvid);
+    if (sw.commitRegBatch() != RT_ERR_OK)
+        return RT_ERR_FAILED;
+
+    return ret;
+}
+
+/* the clear is a pulse of FLOWCTRL_DEBUG_CTRL1, it must not be merged away */
+static int32_t queuePageMaxClearBatched(rtk_port_t port)
+{
+    int32_t ret;
+
+    sw.beginRegBatch();
+    ret = sw.rtk_buf_queuePageMax_clear(port);
+    if (sw.commitRegBatch() != RT_ERR_OK)
+        return RT_ERR_FAILED;
+
+    return ret;
+}
+#endif
+
+#define BENCH_VLAN_NUM 100
+
+static rtk_vlan_entry_t vlanEntries[BENCH_VLAN_NUM];
+
+/* VIDs 200~299, one rtk_vlan_set at a time */
+static int32_t vlanSetLoop()
+{
+    uint32_t i;
+    int32_t ret;
+
+    for (i = 0; i < BENCH_VLAN_NUM; i++)
+    {
+        if ((ret = sw.rtk_vlan_set(vlanEntries[i].vid, &vlanEntries[i].cfg)) != RT_ERR_OK)
+            return ret;
+    }
+
+    return RT_ERR_OK;
+}
+
+#ifdef RTL8367_VLAN_SHADOW
+/* every configured VID from the shadow */
+static int32_t listVlans(uint32_t *pNum)
+{
+    uint32_t vid = 0;
+    int32_t ret;
+
+    *pNum = 0;
+    while ((ret = sw.rtk_vlan_shadow_next_get(&vid)) == RT_ERR_OK)
+    {
+        (*pNum)++;
+        vid++;
+    }
+
+    return (ret == RT_ERR_VLAN_ENTRY_NOT_FOUND) ? RT_ERR_OK : ret;
+}
+#endif
+
+/* link state of the UTP ports, one rtk_port_phyStatus_get at a time */
+static int32_t phyStatusLoop()
+{
+    uint8_t port, link, speed, duplex;
+    int32_t ret;
+
+    for (port = UTP_PORT0; port <= UTP_PORT4; port++)
+    {
+        if ((ret = sw.rtk_port_phyStatus_get(port, link, speed, duplex)) != RT_ERR_OK)
+            return ret;
+    }
+
+    return RT_ERR_OK;
+}
+
+#define BENCH_L2_NUM 100
+
+/* walk the unicast entries one rtk_l2_addr_next_get at a time */
+static int32_t walkL2()
+{
+    rtk_l2_ucastAddr_t l2;
+    uint32_t addr = 0;
+    int32_t ret;
+
+    while ((ret = sw.rtk_l2_addr_next_get(READMETHOD_NEXT_L2UC, UTP_PORT0, &addr, &l2)) == RT_ERR_OK)
+        addr++;
+
+    return (ret == RT_ERR_L2_ENTRY_NOTFOUND) ? RT_ERR_OK : ret;
+}
+
+static int32_t dumpL2()
+{
+    static rtk_l2_entry_t entries[BENCH_L2_NUM];
+    uint32_t addr = 0, num;
+
+    return sw.rtk_l2_table_dump(&addr, entries, BENCH_L2_NUM, &num);
+}
+
+/* every counter of a port, one rtk_stat_port_get at a time */
+static int32_t statPortLoop(rtk_port_t port, rtk_stat_port_cntr_t *pCntrs)
+{
+    uint32_t idx;
+    int32_t ret;
+
+    for (idx = 0; idx < STAT_PORT_CNTR_END; idx++)
+    {
+        ret = sw.rtk_stat_port_get(port, (rtk_stat_port_type_t)idx, &pCntrs->cntr[idx]);
+        if (ret == RT_ERR_CHIP_NOT_SUPPORTED)
+            pCntrs->cntr[idx] = 0;
+        else if (ret != RT_ERR_OK)
+            return ret;
+    }
+
+    return RT_ERR_OK;
+}
+
+#ifdef RTL8367_TRUNK_BALANCE
+/* 10 MB per hash value onto the member it maps to, then one rebalance */
+static int32_t trunkTrafficRebalance(uint32_t *pMoved)
+{
+    rtk_trunk_hashVal2Port_t map;
+    uint32_t hash, off;
+    int32_t ret;
+
+    if ((ret = sw.rtk_trunk_hashMappingTable_get(TRUNK_GROUP0, &map)) != RT_ERR_OK)
+        return ret;
+    for (hash = 0; hash < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; hash++)
+    {
+        off = RTL8367C_MIB_PORT_OFFSET * map.value[hash] + 60; /* ifOutOctets */
+        sim.mibSet(off, 4, sim.mibGet(off, 4) + 10000000);
+    }
+
+    return sw.rtk_trunk_rebalance(TRUNK_GROUP0, pMoved);
+}
+#endif
+
+#ifdef RTL8367_INT_EVENT
+static rtk_int_event_t lastEvent;
+
+static void onLinkChange(const rtk_int_event_t *pEvent, void *pArg)
+{
+    lastEvent = *pEvent;
+    (*(uint32_t *)pArg)++;
+}
+#endif
+
+int main()
+{
+    uint8_t chip;
+    uint8_t link, speed, duplex;
+    rtk_vlan_cfg_t vlan;
+    rtk_mac_t mac = {{0x00, 0x11, 0x22, 0x33, 0x44, 0x55}};
+    rtk_l2_ucastAddr_t l2;
+    uint64_t cntr;
+    static rtk_stat_port_cntr_t cntrs[7];
+    static rtk_stat_port_cntr_t cntrsRef;
+    uint32_t pvid, pri;
+    rtk_portmask_t pmask;
+    rtk_port_status_all_t portStatus;
+    rtk_port_phy_ability_t ability;
+    const uint32_t phyRegs[4] = {PHY_REG_CONTROL, PHY_REG_STATUS, PHY_REG_IDENTIFIER_1, PHY_REG_IDENTIFIER_2};
+    uint32_t phyData[4];
+    rtk_buf_port_page_t portPage;
+    rtk_pktgen_cfg_t pktgen = {{{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, {{0x00, 0xE0, 0x4C, 0x00, 0x00, 0x01}}, 64, 100000, PKTGEN_CRC_GOOD};
+    rtk_pktgen_result_t pktgenResult;
+    rtk_trunk_hashVal2Port_t trunkMap;
+    rtk_l2_flushCfg_t flushCfg;
+    static rtk_l2_entry_t l2Entries[BENCH_L2_NUM];
+    rtk_enable_t ifg, fc;
+#ifdef RTL8367_TRUNK_BALANCE
+    uint32_t moved, round, onUtp1;
+#endif
+#ifdef RTL8367_BUF_HIST
+    rtk_buf_hist_t hist;
+#endif
+#ifdef RTL8367_STAT_RATE
+    rtk_stat_port_rate_t rate;
+#endif
+#ifdef RTL8367_L2_LEARN_RATE
+    rtk_l2_learn_rate_t learn;
+    rtk_portmask_t flood;
+#endif
+    uint32_t addr;
+#ifdef RTL8367_L2_INDEX
+    rtk_l2_entry_t l2Entry;
+#endif
+#ifdef RTL8367_INT_EVENT
+    uint32_t linkChanges = 0, num;
+#endif
+#ifdef RTL8367_REG_CACHE
+    uint32_t mismatch;
+    rtl8367_reg_cache_stats_t cacheStats;
+#endif
+
+    sim.attach(SIM_SCK_PIN, SIM_SDA_PIN);
+    sw.setCommunicationPins(SIM_SCK_PIN, SIM_SDA_PIN);
+#ifdef RTL8367_L2_INDEX
+    coldSw.setCommunicationPins(SIM_SCK_PIN, SIM_SDA_PIN);
+#endif
+
+    printf("%-36s %6s %8s %8s %10s %10s\n", "call", "ret", "reads", "writes", "bus us", "host us");
+
+    BENCH("rtk_switch_probe", sw.rtk_switch_probe(chip));
+    CHECK(chip == CHIP_RTL8367C);
+    BENCH("rtk_port_phyStatus_get", sw.rtk_port_phyStatus_get(UTP_PORT0, link, speed, duplex));
+    BENCH("rtk_port_phyStatus_get x5", phyStatusLoop());
+    /* UTP1 up at 1000F, EXT1 forced to 100F */
+    sim.poke(RTL8367C_REG_PORT1_STATUS, 0x0016);
+    sim.poke(RTL8367C_REG_PORT7_STATUS, 0x0015);
+    BENCH("rtk_port_phyStatus_getAll", sw.rtk_port_phyStatus_getAll(&portStatus));
+    printf("  link 0x%x, UTP1 speed %u duplex %u, EXT1 speed %u duplex %u\n", portStatus.linkUp.bits[0],
+           portStatus.speed[UTP_PORT1], portStatus.duplex[UTP_PORT1], portStatus.speed[EXT_PORT1], portStatus.duplex[EXT_PORT1]);
+    CHECK(portStatus.linkUp.bits[0] == ((1 << UTP_PORT1) | (1 << EXT_PORT1)));
+    CHECK((portStatus.speed[UTP_PORT1] == PORT_SPEED_1000M) && (portStatus.duplex[UTP_PORT1] == PORT_FULL_DUPLEX));
+    CHECK((portStatus.speed[EXT_PORT1] == PORT_SPEED_100M) && (portStatus.duplex[EXT_PORT1] == PORT_FULL_DUPLEX));
+    BENCH("rtk_port_phyAutoNegoAbility_get", sw.rtk_port_phyAutoNegoAbility_get(UTP_PORT1, &ability));
+    BENCH("rtk_port_phyAutoNegoAbility_set", sw.rtk_port_phyAutoNegoAbility_set(UTP_PORT1, &ability));
+    BENCH("rtk_port_phyRegs_get (4 regs)", sw.rtk_port_phyRegs_get(UTP_PORT1, phyRegs, 4, phyData));
+    printf("  BMCR 0x%04x BMSR 0x%04x\n", phyData[0], phyData[1]);
+    CHECK(phyData[0] == sim.phyPeek(1, 0xA400));
+    CHECK(phyData[1] == sim.phyPeek(1, 0xA402));
+    BENCH("rtk_vlan_init", sw.rtk_vlan_init());
+    BENCH("rtk_vlan_init (diff, unchanged)", sw.rtk_vlan_init(VLAN_INIT_MODE_DIFF));
+
+    memset(&vlan, 0, sizeof(vlan));
+    RTK_PORTMASK_PORT_SET(vlan.mbr, UTP_PORT0);
+    RTK_PORTMASK_PORT_SET(vlan.mbr, UTP_PORT1);
+    vlan.untag = vlan.mbr;
+    BENCH("rtk_vlan_set", sw.rtk_vlan_set(100, &vlan));
+    BENCH("rtk_vlan_get", sw.rtk_vlan_get(100, &vlan));
+    CHECK((vlan.mbr.bits[0] == ((1 << UTP_PORT0) | (1 << UTP_PORT1))) && (vlan.untag.bits[0] == vlan.mbr.bits[0]));
+#ifdef RTL8367_VLAN_SHADOW
+    BENCH("rtk_vlan_shadow_rebuild", sw.rtk_vlan_shadow_rebuild(&addr));
+    BENCH("rtk_vlan_get (shadowed)", sw.rtk_vlan_get(100, &vlan));
+    BENCH("rtk_vlan_shadow_next_get (list)", listVlans(&phyData[0]));
+    printf("  %u VLANs configured, %u listed\n", addr, phyData[0]);
+    CHECK((addr == 2) && (phyData[0] == 2));
+#endif
+    BENCH("rtk_vlan_portPvid_set", sw.rtk_vlan_portPvid_set(UTP_PORT0, 100, 0));
+    CHECK((sw.rtk_vlan_portPvid_get(UTP_PORT0, &pvid, &pri) == RT_ERR_OK) && (pvid == 100) && (pri == 0));
+
+    /* 100 VLANs on UTP0~2, pushed again, then again with 10 of them moved to UTP3 */
+    for (addr = 0; addr < BENCH_VLAN_NUM; addr++)
+    {
+        vlanEntries[addr].vid = 200 + addr;
+        vlanEntries[addr].cfg = vlan;
+        RTK_PORTMASK_PORT_SET(vlanEntries[addr].cfg.mbr, UTP_PORT2);
+        vlanEntries[addr].cfg.fid_msti = 1;
+    }
+    BENCH("rtk_vlan_set x100", vlanSetLoop());
+    BENCH("rtk_vlan_bulk_set (100, unchanged)", sw.rtk_vlan_bulk_set(vlanEntries, BENCH_VLAN_NUM, &phyData[0]));
+    for (addr = 0; addr < BENCH_VLAN_NUM; addr += 10)
+        RTK_PORTMASK_PORT_SET(vlanEntries[addr].cfg.mbr, UTP_PORT3);
+    BENCH("rtk_vlan_bulk_set (100, 10 changed)", sw.rtk_vlan_bulk_set(vlanEntries, BENCH_VLAN_NUM, &phyData[1]));
+    BENCH("rtk_vlan_range_set (300~399)", sw.rtk_vlan_range_set(300, 399, &vlanEntries[0].cfg, &phyData[2]));
+    printf("  written %u, %u, %u\n", phyData[0], phyData[1], phyData[2]);
+    CHECK((phyData[0] == 0) && (phyData[1] == BENCH_VLAN_NUM / 10) && (phyData[2] == 100));
+    CHECK((sw.rtk_vlan_get(200, &vlan) == RT_ERR_OK) && (vlan.mbr.bits[0] == vlanEntries[0].cfg.mbr.bits[0]) && (vlan.fid_msti == 1));
+    CHECK((sw.rtk_vlan_get(399, &vlan) == RT_ERR_OK) && (vlan.mbr.bits[0] == vlanEntries[0].cfg.mbr.bits[0]));
+    CHECK((sw.rtk_vlan_get(201, &vlan) == RT_ERR_OK) && !(vlan.mbr.bits[0] & (1 << UTP_PORT3)));
+
+    BENCH("provisionPorts", provisionPorts(100));
+#ifdef RTL8367_REG_BATCH
+    /* move to PVID 200 and back, the batched row redoes the work of the first one */
+    BENCH("provisionPorts", provisionPorts(200));
+    BENCH("provisionPorts (batched)", provisionPortsBatched(100));
+#endif
+
+    BENCH("rtk_qos_init", sw.rtk_qos_init(8));
+    BENCH("rtk_igmp_init", sw.rtk_igmp_init());
+    CHECK((sw.rtk_vlan_portPvid_get(UTP_PORT4, &pvid, &pri) == RT_ERR_OK) && (pvid == 100));
+
+    memset(&l2, 0, sizeof(l2));
+    l2.port = UTP_PORT2;
+    l2.is_static = ENABLED;
+    BENCH("rtk_l2_addr_add", sw.rtk_l2_addr_add(&mac, &l2));
+    memset(&l2, 0, sizeof(l2));
+    BENCH("rtk_l2_addr_get", sw.rtk_l2_addr_get(&mac, &l2));
+    CHECK((l2.port == UTP_PORT2) && (l2.is_static == ENABLED));
+    addr = 0;
+    BENCH("rtk_l2_addr_next_get", sw.rtk_l2_addr_next_get(READMETHOD_NEXT_L2UC, UTP_PORT0, &addr, &l2));
+    BENCH("rtk_l2_addr_del", sw.rtk_l2_addr_del(&mac, &l2));
+
+    for (addr = 0; addr < BENCH_L2_NUM; addr++)
+    {
+        mac.octet[4] = addr >> 8;
+        mac.octet[5] = addr;
+        memset(&l2, 0, sizeof(l2));
+        l2.port = (rtk_port_t)(addr % 5);
+        sw.rtk_l2_addr_add(&mac, &l2);
+    }
+    BENCH("rtk_l2_addr_next_get x100", walkL2());
+    BENCH("rtk_l2_table_dump (100 entries)", dumpL2());
+#ifdef RTL8367_L2_INDEX
+    /* a second driver on the same bus has not indexed the LUT, the chip answers */
+    mac.octet[5] = 42;
+    memset(&l2Entry, 0, sizeof(l2Entry));
+    BENCH("rtk_l2_index_get (not rebuilt)", coldSw.rtk_l2_index_get(&mac, 0, 0, &l2Entry));
+    CHECK(l2Entry.port == UTP_PORT2);
+    BENCH("rtk_l2_index_rebuild", sw.rtk_l2_index_rebuild(NULL));
+    memset(&l2, 0, sizeof(l2));
+    BENCH("rtk_l2_addr_get", sw.rtk_l2_addr_get(&mac, &l2));
+    BENCH("rtk_l2_index_get", sw.rtk_l2_index_get(&mac, 0, 0, &l2Entry));
+    CHECK(l2Entry.port == l2.port);
+#endif
+
+    /* UTP2 went down: its 20 dynamic entries in one command, then the rest */
+    memset(&flushCfg, 0, sizeof(flushCfg));
+    flushCfg.flushByPort = ENABLED;
+    flushCfg.port = UTP_PORT2;
+    BENCH("rtk_l2_ucastAddr_flush (port)", sw.rtk_l2_ucastAddr_flush(&flushCfg));
+    addr = 0;
+    sw.rtk_l2_table_dump(&addr, l2Entries, BENCH_L2_NUM, &phyData[0]);
+#ifdef RTL8367_L2_INDEX
+    mac.octet[5] = 42;
+    printf("  %u entries left, UTP2 entry in index: %s\n", phyData[0], (sw.rtk_l2_index_get(&mac, 0, 0, &l2Entry) == RT_ERR_OK) ? "yes" : "no");
+    CHECK(sw.rtk_l2_index_get(&mac, 0, 0, &l2Entry) != RT_ERR_OK);
+#else
+    printf("  %u entries left\n", phyData[0]);
+#endif
+    CHECK(phyData[0] == BENCH_L2_NUM - BENCH_L2_NUM / 5);
+    BENCH("rtk_l2_flushLinkDownPortAddrEnable_set", sw.rtk_l2_flushLinkDownPortAddrEnable_set(RTK_WHOLE_SYSTEM, ENABLED));
+    BENCH("rtk_l2_table_clear", sw.rtk_l2_table_clear());
+
+    /* public facing UTP4 may hold 64 MACs, UTP0~4 together 1024, 5 minute aging */
+    BENCH("rtk_l2_limitLearningCnt_set", sw.rtk_l2_limitLearningCnt_set(UTP_PORT4, 64));
+    BENCH("rtk_l2_limitLearningCntAction_set", sw.rtk_l2_limitLearningCntAction_set(RTK_WHOLE_SYSTEM, LIMIT_LEARN_CNT_ACTION_DROP));
+    RTK_PORTMASK_CLEAR(pmask);
+    for (addr = UTP_PORT0; addr <= UTP_PORT4; addr++)
+        RTK_PORTMASK_PORT_SET(pmask, addr);
+    BENCH("rtk_l2_limitSystemLearningCntPortMask_set", sw.rtk_l2_limitSystemLearningCntPortMask_set(&pmask));
+    BENCH("rtk_l2_limitSystemLearningCnt_set", sw.rtk_l2_limitSystemLearningCnt_set(1024));
+    BENCH("rtk_l2_aging_set", sw.rtk_l2_aging_set(300));
+    sw.rtk_l2_aging_get(&addr);
+    printf("  aging %u s\n", addr);
+    CHECK(addr == 310);
+#ifdef RTL8367_L2_LEARN_RATE
+    /* UTP4 learns 50 MACs in 500 ms */
+    sim.poke(RTL8367C_REG_L2_LRN_CNT_CTRL4, 10);
+    BENCH("rtk_l2_learnRate_sample (first)", sw.rtk_l2_learnRate_sample(&pmask, 50, &flood));
+    sim.poke(RTL8367C_REG_L2_LRN_CNT_CTRL4, 60);
+    delay(500);
+    BENCH("rtk_l2_learnRate_sample (5 ports)", sw.rtk_l2_learnRate_sample(&pmask, 50, &flood));
+    sw.rtk_l2_learnRate_get(UTP_PORT4, &learn);
+    printf("  UTP4 %u entries, %u/s over %u ms, flood 0x%x\n", learn.count, learn.perSec, learn.ms, flood.bits[0]);
+    CHECK((learn.count == 60) && (learn.ms >= 500) && (learn.perSec == 50 * 1000 / learn.ms));
+    CHECK(flood.bits[0] == (1 << UTP_PORT4));
+#endif
+
+    BENCH("rtk_stat_port_get", sw.rtk_stat_port_get(UTP_PORT0, STAT_IfInOctets, &cntr));
+    for (addr = 0; addr < RTL8367C_MIB_PORT_OFFSET; addr++)
+        sim.mibSet(addr, 1, addr * 0x1357 + 1);
+    BENCH("rtk_stat_port_get x62", statPortLoop(UTP_PORT0, &cntrs[0]));
+    BENCH("rtk_stat_port_getAll", sw.rtk_stat_port_getAll(UTP_PORT0, &cntrs[1]));
+    CHECK(memcmp(&cntrs[0], &cntrs[1], sizeof(cntrs[0])) == 0);
+    CHECK(cntrs[1].cntr[STAT_IfInOctets] == sim.mibGet(0, 4));
+    cntrsRef = cntrs[1];
+    RTK_PORTMASK_CLEAR(pmask);
+    for (addr = UTP_PORT0; addr <= UTP_PORT4; addr++)
+        RTK_PORTMASK_PORT_SET(pmask, addr);
+    RTK_PORTMASK_PORT_SET(pmask, EXT_PORT0);
+    RTK_PORTMASK_PORT_SET(pmask, EXT_PORT1);
+    BENCH("rtk_stat_all_ports_get (7 ports)", sw.rtk_stat_all_ports_get(&pmask, cntrs));
+    CHECK(memcmp(&cntrs[0], &cntrsRef, sizeof(cntrsRef)) == 0);
+    CHECK(cntrs[6].cntr[STAT_IfInOctets] == sim.mibGet(RTL8367C_MIB_PORT_OFFSET * 7, 4));
+    BENCH("rtk_stat_port_reset", sw.rtk_stat_port_reset(UTP_PORT0));
+#ifdef RTL8367_STAT_RATE
+    /* 1 s of 100 MB/s in, ifInUcastPkts (word 16) wrapping */
+    sim.mibSet(0, 4, 1000);
+    sim.mibSet(16, 2, 0xFFFFF000);
+    BENCH("rtk_stat_port_rate_get (first)", sw.rtk_stat_port_rate_get(UTP_PORT0, &rate));
+    sim.mibSet(0, 4, 1000 + 100000000ULL);
+    sim.mibSet(16, 2, 0x00010000);
+    delay(1000);
+    BENCH("rtk_stat_port_rate_get", sw.rtk_stat_port_rate_get(UTP_PORT0, &rate));
+    printf("  %u ms: %llu bytes/s, %u pkts/s in\n", rate.ms, (unsigned long long)rate.inBytesPerSec, rate.inPktsPerSec);
+    CHECK((rate.ms >= 1000) && (rate.inBytesPerSec == 100000000ULL * 1000 / rate.ms));
+    CHECK(rate.inPktsPerSec == 0x11000ULL * 1000 / rate.ms);
+#endif
+
+    /* UTP0 holds 40 pages after a burst of 300 */
+    sim.poke(RTL8367C_REG_FLOWCTRL_PORT0_PAGE_COUNTER, 40);
+    sim.poke(RTL8367C_REG_FLOWCTRL_PORT0_PAGE_MAX, 300);
+    BENCH("rtk_buf_portPage_get", sw.rtk_buf_portPage_get(UTP_PORT0, &portPage));
+    printf("  UTP0 %u pages, peak %u\n", portPage.page, portPage.pageMax);
+    CHECK((portPage.page == 40) && (portPage.pageMax == 300));
+    sim.poke(RTL8367C_REG_FLOWCTRL_QUEUE0_PAGE_COUNT, 10);
+    sim.poke(RTL8367C_REG_FLOWCTRL_QUEUE0_MAX_PAGE_COUNT, 200);
+    BENCH("rtk_buf_queuePageMax_clear", sw.rtk_buf_queuePageMax_clear(UTP_PORT0));
+    CHECK(sim.peek(RTL8367C_REG_FLOWCTRL_QUEUE0_MAX_PAGE_COUNT) == 10);
+#ifdef RTL8367_REG_BATCH
+    sim.poke(RTL8367C_REG_FLOWCTRL_QUEUE0_MAX_PAGE_COUNT, 200);
+    BENCH("rtk_buf_queuePageMax_clear (batched)", queuePageMaxClearBatched(UTP_PORT0));
+    CHECK(sim.peek(RTL8367C_REG_FLOWCTRL_QUEUE0_MAX_PAGE_COUNT) == 10);
+#endif
+#ifdef RTL8367_BUF_HIST
+    BENCH("rtk_buf_sample (7 ports)", sw.rtk_buf_sample(&pmask));
+    BENCH("rtk_buf_sample (7 ports)", sw.rtk_buf_sample(&pmask));
+    sw.rtk_buf_hist_get(UTP_PORT0, &hist);
+    printf("  UTP0 %u samples, peak %u, peak buckets 6:%u 9:%u\n", hist.samples, hist.pageMax, hist.peak[6], hist.peak[9]);
+    CHECK((hist.samples == 2) && (hist.pageMax == 300));
+#endif
+
+    /* 100000 minimum frames at 1 Gb/s take 67 ms, with a loopback plug */
+    sim.pktgenLoopback = true;
+    BENCH("rtk_pktgen_test", sw.rtk_pktgen_test(UTP_PORT1, &pktgen, 1000, &pktgenResult));
+    printf("  %u ms, done %u, %u pkts/s out, %u pkts/s in, %u lost\n", pktgenResult.ms, pktgenResult.done,
+           pktgenResult.txPktsPerSec, pktgenResult.rxPktsPerSec, pktgenResult.txPkts - pktgenResult.rxPkts);
+    CHECK((pktgenResult.done == 1) && (pktgenResult.txPkts == pktgen.count) && (pktgenResult.rxPkts == pktgenResult.txPkts));
+
+    /* UTP0 and UTP1 bonded, every hash value on UTP0 */
+    RTK_PORTMASK_CLEAR(pmask);
+    RTK_PORTMASK_PORT_SET(pmask, UTP_PORT0);
+    RTK_PORTMASK_PORT_SET(pmask, UTP_PORT1);
+    BENCH("rtk_trunk_port_set", sw.rtk_trunk_port_set(TRUNK_GROUP0, &pmask));
+    BENCH("rtk_trunk_distributionAlgorithm_set", sw.rtk_trunk_distributionAlgorithm_set(RTK_WHOLE_SYSTEM, TRUNK_DISTRIBUTION_ALGO_SMAC_BIT | TRUNK_DISTRIBUTION_ALGO_DMAC_BIT));
+    for (addr = 0; addr < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; addr++)
+        trunkMap.value[addr] = UTP_PORT0;
+    BENCH("rtk_trunk_hashMappingTable_set", sw.rtk_trunk_hashMappingTable_set(TRUNK_GROUP0, &trunkMap));
+#ifdef RTL8367_TRUNK_BALANCE
+    BENCH("rtk_trunk_rebalance (first)", sw.rtk_trunk_rebalance(TRUNK_GROUP0, &moved));
+    BENCH("rtk_trunk_rebalance", trunkTrafficRebalance(&moved));
+    for (round = 1; moved && round < 16; round++)
+        trunkTrafficRebalance(&moved);
+    sw.rtk_trunk_hashMappingTable_get(TRUNK_GROUP0, &trunkMap);
+    for (addr = 0, onUtp1 = 0; addr < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; addr++)
+        onUtp1 += (trunkMap.value[addr] == UTP_PORT1);
+    printf("  balanced after %u rounds, %u of %u hash values on UTP1\n", round, onUtp1, RTK_MAX_NUM_OF_TRUNK_HASH_VAL);
+    CHECK((moved == 0) && (onUtp1 == RTK_MAX_NUM_OF_TRUNK_HASH_VAL / 2));
+#endif
+
+    /* 9K jumbo on every gigabit port, UTP2 limited to 1522 */
+    BENCH("rtk_switch_maxPktLen_set", sw.rtk_switch_maxPktLen_set(MAXPKTLEN_LINK_SPEED_GE, MAXPKTLEN_9216B));
+    BENCH("rtk_switch_maxPktLenCfg_set", sw.rtk_switch_maxPktLenCfg_set(0, 1522));
+    BENCH("rtk_switch_portMaxPktLen_set", sw.rtk_switch_portMaxPktLen_set(UTP_PORT2, MAXPKTLEN_LINK_SPEED_GE, 0));
+    sw.rtk_switch_portMaxPktLen_get(UTP_PORT1, MAXPKTLEN_LINK_SPEED_GE, &addr);
+    sw.rtk_switch_maxPktLenCfg_get(addr, &phyData[0]);
+    sw.rtk_switch_portMaxPktLen_get(UTP_PORT2, MAXPKTLEN_LINK_SPEED_GE, &addr);
+    sw.rtk_switch_maxPktLenCfg_get(addr, &phyData[1]);
+    printf("  1000M max length UTP1 %u, UTP2 %u\n", phyData[0], phyData[1]);
+    CHECK((phyData[0] == 9216) && (phyData[1] == 1522));
+
+    /* guest port UTP3 capped at 100 Mb/s in, 50 Mb/s out */
+    BENCH("rtk_rate_igrBandwidthCtrlRate_set", sw.rtk_rate_igrBandwidthCtrlRate_set(UTP_PORT3, 100000, ENABLED, ENABLED));
+    BENCH("rtk_rate_egrBandwidthCtrlRate_set", sw.rtk_rate_egrBandwidthCtrlRate_set(UTP_PORT3, 50000, ENABLED));
+    BENCH("rtk_rate_igrBandwidthCtrlRate_get", sw.rtk_rate_igrBandwidthCtrlRate_get(UTP_PORT3, &phyData[0], &ifg, &fc));
+    BENCH("rtk_rate_egrBandwidthCtrlRate_get", sw.rtk_rate_egrBandwidthCtrlRate_get(UTP_PORT3, &phyData[1], &ifg));
+    printf("  UTP3 ingress %u kbps (fc %u), egress %u kbps\n", phyData[0], fc, phyData[1]);
+    CHECK((phyData[0] == 100000) && (fc == ENABLED) && (phyData[1] == 50000));
+
+    /* UTP3 queue 7 strict for voice, bulk queue 0 held to 20 Mb/s by a meter of its block */
+    BENCH("rtk_rate_shareMeter_set", sw.rtk_rate_shareMeter_set(24, METER_TYPE_KBPS, 20000, ENABLED));
+    BENCH("rtk_rate_egrQueueBwCtrlRate_set", sw.rtk_rate_egrQueueBwCtrlRate_set(UTP_PORT3, 0, 24));
+    BENCH("rtk_rate_egrQueueBwCtrlEnable_set", sw.rtk_rate_egrQueueBwCtrlEnable_set(UTP_PORT3, RTK_WHOLE_SYSTEM, ENABLED));
+    BENCH("rtk_qos_wfqBurstSize_set", sw.rtk_qos_wfqBurstSize_set(0x600));
+    sw.rtk_rate_egrQueueBwCtrlRate_get(UTP_PORT3, 0, &addr);
+    sw.rtk_rate_egrQueueBwCtrlEnable_get(UTP_PORT3, RTK_WHOLE_SYSTEM, &ifg);
+    sw.rtk_qos_wfqBurstSize_get(&phyData[0]);
+    printf("  UTP3 queue 0 on meter %u (APR %u), WFQ burst %u bytes\n", addr, ifg, phyData[0]);
+    CHECK((addr == 24) && (ifg == ENABLED) && (phyData[0] == 0x600));
+
+#ifdef RTL8367_INT_EVENT
+    /* nothing pending costs nothing, then ports 0 and 1 come up */
+    sim.intPin = SIM_INT_PIN;
+    BENCH("rtk_int_event_attach", sw.rtk_int_event_attach(SIM_INT_PIN, INT_POLAR_LOW));
+    BENCH("rtk_int_callback_set", sw.rtk_int_callback_set(INT_TYPE_LINK_STATUS, onLinkChange, &linkChanges));
+    BENCH("rtk_int_event_service (idle)", sw.rtk_int_event_service(&num));
+    sim.raiseInterrupt(INT_TYPE_LINK_STATUS, RTL8367C_REG_PORT_LINKUP_INDICATOR, 0x0003);
+    BENCH("rtk_int_event_service (link up)", sw.rtk_int_event_service(&num));
+    printf("  %u callbacks, link up 0x%x, link down 0x%x\n", linkChanges, lastEvent.linkUp.bits[0], lastEvent.linkDown.bits[0]);
+    CHECK((linkChanges == 1) && (lastEvent.linkUp.bits[0] == 0x3) && (lastEvent.linkDown.bits[0] == 0));
+    BENCH("rtk_int_event_service (idle)", sw.rtk_int_event_service(&num));
+#endif
+
+    /* typical boot: SMI up after ~300 ms, EEPROM loaded after ~450 ms */
+    sim.bootUs = 300000;
+    sim.eepromUs = 450000;
+    BENCH("resetWithDelay", sw.resetWithDelay());
+    sim.bootUs = 0;
+    sim.eepromUs = 0;
+    BENCH("rtk_vlan_init (fresh)", sw.rtk_vlan_init(VLAN_INIT_MODE_FRESH));
+    CHECK((sw.rtk_vlan_portPvid_get(UTP_PORT4, &pvid, &pri) == RT_ERR_OK) && (pvid == 1) && (pri == 0));
+    CHECK((sw.rtk_vlan_get(1, &vlan) == RT_ERR_OK) && (vlan.mbr.bits[0] != 0));
+
+#ifdef RTL8367_REG_CACHE
+    BENCH("rtk_qos_init (shadowed)", sw.rtk_qos_init(8));
+    BENCH("rtk_vlan_init (shadowed)", sw.rtk_vlan_init());
+    BENCH("verifyRegCache", sw.verifyRegCache(&mismatch));
+    sw.getRegCacheStats(&cacheStats);
+    printf("\nreg cache: %u entries, %u hits, %u misses, %u mismatches, %u overflows\n",
+           cacheStats.entries, cacheStats.hits, cacheStats.misses, cacheStats.mismatches, cacheStats.overflows);
+    CHECK((mismatch == 0) && (cacheStats.mismatches == 0));
+#endif
+
+#ifdef RTL8367_SMI_STATS
+    printf("\n");
+    sw.dumpSmiStats();
+#endif
+
+    if (failures)
+    {
+        printf("\n%u checks FAILED\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
+#endif
@@ -0,0 +1,937 @@
+#if !defined(ARDUINO)
+#include "rtl8367c_sim.h"
+#include <algorithm>
+#include "Arduino.h"
+#include "rtl8367c_reg.h"
+
+#define SIM_LUT_ENTRIES 2112
+#define SIM_LUT_HASH_ENTRIES 2048
+#define SIM_LUT_WAYS 4
+#define SIM_LUT_WORDS 6
+#define SIM_VLAN_WORDS 3
+#define SIM_TABLE_WORDS 10
+#define SIM_MIB_WORDS 0x800
+#define SIM_PHY_NUM 8
+
+#define SIM_SMI_CTRL_CODE 0x5C /* 4'b1011 + 3'b100 */
+
+#define SIM_TB_OP_WRITE 1
+#define SIM_TB_TARGET_CVLAN 3
+#define SIM_TB_TARGET_L2 4
+
+static rtl8367c_sim *simAttached = NULL;
+
+rtl8367c_sim::rtl8367c_sim()
+    : regs(0x10000), phy(SIM_PHY_NUM * 0x8000), mib(SIM_MIB_WORDS),
+      vlan4k(4096 * SIM_VLAN_WORDS), lut(SIM_LUT_ENTRIES * SIM_LUT_WORDS)
+{
+    busyPolls = 1;
+    bootUs = 0;
+    eepromUs = 0;
+    intPin = 0xFF;
+    pktgenLoopback = false;
+    bootEnd = eepromEnd = 0;
+    sckPin = 0xFF;
+    sdaPin = 0xFF;
+    sckOut = sdaOut = 1;
+    sckDrive = sdaDrive = 0;
+    sckLine = sdaLine = 1;
+    slaveDrive = slaveBit = 0;
+    clocked = false;
+    phase = PH_IDLE;
+    bitIdx = shift = 0;
+    isRead = false;
+    addr = 0;
+    data = 0;
+    reset();
+    clearStats();
+}
+
+void rtl8367c_sim::attach(uint8_t sckPin, uint8_t sdaPin)
+{
+    this->sckPin = sckPin;
+    this->sdaPin = sdaPin;
+    simAttached = this;
+}
+
+void rtl8367c_sim::detach()
+{
+    if (simAttached == this)
+        simAttached = NULL;
+}
+
+rtl8367c_sim *rtl8367c_sim::attached()
+{
+    return simAttached;
+}
+
+void rtl8367c_sim::reset()
+{
+    uint32_t p;
+
+    std::fill(regs.begin(), regs.end(), 0);
+    std::fill(phy.begin(), phy.end(), 0);
+    std::fill(mib.begin(), mib.end(), 0);
+    std::fill(vlan4k.begin(), vlan4k.end(), 0);
+    std::fill(lut.begin(), lut.end(), 0);
+    otherTables.clear();
+    lutBusy = phyBusy = mibBusy = flushBusy = 0;
+    flushPorts = 0;
+    memset(pktgen, 0, sizeof(pktgen));
+
+    /* chip id probed by rtk_switch_probe */
+    regs[0x1300] = 0x6367;
+    regs[0x1301] = 0x0020;
+
+    regs[RTL8367C_REG_MISCELLANEOUS_CONFIGURE0] = RTL8367C_AUTOLOAD_EN_MASK;
+
+    for (p = 0; p < SIM_PHY_NUM; p++)
+    {
+        phyPoke(p, 0xa400, 0x1140); /* BMCR: AN enabled, 1000F */
+        phyPoke(p, 0xa402, 0x7949); /* BMSR: no link */
+        phyPoke(p, 0xa408, 0x05e1); /* ANAR */
+        phyPoke(p, 0xa412, 0x0200); /* GBCR */
+    }
+
+    intUpdate();
+}
+
+bool rtl8367c_sim::booting() const
+{
+    return (long)(micros() - bootEnd) < 0;
+}
+
+void rtl8367c_sim::clearStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint16_t rtl8367c_sim::phyPeek(uint32_t phyNo, uint32_t ocpAddr) const
+{
+    return phy[(phyNo % SIM_PHY_NUM) * 0x8000 + ((ocpAddr & 0xFFFF) >> 1)];
+}
+
+void rtl8367c_sim::phyPoke(uint32_t phyNo, uint32_t ocpAddr, uint16_t value)
+{
+    phy[(phyNo % SIM_PHY_NUM) * 0x8000 + ((ocpAddr & 0xFFFF) >> 1)] = value;
+}
+
+void rtl8367c_sim::mibSet(uint32_t mibOff, uint32_t words, uint64_t value)
+{
+    uint32_t i;
+
+    for (i = 0; i < words && (mibOff + i) < SIM_MIB_WORDS; i++)
+        mib[mibOff + i] = (value >> (16 * i)) & 0xFFFF;
+}
+
+uint64_t rtl8367c_sim::mibGet(uint32_t mibOff, uint32_t words) const
+{
+    uint64_t value = 0;
+    uint32_t i;
+
+    for (i = words; i > 0; i--)
+        if ((mibOff + i - 1) < SIM_MIB_WORDS)
+            value = (value << 16) | mib[mibOff + i - 1];
+
+    return value;
+}
+
+/* ---------------------------------------------------------------------- */
+/* register file                                                          */
+/* ---------------------------------------------------------------------- */
+
+uint16_t rtl8367c_sim::read(uint32_t addr)
+{
+    uint16_t value;
+
+    addr &= 0xFFFF;
+    value = regs[addr];
+    stats.regReads[addr >> 8]++;
+
+    switch (addr)
+    {
+    case RTL8367C_REG_MISCELLANEOUS_CONFIGURE1:
+        if ((long)(micros() - eepromEnd) >= 0)
+            value |= RTL8367C_EEPROM_DWONLOAD_COMPLETE_MASK;
+        else
+            value &= ~RTL8367C_EEPROM_DWONLOAD_COMPLETE_MASK;
+        break;
+    case RTL8367C_REG_TABLE_LUT_ADDR:
+        if (lutBusy)
+        {
+            lutBusy--;
+            value |= (1 << RTL8367C_TABLE_LUT_ADDR_BUSY_FLAG_OFFSET);
+        }
+        break;
+    case RTL8367C_REG_INDRECT_ACCESS_STATUS:
+        if (phyBusy)
+        {
+            phyBusy--;
+            value |= 0x1;
+        }
+        break;
+    case RTL8367C_REG_MIB_CTRL0:
+        if (mibBusy)
+        {
+            mibBusy--;
+            value |= RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK;
+        }
+        break;
+    case RTL8367C_REG_HWPKT_GEN_MISC:
+        pktgenUpdate(false);
+        value = regs[addr];
+        break;
+    case RTL8367C_REG_FORCE_FLUSH:
+    case RTL8367C_REG_FORCE_FLUSH1:
+    case RTL8367C_REG_L2_FLUSH_CTRL3:
+        if (flushBusy)
+        {
+            flushBusy--;
+            if (addr == RTL8367C_REG_FORCE_FLUSH)
+                value |= (flushPorts & 0xFF) << RTL8367C_BUSY_STATUS_OFFSET;
+            else if (addr == RTL8367C_REG_FORCE_FLUSH1)
+                value |= ((flushPorts >> 8) & 0x7) << RTL8367C_BUSY_STATUS1_OFFSET;
+            else
+                value |= RTL8367C_L2_FLUSH_CTRL3_MASK;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return value;
+}
+
+void rtl8367c_sim::write(uint32_t addr, uint16_t value)
+{
+    addr &= 0xFFFF;
+    stats.regWrites[addr >> 8]++;
+
+    switch (addr)
+    {
+    case RTL8367C_REG_CHIP_RESET:
+        if (value & 0x1)
+        {
+            reset();
+            bootEnd = micros() + bootUs;
+            eepromEnd = micros() + eepromUs;
+            return;
+        }
+        break;
+    case RTL8367C_REG_TABLE_ACCESS_CTRL:
+        regs[addr] = value;
+        tableCommand(value);
+        return;
+    case RTL8367C_REG_INDRECT_ACCESS_CTRL:
+        if (value & RTL8367C_CMD_MASK)
+            phyCommand(value);
+        regs[addr] = value & ~RTL8367C_CMD_MASK;
+        return;
+    case RTL8367C_REG_MIB_ADDRESS:
+        regs[addr] = value;
+        mibLatch(value);
+        return;
+    case RTL8367C_REG_MIB_CTRL0:
+        mibReset(value);
+        return;
+    /* interrupt status and indicators, write 1 to clear */
+    case RTL8367C_REG_INTR_IMS:
+    case RTL8367C_REG_LEARN_OVER_INDICATOR:
+    case RTL8367C_REG_SPEED_CHANGE_INDICATOR:
+    case RTL8367C_REG_SPECIAL_CONGEST_INDICATOR:
+    case RTL8367C_REG_PORT_LINKDOWN_INDICATOR:
+    case RTL8367C_REG_PORT_LINKUP_INDICATOR:
+    case RTL8367C_REG_SYSTEM_LEARN_OVER_INDICATOR:
+    case RTL8367C_REG_METER_OVERRATE_INDICATOR0:
+    case RTL8367C_REG_METER_OVERRATE_INDICATOR1:
+    case RTL8367C_REG_RLDP_LOOPED_INDICATOR:
+    case RTL8367C_REG_RLDP_RELEASED_INDICATOR:
+        regs[addr] &= ~value;
+        intUpdate();
+        return;
+    case RTL8367C_REG_INTR_CTRL:
+    case RTL8367C_REG_INTR_IMR:
+        regs[addr] = value;
+        intUpdate();
+        return;
+    case RTL8367C_REG_PKTGEN_COMMAND:
+        pktgenCommand(value);
+        regs[addr] = value & RTL8367C_PKTGEN_BYPASS_FLOWCONTROL_MASK;
+        return;
+    /* self-clearing port masks, writing FORCE_FLUSH starts the flush of
+       its ports and of those set in FORCE_FLUSH1 */
+    case RTL8367C_REG_FORCE_FLUSH1:
+        regs[addr] = value & RTL8367C_PORTMASK1_MASK;
+        return;
+    case RTL8367C_REG_FORCE_FLUSH:
+        flushPorts = (value & RTL8367C_FORCE_FLUSH_PORTMASK_MASK) | (regs[RTL8367C_REG_FORCE_FLUSH1] << 8);
+        regs[RTL8367C_REG_FORCE_FLUSH1] = 0;
+        lutFlush(flushPorts);
+        return;
+    case RTL8367C_REG_L2_FLUSH_CTRL3:
+        if (value & RTL8367C_L2_FLUSH_CTRL3_MASK)
+        {
+            std::fill(lut.begin(), lut.end(), 0);
+            flushPorts = 0;
+            flushBusy = busyPolls;
+        }
+        return;
+    case RTL8367C_REG_FLOWCTRL_PAGE_COUNT_CLEAR:
+        if (value & RTL8367C_PAGE_COUNT_CLEAR_MASK)
+            pageMaxClear();
+        regs[addr] = value;
+        return;
+    case RTL8367C_REG_FLOWCTRL_DEBUG_CTRL1:
+        if (value & RTL8367C_QMAX_MASK_MASK)
+            queuePageMaxClear(value & RTL8367C_QMAX_MASK_MASK);
+        regs[addr] = value;
+        return;
+    /* read-only status */
+    case RTL8367C_REG_TABLE_LUT_ADDR:
+    case RTL8367C_REG_INDRECT_ACCESS_STATUS:
+    case RTL8367C_REG_INDRECT_ACCESS_READ_DATA:
+    case RTL8367C_REG_MIB_COUNTER0:
+    case RTL8367C_REG_MIB_COUNTER1:
+    case RTL8367C_REG_MIB_COUNTER2:
+    case RTL8367C_REG_MIB_COUNTER3:
+        return;
+    default:
+        break;
+    }
+
+    regs[addr] = value;
+}
+
+/* peaks restart from the current pages */
+void rtl8367c_sim::pageMaxClear()
+{
+    uint32_t port;
+
+    for (port = 0; port < 8; port++)
+        regs[RTL8367C_REG_FLOWCTRL_PORT0_PAGE_MAX + port] = regs[RTL8367C_REG_FLOWCTRL_PORT0_PAGE_COUNTER + port];
+    for (port = 0; port < 3; port++)
+        regs[RTL8367C_REG_FLOWCTRL_PORT8_PAGE_MAX + port] = regs[RTL8367C_REG_FLOWCTRL_PORT8_PAGE_COUNTER + port];
+    regs[RTL8367C_REG_FLOWCTRL_TOTAL_PAGE_MAX] = regs[RTL8367C_REG_FLOWCTRL_TOTAL_PAGE_COUNTER];
+    regs[RTL8367C_REG_FLOWCTRL_PUBLIC_PAGE_MAX] = regs[RTL8367C_REG_FLOWCTRL_PUBLIC_PAGE_COUNTER];
+}
+
+/* queue peaks of the port selected in FLOWCTRL_DEBUG_CTRL0, one mask bit per queue */
+void rtl8367c_sim::queuePageMaxClear(uint16_t qmask)
+{
+    uint32_t qid;
+
+    for (qid = 0; qid < 8; qid++)
+    {
+        if (qmask & (1 << qid))
+            regs[RTL8367C_REG_FLOWCTRL_QUEUE0_MAX_PAGE_COUNT + qid] = regs[RTL8367C_REG_FLOWCTRL_QUEUE0_PAGE_COUNT + qid];
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* packet generator                                                       */
+/* ---------------------------------------------------------------------- */
+
+/* MIB word offsets of ifOutOctets, ifOutUcastPkts and ifInUcastPkts */
+#define SIM_MIB_OUT_OCTETS 60
+#define SIM_MIB_OUT_UCAST 82
+#define SIM_MIB_IN_UCAST 16
+
+void rtl8367c_sim::pktgenCommand(uint16_t cmd)
+{
+    uint32_t port, base;
+
+    if (cmd & RTL8367C_PKTGEN_STOP_MASK)
+        pktgenUpdate(true);
+
+    if (!(cmd & RTL8367C_PKTGEN_START_MASK))
+        return;
+
+    for (port = 0; port < 8; port++)
+    {
+        base = RTL8367C_REG_PKTGEN_PORT0_CTRL + (port << 5);
+        if (!(regs[base] & RTL8367C_PKTGEN_PORT0_CTRL_CMD_START_MASK))
+            continue;
+
+        pktgen[port].startUs = micros();
+        /* frame, preamble and IPG at 1 ns per bit */
+        pktgen[port].frameNs = ((regs[RTL8367C_REG_PKTGEN_PORT0_TX_LENGTH + (port << 5)] & RTL8367C_PKTGEN_PORT0_TX_LENGTH_MASK) + 20) * 8;
+        pktgen[port].count = regs[RTL8367C_REG_PKTGEN_PORT0_COUNTER0 + (port << 5)] |
+                             ((regs[RTL8367C_REG_PKTGEN_PORT0_COUNTER1 + (port << 5)] & RTL8367C_PKTGEN_PORT0_COUNTER1_MASK) << 16);
+        regs[RTL8367C_REG_HWPKT_GEN_MISC] |= (1 << port);
+    }
+}
+
+/* count the frames of generators that finished, or of all when stopped */
+void rtl8367c_sim::pktgenUpdate(bool stop)
+{
+    uint32_t port, off;
+    uint64_t sent;
+
+    for (port = 0; port < 8; port++)
+    {
+        if (!(regs[RTL8367C_REG_HWPKT_GEN_MISC] & (1 << port)))
+            continue;
+
+        sent = (uint64_t)(micros() - pktgen[port].startUs) * 1000 / pktgen[port].frameNs;
+        if (sent < pktgen[port].count && !stop)
+            continue;
+        if (sent > pktgen[port].count)
+            sent = pktgen[port].count;
+
+        off = 0x7C * port;
+        mibSet(off + SIM_MIB_OUT_OCTETS, 4, mibGet(off + SIM_MIB_OUT_OCTETS, 4) + sent * (pktgen[port].frameNs / 8 - 20));
+        mibSet(off + SIM_MIB_OUT_UCAST, 2, mibGet(off + SIM_MIB_OUT_UCAST, 2) + sent);
+        if (pktgenLoopback)
+            mibSet(off + SIM_MIB_IN_UCAST, 2, mibGet(off + SIM_MIB_IN_UCAST, 2) + sent);
+        regs[RTL8367C_REG_HWPKT_GEN_MISC] &= ~(1 << port);
+    }
+}
+
+/* ---------------------------------------------------------------------- */
+/* interrupts                                                             */
+/* ---------------------------------------------------------------------- */
+
+void rtl8367c_sim::raiseInterrupt(uint32_t type, uint32_t indicatorReg, uint16_t bits)
+{
+    if (indicatorReg != 0)
+        regs[indicatorReg & 0xFFFF] |= bits;
+    regs[RTL8367C_REG_INTR_IMS] |= (1 << type);
+    intUpdate();
+}
+
+void rtl8367c_sim::intUpdate()
+{
+    bool asserted = (regs[RTL8367C_REG_INTR_IMS] & regs[RTL8367C_REG_INTR_IMR]) != 0;
+    bool activeLow = (regs[RTL8367C_REG_INTR_CTRL] & RTL8367C_INTR_CTRL_MASK) != 0;
+
+    if (intPin != 0xFF)
+        hostPinDrive(intPin, (asserted != activeLow) ? HIGH : LOW);
+}
+
+/* ---------------------------------------------------------------------- */
+/* table access                                                           */
+/* ---------------------------------------------------------------------- */
+
+void rtl8367c_sim::tableCommand(uint16_t cmd)
+{
+    uint32_t target = cmd & RTL8367C_TABLE_TYPE_MASK;
+    uint32_t op = (cmd & RTL8367C_COMMAND_TYPE_MASK) ? SIM_TB_OP_WRITE : 0;
+    uint32_t method = (cmd & RTL8367C_ACCESS_METHOD_MASK) >> RTL8367C_ACCESS_METHOD_OFFSET;
+    uint32_t spa = (cmd & RTL8367C_TABLE_ACCESS_CTRL_SPA_MASK) >> RTL8367C_TABLE_ACCESS_CTRL_SPA_OFFSET;
+    uint32_t address = regs[RTL8367C_REG_TABLE_ACCESS_ADDR];
+    uint32_t i;
+
+    lutBusy = busyPolls;
+
+    if (target == SIM_TB_TARGET_L2)
+    {
+        lutCommand(op, method, spa);
+        return;
+    }
+
+    if (target == SIM_TB_TARGET_CVLAN)
+    {
+        uint16_t *e = &vlan4k[(address & 0xFFF) * SIM_VLAN_WORDS];
+
+        for (i = 0; i < SIM_VLAN_WORDS; i++)
+        {
+            if (op == SIM_TB_OP_WRITE)
+                e[i] = regs[RTL8367C_REG_TABLE_WRITE_DATA0 + i];
+            else
+                regs[RTL8367C_REG_TABLE_READ_DATA0 + i] = e[i];
+        }
+        return;
+    }
+
+    /* ACL rule/action, IGMP group: plain storage */
+    std::vector<uint16_t> &e = otherTables[(target << 16) | address];
+    e.resize(SIM_TABLE_WORDS);
+    for (i = 0; i < SIM_TABLE_WORDS; i++)
+    {
+        if (op == SIM_TB_OP_WRITE)
+            e[i] = regs[RTL8367C_REG_TABLE_WRITE_DATA0 + i];
+        else
+            regs[RTL8367C_REG_TABLE_READ_DATA0 + i] = e[i];
+    }
+}
+
+void rtl8367c_sim::lutStatus(bool hit, uint32_t address)
+{
+    uint16_t value;
+
+    value = (address & 0x7FF) | ((address & 0x800) << 3) | ((address & 0x1000) >> 1);
+    if (hit)
+        value |= (1 << RTL8367C_HIT_STATUS_OFFSET);
+
+    regs[RTL8367C_REG_TABLE_LUT_ADDR] = value;
+}
+
+/* mbr of an L2/L3 multicast entry */
+static uint32_t simLutMbr(const uint16_t *e)
+{
+    return (e[4] & 0x00FF) | (((e[3] & 0xC000) >> 14) << 8) | (((e[5] & 0x0080) >> 7) << 10);
+}
+
+static bool simLutIsL3(const uint16_t *e)
+{
+    return (e[3] & 0x1000) != 0;
+}
+
+static bool simLutIsL2Mc(const uint16_t *e)
+{
+    return !simLutIsL3(e) && (e[2] & 0x0100);
+}
+
+bool rtl8367c_sim::lutValid(const uint16_t *e) const
+{
+    if (simLutIsL3(e) || simLutIsL2Mc(e))
+        return (simLutMbr(e) != 0) || (e[5] & 0x0020);
+
+    /* unicast: age 0 means invalid */
+    return ((e[4] >> 11) & 0x7) != 0;
+}
+
+bool rtl8367c_sim::lutKeyEqual(const uint16_t *a, const uint16_t *b) const
+{
+    if ((a[0] != b[0]) || (a[1] != b[1]) || (a[2] != b[2]))
+        return false;
+
+    if (simLutIsL3(a) != simLutIsL3(b))
+        return false;
+
+    if (simLutIsL3(a))
+    {
+        if ((a[3] & 0x3FFF) != (b[3] & 0x3FFF))
+            return false;
+        if ((a[3] & 0x2000) && (((a[4] >> 8) != (b[4] >> 8)) || ((a[5] & 0xF) != (b[5] & 0xF))))
+            return false;
+        return true;
+    }
+
+    /* IVL: MAC + CVID, SVL: MAC + FID (+EFID for unicast) */
+    if ((a[3] & 0x2000) != (b[3] & 0x2000))
+        return false;
+
+    if ((a[3] & 0x2000) || simLutIsL2Mc(a))
+        return (a[3] & 0x0FFF) == (b[3] & 0x0FFF);
+
+    return (a[4] & 0x007F) == (b[4] & 0x007F);
+}
+
+uint32_t rtl8367c_sim::lutHash(const uint16_t *e) const
+{
+    uint32_t h;
+
+    h = e[0] ^ (e[1] * 31) ^ (e[2] * 131) ^ ((e[3] & 0x0FFF) * 7);
+    h ^= h >> 9;
+
+    return (h % (SIM_LUT_HASH_ENTRIES / SIM_LUT_WAYS)) * SIM_LUT_WAYS;
+}
+
+bool rtl8367c_sim::lutMatchMethod(const uint16_t *e, uint32_t method, uint32_t spa) const
+{
+    if (!lutValid(e))
+        return false;
+
+    switch (method)
+    {
+    case 2: /* LUTREADMETHOD_NEXT_ADDRESS */
+        return true;
+    case 3: /* LUTREADMETHOD_NEXT_L2UC */
+        return !simLutIsL3(e) && !simLutIsL2Mc(e);
+    case 4: /* LUTREADMETHOD_NEXT_L2MC */
+        return simLutIsL2Mc(e);
+    case 5: /* LUTREADMETHOD_NEXT_L3MC */
+        return simLutIsL3(e);
+    case 6: /* LUTREADMETHOD_NEXT_L2L3MC */
+        return simLutIsL3(e) || simLutIsL2Mc(e);
+    case 7: /* LUTREADMETHOD_NEXT_L2UCSPA */
+        return !simLutIsL3(e) && !simLutIsL2Mc(e) &&
+               ((uint32_t)(((e[4] >> 8) & 0x7) | (((e[3] >> 15) & 0x1) << 3)) == spa);
+    default:
+        return false;
+    }
+}
+
+void rtl8367c_sim::lutCommand(uint32_t op, uint32_t method, uint32_t spa)
+{
+    uint16_t key[SIM_LUT_WORDS];
+    uint32_t address = regs[RTL8367C_REG_TABLE_ACCESS_ADDR];
+    uint32_t i, idx, base;
+    int32_t found = -1;
+    int32_t freeIdx = -1;
+
+    for (i = 0; i < SIM_LUT_WORDS; i++)
+        key[i] = regs[RTL8367C_REG_TABLE_WRITE_DATA0 + i];
+
+    if ((op == SIM_TB_OP_WRITE) || (method == 0))
+    {
+        /* hashed 4-way bucket, then the 64-entry CAM */
+        base = lutHash(key);
+        for (i = 0; i < (uint32_t)(SIM_LUT_WAYS + SIM_LUT_ENTRIES - SIM_LUT_HASH_ENTRIES); i++)
+        {
+            idx = (i < SIM_LUT_WAYS) ? (base + i) : (SIM_LUT_HASH_ENTRIES + i - SIM_LUT_WAYS);
+            uint16_t *e = &lut[idx * SIM_LUT_WORDS];
+
+            if (lutValid(e))
+            {
+                if (lutKeyEqual(e, key))
+                {
+                    found = idx;
+                    break;
+                }
+            }
+            else if (freeIdx < 0)
+                freeIdx = idx;
+        }
+
+        if (op == SIM_TB_OP_WRITE)
+        {
+            if (found < 0)
+                found = lutValid(key) ? freeIdx : -1;
+
+            if (found < 0)
+            {
+                lutStatus(false, 0);
+                return;
+            }
+
+            memcpy(&lut[found * SIM_LUT_WORDS], key, sizeof(key));
+            lutStatus(true, found);
+            return;
+        }
+    }
+    else if (method == 1) /* LUTREADMETHOD_ADDRESS */
+    {
+        if ((address < SIM_LUT_ENTRIES) && lutValid(&lut[address * SIM_LUT_WORDS]))
+            found = address;
+    }
+    else
+    {
+        for (i = 0; i < SIM_LUT_ENTRIES; i++)
+        {
+            idx = (address + i) % SIM_LUT_ENTRIES;
+            if (lutMatchMethod(&lut[idx * SIM_LUT_WORDS], method, spa))
+            {
+                found = idx;
+                break;
+            }
+        }
+    }
+
+    if (found < 0)
+    {
+        lutStatus(false, 0);
+        return;
+    }
+
+    for (i = 0; i < SIM_LUT_WORDS; i++)
+        regs[RTL8367C_REG_TABLE_READ_DATA0 + i] = lut[found * SIM_LUT_WORDS + i];
+    lutStatus(true, found);
+}
+
+/* forced flush of the unicast entries learned on portmask, filtered by
+   L2_FLUSH_CTRL1/2 */
+void rtl8367c_sim::lutFlush(uint32_t portmask)
+{
+    uint32_t mode = regs[RTL8367C_REG_L2_FLUSH_CTRL2] & RTL8367C_LUT_FLUSH_MODE_MASK;
+    bool both = (regs[RTL8367C_REG_L2_FLUSH_CTRL2] & RTL8367C_LUT_FLUSH_TYPE_MASK) != 0;
+    uint32_t vid = regs[RTL8367C_REG_L2_FLUSH_CTRL1] & RTL8367C_LUT_FLUSH_VID_MASK;
+    uint32_t fid = (regs[RTL8367C_REG_L2_FLUSH_CTRL1] & RTL8367C_LUT_FLUSH_FID_MASK) >> RTL8367C_LUT_FLUSH_FID_OFFSET;
+    uint32_t i, spa;
+
+    for (i = 0; i < SIM_LUT_ENTRIES; i++)
+    {
+        uint16_t *e = &lut[i * SIM_LUT_WORDS];
+
+        if (!lutMatchMethod(e, 3, 0))
+            continue;
+
+        spa = ((e[4] >> 8) & 0x7) | (((e[3] >> 15) & 0x1) << 3);
+        if (!(portmask & (1 << spa)) || ((e[5] & 0x0020) && !both))
+            continue;
+        if ((mode == 1) && (!(e[3] & 0x2000) || ((e[3] & 0x0FFF) != vid)))
+            continue;
+        if ((mode == 2) && ((e[3] & 0x2000) || ((e[4] & 0x000F) != fid)))
+            continue;
+
+        memset(e, 0, SIM_LUT_WORDS * sizeof(uint16_t));
+    }
+
+    flushBusy = busyPolls;
+}
+
+/* ---------------------------------------------------------------------- */
+/* PHY indirect access and MIB                                            */
+/* ---------------------------------------------------------------------- */
+
+void rtl8367c_sim::phyCommand(uint16_t cmd)
+{
+    uint32_t access = regs[RTL8367C_REG_INDRECT_ACCESS_ADDRESS];
+    uint32_t prefix = (regs[RTL8367C_REG_GPHY_OCP_MSB_0] & RTL8367C_CFG_CPU_OCPADR_MSB_MASK) >> 6;
+    uint32_t phyNo = (access >> 5) & 0x7;
+    uint32_t ocpAddr = (prefix << 10) | (((access >> 8) & 0xF) << 6) | ((access & 0x1F) << 1);
+
+    phyBusy = busyPolls;
+
+    if (cmd & RTL8367C_RW_MASK)
+        phyPoke(phyNo, ocpAddr, regs[RTL8367C_REG_INDRECT_ACCESS_WRITE_DATA]);
+    else
+        regs[RTL8367C_REG_INDRECT_ACCESS_READ_DATA] = phyPeek(phyNo, ocpAddr);
+}
+
+void rtl8367c_sim::mibLatch(uint16_t sramAddr)
+{
+    uint32_t i, off = (uint32_t)sramAddr << 2;
+
+    mibBusy = busyPolls;
+    for (i = 0; i < 4; i++)
+        regs[RTL8367C_REG_MIB_COUNTER0 + i] = ((off + i) < SIM_MIB_WORDS) ? mib[off + i] : 0;
+}
+
+void rtl8367c_sim::mibReset(uint16_t ctrl)
+{
+    uint32_t port, i, off;
+    uint32_t portmask;
+
+    portmask = ((ctrl >> RTL8367C_PORT0_RESET_OFFSET) & 0xFF) | (((ctrl >> RTL8367C_PORT8_RESET_OFFSET) & 0x7) << 8);
+    if (ctrl & RTL8367C_GLOBAL_RESET_MASK)
+        std::fill(mib.begin(), mib.end(), 0);
+
+    for (port = 0; port < 11; port++)
+    {
+        if (!(portmask & (1 << port)))
+            continue;
+
+        off = 0x7C * port + ((port > 7) ? 68 : 0);
+        for (i = 0; i < 0x7C && (off + i) < SIM_MIB_WORDS; i++)
+            mib[off + i] = 0;
+    }
+
+    /* reset requests are self-clearing */
+    regs[RTL8367C_REG_MIB_CTRL0] = ctrl & ~(RTL8367C_PORT10_RESET_MASK | RTL8367C_PORT9_RESET_MASK | RTL8367C_PORT8_RESET_MASK |
+                                            RTL8367C_GLOBAL_RESET_MASK | RTL8367C_QM_RESET_MASK | (0xFF << RTL8367C_PORT0_RESET_OFFSET) |
+                                            RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK | RTL8367C_RESET_FLAG_MASK);
+}
+
+/* ---------------------------------------------------------------------- */
+/* SMI slave                                                              */
+/* ---------------------------------------------------------------------- */
+
+void rtl8367c_sim::pinMode(uint8_t pin, uint8_t mode)
+{
+    stats.pinOps++;
+    if (pin == sckPin)
+        sckDrive = (mode == OUTPUT);
+    else if (pin == sdaPin)
+        sdaDrive = (mode == OUTPUT);
+    lineUpdate();
+}
+
+void rtl8367c_sim::pinWrite(uint8_t pin, uint8_t level)
+{
+    stats.pinOps++;
+    if (pin == sckPin)
+        sckOut = level ? 1 : 0;
+    else if (pin == sdaPin)
+        sdaOut = level ? 1 : 0;
+    lineUpdate();
+}
+
+int rtl8367c_sim::pinRead(uint8_t pin)
+{
+    stats.pinOps++;
+    if (pin == sckPin)
+        return sckLine;
+    return sdaLine;
+}
+
+void rtl8367c_sim::lineUpdate()
+{
+    uint8_t sck, sda;
+
+    /* open lines are pulled up */
+    sck = sckDrive ? sckOut : 1;
+    sda = sdaDrive ? sdaOut : (slaveDrive ? slaveBit : 1);
+
+    if (sck != sckLine)
+    {
+        sckLine = sck;
+        sdaLine = sda;
+        if (sck)
+            onRise();
+        else
+            onFall();
+        sdaLine = sdaDrive ? sdaOut : (slaveDrive ? slaveBit : 1);
+        return;
+    }
+
+    if (sda != sdaLine)
+    {
+        sdaLine = sda;
+        if (!sckLine)
+            return;
+
+        if (!sda)
+        {
+            /* START: SDA falls while SCK high */
+            phase = PH_CTRL;
+            bitIdx = 0;
+            shift = 0;
+            clocked = false;
+            slaveDrive = 0;
+        }
+        else
+        {
+            /* STOP: SDA rises while SCK high */
+            phase = PH_IDLE;
+            slaveDrive = 0;
+        }
+    }
+}
+
+uint32_t rtl8367c_sim::phaseBits(phase_e ph) const
+{
+    switch (ph)
+    {
+    case PH_CTRL:
+    case PH_ADDRL:
+    case PH_ADDRH:
+    case PH_RDATAL:
+    case PH_RDATAH:
+    case PH_WDATAL:
+    case PH_WDATAH:
+        return 8;
+    default:
+        return 1;
+    }
+}
+
+bool rtl8367c_sim::slaveDriven(phase_e ph) const
+{
+    switch (ph)
+    {
+    case PH_ACK_CTRL:
+    case PH_ACK_ADDRL:
+    case PH_ACK_ADDRH:
+    case PH_ACK_WDATAL:
+    case PH_ACK_WDATAH:
+    case PH_RDATAL:
+    case PH_RDATAH:
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint8_t rtl8367c_sim::slaveOutput()
+{
+    switch (phase)
+    {
+    case PH_RDATAL:
+        return (data >> (7 - bitIdx)) & 0x1;
+    case PH_RDATAH:
+        return (data >> (15 - bitIdx)) & 0x1;
+    default:
+        return 0; /* ACK */
+    }
+}
+
+void rtl8367c_sim::onRise()
+{
+    if ((phase == PH_IDLE) || (phase == PH_DONE))
+        return;
+
+    clocked = true;
+    if (slaveDriven(phase))
+    {
+        slaveDrive = 1;
+        slaveBit = slaveOutput();
+    }
+    else
+    {
+        shift = (shift << 1) | sdaLine;
+    }
+}
+
+void rtl8367c_sim::onFall()
+{
+    if (!clocked)
+        return;
+
+    clocked = false;
+    slaveDrive = 0;
+    bitIdx++;
+    if (bitIdx >= phaseBits(phase))
+    {
+        phaseDone();
+        bitIdx = 0;
+        shift = 0;
+    }
+}
+
+void rtl8367c_sim::phaseDone()
+{
+    switch (phase)
+    {
+    case PH_CTRL:
+        if (((shift >> 1) != SIM_SMI_CTRL_CODE) || booting())
+        {
+            /* not addressed to us or still booting, leave SDA floating (NACK) */
+            stats.nacks++;
+            phase = PH_IDLE;
+            return;
+        }
+        isRead = shift & 0x1;
+        phase = PH_ACK_CTRL;
+        break;
+    case PH_ACK_CTRL:
+        phase = PH_ADDRL;
+        break;
+    case PH_ADDRL:
+        addr = shift & 0xFF;
+        phase = PH_ACK_ADDRL;
+        break;
+    case PH_ACK_ADDRL:
+        phase = PH_ADDRH;
+        break;
+    case PH_ADDRH:
+        addr |= (shift & 0xFF) << 8;
+        if (isRead)
+        {
+            data = read(addr);
+            stats.reads++;
+        }
+        phase = PH_ACK_ADDRH;
+        break;
+    case PH_ACK_ADDRH:
+        phase = isRead ? PH_RDATAL : PH_WDATAL;
+        break;
+    case PH_RDATAL:
+        phase = PH_MACK_L;
+        break;
+    case PH_MACK_L:
+        phase = PH_RDATAH;
+        break;
+    case PH_RDATAH:
+        phase = PH_MACK_H;
+        break;
+    case PH_WDATAL:
+        data = shift & 0xFF;
+        phase = PH_ACK_WDATAL;
+        break;
+    case PH_ACK_WDATAL:
+        phase = PH_WDATAH;
+        break;
+    case PH_WDATAH:
+        data |= (shift & 0xFF) << 8;
+        write(addr, data);
+        stats.writes++;
+        phase = PH_ACK_WDATAH;
+        break;
+    default:
+        phase = PH_DONE;
+        break;
+    }
+}
+#endif
@@ -0,0 +1,161 @@
+#ifndef rtl8367c_sim_h
+#define rtl8367c_sim_h
+/*
+ * Host-side RTL8367C model.
+ *
+ * An SMI bit-level slave decoding the frames produced by smi_read/smi_write,
+ * backed by a 64K x 16-bit register file. Writes to the table access, PHY
+ * indirect access and MIB address registers run the operation against
+ * in-memory tables and raise the matching busy flag for busyPolls status
+ * reads, so the driver's polling loops are exercised as on hardware.
+ */
+#include <stdint.h>
+#include <vector>
+#include <map>
+
+class rtl8367c_sim
+{
+public:
+    rtl8367c_sim();
+
+    /* route pin accesses of sckPin/sdaPin to this model */
+    void attach(uint8_t sckPin, uint8_t sdaPin);
+    void detach();
+    static rtl8367c_sim *attached();
+
+    /* chip state back to power-on defaults (also done by CHIP_RESET) */
+    void reset();
+
+    /* register access without SMI, side effects included */
+    uint16_t read(uint32_t addr);
+    void write(uint32_t addr, uint16_t value);
+
+    /* raw register file, no side effects */
+    uint16_t peek(uint32_t addr) const { return regs[addr & 0xFFFF]; }
+    void poke(uint32_t addr, uint16_t value) { regs[addr & 0xFFFF] = value; }
+
+    /* OCP space of the embedded PHYs (phyNo 0~7) */
+    uint16_t phyPeek(uint32_t phyNo, uint32_t ocpAddr) const;
+    void phyPoke(uint32_t phyNo, uint32_t ocpAddr, uint16_t value);
+
+    /* MIB SRAM, offsets as computed by rtl8367c_getAsicMIBsCounter */
+    void mibSet(uint32_t mibOff, uint32_t words, uint64_t value);
+    uint64_t mibGet(uint32_t mibOff, uint32_t words) const;
+
+    /* status reads that report busy after each table/PHY/MIB command */
+    uint32_t busyPolls;
+
+    /* time after a CHIP_RESET before the chip answers SMI, and before it
+       reports the EEPROM download complete (EEPROM autoload is strapped on) */
+    uint32_t bootUs;
+    uint32_t eepromUs;
+
+    /* pin the INT output drives through hostPinDrive(), 0xFF for none;
+       the line follows IMS & IMR and the INTR_CTRL polarity */
+    uint8_t intPin;
+
+    /* an event of rtk_int_type_t type: sets bits in its indicator register
+       (0 for none) and the type's IMS bit */
+    void raiseInterrupt(uint32_t type, uint32_t indicatorReg, uint16_t bits);
+
+    /* frames of the packet generators are also received on their port,
+       as with a loopback plug; generators send at 1 Gb/s */
+    bool pktgenLoopback;
+
+    /* completed SMI frames and pin activity since the last clearStats() */
+    struct stats_t
+    {
+        uint32_t reads;
+        uint32_t writes;
+        uint32_t nacks;
+        uint32_t pinOps;
+        uint32_t regReads[0x10000 / 0x100];
+        uint32_t regWrites[0x10000 / 0x100];
+    } stats;
+    void clearStats();
+
+    /* pin level interface used by the Arduino shim */
+    void pinMode(uint8_t pin, uint8_t mode);
+    void pinWrite(uint8_t pin, uint8_t level);
+    int pinRead(uint8_t pin);
+    bool ownsPin(uint8_t pin) const { return (pin == sckPin) || (pin == sdaPin); }
+
+private:
+    enum phase_e
+    {
+        PH_IDLE = 0,
+        PH_CTRL,
+        PH_ACK_CTRL,
+        PH_ADDRL,
+        PH_ACK_ADDRL,
+        PH_ADDRH,
+        PH_ACK_ADDRH,
+        PH_RDATAL,
+        PH_MACK_L,
+        PH_RDATAH,
+        PH_MACK_H,
+        PH_WDATAL,
+        PH_ACK_WDATAL,
+        PH_WDATAH,
+        PH_ACK_WDATAH,
+        PH_DONE
+    };
+
+    std::vector<uint16_t> regs;
+    std::vector<uint16_t> phy;
+    std::vector<uint16_t> mib;
+    std::vector<uint16_t> vlan4k;
+    std::vector<uint16_t> lut;
+    std::map<uint32_t, std::vector<uint16_t> > otherTables;
+
+    uint32_t lutBusy, phyBusy, mibBusy, flushBusy;
+    uint32_t flushPorts;
+
+    /* running packet generators, ports 0~7 */
+    struct pktgen_t
+    {
+        unsigned long startUs;
+        unsigned long frameNs;
+        uint32_t count;
+    } pktgen[8];
+    unsigned long bootEnd, eepromEnd;
+
+    uint8_t sckPin, sdaPin;
+    uint8_t sckOut, sdaOut, sckDrive, sdaDrive;
+    uint8_t sckLine, sdaLine;
+    uint8_t slaveDrive, slaveBit;
+    bool clocked;
+    phase_e phase;
+    uint32_t bitIdx, shift;
+    bool isRead;
+    uint32_t addr;
+    uint16_t data;
+
+    bool booting() const;
+    void lineUpdate();
+    void onRise();
+    void onFall();
+    uint32_t phaseBits(phase_e ph) const;
+    bool slaveDriven(phase_e ph) const;
+    uint8_t slaveOutput();
+    void phaseDone();
+
+    void tableCommand(uint16_t cmd);
+    void lutCommand(uint32_t op, uint32_t method, uint32_t spa);
+    void lutStatus(bool hit, uint32_t address);
+    bool lutValid(const uint16_t *e) const;
+    bool lutKeyEqual(const uint16_t *a, const uint16_t *b) const;
+    uint32_t lutHash(const uint16_t *e) const;
+    bool lutMatchMethod(const uint16_t *e, uint32_t method, uint32_t spa) const;
+    void lutFlush(uint32_t portmask);
+    void phyCommand(uint16_t cmd);
+    void mibLatch(uint16_t sramAddr);
+    void mibReset(uint16_t ctrl);
+    void intUpdate();
+    void pageMaxClear();
+    void queuePageMaxClear(uint16_t qmask);
+    void pktgenCommand(uint16_t cmd);
+    void pktgenUpdate(bool stop);
+};
+
+#endif
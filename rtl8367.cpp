@@ -4,26 +4,147 @@
 rtl8367::rtl8367(uint16_t usTransmissionDelay)
 {
     this->usTransmissionDelay = usTransmissionDelay;
+    smiDefaultTransport.begin(sckPin, sdaPin, usTransmissionDelay);
+
+#ifdef RTL8367_SMI_STATS
+    clearSmiStats();
+#endif
+#ifdef RTL8367_REG_CACHE
+    memset(&regCacheStats, 0, sizeof(regCacheStats));
+    invalidateRegCache();
+#endif
+#ifdef RTL8367_L2_INDEX
+    l2IndexClear();
+#endif
+#ifdef RTL8367_STAT_RATE
+    statRateValid = 0;
+#endif
+#ifdef RTL8367_VLAN_SHADOW
+    vlanShadowReset(0);
+#endif
+#ifdef RTL8367_L2_LEARN_RATE
+    rtk_l2_learnRate_clear();
+#endif
+#ifdef RTL8367_INT_EVENT
+    intEventClear();
+#endif
+    phyOcpPrefix = RTL8367C_PHY_OCP_PREFIX_NONE;
+#ifdef RTL8367_BUF_HIST
+    rtk_buf_hist_clear();
+#endif
+#ifdef RTL8367_TRUNK_BALANCE
+    trunkTxValid = 0;
+#endif
 }
 
 int32_t rtl8367::reset()
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     retVal = rtl8367c_setAsicReg(RTL8367C_REG_CHIP_RESET, 1);
     if (retVal != RT_ERR_OK)
         return retVal;
 
+    phyOcpPrefix = RTL8367C_PHY_OCP_PREFIX_NONE;
+#ifdef RTL8367_REG_CACHE
+    invalidateRegCache();
+#endif
+#ifdef RTL8367_L2_INDEX
+    /* the reset empties the LUT */
+    l2IndexClear();
+    l2IndexValid = 1;
+#endif
+#ifdef RTL8367_STAT_RATE
+    statRateZero(0xFF);
+#endif
+#ifdef RTL8367_VLAN_SHADOW
+    /* the reset empties the VLAN table */
+    vlanShadowReset(1);
+#endif
+#ifdef RTL8367_L2_LEARN_RATE
+    rtk_l2_learnRate_clear();
+#endif
+#ifdef RTL8367_INT_EVENT
+    /* the reset puts the INT polarity and mask back to their defaults */
+    intEventClear();
+#endif
+#ifdef RTL8367_TRUNK_BALANCE
+    /* the reset clears the trunk groups and the MIB counters */
+    trunkTxValid = 0;
+#endif
+
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::resetWithDelay()
+/* Function Name:
+ *      resetWithDelay
+ * Description:
+ *      Reset the switch and wait until it is usable again
+ * Input:
+ *      msTimeout - longest time to wait for the switch, in ms
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Switch reset and ready
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_BUSYWAIT_TIMEOUT - Switch not ready before the deadline
+ * Note:
+ *      Returns as soon as waitReady() sees the switch booted instead of
+ *      always waiting the worst case.
+ */
+int32_t rtl8367::resetWithDelay(uint32_t msTimeout)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_CHIP_RESET, 1);
+    retVal = reset();
     if (retVal != RT_ERR_OK)
         return retVal;
 
-    delay(2000);
+    /* let the reset take effect before the first probe */
+    delay(RTL8367_READY_POLL_MS);
+
+    return waitReady((msTimeout > RTL8367_READY_POLL_MS) ? (msTimeout - RTL8367_READY_POLL_MS) : 0);
+}
+
+/* Function Name:
+ *      waitReady
+ * Description:
+ *      Wait for the switch to finish booting
+ * Input:
+ *      msTimeout - longest time to wait, in ms
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Switch ready
+ *      RT_ERR_BUSYWAIT_TIMEOUT - Switch not ready before the deadline
+ * Note:
+ *      The switch is ready when it answers the chip ID probe and, if EEPROM
+ *      autoload is enabled, reports the EEPROM download complete. Call it
+ *      after power-on instead of waiting a fixed time.
+ */
+int32_t rtl8367::waitReady(uint32_t msTimeout)
+{
+    RTK_SMI_STATS_SCOPE();
+    unsigned long start = millis();
+    uint32_t ready;
+
+    while (1)
+    {
+        if ((rtl8367c_getAsicReady(&ready) == RT_ERR_OK) && ready)
+            break;
+
+        if ((millis() - start) >= msTimeout)
+            return RT_ERR_BUSYWAIT_TIMEOUT;
+
+        delay(RTL8367_READY_POLL_MS);
+    }
+
+    /* a reset the driver did not issue cleared the OCP prefix too */
+    phyOcpPrefix = RTL8367C_PHY_OCP_PREFIX_NONE;
+#ifdef RTL8367_REG_CACHE
+    /* the EEPROM may have rewritten anything read while booting */
+    invalidateRegCache();
+#endif
 
     return RT_ERR_OK;
 }
@@ -35,11 +156,43 @@ void rtl8367::setCommunicationPins(uint8_t sckPin, uint8_t sdaPin)
 
     pinMode(sdaPin, OUTPUT);
     pinMode(sckPin, OUTPUT);
+
+    smiTransport->begin(sckPin, sdaPin, usTransmissionDelay);
 }
 
 void rtl8367::setCommunicationDelay(uint16_t usTransmissionDelay)
 {
     this->usTransmissionDelay = usTransmissionDelay;
+
+    /* pins not configured yet, setCommunicationPins() will begin the transport */
+    if (sckPin != sdaPin)
+        smiTransport->begin(sckPin, sdaPin, usTransmissionDelay);
+}
+
+/* Function Name:
+ *      setTransport
+ * Description:
+ *      Select the SMI bit-level transport
+ * Input:
+ *      pTransport - transport to use, NULL restores the Arduino HAL transport
+ * Output:
+ *      None
+ * Return:
+ *      None
+ * Note:
+ *      The transport is handed the current pins and clock delay, it can be
+ *      installed before or after setCommunicationPins(). The object must
+ *      outlive this rtl8367 instance.
+ *      e.g. static rtl8367_smi_gpio fastSmi; sw.setTransport(&fastSmi);
+ */
+void rtl8367::setTransport(rtl8367_smi_transport *pTransport)
+{
+    if (pTransport == NULL)
+        pTransport = &smiDefaultTransport;
+
+    smiTransport = pTransport;
+    if (sckPin != sdaPin)
+        smiTransport->begin(sckPin, sdaPin, usTransmissionDelay);
 }
 
 int32_t rtl8367::rtk_switch_logicalPortCheck(uint32_t logicalPort)
@@ -78,6 +231,7 @@ int32_t rtl8367::rtk_switch_isPortMaskValid(rtk_portmask_t *pPmask)
  */
 int32_t rtl8367::rtk_switch_probe(uint8_t &pSwitchChip)
 {
+    RTK_SMI_STATS_SCOPE();
     uint32_t retVal;
     uint32_t data, regValue;
 
@@ -109,6 +263,51 @@ int32_t rtl8367::rtk_switch_probe(uint8_t &pSwitchChip)
     return retVal;
 }
 
+/* ready = chip ID readable and, with EEPROM autoload, EEPROM download done */
+int32_t rtl8367::rtl8367c_getAsicReady(uint32_t *pReady)
+{
+    int32_t retVal;
+    uint32_t data, regData;
+
+    *pReady = 0;
+
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
+        return retVal;
+
+    retVal = rtl8367c_getAsicReg(0x1300, &data);
+    if (retVal == RT_ERR_OK)
+        retVal = rtl8367c_setAsicReg(0x13C2, 0x0000);
+
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    switch (data)
+    {
+    case 0x0276:
+    case 0x0597:
+    case 0x6367:
+        break;
+    default:
+        return RT_ERR_OK;
+    }
+
+    if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_MISCELLANEOUS_CONFIGURE0, RTL8367C_AUTOLOAD_EN_OFFSET, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    if (regData)
+    {
+        if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_MISCELLANEOUS_CONFIGURE1, RTL8367C_EEPROM_DWONLOAD_COMPLETE_OFFSET, &regData)) != RT_ERR_OK)
+            return retVal;
+
+        if (!regData)
+            return RT_ERR_OK;
+    }
+
+    *pReady = 1;
+
+    return RT_ERR_OK;
+}
+
 /* Function Name:
  *      rtk_switch_isUtpPort
  * Description:
@@ -187,9 +386,8 @@ uint32_t rtl8367::rtk_switch_port_L2P_get(uint8_t logicalPort)
 int32_t rtl8367::rtl8367c_getAsicPHYOCPReg(uint32_t phyNo, uint32_t ocpAddr, uint32_t *pRegData)
 {
     int32_t retVal;
-    uint32_t regData;
-    uint32_t busyFlag, checkCounter;
-    uint32_t ocpAddrPrefix, ocpAddr9_6, ocpAddr5_1;
+    uint32_t busyFlag;
+
     /*Check internal phy access busy or not*/
     /*retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_INDRECT_ACCESS_STATUS, RTL8367C_INDRECT_ACCESS_STATUS_OFFSET,&busyFlag);*/
     retVal = rtl8367c_getAsicReg(RTL8367C_REG_INDRECT_ACCESS_STATUS, &busyFlag);
@@ -199,9 +397,40 @@ int32_t rtl8367::rtl8367c_getAsicPHYOCPReg(uint32_t phyNo, uint32_t ocpAddr, uin
     if (busyFlag)
         return RT_ERR_BUSYWAIT_TIMEOUT;
 
-    /* OCP prefix */
+    return _rtl8367c_getAsicPHYOCPReg(phyNo, ocpAddr, pRegData);
+}
+
+/* program the OCP address prefix, unless the previous access left it in place */
+int32_t rtl8367::_rtl8367c_setAsicPHYOCPPrefix(uint32_t ocpAddr)
+{
+    int32_t retVal;
+    uint32_t ocpAddrPrefix;
+
     ocpAddrPrefix = ((ocpAddr & 0xFC00) >> 10);
-    if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_GPHY_OCP_MSB_0, RTL8367C_CFG_CPU_OCPADR_MSB_MASK, ocpAddrPrefix)) != RT_ERR_OK)
+    if (ocpAddrPrefix == phyOcpPrefix)
+        return RT_ERR_OK;
+
+    if ((retVal = rtl8367c_setAsicField<RTL8367C_FIELD(GPHY_OCP_MSB_0, CFG_CPU_OCPADR_MSB)>(ocpAddrPrefix)) != RT_ERR_OK)
+    {
+        phyOcpPrefix = RTL8367C_PHY_OCP_PREFIX_NONE;
+        return retVal;
+    }
+
+    phyOcpPrefix = ocpAddrPrefix;
+
+    return RT_ERR_OK;
+}
+
+/* rtl8367c_getAsicPHYOCPReg once the indirect access is known to be idle */
+int32_t rtl8367::_rtl8367c_getAsicPHYOCPReg(uint32_t phyNo, uint32_t ocpAddr, uint32_t *pRegData)
+{
+    int32_t retVal;
+    uint32_t regData;
+    uint32_t busyFlag, checkCounter;
+    uint32_t ocpAddr9_6, ocpAddr5_1;
+
+    /* OCP prefix */
+    if ((retVal = _rtl8367c_setAsicPHYOCPPrefix(ocpAddr)) != RT_ERR_OK)
         return retVal;
 
     /*prepare access address*/
@@ -274,6 +503,52 @@ int32_t rtl8367::rtl8367c_getAsicPHYReg(uint32_t phyNo, uint32_t phyAddr, uint32
     return rtl8367c_getAsicPHYOCPReg(phyNo, ocp_addr, pRegData);
 }
 
+/* Function Name:
+ *      rtl8367c_getAsicPHYRegs
+ * Description:
+ *      Get several PHY registers of one PHY
+ * Input:
+ *      phyNo       - Physical port number (0~7)
+ *      pPhyAddr    - PHY addresses (0~31)
+ *      num         - number of registers
+ * Output:
+ *      pRegData    - register values, in pPhyAddr order
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PHY_REG_ID       - invalid PHY address
+ *      RT_ERR_BUSYWAIT_TIMEOUT - PHY access busy
+ * Note:
+ *      The indirect access is checked idle once for the whole sequence,
+ *      each access already waits for the previous one to complete.
+ */
+int32_t rtl8367::rtl8367c_getAsicPHYRegs(uint32_t phyNo, const uint32_t *pPhyAddr, uint32_t num, uint32_t *pRegData)
+{
+    int32_t retVal;
+    uint32_t busyFlag, i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (pPhyAddr[i] > RTL8367C_PHY_REGNOMAX)
+            return RT_ERR_PHY_REG_ID;
+    }
+
+    retVal = rtl8367c_getAsicReg(RTL8367C_REG_INDRECT_ACCESS_STATUS, &busyFlag);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    if (busyFlag)
+        return RT_ERR_BUSYWAIT_TIMEOUT;
+
+    for (i = 0; i < num; i++)
+    {
+        if ((retVal = _rtl8367c_getAsicPHYOCPReg(phyNo, 0xa400 + pPhyAddr[i] * 2, &pRegData[i])) != RT_ERR_OK)
+            return retVal;
+    }
+
+    return RT_ERR_OK;
+}
+
 /* Function Name:
  *      rtk_port_phyStatus_get
  * Description:
@@ -297,6 +572,7 @@ int32_t rtl8367::rtl8367c_getAsicPHYReg(uint32_t phyNo, uint32_t phyAddr, uint32
  */
 int32_t rtl8367::rtk_port_phyStatus_get(uint8_t port, uint8_t &pLinkStatus, uint8_t &pSpeed, uint8_t &pDuplex)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t phyData;
 
@@ -328,6 +604,61 @@ int32_t rtl8367::rtk_port_phyStatus_get(uint8_t port, uint8_t &pLinkStatus, uint
     return RT_ERR_OK;
 }
 
+/* Function Name:
+ *      rtk_port_phyStatus_getAll
+ * Description:
+ *      Get link status, speed and duplex of every port
+ * Input:
+ *      None
+ * Output:
+ *      pStatus - link up portmask, speed and duplex per logical port
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      Reads the MAC status register of each port, one SMI read per port
+ *      instead of an indirect PHY access. UTP ports report the link the PHY
+ *      resolved, EXT ports the forced or negotiated MAC link; an EXT port in
+ *      HSGMII mode costs one more read and reports PORT_SPEED_2500M.
+ */
+int32_t rtl8367::rtk_port_phyStatus_getAll(rtk_port_status_all_t *pStatus)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t port, phyPort, regData, mode;
+
+    if (NULL == pStatus)
+        return RT_ERR_NULL_POINTER;
+
+    memset(pStatus, 0, sizeof(rtk_port_status_all_t));
+
+    RTK_SCAN_ALL_LOG_PORT(port)
+    {
+        phyPort = rtk_switch_port_L2P_get((rtk_port_t)port);
+        if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_PORT0_STATUS + phyPort, &regData)) != RT_ERR_OK)
+            return retVal;
+
+        if ((regData & RTL8367C_PORT0_STATUS_LINK_STATE_MASK) == 0)
+            continue;
+
+        RTK_PORTMASK_PORT_SET(pStatus->linkUp, port);
+        pStatus->speed[port] = (regData & RTL8367C_PORT0_STATUS_LINK_SPEED_MASK) >> RTL8367C_PORT0_STATUS_LINK_SPEED_OFFSET;
+        pStatus->duplex[port] = (regData & RTL8367C_PORT0_STATUS_FULL_DUPLUX_CAP_MASK) ? PORT_FULL_DUPLEX : PORT_HALF_DUPLEX;
+
+        if ((rtk_switch_isExtPort((rtk_port_t)port) == RT_ERR_OK) && (pStatus->speed[port] == PORT_SPEED_1000M))
+        {
+            if ((retVal = rtl8367c_getAsicPortExtMode(port - 15, &mode)) != RT_ERR_OK)
+                return retVal;
+
+            if (mode == MODE_EXT_HSGMII)
+                pStatus->speed[port] = PORT_SPEED_2500M;
+        }
+    }
+
+    return RT_ERR_OK;
+}
+
 ////////////////// Vlan Part
 
 #include "Arduino.h"
@@ -480,6 +811,10 @@ int32_t rtl8367::rtl8367c_setAsicVlan4kEntry(rtl8367c_user_vlan4kentry *pVlan4kE
 
     memset(vlan_4k_entry, 0x00, sizeof(uint16_t) * RTL8367C_VLAN_4KTABLE_LEN);
     _rtl8367c_Vlan4kStUser2Smi(pVlan4kEntry, vlan_4k_entry);
+#ifdef RTL8367_VLAN_SHADOW
+    /* unknown until the write command went out */
+    vlanShadowDrop(pVlan4kEntry->vid);
+#endif
 
     /* Prepare Data */
     tableAddr = vlan_4k_entry;
@@ -503,6 +838,9 @@ int32_t rtl8367::rtl8367c_setAsicVlan4kEntry(rtl8367c_user_vlan4kentry *pVlan4kE
     retVal = rtl8367c_setAsicRegBits(RTL8367C_TABLE_ACCESS_CTRL_REG, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_CVLAN));
     if (retVal != RT_ERR_OK)
         return retVal;
+#ifdef RTL8367_VLAN_SHADOW
+    vlanShadowPut(pVlan4kEntry->vid, vlan_4k_entry);
+#endif
 
     return RT_ERR_OK;
 }
@@ -626,29 +964,112 @@ int32_t rtl8367::rtl8367c_setAsicVlanFilter(uint32_t enabled)
     return rtl8367c_setAsicRegBit(RTL8367C_REG_VLAN_CTRL, RTL8367C_VLAN_CTRL_OFFSET, enabled);
 }
 
-int32_t rtl8367::rtk_vlan_init()
+/* Function Name:
+ *      vlanInitReg
+ * Description:
+ *      Bring the masked bits of one register to their rtk_vlan_init default
+ * Input:
+ *      reg             - register address
+ *      mask            - bits owned by rtk_vlan_init, RTL8367C_REGDATAMAX for the whole register
+ *      valueShifted    - default of those bits, already in place
+ *      mode            - VLAN_INIT_MODE_FULL, _DIFF or _FRESH
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ * Note:
+ *      FULL writes (read-modify-write for a partial mask), DIFF reads once and
+ *      writes only on a difference, FRESH skips a zero default since the reset
+ *      left it zero.
+ */
+int32_t rtl8367::vlanInitReg(uint32_t reg, uint32_t mask, uint32_t valueShifted, rtk_vlan_initMode_t mode)
+{
+    int32_t retVal;
+    uint32_t regData;
+
+    if ((mode == VLAN_INIT_MODE_FRESH) && ((valueShifted & mask) == 0))
+        return RT_ERR_OK;
+
+    if (mode != VLAN_INIT_MODE_DIFF)
+    {
+        if (mask == RTL8367C_REGDATAMAX)
+            return rtl8367c_setAsicReg(reg, valueShifted);
+
+        return rtl8367c_setAsicRegMasked(reg, mask, valueShifted);
+    }
+
+    if ((retVal = rtl8367c_getAsicReg(reg, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    if ((regData & mask) == (valueShifted & mask))
+        return RT_ERR_OK;
+
+    return rtl8367c_setAsicReg(reg, (regData & ~mask) | (valueShifted & mask));
+}
+
+/* Function Name:
+ *      rtk_vlan_init
+ * Description:
+ *      Initialize VLAN
+ * Input:
+ *      mode - VLAN_INIT_MODE_FULL, VLAN_INIT_MODE_DIFF or VLAN_INIT_MODE_FRESH
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_INPUT    - Invalid input parameter
+ * Note:
+ *      All 32 member configurations are cleared but index 0, which holds VID 1
+ *      like the 4K table, every port gets PVID 1 with priority 0, original egress
+ *      tag mode and ingress filtering, and VLAN filtering is enabled.
+ *      FULL writes all of it. DIFF reads the current state once and writes only
+ *      the registers that differ, for a switch that may already be configured.
+ *      FRESH skips everything whose default is zero and may only be used right
+ *      after reset()/resetWithDelay(), before any other VLAN call.
+ *      Registers shared by several ports are written once for all of them.
+ */
+int32_t rtl8367::rtk_vlan_init(rtk_vlan_initMode_t mode)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t i;
+    uint32_t page_idx;
+    uint32_t igrMask;
+    uint32_t pvidMask[(RTL8367C_PORTIDMAX >> 1) + 1];
+    uint32_t priMask[(RTL8367C_PORTIDMAX >> 2) + 1];
     rtl8367c_user_vlan4kentry vlan4K;
+    rtl8367c_user_vlan4kentry cur4K;
     rtl8367c_vlanconfiguser vlanMC;
+    uint16_t smi_vlancfg[RTL8367C_VLAN_MBRCFG_LEN];
+
+    if (mode >= VLAN_INIT_MODE_END)
+        return RT_ERR_INPUT;
 
     /* Clean Database */
     memset(vlan_mbrCfgVid, 0x00, sizeof(uint32_t) * RTL8367C_CVIDXNO);
     memset(vlan_mbrCfgUsage, 0x00, sizeof(vlan_mbrCfgType_t) * RTL8367C_CVIDXNO);
 
-    /* clean 32 VLAN member configuration */
+    /* clean 32 VLAN member configuration, the default VLAN goes to index 0 */
     for (i = 0; i <= RTL8367C_CVIDXMAX; i++)
     {
-        vlanMC.evid = 0;
-        vlanMC.mbr = 0;
-        vlanMC.fid_msti = 0;
-        vlanMC.envlanpol = 0;
-        vlanMC.meteridx = 0;
-        vlanMC.vbpen = 0;
-        vlanMC.vbpri = 0;
-        if ((retVal = rtl8367c_setAsicVlanMemberConfig(i, &vlanMC)) != RT_ERR_OK)
-            return retVal;
+        memset(&vlanMC, 0, sizeof(rtl8367c_vlanconfiguser));
+        if (i == 0)
+        {
+            vlanMC.evid = 1;
+            vlanMC.mbr = halCtrl.phy_portmask;
+        }
+
+        memset(smi_vlancfg, 0x00, sizeof(uint16_t) * RTL8367C_VLAN_MBRCFG_LEN);
+        _rtl8367c_VlanMCStUser2Smi(&vlanMC, smi_vlancfg);
+        for (page_idx = 0; page_idx < 4; page_idx++) /* 4 pages per VLAN Member Config */
+        {
+            retVal = vlanInitReg(RTL8367C_VLAN_MEMBER_CONFIGURATION_BASE + (i * 4) + page_idx, RTL8367C_REGDATAMAX,
+                                 smi_vlancfg[page_idx], mode);
+            if (retVal != RT_ERR_OK)
+                return retVal;
+        }
     }
 
     /* Set a default VLAN with vid 1 to 4K table for all ports */
@@ -657,23 +1078,47 @@ int32_t rtl8367::rtk_vlan_init()
     vlan4K.mbr = halCtrl.phy_portmask;
     vlan4K.untag = halCtrl.phy_portmask;
     vlan4K.fid_msti = 0;
-    if ((retVal = rtl8367c_setAsicVlan4kEntry(&vlan4K)) != RT_ERR_OK)
-        return retVal;
-
-    /* Also set the default VLAN to 32 member configuration index 0 */
-    memset(&vlanMC, 0, sizeof(rtl8367c_vlanconfiguser));
-    vlanMC.evid = 1;
-    vlanMC.mbr = halCtrl.phy_portmask;
-    vlanMC.fid_msti = 0;
-    if ((retVal = rtl8367c_setAsicVlanMemberConfig(0, &vlanMC)) != RT_ERR_OK)
-        return retVal;
+    memset(&cur4K, 0, sizeof(rtl8367c_user_vlan4kentry));
+    cur4K.vid = 1;
+    if (mode == VLAN_INIT_MODE_DIFF)
+    {
+        if ((retVal = rtl8367c_getAsicVlan4kEntry(&cur4K)) != RT_ERR_OK)
+            return retVal;
+    }
+    if ((mode != VLAN_INIT_MODE_DIFF) || (memcmp(&cur4K, &vlan4K, sizeof(rtl8367c_user_vlan4kentry)) != 0))
+    {
+        if ((retVal = rtl8367c_setAsicVlan4kEntry(&vlan4K)) != RT_ERR_OK)
+            return retVal;
+    }
 
     /* Set all ports PVID to default VLAN and tag-mode to original */
+    memset(pvidMask, 0, sizeof(pvidMask));
+    memset(priMask, 0, sizeof(priMask));
+    igrMask = 0;
     RTK_SCAN_ALL_PHY_PORTMASK(i)
     {
-        if ((retVal = rtl8367c_setAsicVlanPortBasedVID(i, 0, 0)) != RT_ERR_OK)
+        pvidMask[i >> 1] |= RTL8367C_PORT_VIDX_MASK(i);
+        priMask[i >> 2] |= RTL8367C_VLAN_PORTBASED_PRIORITY_MASK(i);
+        igrMask |= 1 << i;
+
+        /* EG_TAG_MODE_ORI */
+        if ((retVal = vlanInitReg(RTL8367C_PORT_MISC_CFG_REG(i), RTL8367C_VLAN_EGRESS_MDOE_MASK, 0, mode)) != RT_ERR_OK)
+            return retVal;
+    }
+
+    for (i = 0; i <= (RTL8367C_PORTIDMAX >> 1); i++)
+    {
+        if (pvidMask[i] == 0)
+            continue;
+        if ((retVal = vlanInitReg(RTL8367C_VLAN_PVID_CTRL_BASE + i, pvidMask[i], 0, mode)) != RT_ERR_OK)
             return retVal;
-        if ((retVal = rtl8367c_setAsicVlanEgressTagMode(i, EG_TAG_MODE_ORI)) != RT_ERR_OK)
+    }
+
+    for (i = 0; i <= (RTL8367C_PORTIDMAX >> 2); i++)
+    {
+        if (priMask[i] == 0)
+            continue;
+        if ((retVal = vlanInitReg(RTL8367C_VLAN_PORTBASED_PRIORITY_BASE + i, priMask[i], 0, mode)) != RT_ERR_OK)
             return retVal;
     }
 
@@ -682,14 +1127,11 @@ int32_t rtl8367::rtk_vlan_init()
     vlan_mbrCfgVid[0] = 1;
 
     /* Enable Ingress filter */
-    RTK_SCAN_ALL_PHY_PORTMASK(i)
-    {
-        if ((retVal = rtl8367c_setAsicVlanIngressFilter(i, ENABLED)) != RT_ERR_OK)
-            return retVal;
-    }
+    if ((retVal = vlanInitReg(RTL8367C_VLAN_INGRESS_REG, igrMask, igrMask, mode)) != RT_ERR_OK)
+        return retVal;
 
     /* enable VLAN */
-    if ((retVal = rtl8367c_setAsicVlanFilter(ENABLED)) != RT_ERR_OK)
+    if ((retVal = vlanInitReg(RTL8367C_REG_VLAN_CTRL, 1 << RTL8367C_VLAN_CTRL_OFFSET, 1 << RTL8367C_VLAN_CTRL_OFFSET, mode)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
@@ -730,45 +1172,9 @@ int32_t rtl8367::rtk_switch_portmask_L2P_get(rtk_portmask_t *pLogicalPmask, uint
     return RT_ERR_OK;
 }
 
-/* Function Name:
- *      rtk_vlan_set
- * Description:
- *      Set a VLAN entry.
- * Input:
- *      vid - VLAN ID to configure.
- *      pVlanCfg - VLAN Configuration
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                   - OK
- *      RT_ERR_FAILED               - Failed
- *      RT_ERR_SMI                  - SMI access error
- *      RT_ERR_INPUT                - Invalid input parameters.
- *      RT_ERR_L2_FID               - Invalid FID.
- *      RT_ERR_VLAN_PORT_MBR_EXIST  - Invalid member port mask.
- *      RT_ERR_VLAN_VID             - Invalid VID parameter.
- * Note:
- *
- */
-int32_t rtl8367::rtk_vlan_set(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg)
+/* the checks of rtk_vlan_set on a VLAN configuration */
+int32_t rtl8367::vlanCfgCheck(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg)
 {
-    int32_t retVal;
-    uint32_t phyMbrPmask;
-    uint32_t phyUntagPmask;
-    rtl8367c_user_vlan4kentry vlan4K;
-    rtl8367c_vlanconfiguser vlanMC;
-    uint32_t idx;
-    uint32_t empty_index = 0xffff;
-    uint32_t update_evid = 0;
-
-    /* vid must be 0~8191 */
-    if (vid > RTL8367C_EVIDMAX)
-        return RT_ERR_VLAN_VID;
-
-    /* Null pointer check */
-    if (NULL == pVlanCfg)
-        return RT_ERR_NULL_POINTER;
-
     /* Check port mask valid */
     RTK_CHK_PORTMASK_VALID(&(pVlanCfg->mbr));
 
@@ -802,6 +1208,15 @@ int32_t rtl8367::rtk_vlan_set(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg)
     if (pVlanCfg->vbpri > RTL8367C_PRIMAX)
         return RT_ERR_INPUT;
 
+    return RT_ERR_OK;
+}
+
+/* the 4K entry of a VLAN configuration already checked by vlanCfgCheck */
+int32_t rtl8367::vlanCfgTo4k(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg, rtl8367c_user_vlan4kentry *pVlan4K)
+{
+    uint32_t phyMbrPmask;
+    uint32_t phyUntagPmask;
+
     /* Get physical port mask */
     if (rtk_switch_portmask_L2P_get(&(pVlanCfg->mbr), &phyMbrPmask) != RT_ERR_OK)
         return RT_ERR_FAILED;
@@ -809,63 +1224,130 @@ int32_t rtl8367::rtk_vlan_set(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg)
     if (rtk_switch_portmask_L2P_get(&(pVlanCfg->untag), &phyUntagPmask) != RT_ERR_OK)
         return RT_ERR_FAILED;
 
-    if (vid <= RTL8367C_VIDMAX)
-    {
-        /* update 4K table */
-        memset(&vlan4K, 0, sizeof(rtl8367c_user_vlan4kentry));
-        vlan4K.vid = vid;
-
-        vlan4K.mbr = (phyMbrPmask & 0xFFFF);
-        vlan4K.untag = (phyUntagPmask & 0xFFFF);
+    memset(pVlan4K, 0, sizeof(rtl8367c_user_vlan4kentry));
+    pVlan4K->vid = vid;
+    pVlan4K->mbr = (phyMbrPmask & 0xFFFF);
+    pVlan4K->untag = (phyUntagPmask & 0xFFFF);
+    pVlan4K->ivl_svl = pVlanCfg->ivl_en;
+    pVlan4K->fid_msti = pVlanCfg->fid_msti;
+    pVlan4K->envlanpol = pVlanCfg->envlanpol;
+    pVlan4K->meteridx = pVlanCfg->meteridx;
+    pVlan4K->vbpen = pVlanCfg->vbpen;
+    pVlan4K->vbpri = pVlanCfg->vbpri;
 
-        vlan4K.ivl_svl = pVlanCfg->ivl_en;
-        vlan4K.fid_msti = pVlanCfg->fid_msti;
-        vlan4K.envlanpol = pVlanCfg->envlanpol;
-        vlan4K.meteridx = pVlanCfg->meteridx;
-        vlan4K.vbpen = pVlanCfg->vbpen;
-        vlan4K.vbpri = pVlanCfg->vbpri;
+    return RT_ERR_OK;
+}
 
-        if ((retVal = rtl8367c_setAsicVlan4kEntry(&vlan4K)) != RT_ERR_OK)
-            return retVal;
+/* follow a 4K entry change in the member configuration holding its VID, if any */
+int32_t rtl8367::vlanMbrCfgSync(rtl8367c_user_vlan4kentry *pVlan4K)
+{
+    int32_t retVal;
+    rtl8367c_vlanconfiguser vlanMC;
+    uint32_t idx;
 
-        /* Update Member configuration if exist */
-        for (idx = 0; idx <= RTL8367C_CVIDXMAX; idx++)
+    for (idx = 0; idx <= RTL8367C_CVIDXMAX; idx++)
+    {
+        if (vlan_mbrCfgUsage[idx] == MBRCFG_USED_BY_VLAN)
         {
-            if (vlan_mbrCfgUsage[idx] == MBRCFG_USED_BY_VLAN)
+            if (vlan_mbrCfgVid[idx] == pVlan4K->vid)
             {
-                if (vlan_mbrCfgVid[idx] == vid)
+                /* Found! Update */
+                if (pVlan4K->mbr == 0x00)
                 {
-                    /* Found! Update */
-                    if (phyMbrPmask == 0x00)
-                    {
-                        /* Member port = 0x00, delete this VLAN from Member Configuration */
-                        memset(&vlanMC, 0x00, sizeof(rtl8367c_vlanconfiguser));
-                        if ((retVal = rtl8367c_setAsicVlanMemberConfig(idx, &vlanMC)) != RT_ERR_OK)
-                            return retVal;
-
-                        /* Clear Database */
-                        vlan_mbrCfgUsage[idx] = MBRCFG_UNUSED;
-                        vlan_mbrCfgVid[idx] = 0;
-                    }
-                    else
-                    {
-                        /* Normal VLAN config, update to member configuration */
-                        vlanMC.evid = vid;
-                        vlanMC.mbr = vlan4K.mbr;
-                        vlanMC.fid_msti = vlan4K.fid_msti;
-                        vlanMC.meteridx = vlan4K.meteridx;
-                        vlanMC.envlanpol = vlan4K.envlanpol;
-                        vlanMC.vbpen = vlan4K.vbpen;
-                        vlanMC.vbpri = vlan4K.vbpri;
-                        if ((retVal = rtl8367c_setAsicVlanMemberConfig(idx, &vlanMC)) != RT_ERR_OK)
-                            return retVal;
-                    }
+                    /* Member port = 0x00, delete this VLAN from Member Configuration */
+                    memset(&vlanMC, 0x00, sizeof(rtl8367c_vlanconfiguser));
+                    if ((retVal = rtl8367c_setAsicVlanMemberConfig(idx, &vlanMC)) != RT_ERR_OK)
+                        return retVal;
 
-                    break;
+                    /* Clear Database */
+                    vlan_mbrCfgUsage[idx] = MBRCFG_UNUSED;
+                    vlan_mbrCfgVid[idx] = 0;
+                }
+                else
+                {
+                    /* Normal VLAN config, update to member configuration */
+                    vlanMC.evid = pVlan4K->vid;
+                    vlanMC.mbr = pVlan4K->mbr;
+                    vlanMC.fid_msti = pVlan4K->fid_msti;
+                    vlanMC.meteridx = pVlan4K->meteridx;
+                    vlanMC.envlanpol = pVlan4K->envlanpol;
+                    vlanMC.vbpen = pVlan4K->vbpen;
+                    vlanMC.vbpri = pVlan4K->vbpri;
+                    if ((retVal = rtl8367c_setAsicVlanMemberConfig(idx, &vlanMC)) != RT_ERR_OK)
+                        return retVal;
                 }
+
+                break;
             }
         }
     }
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_vlan_set
+ * Description:
+ *      Set a VLAN entry.
+ * Input:
+ *      vid - VLAN ID to configure.
+ *      pVlanCfg - VLAN Configuration
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK                   - OK
+ *      RT_ERR_FAILED               - Failed
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_INPUT                - Invalid input parameters.
+ *      RT_ERR_L2_FID               - Invalid FID.
+ *      RT_ERR_VLAN_PORT_MBR_EXIST  - Invalid member port mask.
+ *      RT_ERR_VLAN_VID             - Invalid VID parameter.
+ * Note:
+ *
+ */
+int32_t rtl8367::rtk_vlan_set(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t phyMbrPmask;
+    uint32_t phyUntagPmask;
+    rtl8367c_user_vlan4kentry vlan4K;
+    rtl8367c_vlanconfiguser vlanMC;
+    uint32_t idx;
+    uint32_t empty_index = 0xffff;
+    uint32_t update_evid = 0;
+
+    /* vid must be 0~8191 */
+    if (vid > RTL8367C_EVIDMAX)
+        return RT_ERR_VLAN_VID;
+
+    /* Null pointer check */
+    if (NULL == pVlanCfg)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = vlanCfgCheck(vid, pVlanCfg)) != RT_ERR_OK)
+        return retVal;
+
+    /* Get physical port mask */
+    if (rtk_switch_portmask_L2P_get(&(pVlanCfg->mbr), &phyMbrPmask) != RT_ERR_OK)
+        return RT_ERR_FAILED;
+
+    if (rtk_switch_portmask_L2P_get(&(pVlanCfg->untag), &phyUntagPmask) != RT_ERR_OK)
+        return RT_ERR_FAILED;
+
+    if (vid <= RTL8367C_VIDMAX)
+    {
+        /* update 4K table */
+        if ((retVal = vlanCfgTo4k(vid, pVlanCfg, &vlan4K)) != RT_ERR_OK)
+            return retVal;
+
+        if ((retVal = rtl8367c_setAsicVlan4kEntry(&vlan4K)) != RT_ERR_OK)
+            return retVal;
+
+        /* Update Member configuration if exist */
+        if ((retVal = vlanMbrCfgSync(&vlan4K)) != RT_ERR_OK)
+            return retVal;
+    }
     else
     {
         /* vid > 4095 */
@@ -935,6 +1417,181 @@ int32_t rtl8367::rtk_vlan_set(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg)
     return RT_ERR_OK;
 }
 
+/* busy pre-poll of a bulk VLAN table update */
+int32_t rtl8367::vlanBulkBegin()
+{
+    int32_t retVal;
+    uint32_t regData;
+    uint32_t busyCounter;
+
+    busyCounter = RTL8367C_VLAN_BUSY_CHECK_NO;
+    while (1)
+    {
+        retVal = rtl8367c_getAsicRegBit(RTL8367C_TABLE_ACCESS_STATUS_REG, RTL8367C_TABLE_LUT_ADDR_BUSY_FLAG_OFFSET, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        if (regData == 0)
+            return RT_ERR_OK;
+
+        busyCounter--;
+        if (busyCounter == 0)
+            return RT_ERR_BUSYWAIT_TIMEOUT;
+    }
+}
+
+/* write one 4K entry of a bulk update unless the table holds it already */
+int32_t rtl8367::vlanBulkApply(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg, uint32_t *pWritten)
+{
+    int32_t retVal;
+    rtl8367c_user_vlan4kentry vlan4K;
+    rtl8367c_user_vlan4kentry cur4K;
+    uint16_t want[RTL8367C_VLAN_4KTABLE_LEN];
+    uint16_t have[RTL8367C_VLAN_4KTABLE_LEN];
+
+    if ((retVal = vlanCfgTo4k(vid, pVlanCfg, &vlan4K)) != RT_ERR_OK)
+        return retVal;
+
+    /* from the shadow when it knows the VID, else read back from the table */
+    memset(&cur4K, 0, sizeof(rtl8367c_user_vlan4kentry));
+    cur4K.vid = vid;
+    if ((retVal = rtl8367c_getAsicVlan4kEntry(&cur4K)) != RT_ERR_OK)
+        return retVal;
+
+    memset(want, 0x00, sizeof(want));
+    memset(have, 0x00, sizeof(have));
+    _rtl8367c_Vlan4kStUser2Smi(&vlan4K, want);
+    _rtl8367c_Vlan4kStUser2Smi(&cur4K, have);
+    if (memcmp(have, want, sizeof(want)) == 0)
+        return RT_ERR_OK;
+
+    if ((retVal = rtl8367c_setAsicVlan4kEntryBulk(vid, want)) != RT_ERR_OK)
+        return retVal;
+
+    (*pWritten)++;
+
+    return vlanMbrCfgSync(&vlan4K);
+}
+
+/* Function Name:
+ *      rtk_vlan_bulk_set
+ * Description:
+ *      Set many VLAN entries, writing only the ones that change
+ * Input:
+ *      pEntries    - VLAN entries sorted by ascending VID, VIDs 0~4095
+ *      num         - number of entries
+ * Output:
+ *      pWritten    - number of entries written, may be NULL
+ * Return:
+ *      RT_ERR_OK                   - OK
+ *      RT_ERR_FAILED               - Failed
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_INPUT                - Invalid input parameters.
+ *      RT_ERR_L2_FID               - Invalid FID.
+ *      RT_ERR_VLAN_PORT_MBR_EXIST  - Invalid member port mask.
+ *      RT_ERR_VLAN_VID             - Invalid VID parameter.
+ *      RT_ERR_NULL_POINTER         - Input parameter may be null pointer
+ *      RT_ERR_BUSYWAIT_TIMEOUT     - VLAN table is busy
+ * Note:
+ *      Same result as rtk_vlan_set on each entry. Every entry is checked
+ *      before the first write, so bad input changes nothing. Each VID is
+ *      compared with the table and written only if it differs. The compare
+ *      costs no SMI access when RTL8367_VLAN_SHADOW knows the VID, otherwise
+ *      a table read, which is more than the write it may save: without the
+ *      shadow the call avoids needless writes, it is not faster than
+ *      rtk_vlan_set. A VID that is repeated or out of order is RT_ERR_INPUT.
+ */
+int32_t rtl8367::rtk_vlan_bulk_set(rtk_vlan_entry_t *pEntries, uint32_t num, uint32_t *pWritten)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t i, written;
+
+    if (NULL == pEntries)
+        return RT_ERR_NULL_POINTER;
+
+    for (i = 0; i < num; i++)
+    {
+        if (pEntries[i].vid > RTL8367C_VIDMAX)
+            return RT_ERR_VLAN_VID;
+
+        if ((i > 0) && (pEntries[i].vid <= pEntries[i - 1].vid))
+            return RT_ERR_INPUT;
+
+        if ((retVal = vlanCfgCheck(pEntries[i].vid, &pEntries[i].cfg)) != RT_ERR_OK)
+            return retVal;
+    }
+
+    written = 0;
+    if ((retVal = vlanBulkBegin()) == RT_ERR_OK)
+    {
+        for (i = 0; i < num; i++)
+        {
+            if ((retVal = vlanBulkApply(pEntries[i].vid, &pEntries[i].cfg, &written)) != RT_ERR_OK)
+                break;
+        }
+    }
+
+    if (pWritten != NULL)
+        *pWritten = written;
+
+    return retVal;
+}
+
+/* Function Name:
+ *      rtk_vlan_range_set
+ * Description:
+ *      Set a range of VLANs to one configuration, writing only the ones that change
+ * Input:
+ *      vidFirst    - first VID of the range (0~4095)
+ *      vidLast     - last VID of the range (vidFirst~4095)
+ *      pVlanCfg    - VLAN Configuration of every VID in the range
+ * Output:
+ *      pWritten    - number of entries written, may be NULL
+ * Return:
+ *      RT_ERR_OK                   - OK
+ *      RT_ERR_FAILED               - Failed
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_INPUT                - Invalid input parameters.
+ *      RT_ERR_L2_FID               - Invalid FID.
+ *      RT_ERR_VLAN_PORT_MBR_EXIST  - Invalid member port mask.
+ *      RT_ERR_VLAN_VID             - Invalid VID parameter.
+ *      RT_ERR_NULL_POINTER         - Input parameter may be null pointer
+ *      RT_ERR_BUSYWAIT_TIMEOUT     - VLAN table is busy
+ * Note:
+ *      See rtk_vlan_bulk_set. An empty member set clears the range.
+ */
+int32_t rtl8367::rtk_vlan_range_set(uint32_t vidFirst, uint32_t vidLast, rtk_vlan_cfg_t *pVlanCfg, uint32_t *pWritten)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t vid, written;
+
+    if ((vidFirst > vidLast) || (vidLast > RTL8367C_VIDMAX))
+        return RT_ERR_VLAN_VID;
+
+    if (NULL == pVlanCfg)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = vlanCfgCheck(vidFirst, pVlanCfg)) != RT_ERR_OK)
+        return retVal;
+
+    written = 0;
+    if ((retVal = vlanBulkBegin()) == RT_ERR_OK)
+    {
+        for (vid = vidFirst; vid <= vidLast; vid++)
+        {
+            if ((retVal = vlanBulkApply(vid, pVlanCfg, &written)) != RT_ERR_OK)
+                break;
+        }
+    }
+
+    if (pWritten != NULL)
+        *pWritten = written;
+
+    return retVal;
+}
+
 void rtl8367::_rtl8367c_Vlan4kStSmi2User(uint16_t *pSmiVlan4kEntry, rtl8367c_user_vlan4kentry *pUserVlan4kEntry)
 {
     pUserVlan4kEntry->mbr = (pSmiVlan4kEntry[0] & 0x00FF) | ((pSmiVlan4kEntry[2] & 0x0007) << 8);
@@ -975,6 +1632,14 @@ int32_t rtl8367::rtl8367c_getAsicVlan4kEntry(rtl8367c_user_vlan4kentry *pVlan4kE
     if (pVlan4kEntry->vid > RTL8367C_VIDMAX)
         return RT_ERR_VLAN_VID;
 
+#ifdef RTL8367_VLAN_SHADOW
+    if (vlanShadowGet(pVlan4kEntry->vid, vlan_4k_entry))
+    {
+        _rtl8367c_Vlan4kStSmi2User(vlan_4k_entry, pVlan4kEntry);
+        return RT_ERR_OK;
+    }
+#endif
+
     /* Polling status */
     busyCounter = RTL8367C_VLAN_BUSY_CHECK_NO;
     while (busyCounter)
@@ -1031,16 +1696,222 @@ int32_t rtl8367::rtl8367c_getAsicVlan4kEntry(rtl8367c_user_vlan4kentry *pVlan4kE
     }
 
     _rtl8367c_Vlan4kStSmi2User(vlan_4k_entry, pVlan4kEntry);
+#ifdef RTL8367_VLAN_SHADOW
+    vlanShadowPut(pVlan4kEntry->vid, vlan_4k_entry);
+#endif
 
     return RT_ERR_OK;
 }
 
-uint32_t rtl8367::rtk_switch_port_P2L_get(uint32_t physicalPort)
-{
-    if (physicalPort >= RTK_SWITCH_PORT_NUM)
-        return UNDEFINE_PORT;
-
-    return (halCtrl.p2l_port[physicalPort]);
+/* Function Name:
+ *      rtl8367c_setAsicVlan4kEntryBulk
+ * Description:
+ *      Write a 4K VLAN table entry in raw SMI format
+ * Input:
+ *      vid         - VLAN ID (0~4095)
+ *      pSmiEntry   - RTL8367C_VLAN_4KTABLE_LEN words of the entry
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ * Note:
+ *      Bulk write helper: the table must be idle before the first write, the
+ *      command is written whole and, like rtl8367c_setAsicVlan4kEntry, not
+ *      polled for completion.
+ */
+int32_t rtl8367::rtl8367c_setAsicVlan4kEntryBulk(uint32_t vid, const uint16_t *pSmiEntry)
+{
+    int32_t retVal;
+    uint32_t i;
+
+#ifdef RTL8367_VLAN_SHADOW
+    /* unknown until the write command went out */
+    vlanShadowDrop(vid);
+#endif
+    for (i = 0; i < RTL8367C_VLAN_4KTABLE_LEN; i++)
+    {
+        retVal = rtl8367c_setAsicReg(RTL8367C_TABLE_ACCESS_WRDATA_BASE + i, pSmiEntry[i]);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+
+    retVal = rtl8367c_setAsicReg(RTL8367C_TABLE_ACCESS_ADDR_REG, vid);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    retVal = rtl8367c_setAsicReg(RTL8367C_TABLE_ACCESS_CTRL_REG, RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_CVLAN));
+    if (retVal != RT_ERR_OK)
+        return retVal;
+#ifdef RTL8367_VLAN_SHADOW
+    vlanShadowPut(vid, pSmiEntry);
+#endif
+
+    return RT_ERR_OK;
+}
+
+#ifdef RTL8367_VLAN_SHADOW
+/* the SMI words of a VID when the shadow knows it, 0 otherwise */
+uint32_t rtl8367::vlanShadowGet(uint32_t vid, uint16_t *pSmiVlan4kEntry)
+{
+    if (!(vlanShadowKnown[vid >> 5] & (1UL << (vid & 31))))
+        return 0;
+
+    pSmiVlan4kEntry[0] = vlanShadowLo[vid] & 0xFFFF;
+    pSmiVlan4kEntry[1] = vlanShadowLo[vid] >> 16;
+    pSmiVlan4kEntry[2] = vlanShadowHi[vid];
+
+    return 1;
+}
+
+void rtl8367::vlanShadowPut(uint32_t vid, const uint16_t *pSmiVlan4kEntry)
+{
+    vlanShadowLo[vid] = pSmiVlan4kEntry[0] | ((uint32_t)pSmiVlan4kEntry[1] << 16);
+    vlanShadowHi[vid] = pSmiVlan4kEntry[2];
+    vlanShadowKnown[vid >> 5] |= (1UL << (vid & 31));
+
+    /* configured means at least one member port, word 0 and 2 hold them */
+    if ((pSmiVlan4kEntry[0] & 0x00FF) || (pSmiVlan4kEntry[2] & 0x0007))
+        vlanShadowPresent[vid >> 5] |= (1UL << (vid & 31));
+    else
+        vlanShadowPresent[vid >> 5] &= ~(1UL << (vid & 31));
+}
+
+void rtl8367::vlanShadowDrop(uint32_t vid)
+{
+    vlanShadowKnown[vid >> 5] &= ~(1UL << (vid & 31));
+    vlanShadowPresent[vid >> 5] &= ~(1UL << (vid & 31));
+}
+
+/* forget every entry, or know them all as empty after a reset */
+void rtl8367::vlanShadowReset(uint32_t empty)
+{
+    memset(vlanShadowLo, 0, sizeof(vlanShadowLo));
+    memset(vlanShadowHi, 0, sizeof(vlanShadowHi));
+    memset(vlanShadowKnown, empty ? 0xFF : 0, sizeof(vlanShadowKnown));
+    memset(vlanShadowPresent, 0, sizeof(vlanShadowPresent));
+}
+
+/* Function Name:
+ *      rtk_vlan_shadow_rebuild
+ * Description:
+ *      Reload the VLAN 4K table shadow from the switch
+ * Input:
+ *      None
+ * Output:
+ *      pNum    - number of VIDs with member ports, may be NULL
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_BUSYWAIT_TIMEOUT - VLAN table is busy at retrieving
+ * Note:
+ *      Reads all 4096 entries, several seconds of SMI traffic. Needed once
+ *      when the switch was configured before this instance started; after
+ *      reset() or rtk_vlan_init on a freshly reset switch the shadow is
+ *      already complete.
+ */
+int32_t rtl8367::rtk_vlan_shadow_rebuild(uint32_t *pNum)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t vid, num;
+    rtl8367c_user_vlan4kentry vlan4K;
+
+    vlanShadowReset(0);
+
+    num = 0;
+    for (vid = 0; vid <= RTL8367C_VIDMAX; vid++)
+    {
+        vlan4K.vid = vid;
+        if ((retVal = rtl8367c_getAsicVlan4kEntry(&vlan4K)) != RT_ERR_OK)
+            return retVal;
+
+        if (vlan4K.mbr)
+            num++;
+    }
+
+    if (pNum != NULL)
+        *pNum = num;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_vlan_shadow_next_get
+ * Description:
+ *      Find the next configured VLAN in the 4K table shadow
+ * Input:
+ *      pVid    - VID to start from
+ * Output:
+ *      pVid    - first VID at or after the input with member ports
+ * Return:
+ *      RT_ERR_OK                   - OK
+ *      RT_ERR_NOT_INIT             - The shadow does not know every VID
+ *      RT_ERR_NULL_POINTER         - Input parameter may be null pointer
+ *      RT_ERR_VLAN_ENTRY_NOT_FOUND - No configured VID left
+ * Note:
+ *      No SMI access. List all VLANs by starting from 0 and passing the
+ *      returned VID + 1 on the next call. Until the shadow is complete (see
+ *      rtk_vlan_shadow_rebuild) it cannot tell unknown VIDs from empty ones.
+ */
+int32_t rtl8367::rtk_vlan_shadow_next_get(uint32_t *pVid)
+{
+    uint32_t i, word;
+
+    if (NULL == pVid)
+        return RT_ERR_NULL_POINTER;
+
+    for (i = 0; i < sizeof(vlanShadowKnown) / sizeof(vlanShadowKnown[0]); i++)
+    {
+        if (vlanShadowKnown[i] != 0xFFFFFFFF)
+            return RT_ERR_NOT_INIT;
+    }
+
+    if (*pVid > RTL8367C_VIDMAX)
+        return RT_ERR_VLAN_ENTRY_NOT_FOUND;
+
+    /* skip the VIDs before *pVid in its word, then whole words */
+    i = *pVid >> 5;
+    word = vlanShadowPresent[i] & (0xFFFFFFFFUL << (*pVid & 31));
+    while (word == 0)
+    {
+        if (++i >= sizeof(vlanShadowPresent) / sizeof(vlanShadowPresent[0]))
+            return RT_ERR_VLAN_ENTRY_NOT_FOUND;
+
+        word = vlanShadowPresent[i];
+    }
+
+    *pVid = (i << 5) + __builtin_ctzl(word);
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_vlan_shadow_invalidate
+ * Description:
+ *      Forget the VLAN 4K table shadow
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      None
+ * Note:
+ *      Call it when something else than this instance changed the VLAN
+ *      table. Every VID is then read from the switch again once.
+ */
+void rtl8367::rtk_vlan_shadow_invalidate()
+{
+    vlanShadowReset(0);
+}
+#endif
+
+uint32_t rtl8367::rtk_switch_port_P2L_get(uint32_t physicalPort)
+{
+    if (physicalPort >= RTK_SWITCH_PORT_NUM)
+        return UNDEFINE_PORT;
+
+    return (halCtrl.p2l_port[physicalPort]);
 }
 
 /* Function Name:
@@ -1144,6 +2015,7 @@ int32_t rtl8367::rtl8367c_getAsicVlanMemberConfig(uint32_t index, rtl8367c_vlanc
 
 int32_t rtl8367::rtk_vlan_get(uint32_t vid, rtk_vlan_cfg_t *pVlanCfg)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t phyMbrPmask;
     uint32_t phyUntagPmask;
@@ -1348,6 +2220,7 @@ int32_t rtl8367::rtk_vlan_checkAndCreateMbr(uint32_t vid, uint32_t *pIndex)
 
 int32_t rtl8367::rtk_vlan_portPvid_set(rtk_port_t port, uint32_t pvid, uint32_t priority)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t index;
 
@@ -1413,6 +2286,7 @@ int32_t rtl8367::rtl8367c_getAsicVlanPortBasedVID(uint32_t port, uint32_t *pInde
 
 int32_t rtl8367::rtk_vlan_portPvid_get(rtk_port_t port, uint32_t *pPvid, uint32_t *pPriority)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t index, pri;
     rtl8367c_vlanconfiguser mbrCfg;
@@ -1441,6 +2315,7 @@ int32_t rtl8367::rtk_vlan_portPvid_get(rtk_port_t port, uint32_t *pPvid, uint32_
 
 int32_t rtl8367::rtk_vlan_portIgrFilterEnable_set(rtk_port_t port, rtk_enable_t igr_filter)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     /* Check Port Valid */
@@ -1485,6 +2360,7 @@ int32_t rtl8367::rtl8367c_setAsicVlanAccpetFrameType(uint32_t port, rtl8367c_acc
 
 int32_t rtl8367::rtk_vlan_portAcceptFrameType_set(rtk_port_t port, rtk_vlan_acceptFrameType_t accept_frame_type)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     /* Check Port Valid */
@@ -1501,6 +2377,7 @@ int32_t rtl8367::rtk_vlan_portAcceptFrameType_set(rtk_port_t port, rtk_vlan_acce
 
 int32_t rtl8367::rtk_vlan_tagMode_set(rtk_port_t port, rtl8367c_egtagmode tag_mode)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     /* Check Port Valid */
@@ -1545,6 +2422,7 @@ int32_t rtl8367::rtl8367c_setAsicVlanTransparent(uint32_t port, uint32_t portmas
 
 int32_t rtl8367::rtk_vlan_transparent_set(rtk_port_t egr_port, rtk_portmask_t *pIgr_pmask)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t pmask;
 
@@ -1585,7 +2463,7 @@ int32_t rtl8367::rtl8367c_setAsicSvlanPrioritySel(uint32_t priSel)
     if (priSel >= SPRISEL_END)
         return RT_ERR_QOS_INT_PRIORITY;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_REG_SVLAN_CFG, RTL8367C_VS_SPRISEL_MASK, priSel);
+    return rtl8367c_setAsicField<RTL8367C_FIELD(SVLAN_CFG, VS_SPRISEL)>(priSel);
 }
 
 /* Function Name:
@@ -1604,7 +2482,7 @@ int32_t rtl8367::rtl8367c_setAsicSvlanPrioritySel(uint32_t priSel)
  */
 int32_t rtl8367::rtl8367c_setAsicSvlanIngressUntag(uint32_t mode)
 {
-    return rtl8367c_setAsicRegBits(RTL8367C_REG_SVLAN_CFG, RTL8367C_VS_UNTAG_MASK, mode);
+    return rtl8367c_setAsicField<RTL8367C_FIELD(SVLAN_CFG, VS_UNTAG)>(mode);
 }
 
 /* Function Name:
@@ -1623,7 +2501,7 @@ int32_t rtl8367::rtl8367c_setAsicSvlanIngressUntag(uint32_t mode)
  */
 int32_t rtl8367::rtl8367c_setAsicSvlanIngressUnmatch(uint32_t mode)
 {
-    return rtl8367c_setAsicRegBits(RTL8367C_REG_SVLAN_CFG, RTL8367C_VS_UNMAT_MASK, mode);
+    return rtl8367c_setAsicField<RTL8367C_FIELD(SVLAN_CFG, VS_UNMAT)>(mode);
 }
 
 /* Function Name:
@@ -1922,6 +2800,7 @@ int32_t rtl8367::_rtk_svlan_lookupType_set(rtk_svlan_lookupType_t type)
 
 int32_t rtl8367::rtk_svlan_init()
 {
+    RTK_SMI_STATS_SCOPE();
     uint32_t i;
     int32_t retVal;
     rtl8367c_svlan_memconf_t svlanMemConf;
@@ -2012,6 +2891,7 @@ int32_t rtl8367::rtl8367c_getAsicSvlanUplinkPortMask(uint32_t *pPortmask)
 
 int32_t rtl8367::rtk_svlan_servicePort_add(rtk_port_t port)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t pmsk;
 
@@ -2031,6 +2911,7 @@ int32_t rtl8367::rtk_svlan_servicePort_add(rtk_port_t port)
 
 int32_t rtl8367::rtk_svlan_tpidEntry_set(uint32_t svlan_tag_id)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     if (svlan_tag_id > RTK_MAX_NUM_OF_PROTO_TYPE)
@@ -2044,6 +2925,7 @@ int32_t rtl8367::rtk_svlan_tpidEntry_set(uint32_t svlan_tag_id)
 
 int32_t rtl8367::rtk_svlan_memberPortEntry_set(uint32_t svid, rtk_svlan_memberCfg_t *pSvlan_cfg)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     int32_t i;
     uint32_t empty_idx;
@@ -2379,6 +3261,7 @@ int32_t rtl8367::rtl8367c_setAsicSvlanDefaultVlan(uint32_t port, uint32_t index)
 
 int32_t rtl8367::rtk_svlan_defaultSvlan_set(rtk_port_t port, uint32_t svid)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t i;
     rtl8367c_svlan_memconf_t svlanMemConf;
@@ -2449,6 +3332,7 @@ int32_t rtl8367::rtl8367c_getAsicSvlanC2SConf(uint32_t index, uint32_t *pEvid, u
 
 int32_t rtl8367::rtk_svlan_c2s_add(uint32_t vid, rtk_port_t src_port, uint32_t svid)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal, i;
     uint32_t empty_idx;
     uint32_t evid, pmsk, svidx, c2s_svidx;
@@ -2602,6 +3486,7 @@ int32_t rtl8367::rtl8367c_getAsicSvlanSP2CConf(uint32_t index, rtl8367c_svlan_s2
 
 int32_t rtl8367::rtk_svlan_sp2c_add(uint32_t svid, rtk_port_t dst_port, uint32_t cvid)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal, i;
     uint32_t empty_idx, svidx;
     rtl8367c_svlan_memconf_t svlanMemConf;
@@ -2693,6 +3578,7 @@ int32_t rtl8367::rtl8367c_setAsicSvlanUntagVlan(uint32_t index)
 
 int32_t rtl8367::rtk_svlan_untag_action_set(rtk_svlan_untag_action_t action, uint32_t svid)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t i;
     rtl8367c_svlan_memconf_t svlanMemConf;
@@ -2756,6 +3642,7 @@ int32_t rtl8367::rtl8367c_setAsicSvlanUnmatchVlan(uint32_t index)
 
 int32_t rtl8367::rtk_svlan_unmatch_action_set(rtk_svlan_unmatch_action_t action, uint32_t svid)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t i;
     rtl8367c_svlan_memconf_t svlanMemConf;
@@ -2823,6 +3710,7 @@ int32_t rtl8367::rtl8367c_setAsicSvlanDmacCvidSel(uint32_t port, uint32_t enable
 
 int32_t rtl8367::rtk_svlan_dmac_vidsel_set(rtk_port_t port, rtk_enable_t enable)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     /* Check port Valid */
@@ -3019,8 +3907,34 @@ void rtl8367::_rtl8367c_fdbStSmi2User(rtl8367c_luttb *pLutSt, uint16_t *pFdbSmi)
         pLutSt->da_block = (pFdbSmi[5] & 0x0001);
         pLutSt->l3lookup = (pFdbSmi[3] & 0x1000) >> 12;
         pLutSt->ivl_svl = (pFdbSmi[3] & 0x2000) >> 13;
-        pLutSt->nosalearn = (pFdbSmi[3] & 0x0020) >> 5;
+        pLutSt->nosalearn = (pFdbSmi[5] & 0x0020) >> 5;
+    }
+}
+
+/* compact form of a unicast entry, see rtk_l2_entry_t */
+void rtl8367::_rtl8367c_fdbStUser2Entry(rtl8367c_luttb *pLutSt, rtk_l2_entry_t *pEntry)
+{
+    memcpy(pEntry->mac.octet, pLutSt->mac.octet, ETHER_ADDR_LEN);
+    pEntry->address = pLutSt->address;
+    pEntry->port = rtk_switch_port_P2L_get(pLutSt->spa);
+    pEntry->flags = (pLutSt->age << RTK_L2_ENTRY_AGE_OFFSET) & RTK_L2_ENTRY_AGE_MASK;
+    if (pLutSt->ivl_svl)
+    {
+        pEntry->cvid_fid = pLutSt->cvid_fid;
+        pEntry->flags |= RTK_L2_ENTRY_IVL;
     }
+    else
+    {
+        pEntry->cvid_fid = pLutSt->fid | (pLutSt->efid << 4);
+    }
+    if (pLutSt->nosalearn)
+        pEntry->flags |= RTK_L2_ENTRY_STATIC;
+    if (pLutSt->auth)
+        pEntry->flags |= RTK_L2_ENTRY_AUTH;
+    if (pLutSt->sa_block)
+        pEntry->flags |= RTK_L2_ENTRY_SA_BLOCK;
+    if (pLutSt->da_block)
+        pEntry->flags |= RTK_L2_ENTRY_DA_BLOCK;
 }
 /* Function Name:
  *      rtl8367c_getAsicL2LookupTb
@@ -3172,6 +4086,75 @@ int32_t rtl8367::rtl8367c_getAsicL2LookupTb(uint32_t method, rtl8367c_luttb *pL2
     return RT_ERR_OK;
 }
 
+/* Function Name:
+ *      rtl8367c_getAsicL2LookupTbNext
+ * Description:
+ *      Read the next filtering database entry in raw SMI format
+ * Input:
+ *      method      - LUTREADMETHOD_NEXT_xxx, LUTREADMETHOD_NEXT_L2UCSPA excluded
+ *      pAddress    - address to search from
+ * Output:
+ *      pAddress    - address of the entry found
+ *      pSmiEntry   - RTL8367C_LUT_ENTRY_SIZE words of the entry
+ * Return:
+ *      RT_ERR_OK                   - Success
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_L2_ENTRY_NOTFOUND    - No entry found
+ *      RT_ERR_BUSYWAIT_TIMEOUT     - LUT is busy at retrieving
+ * Note:
+ *      Bulk read helper: the LUT must be idle already (no busy pre-poll), and
+ *      one status read gives busy, hit and address together.
+ */
+int32_t rtl8367::rtl8367c_getAsicL2LookupTbNext(uint32_t method, uint32_t *pAddress, uint16_t *pSmiEntry)
+{
+    int32_t retVal;
+    uint32_t regData;
+    uint32_t i;
+    uint32_t busyCounter;
+    uint32_t tblCmd;
+
+    retVal = rtl8367c_setAsicReg(RTL8367C_TABLE_ACCESS_ADDR_REG, *pAddress);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    tblCmd = (method << RTL8367C_ACCESS_METHOD_OFFSET) & RTL8367C_ACCESS_METHOD_MASK;
+    tblCmd = tblCmd | ((RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_READ, TB_TARGET_L2)) & (RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK));
+    retVal = rtl8367c_setAsicReg(RTL8367C_TABLE_ACCESS_CTRL_REG, tblCmd);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    busyCounter = RTL8367C_LUT_BUSY_CHECK_NO;
+    while (1)
+    {
+        retVal = rtl8367c_getAsicReg(RTL8367C_TABLE_ACCESS_STATUS_REG, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        if (!(regData & RTL8367C_TABLE_LUT_ADDR_BUSY_FLAG_MASK))
+            break;
+
+        busyCounter--;
+        if (busyCounter == 0)
+            return RT_ERR_BUSYWAIT_TIMEOUT;
+    }
+
+    if (!(regData & RTL8367C_HIT_STATUS_MASK))
+        return RT_ERR_L2_ENTRY_NOTFOUND;
+
+    *pAddress = (regData & 0x7ff) | ((regData & 0x4000) >> 3) | ((regData & 0x800) << 1);
+
+    for (i = 0; i < RTL8367C_LUT_ENTRY_SIZE; i++)
+    {
+        retVal = rtl8367c_getAsicReg(RTL8367C_TABLE_ACCESS_RDDATA_BASE + i, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        pSmiEntry[i] = regData;
+    }
+
+    return RT_ERR_OK;
+}
+
 /* Function Name:
  *      rtl8367c_setAsicL2LookupTb
  * Description:
@@ -3276,9 +4259,13 @@ int32_t rtl8367::rtl8367c_setAsicL2LookupTb(rtl8367c_luttb *pL2Table)
 
 int32_t rtl8367::rtk_l2_addr_add(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t method;
     rtl8367c_luttb l2Table;
+#ifdef RTL8367_L2_INDEX
+    rtk_l2_entry_t l2Entry;
+#endif
 
     /* must be unicast address */
     if ((pMac == NULL) || (pMac->octet[0] & 0x1))
@@ -3353,6 +4340,10 @@ int32_t rtl8367::rtk_l2_addr_add(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
             return retVal;
 
         pL2_data->address = l2Table.address;
+#ifdef RTL8367_L2_INDEX
+        _rtl8367c_fdbStUser2Entry(&l2Table, &l2Entry);
+        l2IndexPut(&l2Entry);
+#endif
         return RT_ERR_OK;
     }
     else if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
@@ -3383,8 +4374,14 @@ int32_t rtl8367::rtk_l2_addr_add(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
         retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
         if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
             return RT_ERR_L2_INDEXTBL_FULL;
-        else
-            return retVal;
+#ifdef RTL8367_L2_INDEX
+        if (RT_ERR_OK == retVal)
+        {
+            _rtl8367c_fdbStUser2Entry(&l2Table, &l2Entry);
+            l2IndexPut(&l2Entry);
+        }
+#endif
+        return retVal;
     }
     else
         return retVal;
@@ -3392,9 +4389,13 @@ int32_t rtl8367::rtk_l2_addr_add(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
 
 int32_t rtl8367::rtk_l2_addr_del(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t method;
     rtl8367c_luttb l2Table;
+#ifdef RTL8367_L2_INDEX
+    rtk_l2_entry_t l2Entry;
+#endif
 
     /* must be unicast address */
     if ((pMac == NULL) || (pMac->octet[0] & 0x1))
@@ -3433,6 +4434,10 @@ int32_t rtl8367::rtk_l2_addr_del(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
             return retVal;
 
         pL2_data->address = l2Table.address;
+#ifdef RTL8367_L2_INDEX
+        _rtl8367c_fdbStUser2Entry(&l2Table, &l2Entry);
+        l2IndexDrop(&l2Entry);
+#endif
         return RT_ERR_OK;
     }
     else
@@ -3441,9 +4446,13 @@ int32_t rtl8367::rtk_l2_addr_del(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
 
 int32_t rtl8367::rtk_l2_addr_get(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t method;
     rtl8367c_luttb l2Table;
+#ifdef RTL8367_L2_INDEX
+    rtk_l2_entry_t l2Entry;
+#endif
 
     /* must be unicast address */
     if ((pMac == NULL) || (pMac->octet[0] & 0x1))
@@ -3461,8 +4470,23 @@ int32_t rtl8367::rtk_l2_addr_get(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
     l2Table.efid = pL2_data->efid;
     method = LUTREADMETHOD_MAC;
 
+#ifdef RTL8367_L2_INDEX
+    /* the key alone is enough to drop a stale index entry */
+    _rtl8367c_fdbStUser2Entry(&l2Table, &l2Entry);
+#endif
     if ((retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table)) != RT_ERR_OK)
+    {
+#ifdef RTL8367_L2_INDEX
+        if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
+            l2IndexDrop(&l2Entry);
+#endif
         return retVal;
+    }
+
+#ifdef RTL8367_L2_INDEX
+    _rtl8367c_fdbStUser2Entry(&l2Table, &l2Entry);
+    l2IndexPut(&l2Entry);
+#endif
 
     memcpy(pL2_data->mac.octet, pMac->octet, ETHER_ADDR_LEN);
     pL2_data->port = rtk_switch_port_P2L_get(l2Table.spa);
@@ -3484,6 +4508,7 @@ int32_t rtl8367::rtk_l2_addr_get(rtk_mac_t *pMac, rtk_l2_ucastAddr_t *pL2_data)
 
 int32_t rtl8367::rtk_l2_addr_next_get(rtk_l2_read_method_t read_method, rtk_port_t port, uint32_t *pAddress, rtk_l2_ucastAddr_t *pL2_data)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t method;
     rtl8367c_luttb l2Table;
@@ -3537,524 +4562,836 @@ int32_t rtl8367::rtk_l2_addr_next_get(rtk_l2_read_method_t read_method, rtk_port
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_l2_mcastAddr_add(rtk_l2_mcastAddr_t *pMcastAddr)
+/* Function Name:
+ *      rtk_l2_table_dump
+ * Description:
+ *      Read the L2 unicast entries of the LUT into a compact array
+ * Input:
+ *      pAddress    - LUT address to start from, 0 for a full dump
+ *      pEntries    - array receiving the entries
+ *      maxNum      - size of pEntries
+ * Output:
+ *      pAddress    - address to continue from, halCtrl.max_lut_addr_num once the whole table is read
+ *      pNum        - number of entries stored
+ * Return:
+ *      RT_ERR_OK                   - OK
+ *      RT_ERR_FAILED               - Failed
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_NULL_POINTER         - Input parameter may be null pointer
+ *      RT_ERR_L2_L2UNI_PARAM       - Invalid start address
+ *      RT_ERR_BUSYWAIT_TIMEOUT     - LUT is busy at retrieving
+ * Note:
+ *      Costs 2 writes and 7 reads (one busy poll) per entry against 2 writes
+ *      and 10 reads for rtk_l2_addr_next_get. When pEntries is full the dump
+ *      stops, call again with the returned address to read the rest.
+ *      rtk_l2_entry_t.cvid_fid and flags follow RTK_L2_ENTRY_xxx.
+ */
+int32_t rtl8367::rtk_l2_table_dump(uint32_t *pAddress, rtk_l2_entry_t *pEntries, uint32_t maxNum, uint32_t *pNum)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t method;
+    uint32_t regData;
+    uint32_t address, busyCounter;
+    uint16_t smil2Table[RTL8367C_LUT_TABLE_SIZE];
     rtl8367c_luttb l2Table;
-    uint32_t pmask;
+    rtk_l2_entry_t *pEntry;
 
-    if (NULL == pMcastAddr)
+    if ((pAddress == NULL) || (pEntries == NULL) || (pNum == NULL))
         return RT_ERR_NULL_POINTER;
 
-    /* must be L2 multicast address */
-    if ((pMcastAddr->mac.octet[0] & 0x01) != 0x01)
-        return RT_ERR_MAC;
+    if (*pAddress > halCtrl.max_lut_addr_num)
+        return RT_ERR_L2_L2UNI_PARAM;
 
-    RTK_CHK_PORTMASK_VALID(&pMcastAddr->portmask);
+    *pNum = 0;
 
-    if (pMcastAddr->ivl == 1)
+    /* the only busy pre-poll, every read below waits for its own completion */
+    busyCounter = RTL8367C_LUT_BUSY_CHECK_NO;
+    while (1)
     {
-        if (pMcastAddr->vid > RTL8367C_VIDMAX)
-            return RT_ERR_L2_VID;
+        retVal = rtl8367c_getAsicRegBit(RTL8367C_TABLE_ACCESS_STATUS_REG, RTL8367C_TABLE_LUT_ADDR_BUSY_FLAG_OFFSET, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        if (!regData)
+            break;
+
+        busyCounter--;
+        if (busyCounter == 0)
+            return RT_ERR_BUSYWAIT_TIMEOUT;
     }
-    else if (pMcastAddr->ivl == 0)
+
+    while ((*pAddress < halCtrl.max_lut_addr_num) && (*pNum < maxNum))
     {
-        if (pMcastAddr->fid > RTL8367C_FIDMAX)
-            return RT_ERR_L2_FID;
+        address = *pAddress;
+        retVal = rtl8367c_getAsicL2LookupTbNext(LUTREADMETHOD_NEXT_L2UC, &address, smil2Table);
+        if (retVal == RT_ERR_L2_ENTRY_NOTFOUND)
+            break;
+        else if (retVal != RT_ERR_OK)
+            return retVal;
+
+        /* the search wraps around at the end of the table */
+        if (address < *pAddress)
+            break;
+
+        memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+        _rtl8367c_fdbStSmi2User(&l2Table, smil2Table);
+        l2Table.address = address;
+
+        pEntry = &pEntries[*pNum];
+        _rtl8367c_fdbStUser2Entry(&l2Table, pEntry);
+#ifdef RTL8367_L2_INDEX
+        l2IndexPut(pEntry);
+#endif
+
+        (*pNum)++;
+        *pAddress = address + 1;
     }
-    else
-        return RT_ERR_INPUT;
 
-    if (pMcastAddr->fwd_pri_en >= RTK_ENABLE_END)
-        return RT_ERR_INPUT;
+    if ((*pNum < maxNum) || (*pAddress >= halCtrl.max_lut_addr_num))
+        *pAddress = halCtrl.max_lut_addr_num;
 
-    if (pMcastAddr->priority > RTL8367C_PRIMAX)
-        return RT_ERR_INPUT;
+    return RT_ERR_OK;
+}
 
-    /* Get physical port mask */
-    if ((retVal = rtk_switch_portmask_L2P_get(&pMcastAddr->portmask, &pmask)) != RT_ERR_OK)
-        return retVal;
+#ifdef RTL8367_L2_INDEX
+uint32_t rtl8367::l2IndexHash(const rtk_l2_entry_t *pEntry)
+{
+    uint32_t key;
 
-    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+    key = ((uint32_t)pEntry->mac.octet[2] << 24) | ((uint32_t)pEntry->mac.octet[3] << 16) |
+          ((uint32_t)pEntry->mac.octet[4] << 8) | (uint32_t)pEntry->mac.octet[5];
+    key ^= (((uint32_t)pEntry->mac.octet[0] << 8) | (uint32_t)pEntry->mac.octet[1]) << 7;
+    key ^= ((uint32_t)pEntry->cvid_fid << 20) | ((uint32_t)(pEntry->flags & RTK_L2_ENTRY_IVL) << 19);
 
-    /* fill key (MAC,FID) to get L2 entry */
-    memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
-    l2Table.ivl_svl = pMcastAddr->ivl;
+    return ((key * 2654435761UL) >> 16) & (RTL8367_L2_INDEX_SIZE - 1);
+}
 
-    if (pMcastAddr->ivl)
-        l2Table.cvid_fid = pMcastAddr->vid;
-    else
-        l2Table.cvid_fid = pMcastAddr->fid;
+/* slot holding the key of pEntry, or the free slot it would take, or RTL8367_L2_INDEX_SIZE if full */
+uint32_t rtl8367::l2IndexFind(const rtk_l2_entry_t *pEntry)
+{
+    uint32_t idx, probe;
+    rtk_l2_entry_t *pSlot;
 
-    method = LUTREADMETHOD_MAC;
-    retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
-    if (RT_ERR_OK == retVal)
+    idx = l2IndexHash(pEntry);
+    for (probe = 0; probe < RTL8367_L2_INDEX_SIZE; probe++)
     {
-        memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
-        l2Table.ivl_svl = pMcastAddr->ivl;
-
-        if (pMcastAddr->ivl)
-            l2Table.cvid_fid = pMcastAddr->vid;
-        else
-            l2Table.cvid_fid = pMcastAddr->fid;
+        if (!(l2IndexUsed[idx >> 3] & (1 << (idx & 7))))
+            return idx;
 
-        l2Table.mbr = pmask;
-        l2Table.nosalearn = 1;
-        l2Table.l3lookup = 0;
-        l2Table.lut_pri = pMcastAddr->priority;
-        l2Table.fwd_en = pMcastAddr->fwd_pri_en;
-        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
-            return retVal;
+        pSlot = &l2Index[idx];
+        if ((pSlot->cvid_fid == pEntry->cvid_fid) &&
+            ((pSlot->flags & RTK_L2_ENTRY_IVL) == (pEntry->flags & RTK_L2_ENTRY_IVL)) &&
+            (memcmp(pSlot->mac.octet, pEntry->mac.octet, ETHER_ADDR_LEN) == 0))
+            return idx;
 
-        pMcastAddr->address = l2Table.address;
-        return RT_ERR_OK;
+        idx = (idx + 1) & (RTL8367_L2_INDEX_SIZE - 1);
     }
-    else if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
-    {
-        memset(&l2Table, 0, sizeof(rtl8367c_luttb));
-        memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
-        l2Table.ivl_svl = pMcastAddr->ivl;
-        if (pMcastAddr->ivl)
-            l2Table.cvid_fid = pMcastAddr->vid;
-        else
-            l2Table.cvid_fid = pMcastAddr->fid;
-
-        l2Table.mbr = pmask;
-        l2Table.nosalearn = 1;
-        l2Table.l3lookup = 0;
-        l2Table.lut_pri = pMcastAddr->priority;
-        l2Table.fwd_en = pMcastAddr->fwd_pri_en;
-        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
-            return retVal;
 
-        pMcastAddr->address = l2Table.address;
-
-        method = LUTREADMETHOD_MAC;
-        retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
-        if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
-            return RT_ERR_L2_INDEXTBL_FULL;
-        else
-            return retVal;
-    }
-    else
-        return retVal;
+    return RTL8367_L2_INDEX_SIZE;
 }
 
-int32_t rtl8367::rtk_l2_mcastAddr_del(rtk_l2_mcastAddr_t *pMcastAddr)
+void rtl8367::l2IndexPut(const rtk_l2_entry_t *pEntry)
 {
-    int32_t retVal;
-    uint32_t method;
-    rtl8367c_luttb l2Table;
-
-    if (NULL == pMcastAddr)
-        return RT_ERR_NULL_POINTER;
-
-    /* must be L2 multicast address */
-    if ((pMcastAddr->mac.octet[0] & 0x01) != 0x01)
-        return RT_ERR_MAC;
+    uint32_t idx;
 
-    if (pMcastAddr->ivl == 1)
+    idx = l2IndexFind(pEntry);
+    /* keep one slot free so a probe run always ends */
+    if ((idx == RTL8367_L2_INDEX_SIZE) ||
+        (!(l2IndexUsed[idx >> 3] & (1 << (idx & 7))) && (l2IndexNum >= RTL8367_L2_INDEX_SIZE - 1)))
     {
-        if (pMcastAddr->vid > RTL8367C_VIDMAX)
-            return RT_ERR_L2_VID;
+        l2IndexOverflows++;
+        return;
     }
-    else if (pMcastAddr->ivl == 0)
+
+    if (!(l2IndexUsed[idx >> 3] & (1 << (idx & 7))))
     {
-        if (pMcastAddr->fid > RTL8367C_FIDMAX)
-            return RT_ERR_L2_FID;
+        l2IndexUsed[idx >> 3] |= (1 << (idx & 7));
+        l2IndexNum++;
     }
-    else
-        return RT_ERR_INPUT;
 
-    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+    l2Index[idx] = *pEntry;
+}
 
-    /* fill key (MAC,FID) to get L2 entry */
-    memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
-    l2Table.ivl_svl = pMcastAddr->ivl;
+void rtl8367::l2IndexDrop(const rtk_l2_entry_t *pEntry)
+{
+    uint32_t idx, next, home;
 
-    if (pMcastAddr->ivl)
-        l2Table.cvid_fid = pMcastAddr->vid;
-    else
-        l2Table.cvid_fid = pMcastAddr->fid;
+    idx = l2IndexFind(pEntry);
+    if ((idx == RTL8367_L2_INDEX_SIZE) || !(l2IndexUsed[idx >> 3] & (1 << (idx & 7))))
+        return;
 
-    method = LUTREADMETHOD_MAC;
-    retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
-    if (RT_ERR_OK == retVal)
+    /* pull back the entries of the run that would no longer be reachable */
+    next = idx;
+    while (1)
     {
-        memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
-        l2Table.ivl_svl = pMcastAddr->ivl;
+        next = (next + 1) & (RTL8367_L2_INDEX_SIZE - 1);
+        if (!(l2IndexUsed[next >> 3] & (1 << (next & 7))))
+            break;
 
-        if (pMcastAddr->ivl)
-            l2Table.cvid_fid = pMcastAddr->vid;
-        else
-            l2Table.cvid_fid = pMcastAddr->fid;
+        home = l2IndexHash(&l2Index[next]);
+        if (((next - home) & (RTL8367_L2_INDEX_SIZE - 1)) >= ((next - idx) & (RTL8367_L2_INDEX_SIZE - 1)))
+        {
+            l2Index[idx] = l2Index[next];
+            idx = next;
+        }
+    }
 
-        l2Table.mbr = 0;
-        l2Table.nosalearn = 0;
-        l2Table.sa_block = 0;
-        l2Table.l3lookup = 0;
-        l2Table.lut_pri = 0;
-        l2Table.fwd_en = 0;
-        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
-            return retVal;
+    l2IndexUsed[idx >> 3] &= ~(1 << (idx & 7));
+    l2IndexNum--;
+}
 
-        pMcastAddr->address = l2Table.address;
-        return RT_ERR_OK;
+void rtl8367::l2IndexClear()
+{
+    memset(l2IndexUsed, 0, sizeof(l2IndexUsed));
+    l2IndexNum = 0;
+    l2IndexOverflows = 0;
+    l2IndexValid = 0;
+}
+
+/* drop the entries a flush of pConfig on the physical ports of portmask removes */
+void rtl8367::l2IndexFlush(const rtk_l2_flushCfg_t *pConfig, uint32_t portmask)
+{
+    uint32_t idx, phyPort;
+    rtk_l2_entry_t entry;
+
+    idx = 0;
+    while (idx < RTL8367_L2_INDEX_SIZE)
+    {
+        entry = l2Index[idx];
+        phyPort = rtk_switch_port_L2P_get((rtk_port_t)entry.port);
+        if (!(l2IndexUsed[idx >> 3] & (1 << (idx & 7))) ||
+            (phyPort > RTL8367C_PORTIDMAX) || !(portmask & (1 << phyPort)) ||
+            ((entry.flags & RTK_L2_ENTRY_STATIC) && (pConfig->flushStaticAddr != ENABLED)) ||
+            ((pConfig->flushByVid == ENABLED) && (!(entry.flags & RTK_L2_ENTRY_IVL) || (entry.cvid_fid != pConfig->vid))) ||
+            ((pConfig->flushByVid != ENABLED) && (pConfig->flushByFid == ENABLED) &&
+             ((entry.flags & RTK_L2_ENTRY_IVL) || ((entry.cvid_fid & 0x000F) != pConfig->fid))))
+        {
+            idx++;
+            continue;
+        }
+
+        /* the drop may pull a later entry into idx, look at it again */
+        l2IndexDrop(&entry);
     }
-    else
-        return retVal;
 }
 
-int32_t rtl8367::rtk_l2_mcastAddr_get(rtk_l2_mcastAddr_t *pMcastAddr)
+/* Function Name:
+ *      rtk_l2_index_get
+ * Description:
+ *      Look up a unicast L2 entry in the host side MAC index
+ * Input:
+ *      pMac        - 6 bytes unicast(I/G bit is 0) mac address
+ *      ivl         - 1 for an IVL entry, 0 for SVL
+ *      cvid_fid    - VID of an IVL entry, FID | EFID << 4 of an SVL one
+ * Output:
+ *      pEntry      - the entry, as rtk_l2_table_dump reports it
+ * Return:
+ *      RT_ERR_OK                   - OK
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_MAC                  - Invalid MAC address
+ *      RT_ERR_NULL_POINTER         - Input parameter may be null pointer
+ *      RT_ERR_L2_ENTRY_NOTFOUND    - No such LUT entry
+ * Note:
+ *      Served from RAM, the chip is only asked when the key is missing and
+ *      the index has overflowed or does not cover the LUT yet, i.e. before
+ *      the first reset(), rtk_l2_table_clear() or rtk_l2_index_rebuild().
+ *      Entries the switch learns or ages out by itself afterwards show up
+ *      after rtk_l2_index_rebuild().
+ */
+int32_t rtl8367::rtk_l2_index_get(rtk_mac_t *pMac, uint32_t ivl, uint32_t cvid_fid, rtk_l2_entry_t *pEntry)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t method;
+    uint32_t idx;
     rtl8367c_luttb l2Table;
 
-    if (NULL == pMcastAddr)
+    /* must be unicast address */
+    if ((pMac == NULL) || (pMac->octet[0] & 0x1))
+        return RT_ERR_MAC;
+
+    if (pEntry == NULL)
         return RT_ERR_NULL_POINTER;
 
-    /* must be L2 multicast address */
-    if ((pMcastAddr->mac.octet[0] & 0x01) != 0x01)
-        return RT_ERR_MAC;
+    memcpy(pEntry->mac.octet, pMac->octet, ETHER_ADDR_LEN);
+    pEntry->cvid_fid = cvid_fid;
+    pEntry->flags = ivl ? RTK_L2_ENTRY_IVL : 0;
 
-    if (pMcastAddr->ivl == 1)
-    {
-        if (pMcastAddr->vid > RTL8367C_VIDMAX)
-            return RT_ERR_L2_VID;
-    }
-    else if (pMcastAddr->ivl == 0)
+    idx = l2IndexFind(pEntry);
+    if ((idx != RTL8367_L2_INDEX_SIZE) && (l2IndexUsed[idx >> 3] & (1 << (idx & 7))))
     {
-        if (pMcastAddr->fid > RTL8367C_FIDMAX)
-            return RT_ERR_L2_FID;
+        *pEntry = l2Index[idx];
+        return RT_ERR_OK;
     }
-    else
-        return RT_ERR_INPUT;
-
-    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
-    memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
-    l2Table.ivl_svl = pMcastAddr->ivl;
-
-    if (pMcastAddr->ivl)
-        l2Table.cvid_fid = pMcastAddr->vid;
-    else
-        l2Table.cvid_fid = pMcastAddr->fid;
 
-    method = LUTREADMETHOD_MAC;
+    if ((l2IndexOverflows == 0) && l2IndexValid)
+        return RT_ERR_L2_ENTRY_NOTFOUND;
 
-    if ((retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table)) != RT_ERR_OK)
+    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+    memcpy(l2Table.mac.octet, pMac->octet, ETHER_ADDR_LEN);
+    l2Table.ivl_svl = ivl ? 1 : 0;
+    l2Table.cvid_fid = cvid_fid;
+    l2Table.fid = cvid_fid & 0x000F;
+    l2Table.efid = (cvid_fid >> 4) & 0x0007;
+    if ((retVal = rtl8367c_getAsicL2LookupTb(LUTREADMETHOD_MAC, &l2Table)) != RT_ERR_OK)
         return retVal;
 
-    pMcastAddr->priority = l2Table.lut_pri;
-    pMcastAddr->fwd_pri_en = l2Table.fwd_en;
-    pMcastAddr->igmp_asic = l2Table.igmp_asic;
-    pMcastAddr->igmp_index = l2Table.igmpidx;
-    pMcastAddr->address = l2Table.address;
-
-    /* Get Logical port mask */
-    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pMcastAddr->portmask)) != RT_ERR_OK)
-        return retVal;
+    _rtl8367c_fdbStUser2Entry(&l2Table, pEntry);
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_l2_mcastAddr_next_get(uint32_t *pAddress, rtk_l2_mcastAddr_t *pMcastAddr)
+/* Function Name:
+ *      rtk_l2_index_rebuild
+ * Description:
+ *      Reload the host side MAC index from the LUT
+ * Input:
+ *      None
+ * Output:
+ *      pNum        - number of entries indexed, may be NULL
+ * Return:
+ *      RT_ERR_OK                   - OK
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_L2_INDEXTBL_FULL     - RTL8367_L2_INDEX_SIZE too small for the table
+ *      RT_ERR_BUSYWAIT_TIMEOUT     - LUT is busy at retrieving
+ * Note:
+ *      Drops the current content and dumps all unicast entries, picking up
+ *      what the switch learned or aged out since the last rebuild.
+ */
+int32_t rtl8367::rtk_l2_index_rebuild(uint32_t *pNum)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    rtl8367c_luttb l2Table;
+    uint32_t address, num;
+    rtk_l2_entry_t entries[16];
 
-    /* Error Checking */
-    if ((pAddress == NULL) || (pMcastAddr == NULL))
-        return RT_ERR_INPUT;
-
-    if (*pAddress > halCtrl.max_lut_addr_num - 1)
-        return RT_ERR_L2_L2UNI_PARAM;
+    l2IndexClear();
 
-    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
-    l2Table.address = *pAddress;
+    address = 0;
+    while (address < halCtrl.max_lut_addr_num)
+    {
+        if ((retVal = rtk_l2_table_dump(&address, entries, sizeof(entries) / sizeof(entries[0]), &num)) != RT_ERR_OK)
+            return retVal;
+    }
+    l2IndexValid = 1;
 
-    if ((retVal = rtl8367c_getAsicL2LookupTb(LUTREADMETHOD_NEXT_L2MC, &l2Table)) != RT_ERR_OK)
-        return retVal;
+    if (pNum != NULL)
+        *pNum = l2IndexNum;
 
-    if (l2Table.address < *pAddress)
-        return RT_ERR_L2_ENTRY_NOTFOUND;
+    return (l2IndexOverflows == 0) ? RT_ERR_OK : RT_ERR_L2_INDEXTBL_FULL;
+}
+#endif
 
-    memcpy(pMcastAddr->mac.octet, l2Table.mac.octet, ETHER_ADDR_LEN);
-    pMcastAddr->ivl = l2Table.ivl_svl;
+/* Function Name:
+ *      rtl8367c_setAsicLutFlushFilter
+ * Description:
+ *      Set the entries the next forced flush removes
+ * Input:
+ *      mode    - FLUSHMDOE_PORT, FLUSHMDOE_VID or FLUSHMDOE_FID
+ *      type    - FLUSHTYPE_DYNAMIC or FLUSHTYPE_BOTH (static entries too)
+ *      vidFid  - VID of FLUSHMDOE_VID or FID of FLUSHMDOE_FID, unused by FLUSHMDOE_PORT
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_INPUT    - Invalid input parameter
+ *      RT_ERR_VLAN_VID - Invalid VID
+ *      RT_ERR_L2_FID   - Invalid FID
+ * Note:
+ *      L2_FLUSH_CTRL1 and L2_FLUSH_CTRL2 hold nothing but these fields, so
+ *      they are written without reading them first.
+ */
+int32_t rtl8367::rtl8367c_setAsicLutFlushFilter(uint32_t mode, uint32_t type, uint32_t vidFid)
+{
+    int32_t retVal;
 
-    if (pMcastAddr->ivl)
-        pMcastAddr->vid = l2Table.cvid_fid;
-    else
-        pMcastAddr->fid = l2Table.cvid_fid;
+    if ((mode >= FLUSHMDOE_END) || (type >= FLUSHTYPE_END))
+        return RT_ERR_INPUT;
 
-    pMcastAddr->priority = l2Table.lut_pri;
-    pMcastAddr->fwd_pri_en = l2Table.fwd_en;
-    pMcastAddr->igmp_asic = l2Table.igmp_asic;
-    pMcastAddr->igmp_index = l2Table.igmpidx;
-    pMcastAddr->address = l2Table.address;
+    if (mode == FLUSHMDOE_VID)
+    {
+        if (vidFid > RTL8367C_VIDMAX)
+            return RT_ERR_VLAN_VID;
 
-    /* Get Logical port mask */
-    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pMcastAddr->portmask)) != RT_ERR_OK)
-        return retVal;
+        retVal = rtl8367c_setAsicReg(RTL8367C_REG_L2_FLUSH_CTRL1, (vidFid << RTL8367C_LUT_FLUSH_VID_OFFSET) & RTL8367C_LUT_FLUSH_VID_MASK);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+    else if (mode == FLUSHMDOE_FID)
+    {
+        if (vidFid > RTL8367C_FIDMAX)
+            return RT_ERR_L2_FID;
 
-    *pAddress = l2Table.address;
+        retVal = rtl8367c_setAsicReg(RTL8367C_REG_L2_FLUSH_CTRL1, (vidFid << RTL8367C_LUT_FLUSH_FID_OFFSET) & RTL8367C_LUT_FLUSH_FID_MASK);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
 
-    return RT_ERR_OK;
+    return rtl8367c_setAsicReg(RTL8367C_REG_L2_FLUSH_CTRL2, (type << RTL8367C_LUT_FLUSH_TYPE_OFFSET) | (mode << RTL8367C_LUT_FLUSH_MODE_OFFSET));
 }
 
-int32_t rtl8367::rtk_l2_ipMcastAddr_add(rtk_l2_ipMcastAddr_t *pIpMcastAddr)
+/* Function Name:
+ *      rtl8367c_setAsicLutForceFlush
+ * Description:
+ *      Start flushing the LUT entries of ports
+ * Input:
+ *      portmask    - Physical port mask (0~0x7FF)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_MASK    - Invalid portmask
+ * Note:
+ *      Entries are selected by rtl8367c_setAsicLutFlushFilter. The upper
+ *      bits of both registers are read only busy flags, ports 8~10 are
+ *      only written when set.
+ */
+int32_t rtl8367::rtl8367c_setAsicLutForceFlush(uint32_t portmask)
 {
     int32_t retVal;
-    uint32_t method;
-    rtl8367c_luttb l2Table;
-    uint32_t pmask;
 
-    if (NULL == pIpMcastAddr)
-        return RT_ERR_NULL_POINTER;
+    if (portmask > RTL8367C_PORTMASK)
+        return RT_ERR_PORT_MASK;
 
-    /* check port mask */
-    RTK_CHK_PORTMASK_VALID(&pIpMcastAddr->portmask);
+    if (portmask >> 8)
+    {
+        retVal = rtl8367c_setAsicReg(RTL8367C_REG_FORCE_FLUSH1, (portmask >> 8) & RTL8367C_PORTMASK1_MASK);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
 
-    if ((pIpMcastAddr->dip & 0xF0000000) != 0xE0000000)
-        return RT_ERR_INPUT;
-
-    if (pIpMcastAddr->fwd_pri_en >= RTK_ENABLE_END)
-        return RT_ERR_ENABLE;
+    return rtl8367c_setAsicReg(RTL8367C_FORCE_FLUSH_REG, portmask & RTL8367C_FORCE_FLUSH_PORTMASK_MASK);
+}
 
-    if (pIpMcastAddr->priority > RTL8367C_PRIMAX)
-        return RT_ERR_INPUT;
+/* Function Name:
+ *      rtl8367c_getAsicLutForceFlushStatus
+ * Description:
+ *      Get the ports whose forced flush is still running
+ * Input:
+ *      portmask    - Physical ports of interest (0~0x7FF)
+ * Output:
+ *      pBusy       - Physical port mask of the busy ones among portmask
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_MASK    - Invalid portmask
+ * Note:
+ *      Reads FORCE_FLUSH1 only when portmask has one of the ports 8~10.
+ */
+int32_t rtl8367::rtl8367c_getAsicLutForceFlushStatus(uint32_t portmask, uint32_t *pBusy)
+{
+    int32_t retVal;
+    uint32_t regData;
 
-    /* Get Physical port mask */
-    if ((retVal = rtk_switch_portmask_L2P_get(&pIpMcastAddr->portmask, &pmask)) != RT_ERR_OK)
-        return retVal;
+    if (portmask > RTL8367C_PORTMASK)
+        return RT_ERR_PORT_MASK;
 
-    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
-    l2Table.sip = pIpMcastAddr->sip;
-    l2Table.dip = pIpMcastAddr->dip;
-    l2Table.l3lookup = 1;
-    l2Table.l3vidlookup = 0;
-    method = LUTREADMETHOD_MAC;
-    retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
-    if (RT_ERR_OK == retVal)
+    *pBusy = 0;
+    if (portmask & 0xFF)
     {
-        l2Table.sip = pIpMcastAddr->sip;
-        l2Table.dip = pIpMcastAddr->dip;
-        l2Table.mbr = pmask;
-        l2Table.nosalearn = 1;
-        l2Table.l3lookup = 1;
-        l2Table.l3vidlookup = 0;
-        l2Table.lut_pri = pIpMcastAddr->priority;
-        l2Table.fwd_en = pIpMcastAddr->fwd_pri_en;
-        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
+        retVal = rtl8367c_getAsicReg(RTL8367C_FORCE_FLUSH_REG, &regData);
+        if (retVal != RT_ERR_OK)
             return retVal;
 
-        pIpMcastAddr->address = l2Table.address;
-        return RT_ERR_OK;
+        *pBusy |= (regData & RTL8367C_BUSY_STATUS_MASK) >> RTL8367C_BUSY_STATUS_OFFSET;
     }
-    else if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
+
+    if (portmask >> 8)
     {
-        memset(&l2Table, 0, sizeof(rtl8367c_luttb));
-        l2Table.sip = pIpMcastAddr->sip;
-        l2Table.dip = pIpMcastAddr->dip;
-        l2Table.mbr = pmask;
-        l2Table.nosalearn = 1;
-        l2Table.l3lookup = 1;
-        l2Table.l3vidlookup = 0;
-        l2Table.lut_pri = pIpMcastAddr->priority;
-        l2Table.fwd_en = pIpMcastAddr->fwd_pri_en;
-        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_FORCE_FLUSH1, &regData);
+        if (retVal != RT_ERR_OK)
             return retVal;
 
-        pIpMcastAddr->address = l2Table.address;
-
-        method = LUTREADMETHOD_MAC;
-        retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
-        if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
-            return RT_ERR_L2_INDEXTBL_FULL;
-        else
-            return retVal;
+        *pBusy |= ((regData & RTL8367C_BUSY_STATUS1_MASK) >> RTL8367C_BUSY_STATUS1_OFFSET) << 8;
     }
-    else
-        return retVal;
+
+    *pBusy &= portmask;
+
+    return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_l2_ipMcastAddr_del(rtk_l2_ipMcastAddr_t *pIpMcastAddr)
+/* Function Name:
+ *      rtl8367c_setAsicLutFlushAll
+ * Description:
+ *      Start flushing every LUT entry
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      The bit clears itself once the flush is done.
+ */
+int32_t rtl8367::rtl8367c_setAsicLutFlushAll()
 {
-    int32_t retVal;
-    uint32_t method;
-    rtl8367c_luttb l2Table;
-
-    /* Error Checking */
-    if (pIpMcastAddr == NULL)
-        return RT_ERR_INPUT;
+    return rtl8367c_setAsicReg(RTL8367C_REG_L2_FLUSH_CTRL3, RTL8367C_L2_FLUSH_CTRL3_MASK);
+}
 
-    if ((pIpMcastAddr->dip & 0xF0000000) != 0xE0000000)
-        return RT_ERR_INPUT;
+/* Function Name:
+ *      rtl8367c_getAsicLutFlushAllStatus
+ * Description:
+ *      Get the state of a flush started by rtl8367c_setAsicLutFlushAll
+ * Input:
+ *      None
+ * Output:
+ *      pBusyStatus - 1: busy, 0: done
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicLutFlushAllStatus(uint32_t *pBusyStatus)
+{
+    return rtl8367c_getAsicRegBit(RTL8367C_REG_L2_FLUSH_CTRL3, RTL8367C_L2_FLUSH_CTRL3_OFFSET, pBusyStatus);
+}
 
-    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
-    l2Table.sip = pIpMcastAddr->sip;
-    l2Table.dip = pIpMcastAddr->dip;
-    l2Table.l3lookup = 1;
-    l2Table.l3vidlookup = 0;
-    method = LUTREADMETHOD_MAC;
-    retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
-    if (RT_ERR_OK == retVal)
-    {
-        l2Table.sip = pIpMcastAddr->sip;
-        l2Table.dip = pIpMcastAddr->dip;
-        l2Table.mbr = 0;
-        l2Table.nosalearn = 0;
-        l2Table.l3lookup = 1;
-        l2Table.l3vidlookup = 0;
-        l2Table.lut_pri = 0;
-        l2Table.fwd_en = 0;
-        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
-            return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicLutLinkDownForceAging
+ * Description:
+ *      Set the LUT entries of a port to age out when its link goes down
+ * Input:
+ *      enable  - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_ENABLE   - Invalid enable input
+ * Note:
+ *      The LINKDOWN_AGEOUT bit disables the function, it is written inverted.
+ */
+int32_t rtl8367::rtl8367c_setAsicLutLinkDownForceAging(uint32_t enable)
+{
+    if (enable > 1)
+        return RT_ERR_ENABLE;
 
-        pIpMcastAddr->address = l2Table.address;
-        return RT_ERR_OK;
-    }
-    else
-        return retVal;
+    return rtl8367c_setAsicRegBit(RTL8367C_LUT_CFG_REG, RTL8367C_LINKDOWN_AGEOUT_OFFSET, enable ? 0 : 1);
 }
 
-int32_t rtl8367::rtk_l2_ipMcastAddr_get(rtk_l2_ipMcastAddr_t *pIpMcastAddr)
+/* Function Name:
+ *      rtl8367c_getAsicLutLinkDownForceAging
+ * Description:
+ *      Get the link down aging setting of the LUT
+ * Input:
+ *      None
+ * Output:
+ *      pEnable - 1: enabled, 0: disabled
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicLutLinkDownForceAging(uint32_t *pEnable)
 {
     int32_t retVal;
-    uint32_t method;
-    rtl8367c_luttb l2Table;
-
-    if (NULL == pIpMcastAddr)
-        return RT_ERR_NULL_POINTER;
-
-    if ((pIpMcastAddr->dip & 0xF0000000) != 0xE0000000)
-        return RT_ERR_INPUT;
-
-    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
-    l2Table.sip = pIpMcastAddr->sip;
-    l2Table.dip = pIpMcastAddr->dip;
-    l2Table.l3lookup = 1;
-    l2Table.l3vidlookup = 0;
-    method = LUTREADMETHOD_MAC;
-    if ((retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table)) != RT_ERR_OK)
-        return retVal;
+    uint32_t value;
 
-    /* Get Logical port mask */
-    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pIpMcastAddr->portmask)) != RT_ERR_OK)
+    retVal = rtl8367c_getAsicRegBit(RTL8367C_LUT_CFG_REG, RTL8367C_LINKDOWN_AGEOUT_OFFSET, &value);
+    if (retVal != RT_ERR_OK)
         return retVal;
 
-    pIpMcastAddr->priority = l2Table.lut_pri;
-    pIpMcastAddr->fwd_pri_en = l2Table.fwd_en;
-    pIpMcastAddr->igmp_asic = l2Table.igmp_asic;
-    pIpMcastAddr->igmp_index = l2Table.igmpidx;
-    pIpMcastAddr->address = l2Table.address;
+    *pEnable = value ? 0 : 1;
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_l2_ipMcastAddr_next_get(uint32_t *pAddress, rtk_l2_ipMcastAddr_t *pIpMcastAddr)
+/* Function Name:
+ *      rtk_l2_table_clear
+ * Description:
+ *      Flush the whole L2 table
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_BUSYWAIT_TIMEOUT - Flush still running after RTL8367C_LUT_FLUSH_BUSY_CHECK_NO polls
+ * Note:
+ *      One hardware command removes static, dynamic and multicast entries
+ *      alike, then the call polls until the LUT reports it done.
+ */
+int32_t rtl8367::rtk_l2_table_clear()
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    rtl8367c_luttb l2Table;
-
-    /* Error Checking */
-    if ((pAddress == NULL) || (pIpMcastAddr == NULL))
-        return RT_ERR_INPUT;
+    uint32_t busy, busyCounter;
 
-    if (*pAddress > halCtrl.max_lut_addr_num - 1)
-        return RT_ERR_L2_L2UNI_PARAM;
+    if ((retVal = rtl8367c_setAsicLutFlushAll()) != RT_ERR_OK)
+        return retVal;
 
-    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
-    l2Table.address = *pAddress;
+#ifdef RTL8367_L2_INDEX
+    l2IndexClear();
+    l2IndexValid = 1;
+#endif
 
-    do
+    for (busyCounter = RTL8367C_LUT_FLUSH_BUSY_CHECK_NO; busyCounter > 0; busyCounter--)
     {
-        if ((retVal = rtl8367c_getAsicL2LookupTb(LUTREADMETHOD_NEXT_L3MC, &l2Table)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_getAsicLutFlushAllStatus(&busy)) != RT_ERR_OK)
             return retVal;
 
-        if (l2Table.address < *pAddress)
-            return RT_ERR_L2_ENTRY_NOTFOUND;
-
-    } while (l2Table.l3vidlookup == 1);
-
-    pIpMcastAddr->sip = l2Table.sip;
-    pIpMcastAddr->dip = l2Table.dip;
-
-    /* Get Logical port mask */
-    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pIpMcastAddr->portmask)) != RT_ERR_OK)
-        return retVal;
-
-    pIpMcastAddr->priority = l2Table.lut_pri;
-    pIpMcastAddr->fwd_pri_en = l2Table.fwd_en;
-    pIpMcastAddr->igmp_asic = l2Table.igmp_asic;
-    pIpMcastAddr->igmp_index = l2Table.igmpidx;
-    pIpMcastAddr->address = l2Table.address;
-    *pAddress = l2Table.address;
+        if (busy == 0)
+            return RT_ERR_OK;
+    }
 
-    return RT_ERR_OK;
+    return RT_ERR_BUSYWAIT_TIMEOUT;
 }
 
-int32_t rtl8367::rtk_l2_ipVidMcastAddr_add(rtk_l2_ipVidMcastAddr_t *pIpVidMcastAddr)
+/* Function Name:
+ *      rtk_l2_ucastAddr_flush
+ * Description:
+ *      Flush L2 unicast entries by port, VID or FID
+ * Input:
+ *      pConfig - flush configuration
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_VLAN_VID         - Invalid VID parameter.
+ *      RT_ERR_L2_FID           - Invalid FID parameter.
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ *      RT_ERR_BUSYWAIT_TIMEOUT - Flush still running after RTL8367C_LUT_FLUSH_BUSY_CHECK_NO polls
+ * Note:
+ *      flushByVid takes precedence over flushByFid, and flushByFid over
+ *      flushByPort. VID and FID flushes cover pConfig->port, or every port
+ *      with flushAddrOnAllPorts. Static entries are only removed with
+ *      flushStaticAddr. The hardware runs the flush in one command of
+ *      three to four register writes, the call returns once it is done.
+ */
+int32_t rtl8367::rtk_l2_ucastAddr_flush(rtk_l2_flushCfg_t *pConfig)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t method;
-    rtl8367c_luttb l2Table;
-    uint32_t pmask;
+    uint32_t mode, vidFid, portmask, busy, busyCounter;
 
-    if (NULL == pIpVidMcastAddr)
+    if (pConfig == NULL)
         return RT_ERR_NULL_POINTER;
 
-    /* check port mask */
-    RTK_CHK_PORTMASK_VALID(&pIpVidMcastAddr->portmask);
+    if ((pConfig->flushByVid >= RTK_ENABLE_END) || (pConfig->flushByFid >= RTK_ENABLE_END) ||
+        (pConfig->flushByPort >= RTK_ENABLE_END) || (pConfig->flushStaticAddr >= RTK_ENABLE_END) ||
+        (pConfig->flushAddrOnAllPorts >= RTK_ENABLE_END))
+        return RT_ERR_ENABLE;
 
-    if (pIpVidMcastAddr->vid > RTL8367C_VIDMAX)
-        return RT_ERR_L2_VID;
+    if (pConfig->flushByVid == ENABLED)
+    {
+        mode = FLUSHMDOE_VID;
+        vidFid = pConfig->vid;
+    }
+    else if (pConfig->flushByFid == ENABLED)
+    {
+        mode = FLUSHMDOE_FID;
+        vidFid = pConfig->fid;
+    }
+    else if (pConfig->flushByPort == ENABLED)
+    {
+        mode = FLUSHMDOE_PORT;
+        vidFid = 0;
+    }
+    else
+        return RT_ERR_INPUT;
 
-    if ((pIpVidMcastAddr->dip & 0xF0000000) != 0xE0000000)
+    if ((mode != FLUSHMDOE_PORT) && (pConfig->flushAddrOnAllPorts == ENABLED))
+        portmask = halCtrl.phy_portmask;
+    else
+    {
+        /* Check Port Valid */
+        RTK_CHK_PORT_VALID(pConfig->port);
+        portmask = 1 << rtk_switch_port_L2P_get(pConfig->port);
+    }
+
+    if ((retVal = rtl8367c_setAsicLutFlushFilter(mode, (pConfig->flushStaticAddr == ENABLED) ? FLUSHTYPE_BOTH : FLUSHTYPE_DYNAMIC, vidFid)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicLutForceFlush(portmask)) != RT_ERR_OK)
+        return retVal;
+
+#ifdef RTL8367_L2_INDEX
+    l2IndexFlush(pConfig, portmask);
+#endif
+
+    for (busyCounter = RTL8367C_LUT_FLUSH_BUSY_CHECK_NO; busyCounter > 0; busyCounter--)
+    {
+        if ((retVal = rtl8367c_getAsicLutForceFlushStatus(portmask, &busy)) != RT_ERR_OK)
+            return retVal;
+
+        if (busy == 0)
+            return RT_ERR_OK;
+    }
+
+    return RT_ERR_BUSYWAIT_TIMEOUT;
+}
+
+/* Function Name:
+ *      rtk_l2_flushLinkDownPortAddrEnable_set
+ * Description:
+ *      Set HW flush linkdown port mac configuration of the specified port.
+ * Input:
+ *      port    - Port id, must be RTK_WHOLE_SYSTEM
+ *      enable  - link down flush status
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - OK
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number.
+ *      RT_ERR_ENABLE   - Invalid enable input.
+ * Note:
+ *      When enabled, the switch ages out the dynamic entries of a port as
+ *      soon as its link goes down, without any SMI traffic. The setting is
+ *      global. Like normal aging, this bypasses the host side MAC index
+ *      until rtk_l2_index_rebuild().
+ */
+int32_t rtl8367::rtk_l2_flushLinkDownPortAddrEnable_set(uint32_t port, rtk_enable_t enable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if (port != RTK_WHOLE_SYSTEM)
+        return RT_ERR_PORT_ID;
+
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
+
+    if ((retVal = rtl8367c_setAsicLutLinkDownForceAging(enable)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_flushLinkDownPortAddrEnable_get
+ * Description:
+ *      Get HW flush linkdown port mac configuration of the specified port.
+ * Input:
+ *      port    - Port id, must be RTK_WHOLE_SYSTEM
+ * Output:
+ *      pEnable - link down flush status
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number.
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_l2_flushLinkDownPortAddrEnable_get(uint32_t port, rtk_enable_t *pEnable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if (port != RTK_WHOLE_SYSTEM)
+        return RT_ERR_PORT_ID;
+
+    if (NULL == pEnable)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicLutLinkDownForceAging((uint32_t *)pEnable)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_l2_mcastAddr_add(rtk_l2_mcastAddr_t *pMcastAddr)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t method;
+    rtl8367c_luttb l2Table;
+    uint32_t pmask;
+
+    if (NULL == pMcastAddr)
+        return RT_ERR_NULL_POINTER;
+
+    /* must be L2 multicast address */
+    if ((pMcastAddr->mac.octet[0] & 0x01) != 0x01)
+        return RT_ERR_MAC;
+
+    RTK_CHK_PORTMASK_VALID(&pMcastAddr->portmask);
+
+    if (pMcastAddr->ivl == 1)
+    {
+        if (pMcastAddr->vid > RTL8367C_VIDMAX)
+            return RT_ERR_L2_VID;
+    }
+    else if (pMcastAddr->ivl == 0)
+    {
+        if (pMcastAddr->fid > RTL8367C_FIDMAX)
+            return RT_ERR_L2_FID;
+    }
+    else
         return RT_ERR_INPUT;
 
-    /* Get Physical port mask */
-    if ((retVal = rtk_switch_portmask_L2P_get(&pIpVidMcastAddr->portmask, &pmask)) != RT_ERR_OK)
+    if (pMcastAddr->fwd_pri_en >= RTK_ENABLE_END)
+        return RT_ERR_INPUT;
+
+    if (pMcastAddr->priority > RTL8367C_PRIMAX)
+        return RT_ERR_INPUT;
+
+    /* Get physical port mask */
+    if ((retVal = rtk_switch_portmask_L2P_get(&pMcastAddr->portmask, &pmask)) != RT_ERR_OK)
         return retVal;
 
-    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
-    l2Table.sip = pIpVidMcastAddr->sip;
-    l2Table.dip = pIpVidMcastAddr->dip;
-    l2Table.l3lookup = 1;
-    l2Table.l3vidlookup = 1;
-    l2Table.l3_vid = pIpVidMcastAddr->vid;
+    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+
+    /* fill key (MAC,FID) to get L2 entry */
+    memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
+    l2Table.ivl_svl = pMcastAddr->ivl;
+
+    if (pMcastAddr->ivl)
+        l2Table.cvid_fid = pMcastAddr->vid;
+    else
+        l2Table.cvid_fid = pMcastAddr->fid;
+
     method = LUTREADMETHOD_MAC;
     retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
     if (RT_ERR_OK == retVal)
     {
-        l2Table.sip = pIpVidMcastAddr->sip;
-        l2Table.dip = pIpVidMcastAddr->dip;
+        memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
+        l2Table.ivl_svl = pMcastAddr->ivl;
+
+        if (pMcastAddr->ivl)
+            l2Table.cvid_fid = pMcastAddr->vid;
+        else
+            l2Table.cvid_fid = pMcastAddr->fid;
+
         l2Table.mbr = pmask;
         l2Table.nosalearn = 1;
-        l2Table.l3lookup = 1;
-        l2Table.l3vidlookup = 1;
-        l2Table.l3_vid = pIpVidMcastAddr->vid;
+        l2Table.l3lookup = 0;
+        l2Table.lut_pri = pMcastAddr->priority;
+        l2Table.fwd_en = pMcastAddr->fwd_pri_en;
         if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
             return retVal;
 
-        pIpVidMcastAddr->address = l2Table.address;
+        pMcastAddr->address = l2Table.address;
         return RT_ERR_OK;
     }
     else if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
     {
         memset(&l2Table, 0, sizeof(rtl8367c_luttb));
-        l2Table.sip = pIpVidMcastAddr->sip;
-        l2Table.dip = pIpVidMcastAddr->dip;
+        memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
+        l2Table.ivl_svl = pMcastAddr->ivl;
+        if (pMcastAddr->ivl)
+            l2Table.cvid_fid = pMcastAddr->vid;
+        else
+            l2Table.cvid_fid = pMcastAddr->fid;
+
         l2Table.mbr = pmask;
         l2Table.nosalearn = 1;
-        l2Table.l3lookup = 1;
-        l2Table.l3vidlookup = 1;
-        l2Table.l3_vid = pIpVidMcastAddr->vid;
+        l2Table.l3lookup = 0;
+        l2Table.lut_pri = pMcastAddr->priority;
+        l2Table.fwd_en = pMcastAddr->fwd_pri_en;
         if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
             return retVal;
 
-        pIpVidMcastAddr->address = l2Table.address;
+        pMcastAddr->address = l2Table.address;
 
         method = LUTREADMETHOD_MAC;
         retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
@@ -4067,89 +5404,134 @@ int32_t rtl8367::rtk_l2_ipVidMcastAddr_add(rtk_l2_ipVidMcastAddr_t *pIpVidMcastA
         return retVal;
 }
 
-int32_t rtl8367::rtk_l2_ipVidMcastAddr_del(rtk_l2_ipVidMcastAddr_t *pIpVidMcastAddr)
+int32_t rtl8367::rtk_l2_mcastAddr_del(rtk_l2_mcastAddr_t *pMcastAddr)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t method;
     rtl8367c_luttb l2Table;
 
-    if (NULL == pIpVidMcastAddr)
+    if (NULL == pMcastAddr)
         return RT_ERR_NULL_POINTER;
 
-    if (pIpVidMcastAddr->vid > RTL8367C_VIDMAX)
-        return RT_ERR_L2_VID;
+    /* must be L2 multicast address */
+    if ((pMcastAddr->mac.octet[0] & 0x01) != 0x01)
+        return RT_ERR_MAC;
 
-    if ((pIpVidMcastAddr->dip & 0xF0000000) != 0xE0000000)
+    if (pMcastAddr->ivl == 1)
+    {
+        if (pMcastAddr->vid > RTL8367C_VIDMAX)
+            return RT_ERR_L2_VID;
+    }
+    else if (pMcastAddr->ivl == 0)
+    {
+        if (pMcastAddr->fid > RTL8367C_FIDMAX)
+            return RT_ERR_L2_FID;
+    }
+    else
         return RT_ERR_INPUT;
 
-    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
-    l2Table.sip = pIpVidMcastAddr->sip;
-    l2Table.dip = pIpVidMcastAddr->dip;
-    l2Table.l3lookup = 1;
-    l2Table.l3vidlookup = 1;
-    l2Table.l3_vid = pIpVidMcastAddr->vid;
+    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+
+    /* fill key (MAC,FID) to get L2 entry */
+    memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
+    l2Table.ivl_svl = pMcastAddr->ivl;
+
+    if (pMcastAddr->ivl)
+        l2Table.cvid_fid = pMcastAddr->vid;
+    else
+        l2Table.cvid_fid = pMcastAddr->fid;
+
     method = LUTREADMETHOD_MAC;
     retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
     if (RT_ERR_OK == retVal)
     {
-        l2Table.sip = pIpVidMcastAddr->sip;
-        l2Table.dip = pIpVidMcastAddr->dip;
+        memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
+        l2Table.ivl_svl = pMcastAddr->ivl;
+
+        if (pMcastAddr->ivl)
+            l2Table.cvid_fid = pMcastAddr->vid;
+        else
+            l2Table.cvid_fid = pMcastAddr->fid;
+
         l2Table.mbr = 0;
         l2Table.nosalearn = 0;
-        l2Table.l3lookup = 1;
-        l2Table.l3vidlookup = 1;
-        l2Table.l3_vid = pIpVidMcastAddr->vid;
+        l2Table.sa_block = 0;
+        l2Table.l3lookup = 0;
+        l2Table.lut_pri = 0;
+        l2Table.fwd_en = 0;
         if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
             return retVal;
 
-        pIpVidMcastAddr->address = l2Table.address;
+        pMcastAddr->address = l2Table.address;
         return RT_ERR_OK;
     }
     else
         return retVal;
 }
 
-int32_t rtl8367::rtk_l2_ipVidMcastAddr_get(rtk_l2_ipVidMcastAddr_t *pIpVidMcastAddr)
+int32_t rtl8367::rtk_l2_mcastAddr_get(rtk_l2_mcastAddr_t *pMcastAddr)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t method;
     rtl8367c_luttb l2Table;
 
-    if (NULL == pIpVidMcastAddr)
+    if (NULL == pMcastAddr)
         return RT_ERR_NULL_POINTER;
 
-    if (pIpVidMcastAddr->vid > RTL8367C_VIDMAX)
-        return RT_ERR_L2_VID;
+    /* must be L2 multicast address */
+    if ((pMcastAddr->mac.octet[0] & 0x01) != 0x01)
+        return RT_ERR_MAC;
 
-    if ((pIpVidMcastAddr->dip & 0xF0000000) != 0xE0000000)
+    if (pMcastAddr->ivl == 1)
+    {
+        if (pMcastAddr->vid > RTL8367C_VIDMAX)
+            return RT_ERR_L2_VID;
+    }
+    else if (pMcastAddr->ivl == 0)
+    {
+        if (pMcastAddr->fid > RTL8367C_FIDMAX)
+            return RT_ERR_L2_FID;
+    }
+    else
         return RT_ERR_INPUT;
 
-    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
-    l2Table.sip = pIpVidMcastAddr->sip;
-    l2Table.dip = pIpVidMcastAddr->dip;
-    l2Table.l3lookup = 1;
-    l2Table.l3vidlookup = 1;
-    l2Table.l3_vid = pIpVidMcastAddr->vid;
+    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+    memcpy(l2Table.mac.octet, pMcastAddr->mac.octet, ETHER_ADDR_LEN);
+    l2Table.ivl_svl = pMcastAddr->ivl;
+
+    if (pMcastAddr->ivl)
+        l2Table.cvid_fid = pMcastAddr->vid;
+    else
+        l2Table.cvid_fid = pMcastAddr->fid;
+
     method = LUTREADMETHOD_MAC;
+
     if ((retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table)) != RT_ERR_OK)
         return retVal;
 
-    pIpVidMcastAddr->address = l2Table.address;
+    pMcastAddr->priority = l2Table.lut_pri;
+    pMcastAddr->fwd_pri_en = l2Table.fwd_en;
+    pMcastAddr->igmp_asic = l2Table.igmp_asic;
+    pMcastAddr->igmp_index = l2Table.igmpidx;
+    pMcastAddr->address = l2Table.address;
 
     /* Get Logical port mask */
-    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pIpVidMcastAddr->portmask)) != RT_ERR_OK)
+    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pMcastAddr->portmask)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_l2_ipVidMcastAddr_next_get(uint32_t *pAddress, rtk_l2_ipVidMcastAddr_t *pIpVidMcastAddr)
+int32_t rtl8367::rtk_l2_mcastAddr_next_get(uint32_t *pAddress, rtk_l2_mcastAddr_t *pMcastAddr)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     rtl8367c_luttb l2Table;
 
     /* Error Checking */
-    if ((pAddress == NULL) || (pIpVidMcastAddr == NULL))
+    if ((pAddress == NULL) || (pMcastAddr == NULL))
         return RT_ERR_INPUT;
 
     if (*pAddress > halCtrl.max_lut_addr_num - 1)
@@ -4158,23 +5540,28 @@ int32_t rtl8367::rtk_l2_ipVidMcastAddr_next_get(uint32_t *pAddress, rtk_l2_ipVid
     memset(&l2Table, 0, sizeof(rtl8367c_luttb));
     l2Table.address = *pAddress;
 
-    do
-    {
-        if ((retVal = rtl8367c_getAsicL2LookupTb(LUTREADMETHOD_NEXT_L3MC, &l2Table)) != RT_ERR_OK)
-            return retVal;
+    if ((retVal = rtl8367c_getAsicL2LookupTb(LUTREADMETHOD_NEXT_L2MC, &l2Table)) != RT_ERR_OK)
+        return retVal;
 
-        if (l2Table.address < *pAddress)
-            return RT_ERR_L2_ENTRY_NOTFOUND;
+    if (l2Table.address < *pAddress)
+        return RT_ERR_L2_ENTRY_NOTFOUND;
 
-    } while (l2Table.l3vidlookup == 0);
+    memcpy(pMcastAddr->mac.octet, l2Table.mac.octet, ETHER_ADDR_LEN);
+    pMcastAddr->ivl = l2Table.ivl_svl;
 
-    pIpVidMcastAddr->sip = l2Table.sip;
-    pIpVidMcastAddr->dip = l2Table.dip;
-    pIpVidMcastAddr->vid = l2Table.l3_vid;
-    pIpVidMcastAddr->address = l2Table.address;
+    if (pMcastAddr->ivl)
+        pMcastAddr->vid = l2Table.cvid_fid;
+    else
+        pMcastAddr->fid = l2Table.cvid_fid;
+
+    pMcastAddr->priority = l2Table.lut_pri;
+    pMcastAddr->fwd_pri_en = l2Table.fwd_en;
+    pMcastAddr->igmp_asic = l2Table.igmp_asic;
+    pMcastAddr->igmp_index = l2Table.igmpidx;
+    pMcastAddr->address = l2Table.address;
 
     /* Get Logical port mask */
-    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pIpVidMcastAddr->portmask)) != RT_ERR_OK)
+    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pMcastAddr->portmask)) != RT_ERR_OK)
         return retVal;
 
     *pAddress = l2Table.address;
@@ -4182,532 +5569,402 @@ int32_t rtl8367::rtk_l2_ipVidMcastAddr_next_get(uint32_t *pAddress, rtk_l2_ipVid
     return RT_ERR_OK;
 }
 
-// ----------------------- QoS -----------------------
-
-/* Function Name:
- *      rtl8367c_setAsicOutputQueueMappingIndex
- * Description:
- *      Set output queue number for each port
- * Input:
- *      port     - Physical port number (0~7)
- *      index     - Mapping table index
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK             - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_PORT_ID      - Invalid port number
- *      RT_ERR_QUEUE_NUM      - Invalid queue number
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicOutputQueueMappingIndex(uint32_t port, uint32_t index)
+int32_t rtl8367::rtk_l2_ipMcastAddr_add(rtk_l2_ipMcastAddr_t *pIpMcastAddr)
 {
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t method;
+    rtl8367c_luttb l2Table;
+    uint32_t pmask;
 
-    if (index >= RTL8367C_QUEUENO)
-        return RT_ERR_QUEUE_NUM;
+    if (NULL == pIpMcastAddr)
+        return RT_ERR_NULL_POINTER;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_QOS_PORT_QUEUE_NUMBER_REG(port), RTL8367C_QOS_PORT_QUEUE_NUMBER_MASK(port), index);
-}
+    /* check port mask */
+    RTK_CHK_PORTMASK_VALID(&pIpMcastAddr->portmask);
 
-/* Function Name:
- *      rtl8367c_setAsicPriorityToQIDMappingTable
- * Description:
- *      Set priority to QID mapping table parameters
- * Input:
- *      index         - Mapping table index
- *      priority     - The priority value
- *      qid         - Queue id
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                 - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_QUEUE_ID          - Invalid queue id
- *      RT_ERR_QUEUE_NUM          - Invalid queue number
- *      RT_ERR_QOS_INT_PRIORITY - Invalid priority
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicPriorityToQIDMappingTable(uint32_t index, uint32_t priority, uint32_t qid)
-{
-    if (index >= RTL8367C_QUEUENO)
-        return RT_ERR_QUEUE_NUM;
+    if ((pIpMcastAddr->dip & 0xF0000000) != 0xE0000000)
+        return RT_ERR_INPUT;
 
-    if (priority > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    if (pIpMcastAddr->fwd_pri_en >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
 
-    if (qid > RTL8367C_QIDMAX)
-        return RT_ERR_QUEUE_ID;
+    if (pIpMcastAddr->priority > RTL8367C_PRIMAX)
+        return RT_ERR_INPUT;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_QOS_1Q_PRIORITY_TO_QID_REG(index, priority), RTL8367C_QOS_1Q_PRIORITY_TO_QID_MASK(priority), qid);
-}
+    /* Get Physical port mask */
+    if ((retVal = rtk_switch_portmask_L2P_get(&pIpMcastAddr->portmask, &pmask)) != RT_ERR_OK)
+        return retVal;
 
-/* Function Name:
- *      rtl8367c_setAsicFlowControlSelect
- * Description:
- *      Set system flow control type
- * Input:
- *      select      - System flow control type 1: Ingress flow control 0:Egress flow control
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK   - Success
- *      RT_ERR_SMI  - SMI access error
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicFlowControlSelect(uint32_t select)
-{
-    return rtl8367c_setAsicRegBit(RTL8367C_REG_FLOWCTRL_CTRL0, RTL8367C_FLOWCTRL_TYPE_OFFSET, select);
+    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
+    l2Table.sip = pIpMcastAddr->sip;
+    l2Table.dip = pIpMcastAddr->dip;
+    l2Table.l3lookup = 1;
+    l2Table.l3vidlookup = 0;
+    method = LUTREADMETHOD_MAC;
+    retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
+    if (RT_ERR_OK == retVal)
+    {
+        l2Table.sip = pIpMcastAddr->sip;
+        l2Table.dip = pIpMcastAddr->dip;
+        l2Table.mbr = pmask;
+        l2Table.nosalearn = 1;
+        l2Table.l3lookup = 1;
+        l2Table.l3vidlookup = 0;
+        l2Table.lut_pri = pIpMcastAddr->priority;
+        l2Table.fwd_en = pIpMcastAddr->fwd_pri_en;
+        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
+            return retVal;
+
+        pIpMcastAddr->address = l2Table.address;
+        return RT_ERR_OK;
+    }
+    else if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
+    {
+        memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+        l2Table.sip = pIpMcastAddr->sip;
+        l2Table.dip = pIpMcastAddr->dip;
+        l2Table.mbr = pmask;
+        l2Table.nosalearn = 1;
+        l2Table.l3lookup = 1;
+        l2Table.l3vidlookup = 0;
+        l2Table.lut_pri = pIpMcastAddr->priority;
+        l2Table.fwd_en = pIpMcastAddr->fwd_pri_en;
+        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
+            return retVal;
+
+        pIpMcastAddr->address = l2Table.address;
+
+        method = LUTREADMETHOD_MAC;
+        retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
+        if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
+            return RT_ERR_L2_INDEXTBL_FULL;
+        else
+            return retVal;
+    }
+    else
+        return retVal;
 }
 
-/* Function Name:
- *      rtl8367c_setAsicPriorityDecision
- * Description:
- *      Set priority decision table
- * Input:
- *      prisrc         - Priority decision source
- *      decisionPri - Decision priority assignment
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                     - Success
- *      RT_ERR_SMI                  - SMI access error
- *      RT_ERR_QOS_INT_PRIORITY        - Invalid priority
- *      RT_ERR_QOS_SEL_PRI_SOURCE    - Invalid priority decision source parameter
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicPriorityDecision(uint32_t index, uint32_t prisrc, uint32_t decisionPri)
+int32_t rtl8367::rtk_l2_ipMcastAddr_del(rtk_l2_ipMcastAddr_t *pIpMcastAddr)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t method;
+    rtl8367c_luttb l2Table;
 
-    if (index >= PRIDEC_IDX_END)
-        return RT_ERR_ENTRY_INDEX;
-
-    if (prisrc >= PRIDEC_END)
-        return RT_ERR_QOS_SEL_PRI_SOURCE;
+    /* Error Checking */
+    if (pIpMcastAddr == NULL)
+        return RT_ERR_INPUT;
 
-    if (decisionPri > RTL8367C_DECISIONPRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    if ((pIpMcastAddr->dip & 0xF0000000) != 0xE0000000)
+        return RT_ERR_INPUT;
 
-    switch (index)
+    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
+    l2Table.sip = pIpMcastAddr->sip;
+    l2Table.dip = pIpMcastAddr->dip;
+    l2Table.l3lookup = 1;
+    l2Table.l3vidlookup = 0;
+    method = LUTREADMETHOD_MAC;
+    retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
+    if (RT_ERR_OK == retVal)
     {
-    case PRIDEC_IDX0:
-        if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_QOS_INTERNAL_PRIORITY_DECISION_REG(prisrc), RTL8367C_QOS_INTERNAL_PRIORITY_DECISION_MASK(prisrc), decisionPri)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case PRIDEC_IDX1:
-        if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_QOS_INTERNAL_PRIORITY_DECISION2_REG(prisrc), RTL8367C_QOS_INTERNAL_PRIORITY_DECISION2_MASK(prisrc), decisionPri)) != RT_ERR_OK)
+        l2Table.sip = pIpMcastAddr->sip;
+        l2Table.dip = pIpMcastAddr->dip;
+        l2Table.mbr = 0;
+        l2Table.nosalearn = 0;
+        l2Table.l3lookup = 1;
+        l2Table.l3vidlookup = 0;
+        l2Table.lut_pri = 0;
+        l2Table.fwd_en = 0;
+        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
             return retVal;
-        break;
-    default:
-        break;
-    };
 
-    return RT_ERR_OK;
+        pIpMcastAddr->address = l2Table.address;
+        return RT_ERR_OK;
+    }
+    else
+        return retVal;
 }
-/* Function Name:
- *      rtl8367c_setAsicRemarkingDot1pAbility
- * Description:
- *      Set 802.1p remarking ability
- * Input:
- *      port     - Physical port number (0~7)
- *      enabled - 1: enabled, 0: disabled
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK             - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_PORT_ID      - Invalid port number
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicRemarkingDot1pAbility(uint32_t port, uint32_t enabled)
+
+int32_t rtl8367::rtk_l2_ipMcastAddr_get(rtk_l2_ipMcastAddr_t *pIpMcastAddr)
 {
-    return rtl8367c_setAsicRegBit(RTL8367C_PORT_MISC_CFG_REG(port), RTL8367C_1QREMARK_ENABLE_OFFSET, enabled);
-}
-/* Function Name:
- *      rtl8367c_setAsicRemarkingDscpAbility
- * Description:
- *      Set DSCP remarking ability
- * Input:
- *      enabled     - 1: enabled, 0: disabled
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK     - Success
- *      RT_ERR_SMI  - SMI access error
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicRemarkingDscpAbility(uint32_t enabled)
-{
-    return rtl8367c_setAsicRegBit(RTL8367C_REMARKING_CTRL_REG, RTL8367C_REMARKING_DSCP_ENABLE_OFFSET, enabled);
-}
-/* Function Name:
- *      rtl8367c_setAsicPriorityDot1qRemapping
- * Description:
- *      Set 802.1Q absolutely priority
- * Input:
- *      srcpriority - Priority value
- *      priority     - Absolute priority value
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                 - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_QOS_INT_PRIORITY    - Invalid priority
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicPriorityDot1qRemapping(uint32_t srcpriority, uint32_t priority)
-{
-    if ((srcpriority > RTL8367C_PRIMAX) || (priority > RTL8367C_PRIMAX))
-        return RT_ERR_QOS_INT_PRIORITY;
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t method;
+    rtl8367c_luttb l2Table;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_QOS_1Q_PRIORITY_REMAPPING_REG(srcpriority), RTL8367C_QOS_1Q_PRIORITY_REMAPPING_MASK(srcpriority), priority);
-}
-/* Function Name:
- *      rtl8367c_setAsicRemarkingDot1pParameter
- * Description:
- *      Set 802.1p remarking parameter
- * Input:
- *      priority     - Priority value
- *      newPriority - New priority value
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                 - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_QOS_INT_PRIORITY - Invalid priority
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicRemarkingDot1pParameter(uint32_t priority, uint32_t newPriority)
-{
-    if (priority > RTL8367C_PRIMAX || newPriority > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    if (NULL == pIpMcastAddr)
+        return RT_ERR_NULL_POINTER;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_QOS_1Q_REMARK_REG(priority), RTL8367C_QOS_1Q_REMARK_MASK(priority), newPriority);
-}
-/* Function Name:
- *      rtl8367c_setAsicRemarkingDscpParameter
- * Description:
- *      Set DSCP remarking parameter
- * Input:
- *      priority     - Priority value
- *      newDscp     - New DSCP value
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                 - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_QOS_DSCP_VALUE    - Invalid DSCP value
- *      RT_ERR_QOS_INT_PRIORITY    - Invalid priority
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicRemarkingDscpParameter(uint32_t priority, uint32_t newDscp)
-{
-    if (priority > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    if ((pIpMcastAddr->dip & 0xF0000000) != 0xE0000000)
+        return RT_ERR_INPUT;
 
-    if (newDscp > RTL8367C_DSCPMAX)
-        return RT_ERR_QOS_DSCP_VALUE;
+    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
+    l2Table.sip = pIpMcastAddr->sip;
+    l2Table.dip = pIpMcastAddr->dip;
+    l2Table.l3lookup = 1;
+    l2Table.l3vidlookup = 0;
+    method = LUTREADMETHOD_MAC;
+    if ((retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table)) != RT_ERR_OK)
+        return retVal;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_QOS_DSCP_REMARK_REG(priority), RTL8367C_QOS_DSCP_REMARK_MASK(priority), newDscp);
-}
-/* Function Name:
- *      rtl8367c_setAsicPriorityDscpBased
- * Description:
- *      Set DSCP-based priority
- * Input:
- *      dscp         - DSCP value
- *      priority     - Priority value
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                 - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_QOS_DSCP_VALUE    - Invalid DSCP value
- *      RT_ERR_QOS_INT_PRIORITY    - Invalid priority
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicPriorityDscpBased(uint32_t dscp, uint32_t priority)
-{
-    if (priority > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    /* Get Logical port mask */
+    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pIpMcastAddr->portmask)) != RT_ERR_OK)
+        return retVal;
 
-    if (dscp > RTL8367C_DSCPMAX)
-        return RT_ERR_QOS_DSCP_VALUE;
+    pIpMcastAddr->priority = l2Table.lut_pri;
+    pIpMcastAddr->fwd_pri_en = l2Table.fwd_en;
+    pIpMcastAddr->igmp_asic = l2Table.igmp_asic;
+    pIpMcastAddr->igmp_index = l2Table.igmpidx;
+    pIpMcastAddr->address = l2Table.address;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_QOS_DSCP_TO_PRIORITY_REG(dscp), RTL8367C_QOS_DSCP_TO_PRIORITY_MASK(dscp), priority);
+    return RT_ERR_OK;
 }
-int32_t rtl8367::rtk_qos_init(uint32_t queueNum)
-{
-    const uint16_t g_prioritytToQid[8][8] = {
-        {0, 0, 0, 0, 0, 0, 0, 0},
-        {0, 0, 0, 0, 7, 7, 7, 7},
-        {0, 0, 0, 0, 1, 1, 7, 7},
-        {0, 0, 1, 1, 2, 2, 7, 7},
-        {0, 0, 1, 1, 2, 3, 7, 7},
-        {0, 0, 1, 2, 3, 4, 7, 7},
-        {0, 0, 1, 2, 3, 4, 5, 7},
-        {0, 1, 2, 3, 4, 5, 6, 7}};
-
-    const uint32_t g_priorityDecision[8] = {0x01, 0x80, 0x04, 0x02, 0x20, 0x40, 0x10, 0x08};
-    const uint32_t g_prioritytRemap[8] = {0, 1, 2, 3, 4, 5, 6, 7};
 
+int32_t rtl8367::rtk_l2_ipMcastAddr_next_get(uint32_t *pAddress, rtk_l2_ipMcastAddr_t *pIpMcastAddr)
+{
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t qmapidx;
-    uint32_t priority;
-    uint32_t priDec;
-    uint32_t port;
-    uint32_t dscp;
+    rtl8367c_luttb l2Table;
 
-    if (queueNum <= 0 || queueNum > RTK_MAX_NUM_OF_QUEUE)
-        return RT_ERR_QUEUE_NUM;
+    /* Error Checking */
+    if ((pAddress == NULL) || (pIpMcastAddr == NULL))
+        return RT_ERR_INPUT;
 
-    /*Set Output Queue Number*/
-    if (RTK_MAX_NUM_OF_QUEUE == queueNum)
-        qmapidx = 0;
-    else
-        qmapidx = queueNum;
+    if (*pAddress > halCtrl.max_lut_addr_num - 1)
+        return RT_ERR_L2_L2UNI_PARAM;
 
-    RTK_SCAN_ALL_PHY_PORTMASK(port)
-    {
-        if ((retVal = rtl8367c_setAsicOutputQueueMappingIndex(port, qmapidx)) != RT_ERR_OK)
-            return retVal;
-    }
+    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+    l2Table.address = *pAddress;
 
-    /*Set Priority to Qid*/
-    for (priority = 0; priority <= RTK_PRIMAX; priority++)
+    do
     {
-        if ((retVal = rtl8367c_setAsicPriorityToQIDMappingTable(queueNum - 1, priority, g_prioritytToQid[queueNum - 1][priority])) != RT_ERR_OK)
+        if ((retVal = rtl8367c_getAsicL2LookupTb(LUTREADMETHOD_NEXT_L3MC, &l2Table)) != RT_ERR_OK)
             return retVal;
-    }
-
-    /*Set Flow Control Type to Ingress Flow Control*/
-    if ((retVal = rtl8367c_setAsicFlowControlSelect(FC_INGRESS)) != RT_ERR_OK)
-        return retVal;
 
-    /*Priority Decision Order*/
-    for (priDec = 0; priDec < PRIDEC_END; priDec++)
-    {
-        if ((retVal = rtl8367c_setAsicPriorityDecision(PRIDECTBL_IDX0, priDec, g_priorityDecision[priDec])) != RT_ERR_OK)
-            return retVal;
-        if ((retVal = rtl8367c_setAsicPriorityDecision(PRIDECTBL_IDX1, priDec, g_priorityDecision[priDec])) != RT_ERR_OK)
-            return retVal;
-    }
+        if (l2Table.address < *pAddress)
+            return RT_ERR_L2_ENTRY_NOTFOUND;
 
-    /*Set Port-based Priority to 0*/
-    RTK_SCAN_ALL_PHY_PORTMASK(port)
-    {
-        if ((retVal = rtl8367c_setAsicPriorityPortBased(port, 0)) != RT_ERR_OK)
-            return retVal;
-    }
+    } while (l2Table.l3vidlookup == 1);
 
-    /*Disable 1p Remarking*/
-    RTK_SCAN_ALL_PHY_PORTMASK(port)
-    {
-        if ((retVal = rtl8367c_setAsicRemarkingDot1pAbility(port, DISABLED)) != RT_ERR_OK)
-            return retVal;
-    }
+    pIpMcastAddr->sip = l2Table.sip;
+    pIpMcastAddr->dip = l2Table.dip;
 
-    /*Disable DSCP Remarking*/
-    if ((retVal = rtl8367c_setAsicRemarkingDscpAbility(DISABLED)) != RT_ERR_OK)
+    /* Get Logical port mask */
+    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pIpMcastAddr->portmask)) != RT_ERR_OK)
         return retVal;
 
-    /*Set 1p & DSCP  Priority Remapping & Remarking*/
-    for (priority = 0; priority <= RTL8367C_PRIMAX; priority++)
-    {
-        if ((retVal = rtl8367c_setAsicPriorityDot1qRemapping(priority, g_prioritytRemap[priority])) != RT_ERR_OK)
-            return retVal;
-
-        if ((retVal = rtl8367c_setAsicRemarkingDot1pParameter(priority, 0)) != RT_ERR_OK)
-            return retVal;
+    pIpMcastAddr->priority = l2Table.lut_pri;
+    pIpMcastAddr->fwd_pri_en = l2Table.fwd_en;
+    pIpMcastAddr->igmp_asic = l2Table.igmp_asic;
+    pIpMcastAddr->igmp_index = l2Table.igmpidx;
+    pIpMcastAddr->address = l2Table.address;
+    *pAddress = l2Table.address;
 
-        if ((retVal = rtl8367c_setAsicRemarkingDscpParameter(priority, 0)) != RT_ERR_OK)
-            return retVal;
-    }
+    return RT_ERR_OK;
+}
 
-    /*Set DSCP Priority*/
-    for (dscp = 0; dscp <= 63; dscp++)
-    {
-        if ((retVal = rtl8367c_setAsicPriorityDscpBased(dscp, 0)) != RT_ERR_OK)
-            return retVal;
-    }
+int32_t rtl8367::rtk_l2_ipVidMcastAddr_add(rtk_l2_ipVidMcastAddr_t *pIpVidMcastAddr)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t method;
+    rtl8367c_luttb l2Table;
+    uint32_t pmask;
 
-    /* Finetune B/T value */
-    if ((retVal = rtl8367c_setAsicReg(0x1722, 0x1158)) != RT_ERR_OK)
-        return retVal;
+    if (NULL == pIpVidMcastAddr)
+        return RT_ERR_NULL_POINTER;
 
-    return RT_ERR_OK;
-}
+    /* check port mask */
+    RTK_CHK_PORTMASK_VALID(&pIpVidMcastAddr->portmask);
 
-/* Function Name:
- *      rtl8367c_setAsicPriorityPortBased
- * Description:
- *      Set port based priority
- * Input:
- *      port         - Physical port number (0~7)
- *      priority     - Priority value
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                 - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PORT_ID          - Invalid port number
- *      RT_ERR_QOS_INT_PRIORITY    - Invalid priority
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicPriorityPortBased(uint32_t port, uint32_t priority)
-{
-    int32_t retVal;
+    if (pIpVidMcastAddr->vid > RTL8367C_VIDMAX)
+        return RT_ERR_L2_VID;
 
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
+    if ((pIpVidMcastAddr->dip & 0xF0000000) != 0xE0000000)
+        return RT_ERR_INPUT;
 
-    if (priority > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    /* Get Physical port mask */
+    if ((retVal = rtk_switch_portmask_L2P_get(&pIpVidMcastAddr->portmask, &pmask)) != RT_ERR_OK)
+        return retVal;
 
-    if (port < 8)
+    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
+    l2Table.sip = pIpVidMcastAddr->sip;
+    l2Table.dip = pIpVidMcastAddr->dip;
+    l2Table.l3lookup = 1;
+    l2Table.l3vidlookup = 1;
+    l2Table.l3_vid = pIpVidMcastAddr->vid;
+    method = LUTREADMETHOD_MAC;
+    retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
+    if (RT_ERR_OK == retVal)
     {
-        retVal = rtl8367c_setAsicRegBits(RTL8367C_QOS_PORTBASED_PRIORITY_REG(port), RTL8367C_QOS_PORTBASED_PRIORITY_MASK(port), priority);
-        if (retVal != RT_ERR_OK)
+        l2Table.sip = pIpVidMcastAddr->sip;
+        l2Table.dip = pIpVidMcastAddr->dip;
+        l2Table.mbr = pmask;
+        l2Table.nosalearn = 1;
+        l2Table.l3lookup = 1;
+        l2Table.l3vidlookup = 1;
+        l2Table.l3_vid = pIpVidMcastAddr->vid;
+        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
             return retVal;
+
+        pIpVidMcastAddr->address = l2Table.address;
+        return RT_ERR_OK;
     }
-    else
+    else if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
     {
-        retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_QOS_PORTBASED_PRIORITY_CTRL2, 0x7 << ((port - 8) << 2), priority);
-        if (retVal != RT_ERR_OK)
+        memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+        l2Table.sip = pIpVidMcastAddr->sip;
+        l2Table.dip = pIpVidMcastAddr->dip;
+        l2Table.mbr = pmask;
+        l2Table.nosalearn = 1;
+        l2Table.l3lookup = 1;
+        l2Table.l3vidlookup = 1;
+        l2Table.l3_vid = pIpVidMcastAddr->vid;
+        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
             return retVal;
-    }
 
-    return RT_ERR_OK;
+        pIpVidMcastAddr->address = l2Table.address;
+
+        method = LUTREADMETHOD_MAC;
+        retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
+        if (RT_ERR_L2_ENTRY_NOTFOUND == retVal)
+            return RT_ERR_L2_INDEXTBL_FULL;
+        else
+            return retVal;
+    }
+    else
+        return retVal;
 }
 
-int32_t rtl8367::rtk_qos_portPri_set(rtk_port_t port, uint32_t int_pri)
+int32_t rtl8367::rtk_l2_ipVidMcastAddr_del(rtk_l2_ipVidMcastAddr_t *pIpVidMcastAddr)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t method;
+    rtl8367c_luttb l2Table;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
-
-    if (int_pri > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
-
-    if ((retVal = rtl8367c_setAsicPriorityPortBased(rtk_switch_port_L2P_get(port), int_pri)) != RT_ERR_OK)
-        return retVal;
+    if (NULL == pIpVidMcastAddr)
+        return RT_ERR_NULL_POINTER;
 
-    return RT_ERR_OK;
-}
+    if (pIpVidMcastAddr->vid > RTL8367C_VIDMAX)
+        return RT_ERR_L2_VID;
 
-int32_t rtl8367::rtk_qos_1pPriRemap_set(uint32_t dot1p_pri, uint32_t int_pri)
-{
-    int32_t retVal;
+    if ((pIpVidMcastAddr->dip & 0xF0000000) != 0xE0000000)
+        return RT_ERR_INPUT;
 
-    if (dot1p_pri > RTL8367C_PRIMAX || int_pri > RTL8367C_PRIMAX)
-        return RT_ERR_VLAN_PRIORITY;
+    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
+    l2Table.sip = pIpVidMcastAddr->sip;
+    l2Table.dip = pIpVidMcastAddr->dip;
+    l2Table.l3lookup = 1;
+    l2Table.l3vidlookup = 1;
+    l2Table.l3_vid = pIpVidMcastAddr->vid;
+    method = LUTREADMETHOD_MAC;
+    retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table);
+    if (RT_ERR_OK == retVal)
+    {
+        l2Table.sip = pIpVidMcastAddr->sip;
+        l2Table.dip = pIpVidMcastAddr->dip;
+        l2Table.mbr = 0;
+        l2Table.nosalearn = 0;
+        l2Table.l3lookup = 1;
+        l2Table.l3vidlookup = 1;
+        l2Table.l3_vid = pIpVidMcastAddr->vid;
+        if ((retVal = rtl8367c_setAsicL2LookupTb(&l2Table)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_setAsicPriorityDot1qRemapping(dot1p_pri, int_pri)) != RT_ERR_OK)
+        pIpVidMcastAddr->address = l2Table.address;
+        return RT_ERR_OK;
+    }
+    else
         return retVal;
-
-    return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_qos_priSel_set(rtk_qos_priDecTbl_t index, rtk_priority_select_t *pPriDec)
+int32_t rtl8367::rtk_l2_ipVidMcastAddr_get(rtk_l2_ipVidMcastAddr_t *pIpVidMcastAddr)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t port_pow;
-    uint32_t dot1q_pow;
-    uint32_t dscp_pow;
-    uint32_t acl_pow;
-    uint32_t svlan_pow;
-    uint32_t cvlan_pow;
-    uint32_t smac_pow;
-    uint32_t dmac_pow;
-    uint32_t i;
-
-    if (index < 0 || index >= PRIDECTBL_END)
-        return RT_ERR_ENTRY_INDEX;
+    uint32_t method;
+    rtl8367c_luttb l2Table;
 
-    if (pPriDec->port_pri >= 8 || pPriDec->dot1q_pri >= 8 || pPriDec->acl_pri >= 8 || pPriDec->dscp_pri >= 8 ||
-        pPriDec->cvlan_pri >= 8 || pPriDec->svlan_pri >= 8 || pPriDec->dmac_pri >= 8 || pPriDec->smac_pri >= 8)
-        return RT_ERR_QOS_SEL_PRI_SOURCE;
+    if (NULL == pIpVidMcastAddr)
+        return RT_ERR_NULL_POINTER;
 
-    port_pow = 1;
-    for (i = pPriDec->port_pri; i > 0; i--)
-        port_pow = (port_pow)*2;
+    if (pIpVidMcastAddr->vid > RTL8367C_VIDMAX)
+        return RT_ERR_L2_VID;
 
-    dot1q_pow = 1;
-    for (i = pPriDec->dot1q_pri; i > 0; i--)
-        dot1q_pow = (dot1q_pow)*2;
+    if ((pIpVidMcastAddr->dip & 0xF0000000) != 0xE0000000)
+        return RT_ERR_INPUT;
 
-    acl_pow = 1;
-    for (i = pPriDec->acl_pri; i > 0; i--)
-        acl_pow = (acl_pow)*2;
+    memset(&l2Table, 0x00, sizeof(rtl8367c_luttb));
+    l2Table.sip = pIpVidMcastAddr->sip;
+    l2Table.dip = pIpVidMcastAddr->dip;
+    l2Table.l3lookup = 1;
+    l2Table.l3vidlookup = 1;
+    l2Table.l3_vid = pIpVidMcastAddr->vid;
+    method = LUTREADMETHOD_MAC;
+    if ((retVal = rtl8367c_getAsicL2LookupTb(method, &l2Table)) != RT_ERR_OK)
+        return retVal;
 
-    dscp_pow = 1;
-    for (i = pPriDec->dscp_pri; i > 0; i--)
-        dscp_pow = (dscp_pow)*2;
+    pIpVidMcastAddr->address = l2Table.address;
 
-    svlan_pow = 1;
-    for (i = pPriDec->svlan_pri; i > 0; i--)
-        svlan_pow = (svlan_pow)*2;
+    /* Get Logical port mask */
+    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pIpVidMcastAddr->portmask)) != RT_ERR_OK)
+        return retVal;
 
-    cvlan_pow = 1;
-    for (i = pPriDec->cvlan_pri; i > 0; i--)
-        cvlan_pow = (cvlan_pow)*2;
+    return RT_ERR_OK;
+}
 
-    dmac_pow = 1;
-    for (i = pPriDec->dmac_pri; i > 0; i--)
-        dmac_pow = (dmac_pow)*2;
+int32_t rtl8367::rtk_l2_ipVidMcastAddr_next_get(uint32_t *pAddress, rtk_l2_ipVidMcastAddr_t *pIpVidMcastAddr)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    rtl8367c_luttb l2Table;
 
-    smac_pow = 1;
-    for (i = pPriDec->smac_pri; i > 0; i--)
-        smac_pow = (smac_pow)*2;
+    /* Error Checking */
+    if ((pAddress == NULL) || (pIpVidMcastAddr == NULL))
+        return RT_ERR_INPUT;
 
-    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_PORT, port_pow)) != RT_ERR_OK)
-        return retVal;
+    if (*pAddress > halCtrl.max_lut_addr_num - 1)
+        return RT_ERR_L2_L2UNI_PARAM;
 
-    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_ACL, acl_pow)) != RT_ERR_OK)
-        return retVal;
+    memset(&l2Table, 0, sizeof(rtl8367c_luttb));
+    l2Table.address = *pAddress;
 
-    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_DSCP, dscp_pow)) != RT_ERR_OK)
-        return retVal;
+    do
+    {
+        if ((retVal = rtl8367c_getAsicL2LookupTb(LUTREADMETHOD_NEXT_L3MC, &l2Table)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_1Q, dot1q_pow)) != RT_ERR_OK)
-        return retVal;
+        if (l2Table.address < *pAddress)
+            return RT_ERR_L2_ENTRY_NOTFOUND;
 
-    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_1AD, svlan_pow)) != RT_ERR_OK)
-        return retVal;
+    } while (l2Table.l3vidlookup == 0);
 
-    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_CVLAN, cvlan_pow)) != RT_ERR_OK)
-        return retVal;
+    pIpVidMcastAddr->sip = l2Table.sip;
+    pIpVidMcastAddr->dip = l2Table.dip;
+    pIpVidMcastAddr->vid = l2Table.l3_vid;
+    pIpVidMcastAddr->address = l2Table.address;
 
-    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_DA, dmac_pow)) != RT_ERR_OK)
+    /* Get Logical port mask */
+    if ((retVal = rtk_switch_portmask_P2L_get(l2Table.mbr, &pIpVidMcastAddr->portmask)) != RT_ERR_OK)
         return retVal;
 
-    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_SA, smac_pow)) != RT_ERR_OK)
-        return retVal;
+    *pAddress = l2Table.address;
 
     return RT_ERR_OK;
 }
 
+// ----------------------- QoS -----------------------
+
 /* Function Name:
- *      rtl8367c_setAsicPortPriorityDecisionIndex
+ *      rtl8367c_setAsicOutputQueueMappingIndex
  * Description:
- *      Set priority decision index for each port
+ *      Set output queue number for each port
  * Input:
  *      port     - Physical port number (0~7)
- *      index     - Table index
+ *      index     - Mapping table index
  * Output:
  *      None
  * Return:
@@ -4718,4348 +5975,4321 @@ int32_t rtl8367::rtk_qos_priSel_set(rtk_qos_priDecTbl_t index, rtk_priority_sele
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicPortPriorityDecisionIndex(uint32_t port, uint32_t index)
+int32_t rtl8367::rtl8367c_setAsicOutputQueueMappingIndex(uint32_t port, uint32_t index)
 {
     if (port > RTL8367C_PORTIDMAX)
         return RT_ERR_PORT_ID;
 
-    if (index >= PRIDEC_IDX_END)
-        return RT_ERR_ENTRY_INDEX;
+    if (index >= RTL8367C_QUEUENO)
+        return RT_ERR_QUEUE_NUM;
 
-    return rtl8367c_setAsicRegBit(RTL8367C_QOS_INTERNAL_PRIORITY_DECISION_IDX_CTRL, port, index);
+    return rtl8367c_setAsicRegBits(RTL8367C_QOS_PORT_QUEUE_NUMBER_REG(port), RTL8367C_QOS_PORT_QUEUE_NUMBER_MASK(port), index);
 }
 
-int32_t rtl8367::rtk_qos_portPriSelIndex_set(rtk_port_t port, rtk_qos_priDecTbl_t index)
-{
-    int32_t retVal;
-
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
-
-    if (index >= PRIDECTBL_END)
-        return RT_ERR_ENTRY_INDEX;
-
-    if ((retVal = rtl8367c_setAsicPortPriorityDecisionIndex(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
-        return retVal;
-
-    return RT_ERR_OK;
-}
-
-int32_t rtl8367::rtk_qos_priMap_set(uint32_t queue_num, rtk_qos_pri2queue_t *pPri2qid)
+/* Function Name:
+ *      rtl8367c_setAsicPriorityToQIDMappingTable
+ * Description:
+ *      Set priority to QID mapping table parameters
+ * Input:
+ *      index         - Mapping table index
+ *      priority     - The priority value
+ *      qid         - Queue id
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK                 - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_QUEUE_ID          - Invalid queue id
+ *      RT_ERR_QUEUE_NUM          - Invalid queue number
+ *      RT_ERR_QOS_INT_PRIORITY - Invalid priority
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicPriorityToQIDMappingTable(uint32_t index, uint32_t priority, uint32_t qid)
 {
-    int32_t retVal;
-    uint32_t pri;
-
-    if ((0 == queue_num) || (queue_num > RTK_MAX_NUM_OF_QUEUE))
+    if (index >= RTL8367C_QUEUENO)
         return RT_ERR_QUEUE_NUM;
 
-    for (pri = 0; pri <= RTK_PRIMAX; pri++)
-    {
-        if (pPri2qid->pri2queue[pri] > RTK_QIDMAX)
-            return RT_ERR_QUEUE_ID;
+    if (priority > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
 
-        if ((retVal = rtl8367c_setAsicPriorityToQIDMappingTable(queue_num - 1, pri, pPri2qid->pri2queue[pri])) != RT_ERR_OK)
-            return retVal;
-    }
+    if (qid > RTL8367C_QIDMAX)
+        return RT_ERR_QUEUE_ID;
 
-    return RT_ERR_OK;
+    return rtl8367c_setAsicRegBits(RTL8367C_QOS_1Q_PRIORITY_TO_QID_REG(index, priority), RTL8367C_QOS_1Q_PRIORITY_TO_QID_MASK(priority), qid);
 }
 
 /* Function Name:
- *      rtl8367c_setAsicQueueType
+ *      rtl8367c_setAsicFlowControlSelect
  * Description:
- *      Set type of a queue
+ *      Set system flow control type
  * Input:
- *      port        - Physical port number (0~10)
- *      qid         - The queue ID wanted to set
- *      queueType   - The specified queue type. 0b0: Strict priority, 0b1: WFQ
+ *      select      - System flow control type 1: Ingress flow control 0:Egress flow control
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
- *      RT_ERR_QUEUE_ID - Invalid queue id
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicQueueType(uint32_t port, uint32_t qid, uint32_t queueType)
+int32_t rtl8367::rtl8367c_setAsicFlowControlSelect(uint32_t select)
 {
-    int32_t retVal;
-
-    /* Invalid input parameter */
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
-
-    if (qid > RTL8367C_QIDMAX)
-        return RT_ERR_QUEUE_ID;
-
-    /* Set Related Registers */
-    retVal = rtl8367c_setAsicRegBit(RTL8367C_SCHEDULE_QUEUE_TYPE_REG(port), RTL8367C_SCHEDULE_QUEUE_TYPE_OFFSET(port, qid), queueType);
-
-    return retVal;
+    return rtl8367c_setAsicRegBit(RTL8367C_REG_FLOWCTRL_CTRL0, RTL8367C_FLOWCTRL_TYPE_OFFSET, select);
 }
 
 /* Function Name:
- *      rtl8367c_setAsicWFQWeight
+ *      rtl8367c_setAsicPriorityDecision
  * Description:
- *      Set weight  of a queue
+ *      Set priority decision table
  * Input:
- *      port    - Physical port number (0~10)
- *      qid     - The queue ID wanted to set
- *      qWeight - The weight value wanted to set (valid:0~127)
+ *      prisrc         - Priority decision source
+ *      decisionPri - Decision priority assignment
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PORT_ID          - Invalid port number
- *      RT_ERR_QUEUE_ID         - Invalid queue id
- *      RT_ERR_QOS_QUEUE_WEIGHT - Invalid queue weight
+ *      RT_ERR_OK                     - Success
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_QOS_INT_PRIORITY        - Invalid priority
+ *      RT_ERR_QOS_SEL_PRI_SOURCE    - Invalid priority decision source parameter
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicWFQWeight(uint32_t port, uint32_t qid, uint32_t qWeight)
+int32_t rtl8367::rtl8367c_setAsicPriorityDecision(uint32_t index, uint32_t prisrc, uint32_t decisionPri)
 {
     int32_t retVal;
 
-    /* Invalid input parameter */
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
-
-    if (qid > RTL8367C_QIDMAX)
-        return RT_ERR_QUEUE_ID;
-
-    if (qWeight > RTL8367C_QWEIGHTMAX && qid > 0)
-        return RT_ERR_QOS_QUEUE_WEIGHT;
-
-    retVal = rtl8367c_setAsicReg(RTL8367C_SCHEDULE_PORT_QUEUE_WFQ_WEIGHT_REG(port, qid), qWeight);
+    if (index >= PRIDEC_IDX_END)
+        return RT_ERR_ENTRY_INDEX;
 
-    return retVal;
-}
-int32_t rtl8367::rtk_qos_schedulingQueue_set(rtk_port_t port, rtk_qos_queue_weights_t *pQweights)
-{
-    int32_t retVal;
-    uint32_t qid;
+    if (prisrc >= PRIDEC_END)
+        return RT_ERR_QOS_SEL_PRI_SOURCE;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
+    if (decisionPri > RTL8367C_DECISIONPRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
 
-    for (qid = 0; qid < RTL8367C_QUEUENO; qid++)
+    switch (index)
     {
-
-        if (pQweights->weights[qid] > QOS_WEIGHT_MAX)
-            return RT_ERR_QOS_QUEUE_WEIGHT;
-
-        if (0 == pQweights->weights[qid])
-        {
-            if ((retVal = rtl8367c_setAsicQueueType(rtk_switch_port_L2P_get(port), qid, QTYPE_STRICT)) != RT_ERR_OK)
-                return retVal;
-        }
-        else
-        {
-            if ((retVal = rtl8367c_setAsicQueueType(rtk_switch_port_L2P_get(port), qid, QTYPE_WFQ)) != RT_ERR_OK)
-                return retVal;
-
-            if ((retVal = rtl8367c_setAsicWFQWeight(rtk_switch_port_L2P_get(port), qid, pQweights->weights[qid])) != RT_ERR_OK)
-                return retVal;
-        }
-    }
+    case PRIDEC_IDX0:
+        if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_QOS_INTERNAL_PRIORITY_DECISION_REG(prisrc), RTL8367C_QOS_INTERNAL_PRIORITY_DECISION_MASK(prisrc), decisionPri)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case PRIDEC_IDX1:
+        if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_QOS_INTERNAL_PRIORITY_DECISION2_REG(prisrc), RTL8367C_QOS_INTERNAL_PRIORITY_DECISION2_MASK(prisrc), decisionPri)) != RT_ERR_OK)
+            return retVal;
+        break;
+    default:
+        break;
+    };
 
     return RT_ERR_OK;
 }
-
-// ----------------- CPU -----------------
-
 /* Function Name:
- *      rtl8367c_setAsicCputagEnable
+ *      rtl8367c_setAsicRemarkingDot1pAbility
  * Description:
- *      Set cpu tag function enable/disable
+ *      Set 802.1p remarking ability
  * Input:
+ *      port     - Physical port number (0~7)
  *      enabled - 1: enabled, 0: disabled
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_ENABLE   - Invalid enable/disable input
+ *      RT_ERR_OK             - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
  * Note:
- *      If CPU tag function is disabled, CPU tag will not be added to frame
- *      forwarded to CPU port, and all ports cannot parse CPU tag.
+ *      None
  */
-int32_t rtl8367::rtl8367c_setAsicCputagEnable(uint32_t enabled)
+int32_t rtl8367::rtl8367c_setAsicRemarkingDot1pAbility(uint32_t port, uint32_t enabled)
 {
-    if (enabled > 1)
-        return RT_ERR_ENABLE;
-
-    return rtl8367c_setAsicRegBit(RTL8367C_REG_CPU_CTRL, RTL8367C_CPU_EN_OFFSET, enabled);
+    return rtl8367c_setAsicRegBit(RTL8367C_PORT_MISC_CFG_REG(port), RTL8367C_1QREMARK_ENABLE_OFFSET, enabled);
 }
-
 /* Function Name:
- *      rtl8367c_setAsicCputagPortmask
+ *      rtl8367c_setAsicRemarkingDscpAbility
  * Description:
- *      Set ports that can parse CPU tag
+ *      Set DSCP remarking ability
  * Input:
- *      portmask - port mask
+ *      enabled     - 1: enabled, 0: disabled
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_PORT_MASK    - Invalid portmask
+ *      RT_ERR_OK     - Success
+ *      RT_ERR_SMI  - SMI access error
  * Note:
- *     None
+ *      None
  */
-int32_t rtl8367::rtl8367c_setAsicCputagPortmask(uint32_t portmask)
-{
-    if (portmask > RTL8367C_PORTMASK)
-        return RT_ERR_PORT_MASK;
-
-    return rtl8367c_setAsicReg(RTL8367C_CPU_PORT_MASK_REG, portmask);
-}
-
-int32_t rtl8367::rtk_cpu_enable_set(rtk_enable_t enable)
+int32_t rtl8367::rtl8367c_setAsicRemarkingDscpAbility(uint32_t enabled)
 {
-    int32_t retVal;
-
-    if (enable >= RTK_ENABLE_END)
-        return RT_ERR_ENABLE;
-
-    if ((retVal = rtl8367c_setAsicCputagEnable(enable)) != RT_ERR_OK)
-        return retVal;
-
-    if (DISABLED == enable)
-    {
-        if ((retVal = rtl8367c_setAsicCputagPortmask(0)) != RT_ERR_OK)
-            return retVal;
-    }
-
-    return RT_ERR_OK;
+    return rtl8367c_setAsicRegBit(RTL8367C_REMARKING_CTRL_REG, RTL8367C_REMARKING_DSCP_ENABLE_OFFSET, enabled);
 }
-
 /* Function Name:
- *      rtl8367c_setAsicCputagTrapPort
+ *      rtl8367c_setAsicPriorityDot1qRemapping
  * Description:
- *      Set cpu tag trap port
+ *      Set 802.1Q absolutely priority
  * Input:
- *      port - port number
+ *      srcpriority - Priority value
+ *      priority     - Absolute priority value
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK                 - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_QOS_INT_PRIORITY    - Invalid priority
  * Note:
- *     API can set destination port of trapping frame
+ *      None
  */
-int32_t rtl8367::rtl8367c_setAsicCputagTrapPort(uint32_t port)
+int32_t rtl8367::rtl8367c_setAsicPriorityDot1qRemapping(uint32_t srcpriority, uint32_t priority)
 {
-    int32_t retVal;
-
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_CPU_CTRL, RTL8367C_CPU_TRAP_PORT_MASK, port & 7);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_CPU_CTRL, RTL8367C_CPU_TRAP_PORT_EXT_MASK, (port >> 3) & 1);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if ((srcpriority > RTL8367C_PRIMAX) || (priority > RTL8367C_PRIMAX))
+        return RT_ERR_QOS_INT_PRIORITY;
 
-    return RT_ERR_OK;
+    return rtl8367c_setAsicRegBits(RTL8367C_QOS_1Q_PRIORITY_REMAPPING_REG(srcpriority), RTL8367C_QOS_1Q_PRIORITY_REMAPPING_MASK(srcpriority), priority);
 }
-
 /* Function Name:
- *      rtl8367c_setAsicCputagInsertMode
+ *      rtl8367c_setAsicRemarkingDot1pParameter
  * Description:
- *      Set CPU-tag insert mode
+ *      Set 802.1p remarking parameter
  * Input:
- *      mode - 0: insert to all packets; 1: insert to trapped packets; 2: don't insert
+ *      priority     - Priority value
+ *      newPriority - New priority value
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_NOT_ALLOWED  - Actions not allowed by the function
+ *      RT_ERR_OK                 - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_QOS_INT_PRIORITY - Invalid priority
  * Note:
- *     None
+ *      None
  */
-int32_t rtl8367::rtl8367c_setAsicCputagInsertMode(uint32_t mode)
-{
-    if (mode >= CPUTAG_INSERT_END)
-        return RT_ERR_NOT_ALLOWED;
-
-    return rtl8367c_setAsicRegBits(RTL8367C_REG_CPU_CTRL, RTL8367C_CPU_INSERTMODE_MASK, mode);
-}
-int32_t rtl8367::rtk_cpu_tagPort_set(rtk_port_t port, rtk_cpu_insert_t mode)
+int32_t rtl8367::rtl8367c_setAsicRemarkingDot1pParameter(uint32_t priority, uint32_t newPriority)
 {
-    int32_t retVal;
-
-    /* Check port Valid */
-    RTK_CHK_PORT_VALID(port);
-
-    if (mode >= CPU_INSERT_END)
-        return RT_ERR_INPUT;
-
-    if ((retVal = rtl8367c_setAsicCputagPortmask(1 << rtk_switch_port_L2P_get(port))) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_setAsicCputagTrapPort(rtk_switch_port_L2P_get(port))) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_setAsicCputagInsertMode(mode)) != RT_ERR_OK)
-        return retVal;
+    if (priority > RTL8367C_PRIMAX || newPriority > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
 
-    return RT_ERR_OK;
+    return rtl8367c_setAsicRegBits(RTL8367C_QOS_1Q_REMARK_REG(priority), RTL8367C_QOS_1Q_REMARK_MASK(priority), newPriority);
 }
-
 /* Function Name:
- *      rtl8367c_getAsicCputagPortmask
+ *      rtl8367c_setAsicRemarkingDscpParameter
  * Description:
- *      Get ports that can parse CPU tag
+ *      Set DSCP remarking parameter
  * Input:
- *      pPortmask - port mask
+ *      priority     - Priority value
+ *      newDscp     - New DSCP value
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OK                 - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_QOS_DSCP_VALUE    - Invalid DSCP value
+ *      RT_ERR_QOS_INT_PRIORITY    - Invalid priority
  * Note:
- *     None
- */
-int32_t rtl8367::rtl8367c_getAsicCputagPortmask(uint32_t *pPortmask)
-{
-    return rtl8367c_getAsicReg(RTL8367C_CPU_PORT_MASK_REG, pPortmask);
-}
-/* Function Name:
- *      rtl8367c_getAsicCputagTrapPort
- * Description:
- *      Get cpu tag trap port
- * Input:
- *      pPort - port number
- * Output:
  *      None
- * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- * Note:
- *     None
  */
-int32_t rtl8367::rtl8367c_getAsicCputagTrapPort(uint32_t *pPort)
+int32_t rtl8367::rtl8367c_setAsicRemarkingDscpParameter(uint32_t priority, uint32_t newDscp)
 {
-    int32_t retVal;
-    uint32_t tmpPort;
-
-    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_CPU_CTRL, RTL8367C_CPU_TRAP_PORT_MASK, &tmpPort);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-    *pPort = tmpPort;
+    if (priority > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
 
-    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_CPU_CTRL, RTL8367C_CPU_TRAP_PORT_EXT_MASK, &tmpPort);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-    *pPort |= (tmpPort & 1) << 3;
+    if (newDscp > RTL8367C_DSCPMAX)
+        return RT_ERR_QOS_DSCP_VALUE;
 
-    return RT_ERR_OK;
+    return rtl8367c_setAsicRegBits(RTL8367C_QOS_DSCP_REMARK_REG(priority), RTL8367C_QOS_DSCP_REMARK_MASK(priority), newDscp);
 }
 /* Function Name:
- *      rtl8367c_getAsicCputagInsertMode
+ *      rtl8367c_setAsicPriorityDscpBased
  * Description:
- *      Get CPU-tag insert mode
+ *      Set DSCP-based priority
  * Input:
- *      pMode - 0: insert to all packets; 1: insert to trapped packets; 2: don't insert
+ *      dscp         - DSCP value
+ *      priority     - Priority value
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OK                 - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_QOS_DSCP_VALUE    - Invalid DSCP value
+ *      RT_ERR_QOS_INT_PRIORITY    - Invalid priority
  * Note:
- *     None
+ *      None
  */
-int32_t rtl8367::rtl8367c_getAsicCputagInsertMode(uint32_t *pMode)
+int32_t rtl8367::rtl8367c_setAsicPriorityDscpBased(uint32_t dscp, uint32_t priority)
 {
-    return rtl8367c_getAsicRegBits(RTL8367C_REG_CPU_CTRL, RTL8367C_CPU_INSERTMODE_MASK, pMode);
+    if (priority > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
+
+    if (dscp > RTL8367C_DSCPMAX)
+        return RT_ERR_QOS_DSCP_VALUE;
+
+    return rtl8367c_setAsicRegBits(RTL8367C_QOS_DSCP_TO_PRIORITY_REG(dscp), RTL8367C_QOS_DSCP_TO_PRIORITY_MASK(dscp), priority);
 }
-int32_t rtl8367::rtk_cpu_tagPort_get(rtk_port_t *pPort, rtk_cpu_insert_t *pMode)
+int32_t rtl8367::rtk_qos_init(uint32_t queueNum)
 {
+    RTK_SMI_STATS_SCOPE();
+    const uint16_t g_prioritytToQid[8][8] = {
+        {0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 7, 7, 7, 7},
+        {0, 0, 0, 0, 1, 1, 7, 7},
+        {0, 0, 1, 1, 2, 2, 7, 7},
+        {0, 0, 1, 1, 2, 3, 7, 7},
+        {0, 0, 1, 2, 3, 4, 7, 7},
+        {0, 0, 1, 2, 3, 4, 5, 7},
+        {0, 1, 2, 3, 4, 5, 6, 7}};
+
+    const uint32_t g_priorityDecision[8] = {0x01, 0x80, 0x04, 0x02, 0x20, 0x40, 0x10, 0x08};
+    const uint32_t g_prioritytRemap[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+
     int32_t retVal;
-    uint32_t pmsk, port;
+    uint32_t qmapidx;
+    uint32_t priority;
+    uint32_t priDec;
+    uint32_t port;
+    uint32_t dscp;
 
-    if (NULL == pPort)
-        return RT_ERR_NULL_POINTER;
+    if (queueNum <= 0 || queueNum > RTK_MAX_NUM_OF_QUEUE)
+        return RT_ERR_QUEUE_NUM;
 
-    if (NULL == pMode)
-        return RT_ERR_NULL_POINTER;
+    /*Set Output Queue Number*/
+    if (RTK_MAX_NUM_OF_QUEUE == queueNum)
+        qmapidx = 0;
+    else
+        qmapidx = queueNum;
 
-    if ((retVal = rtl8367c_getAsicCputagPortmask(&pmsk)) != RT_ERR_OK)
-        return retVal;
+    RTK_SCAN_ALL_PHY_PORTMASK(port)
+    {
+        if ((retVal = rtl8367c_setAsicOutputQueueMappingIndex(port, qmapidx)) != RT_ERR_OK)
+            return retVal;
+    }
 
-    if ((retVal = rtl8367c_getAsicCputagTrapPort(&port)) != RT_ERR_OK)
+    /*Set Priority to Qid*/
+    for (priority = 0; priority <= RTK_PRIMAX; priority++)
+    {
+        if ((retVal = rtl8367c_setAsicPriorityToQIDMappingTable(queueNum - 1, priority, g_prioritytToQid[queueNum - 1][priority])) != RT_ERR_OK)
+            return retVal;
+    }
+
+    /*Set Flow Control Type to Ingress Flow Control*/
+    if ((retVal = rtl8367c_setAsicFlowControlSelect(FC_INGRESS)) != RT_ERR_OK)
         return retVal;
 
-    *pPort = (rtk_port_t)rtk_switch_port_P2L_get(port);
+    /*Priority Decision Order*/
+    for (priDec = 0; priDec < PRIDEC_END; priDec++)
+    {
+        if ((retVal = rtl8367c_setAsicPriorityDecision(PRIDECTBL_IDX0, priDec, g_priorityDecision[priDec])) != RT_ERR_OK)
+            return retVal;
+        if ((retVal = rtl8367c_setAsicPriorityDecision(PRIDECTBL_IDX1, priDec, g_priorityDecision[priDec])) != RT_ERR_OK)
+            return retVal;
+    }
 
-    if ((retVal = rtl8367c_getAsicCputagInsertMode((uint32_t *)pMode)) != RT_ERR_OK)
+    /*Set Port-based Priority to 0*/
+    RTK_SCAN_ALL_PHY_PORTMASK(port)
+    {
+        if ((retVal = rtl8367c_setAsicPriorityPortBased(port, 0)) != RT_ERR_OK)
+            return retVal;
+    }
+
+    /*Disable 1p Remarking*/
+    RTK_SCAN_ALL_PHY_PORTMASK(port)
+    {
+        if ((retVal = rtl8367c_setAsicRemarkingDot1pAbility(port, DISABLED)) != RT_ERR_OK)
+            return retVal;
+    }
+
+    /*Disable DSCP Remarking*/
+    if ((retVal = rtl8367c_setAsicRemarkingDscpAbility(DISABLED)) != RT_ERR_OK)
         return retVal;
 
-    return RT_ERR_OK;
-}
+    /*Set 1p & DSCP  Priority Remapping & Remarking*/
+    for (priority = 0; priority <= RTL8367C_PRIMAX; priority++)
+    {
+        if ((retVal = rtl8367c_setAsicPriorityDot1qRemapping(priority, g_prioritytRemap[priority])) != RT_ERR_OK)
+            return retVal;
 
-// -------------- INTERRUPT --------------
+        if ((retVal = rtl8367c_setAsicRemarkingDot1pParameter(priority, 0)) != RT_ERR_OK)
+            return retVal;
 
-/* Function Name:
- *      rtl8367c_setAsicInterruptPolarity
- * Description:
- *      Set interrupt trigger polarity
- * Input:
- *      polarity    - 0:pull high 1: pull low
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK   - Success
- *      RT_ERR_SMI  - SMI access error
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicInterruptPolarity(uint32_t polarity)
-{
-    return rtl8367c_setAsicRegBit(RTL8367C_REG_INTR_CTRL, RTL8367C_INTR_CTRL_OFFSET, polarity);
-}
-int32_t rtl8367::rtk_int_polarity_set(rtk_int_polarity_t type)
-{
-    int32_t retVal;
+        if ((retVal = rtl8367c_setAsicRemarkingDscpParameter(priority, 0)) != RT_ERR_OK)
+            return retVal;
+    }
 
-    if (type >= INT_POLAR_END)
-        return RT_ERR_INPUT;
+    /*Set DSCP Priority*/
+    for (dscp = 0; dscp <= 63; dscp++)
+    {
+        if ((retVal = rtl8367c_setAsicPriorityDscpBased(dscp, 0)) != RT_ERR_OK)
+            return retVal;
+    }
 
-    if ((retVal = rtl8367c_setAsicInterruptPolarity(type)) != RT_ERR_OK)
+    /* Finetune B/T value */
+    if ((retVal = rtl8367c_setAsicReg(0x1722, 0x1158)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_getAsicInterruptPolarity
+ *      rtl8367c_setAsicPriorityPortBased
  * Description:
- *      Get interrupt trigger polarity
+ *      Set port based priority
  * Input:
- *      pPolarity   - 0:pull high 1: pull low
+ *      port         - Physical port number (0~7)
+ *      priority     - Priority value
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK   - Success
- *      RT_ERR_SMI  - SMI access error
+ *      RT_ERR_OK                 - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_QOS_INT_PRIORITY    - Invalid priority
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicInterruptPolarity(uint32_t *pPolarity)
-{
-    return rtl8367c_getAsicRegBit(RTL8367C_REG_INTR_CTRL, RTL8367C_INTR_CTRL_OFFSET, pPolarity);
-}
-
-int32_t rtl8367::rtk_int_polarity_get(rtk_int_polarity_t *pType)
+int32_t rtl8367::rtl8367c_setAsicPriorityPortBased(uint32_t port, uint32_t priority)
 {
     int32_t retVal;
 
-    if (NULL == pType)
-        return RT_ERR_NULL_POINTER;
-
-    if ((retVal = rtl8367c_getAsicInterruptPolarity((uint32_t *)pType)) != RT_ERR_OK)
-        return retVal;
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    if (priority > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
+
+    if (port < 8)
+    {
+        retVal = rtl8367c_setAsicRegBits(RTL8367C_QOS_PORTBASED_PRIORITY_REG(port), RTL8367C_QOS_PORTBASED_PRIORITY_MASK(port), priority);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+    else
+    {
+        retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_QOS_PORTBASED_PRIORITY_CTRL2, 0x7 << ((port - 8) << 2), priority);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
 
     return RT_ERR_OK;
 }
 
-/* Function Name:
- *      rtl8367c_getAsicInterruptMask
- * Description:
- *      Get interrupt enable mask
- * Input:
- *      pImr    - Interrupt mask
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK   - Success
- *      RT_ERR_SMI  - SMI access error
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicInterruptMask(uint32_t *pImr)
-{
-    return rtl8367c_getAsicReg(RTL8367C_REG_INTR_IMR, pImr);
-}
-/* Function Name:
- *      rtl8367c_setAsicInterruptMask
- * Description:
- *      Set interrupt enable mask
- * Input:
- *      imr     - Interrupt mask
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK   - Success
- *      RT_ERR_SMI  - SMI access error
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicInterruptMask(uint32_t imr)
-{
-    return rtl8367c_setAsicReg(RTL8367C_REG_INTR_IMR, imr);
-}
-int32_t rtl8367::rtk_int_control_set(rtk_int_type_t type, rtk_enable_t enable)
+int32_t rtl8367::rtk_qos_portPri_set(rtk_port_t port, uint32_t int_pri)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t mask;
 
-    if (type >= INT_TYPE_END)
-        return RT_ERR_INPUT;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if (type == INT_TYPE_RESERVED)
-        return RT_ERR_INPUT;
+    if (int_pri > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
 
-    if ((retVal = rtl8367c_getAsicInterruptMask(&mask)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_setAsicPriorityPortBased(rtk_switch_port_L2P_get(port), int_pri)) != RT_ERR_OK)
         return retVal;
 
-    if (ENABLED == enable)
-        mask = mask | (1 << type);
-    else if (DISABLED == enable)
-        mask = mask & ~(1 << type);
-    else
-        return RT_ERR_INPUT;
+    return RT_ERR_OK;
+}
 
-    if ((retVal = rtl8367c_setAsicInterruptMask(mask)) != RT_ERR_OK)
+int32_t rtl8367::rtk_qos_1pPriRemap_set(uint32_t dot1p_pri, uint32_t int_pri)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if (dot1p_pri > RTL8367C_PRIMAX || int_pri > RTL8367C_PRIMAX)
+        return RT_ERR_VLAN_PRIORITY;
+
+    if ((retVal = rtl8367c_setAsicPriorityDot1qRemapping(dot1p_pri, int_pri)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_int_control_get(rtk_int_type_t type, rtk_enable_t *pEnable)
+int32_t rtl8367::rtk_qos_priSel_set(rtk_qos_priDecTbl_t index, rtk_priority_select_t *pPriDec)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t mask;
+    uint32_t port_pow;
+    uint32_t dot1q_pow;
+    uint32_t dscp_pow;
+    uint32_t acl_pow;
+    uint32_t svlan_pow;
+    uint32_t cvlan_pow;
+    uint32_t smac_pow;
+    uint32_t dmac_pow;
+    uint32_t i;
 
-    if (NULL == pEnable)
-        return RT_ERR_NULL_POINTER;
+    if (index < 0 || index >= PRIDECTBL_END)
+        return RT_ERR_ENTRY_INDEX;
 
-    if ((retVal = rtl8367c_getAsicInterruptMask(&mask)) != RT_ERR_OK)
+    if (pPriDec->port_pri >= 8 || pPriDec->dot1q_pri >= 8 || pPriDec->acl_pri >= 8 || pPriDec->dscp_pri >= 8 ||
+        pPriDec->cvlan_pri >= 8 || pPriDec->svlan_pri >= 8 || pPriDec->dmac_pri >= 8 || pPriDec->smac_pri >= 8)
+        return RT_ERR_QOS_SEL_PRI_SOURCE;
+
+    port_pow = 1;
+    for (i = pPriDec->port_pri; i > 0; i--)
+        port_pow = (port_pow)*2;
+
+    dot1q_pow = 1;
+    for (i = pPriDec->dot1q_pri; i > 0; i--)
+        dot1q_pow = (dot1q_pow)*2;
+
+    acl_pow = 1;
+    for (i = pPriDec->acl_pri; i > 0; i--)
+        acl_pow = (acl_pow)*2;
+
+    dscp_pow = 1;
+    for (i = pPriDec->dscp_pri; i > 0; i--)
+        dscp_pow = (dscp_pow)*2;
+
+    svlan_pow = 1;
+    for (i = pPriDec->svlan_pri; i > 0; i--)
+        svlan_pow = (svlan_pow)*2;
+
+    cvlan_pow = 1;
+    for (i = pPriDec->cvlan_pri; i > 0; i--)
+        cvlan_pow = (cvlan_pow)*2;
+
+    dmac_pow = 1;
+    for (i = pPriDec->dmac_pri; i > 0; i--)
+        dmac_pow = (dmac_pow)*2;
+
+    smac_pow = 1;
+    for (i = pPriDec->smac_pri; i > 0; i--)
+        smac_pow = (smac_pow)*2;
+
+    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_PORT, port_pow)) != RT_ERR_OK)
         return retVal;
 
-    if (0 == (mask & (1 << type)))
-        *pEnable = (rtk_enable_t)0;
-    else
-        *pEnable = (rtk_enable_t)1;
+    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_ACL, acl_pow)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_DSCP, dscp_pow)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_1Q, dot1q_pow)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_1AD, svlan_pow)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_CVLAN, cvlan_pow)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_DA, dmac_pow)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicPriorityDecision(index, PRIDEC_SA, smac_pow)) != RT_ERR_OK)
+        return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_getAsicInterruptStatus
+ *      rtl8367c_setAsicPortPriorityDecisionIndex
  * Description:
- *      Get interrupt enable mask
+ *      Set priority decision index for each port
  * Input:
- *      pIms    - Interrupt status mask
+ *      port     - Physical port number (0~7)
+ *      index     - Table index
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK   - Success
- *      RT_ERR_SMI  - SMI access error
+ *      RT_ERR_OK             - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_QUEUE_NUM      - Invalid queue number
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicInterruptStatus(uint32_t *pIms)
+int32_t rtl8367::rtl8367c_setAsicPortPriorityDecisionIndex(uint32_t port, uint32_t index)
 {
-    return rtl8367c_getAsicReg(RTL8367C_REG_INTR_IMS, pIms);
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    if (index >= PRIDEC_IDX_END)
+        return RT_ERR_ENTRY_INDEX;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_QOS_INTERNAL_PRIORITY_DECISION_IDX_CTRL, port, index);
 }
 
-int32_t rtl8367::rtk_int_status_get(rtk_int_status_t *pStatusMask)
+int32_t rtl8367::rtk_qos_portPriSelIndex_set(rtk_port_t port, rtk_qos_priDecTbl_t index)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t ims_mask;
 
-    if (NULL == pStatusMask)
-        return RT_ERR_NULL_POINTER;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if ((retVal = rtl8367c_getAsicInterruptStatus(&ims_mask)) != RT_ERR_OK)
+    if (index >= PRIDECTBL_END)
+        return RT_ERR_ENTRY_INDEX;
+
+    if ((retVal = rtl8367c_setAsicPortPriorityDecisionIndex(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
         return retVal;
 
-    pStatusMask->value[0] = (ims_mask & 0x00000FFF);
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_qos_priMap_set(uint32_t queue_num, rtk_qos_pri2queue_t *pPri2qid)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pri;
+
+    if ((0 == queue_num) || (queue_num > RTK_MAX_NUM_OF_QUEUE))
+        return RT_ERR_QUEUE_NUM;
+
+    for (pri = 0; pri <= RTK_PRIMAX; pri++)
+    {
+        if (pPri2qid->pri2queue[pri] > RTK_QIDMAX)
+            return RT_ERR_QUEUE_ID;
+
+        if ((retVal = rtl8367c_setAsicPriorityToQIDMappingTable(queue_num - 1, pri, pPri2qid->pri2queue[pri])) != RT_ERR_OK)
+            return retVal;
+    }
+
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicInterruptMask
+ *      rtl8367c_setAsicQueueType
  * Description:
- *      Clear interrupt enable mask
+ *      Set type of a queue
  * Input:
- *      ims     - Interrupt status mask
+ *      port        - Physical port number (0~10)
+ *      qid         - The queue ID wanted to set
+ *      queueType   - The specified queue type. 0b0: Strict priority, 0b1: WFQ
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK   - Success
- *      RT_ERR_SMI  - SMI access error
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_QUEUE_ID - Invalid queue id
  * Note:
- *      This API can be used to clear ASIC interrupt status and register will be cleared by writting 1.
- *      [0]:Link change,
- *      [1]:Share meter exceed,
- *      [2]:Learn number overed,
- *      [3]:Speed Change,
- *      [4]:Tx special congestion
- *      [5]:1 second green feature
- *      [6]:loop detection
- *      [7]:interrupt from 8051
- *      [8]:Cable diagnostic finish
- *      [9]:ACL action interrupt trigger
- *      [11]: Silent Start
+ *      None
  */
-int32_t rtl8367::rtl8367c_setAsicInterruptStatus(uint32_t ims)
-{
-    return rtl8367c_setAsicReg(RTL8367C_REG_INTR_IMS, ims);
-}
-int32_t rtl8367::rtk_int_status_set(rtk_int_status_t *pStatusMask)
+int32_t rtl8367::rtl8367c_setAsicQueueType(uint32_t port, uint32_t qid, uint32_t queueType)
 {
     int32_t retVal;
 
-    if (NULL == pStatusMask)
-        return RT_ERR_NULL_POINTER;
-
-    if (pStatusMask->value[0] & (0x0001 << INT_TYPE_RESERVED))
-        return RT_ERR_INPUT;
+    /* Invalid input parameter */
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    if (pStatusMask->value[0] >= (0x0001 << INT_TYPE_END))
-        return RT_ERR_INPUT;
+    if (qid > RTL8367C_QIDMAX)
+        return RT_ERR_QUEUE_ID;
 
-    if ((retVal = rtl8367c_setAsicInterruptStatus((uint32_t)pStatusMask->value[0])) != RT_ERR_OK)
-        return retVal;
+    /* Set Related Registers */
+    retVal = rtl8367c_setAsicRegBit(RTL8367C_SCHEDULE_QUEUE_TYPE_REG(port), RTL8367C_SCHEDULE_QUEUE_TYPE_OFFSET(port, qid), queueType);
 
-    return RT_ERR_OK;
+    return retVal;
 }
 
-int32_t rtl8367::_rtk_int_Advidx_get(rtk_int_advType_t adv_type, uint32_t *pAsic_idx)
+/* Function Name:
+ *      rtl8367c_setAsicWFQWeight
+ * Description:
+ *      Set weight  of a queue
+ * Input:
+ *      port    - Physical port number (0~10)
+ *      qid     - The queue ID wanted to set
+ *      qWeight - The weight value wanted to set (valid:0~127)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_QUEUE_ID         - Invalid queue id
+ *      RT_ERR_QOS_QUEUE_WEIGHT - Invalid queue weight
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicWFQWeight(uint32_t port, uint32_t qid, uint32_t qWeight)
 {
-    uint32_t asic_idx[ADV_END] =
+    int32_t retVal;
+
+    /* Invalid input parameter */
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    if (qid > RTL8367C_QIDMAX)
+        return RT_ERR_QUEUE_ID;
+
+    if (qWeight > RTL8367C_QWEIGHTMAX && qid > 0)
+        return RT_ERR_QOS_QUEUE_WEIGHT;
+
+    retVal = rtl8367c_setAsicReg(RTL8367C_SCHEDULE_PORT_QUEUE_WFQ_WEIGHT_REG(port, qid), qWeight);
+
+    return retVal;
+}
+int32_t rtl8367::rtk_qos_schedulingQueue_set(rtk_port_t port, rtk_qos_queue_weights_t *pQweights)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t qid;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    for (qid = 0; qid < RTL8367C_QUEUENO; qid++)
+    {
+
+        if (pQweights->weights[qid] > QOS_WEIGHT_MAX)
+            return RT_ERR_QOS_QUEUE_WEIGHT;
+
+        if (0 == pQweights->weights[qid])
         {
-            INTRST_L2_LEARN,
-            INTRST_SPEED_CHANGE,
-            INTRST_SPECIAL_CONGESTION,
-            INTRST_PORT_LINKDOWN,
-            INTRST_PORT_LINKUP,
-            ADV_NOT_SUPPORT,
-            INTRST_RLDP_LOOPED,
-            INTRST_RLDP_RELEASED,
-        };
+            if ((retVal = rtl8367c_setAsicQueueType(rtk_switch_port_L2P_get(port), qid, QTYPE_STRICT)) != RT_ERR_OK)
+                return retVal;
+        }
+        else
+        {
+            if ((retVal = rtl8367c_setAsicQueueType(rtk_switch_port_L2P_get(port), qid, QTYPE_WFQ)) != RT_ERR_OK)
+                return retVal;
 
-    if (adv_type >= ADV_END)
+            if ((retVal = rtl8367c_setAsicWFQWeight(rtk_switch_port_L2P_get(port), qid, pQweights->weights[qid])) != RT_ERR_OK)
+                return retVal;
+        }
+    }
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicWFQBurstSize
+ * Description:
+ *      Set WFQ leaky bucket burst size
+ * Input:
+ *      burstsize   - Leaky bucket burst size, default 0x1000 (unit: byte)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicWFQBurstSize(uint32_t burstsize)
+{
+    return rtl8367c_setAsicReg(RTL8367C_SCHEDULE_WFQ_BURST_SIZE_REG, burstsize);
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicWFQBurstSize
+ * Description:
+ *      Get WFQ leaky bucket burst size
+ * Input:
+ *      None
+ * Output:
+ *      pBurstsize  - Leaky bucket burst size (unit: byte)
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicWFQBurstSize(uint32_t *pBurstsize)
+{
+    return rtl8367c_getAsicReg(RTL8367C_SCHEDULE_WFQ_BURST_SIZE_REG, pBurstsize);
+}
+
+/* Function Name:
+ *      rtk_qos_wfqBurstSize_set
+ * Description:
+ *      Set the leaky bucket burst size of the WFQ scheduler
+ * Input:
+ *      burstSize - Burst size in bytes (0~0xFFFF)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - OK
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_INPUT    - Invalid burst size
+ * Note:
+ *      The setting is shared by every WFQ queue of every port. A smaller
+ *      burst tracks the configured weights more closely, a larger one lets
+ *      bulk queues send longer trains between strict-priority frames.
+ */
+int32_t rtl8367::rtk_qos_wfqBurstSize_set(uint32_t burstSize)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if (burstSize > RTL8367C_REGDATAMAX)
         return RT_ERR_INPUT;
 
-    if (asic_idx[adv_type] == ADV_NOT_SUPPORT)
-        return RT_ERR_CHIP_NOT_SUPPORTED;
+    if ((retVal = rtl8367c_setAsicWFQBurstSize(burstSize)) != RT_ERR_OK)
+        return retVal;
 
-    *pAsic_idx = asic_idx[adv_type];
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_getAsicInterruptRelatedStatus
+ *      rtk_qos_wfqBurstSize_get
  * Description:
- *      Get interrupt status
+ *      Get the leaky bucket burst size of the WFQ scheduler
  * Input:
- *      type    - per port Learn over, per-port speed change, per-port special congest, share meter exceed status
- *      pStatus     - exceed status, write 1 to clear
- * Output:
  *      None
+ * Output:
+ *      pBurstSize - Burst size in bytes
  * Return:
- *      RT_ERR_OK           - Success
+ *      RT_ERR_OK           - OK
  *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicInterruptRelatedStatus(uint32_t type, uint32_t *pStatus)
+int32_t rtl8367::rtk_qos_wfqBurstSize_get(uint32_t *pBurstSize)
 {
-    const uint32_t indicatorAddress[INTRST_END] = {RTL8367C_REG_LEARN_OVER_INDICATOR,
-                                                   RTL8367C_REG_SPEED_CHANGE_INDICATOR,
-                                                   RTL8367C_REG_SPECIAL_CONGEST_INDICATOR,
-                                                   RTL8367C_REG_PORT_LINKDOWN_INDICATOR,
-                                                   RTL8367C_REG_PORT_LINKUP_INDICATOR,
-                                                   RTL8367C_REG_METER_OVERRATE_INDICATOR0,
-                                                   RTL8367C_REG_METER_OVERRATE_INDICATOR1,
-                                                   RTL8367C_REG_RLDP_LOOPED_INDICATOR,
-                                                   RTL8367C_REG_RLDP_RELEASED_INDICATOR,
-                                                   RTL8367C_REG_SYSTEM_LEARN_OVER_INDICATOR};
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-    if (type >= INTRST_END)
-        return RT_ERR_OUT_OF_RANGE;
+    if (NULL == pBurstSize)
+        return RT_ERR_NULL_POINTER;
 
-    return rtl8367c_getAsicReg(indicatorAddress[type], pStatus);
+    if ((retVal = rtl8367c_getAsicWFQBurstSize(pBurstSize)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
 }
+
+// ----------------- CPU -----------------
+
 /* Function Name:
- *      rtl8367c_setAsicInterruptRelatedStatus
+ *      rtl8367c_setAsicCputagEnable
  * Description:
- *      Clear interrupt status
+ *      Set cpu tag function enable/disable
  * Input:
- *      type    - per port Learn over, per-port speed change, per-port special congest, share meter exceed status
- *      status  - exceed status, write 1 to clear
+ *      enabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_ENABLE   - Invalid enable/disable input
+ * Note:
+ *      If CPU tag function is disabled, CPU tag will not be added to frame
+ *      forwarded to CPU port, and all ports cannot parse CPU tag.
+ */
+int32_t rtl8367::rtl8367c_setAsicCputagEnable(uint32_t enabled)
+{
+    if (enabled > 1)
+        return RT_ERR_ENABLE;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_REG_CPU_CTRL, RTL8367C_CPU_EN_OFFSET, enabled);
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicCputagPortmask
+ * Description:
+ *      Set ports that can parse CPU tag
+ * Input:
+ *      portmask - port mask
  * Output:
  *      None
  * Return:
  *      RT_ERR_OK           - Success
  *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ *      RT_ERR_PORT_MASK    - Invalid portmask
  * Note:
- *      None
+ *     None
  */
-int32_t rtl8367::rtl8367c_setAsicInterruptRelatedStatus(uint32_t type, uint32_t status)
+int32_t rtl8367::rtl8367c_setAsicCputagPortmask(uint32_t portmask)
 {
-    const uint32_t indicatorAddress[INTRST_END] = {RTL8367C_REG_LEARN_OVER_INDICATOR,
-                                                   RTL8367C_REG_SPEED_CHANGE_INDICATOR,
-                                                   RTL8367C_REG_SPECIAL_CONGEST_INDICATOR,
-                                                   RTL8367C_REG_PORT_LINKDOWN_INDICATOR,
-                                                   RTL8367C_REG_PORT_LINKUP_INDICATOR,
-                                                   RTL8367C_REG_METER_OVERRATE_INDICATOR0,
-                                                   RTL8367C_REG_METER_OVERRATE_INDICATOR1,
-                                                   RTL8367C_REG_RLDP_LOOPED_INDICATOR,
-                                                   RTL8367C_REG_RLDP_RELEASED_INDICATOR,
-                                                   RTL8367C_REG_SYSTEM_LEARN_OVER_INDICATOR};
-
-    if (type >= INTRST_END)
-        return RT_ERR_OUT_OF_RANGE;
+    if (portmask > RTL8367C_PORTMASK)
+        return RT_ERR_PORT_MASK;
 
-    return rtl8367c_setAsicReg(indicatorAddress[type], status);
+    return rtl8367c_setAsicReg(RTL8367C_CPU_PORT_MASK_REG, portmask);
 }
-int32_t rtl8367::rtk_int_advanceInfo_get(rtk_int_advType_t adv_type, rtk_int_info_t *pInfo)
+
+int32_t rtl8367::rtk_cpu_enable_set(rtk_enable_t enable)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t data;
-    uint32_t intAdvType;
 
-    if (adv_type >= ADV_END)
-        return RT_ERR_INPUT;
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
 
-    if (NULL == pInfo)
-        return RT_ERR_NULL_POINTER;
+    if ((retVal = rtl8367c_setAsicCputagEnable(enable)) != RT_ERR_OK)
+        return retVal;
 
-    if (adv_type != ADV_METER_EXCEED_MASK)
+    if (DISABLED == enable)
     {
-        if ((retVal = _rtk_int_Advidx_get(adv_type, &intAdvType)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_setAsicCputagPortmask(0)) != RT_ERR_OK)
             return retVal;
     }
 
-    switch (adv_type)
-    {
-    case ADV_L2_LEARN_PORT_MASK:
-        /* Get physical portmask */
-        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(intAdvType, &data)) != RT_ERR_OK)
-            return retVal;
-
-        /* Clear Advanced Info */
-        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(intAdvType, 0xFFFF)) != RT_ERR_OK)
-            return retVal;
-
-        /* Translate to logical portmask */
-        if ((retVal = rtk_switch_portmask_P2L_get(data, &(pInfo->portMask))) != RT_ERR_OK)
-            return retVal;
+    return RT_ERR_OK;
+}
 
-        /* Get system learn */
-        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(INTRST_SYS_LEARN, &data)) != RT_ERR_OK)
-            return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicCputagTrapPort
+ * Description:
+ *      Set cpu tag trap port
+ * Input:
+ *      port - port number
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *     API can set destination port of trapping frame
+ */
+int32_t rtl8367::rtl8367c_setAsicCputagTrapPort(uint32_t port)
+{
+    int32_t retVal;
 
-        /* Clear system learn */
-        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(INTRST_SYS_LEARN, 0x0001)) != RT_ERR_OK)
-            return retVal;
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-        pInfo->systemLearnOver = data;
-        break;
-    case ADV_SPEED_CHANGE_PORT_MASK:
-    case ADV_SPECIAL_CONGESTION_PORT_MASK:
-    case ADV_PORT_LINKDOWN_PORT_MASK:
-    case ADV_PORT_LINKUP_PORT_MASK:
-    case ADV_RLDP_LOOPED:
-    case ADV_RLDP_RELEASED:
-        /* Get physical portmask */
-        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(intAdvType, &data)) != RT_ERR_OK)
-            return retVal;
+    retVal = rtl8367c_setAsicField<RTL8367C_FIELD(CPU_CTRL, CPU_TRAP_PORT)>(port & 7);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-        /* Clear Advanced Info */
-        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(intAdvType, 0xFFFF)) != RT_ERR_OK)
-            return retVal;
+    retVal = rtl8367c_setAsicField<RTL8367C_FIELD(CPU_CTRL, CPU_TRAP_PORT_EXT)>((port >> 3) & 1);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-        /* Translate to logical portmask */
-        if ((retVal = rtk_switch_portmask_P2L_get(data, &(pInfo->portMask))) != RT_ERR_OK)
-            return retVal;
+    return RT_ERR_OK;
+}
 
-        break;
-    case ADV_METER_EXCEED_MASK:
-        /* Get Meter Mask */
-        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(INTRST_METER0_15, &data)) != RT_ERR_OK)
-            return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicCputagInsertMode
+ * Description:
+ *      Set CPU-tag insert mode
+ * Input:
+ *      mode - 0: insert to all packets; 1: insert to trapped packets; 2: don't insert
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NOT_ALLOWED  - Actions not allowed by the function
+ * Note:
+ *     None
+ */
+int32_t rtl8367::rtl8367c_setAsicCputagInsertMode(uint32_t mode)
+{
+    if (mode >= CPUTAG_INSERT_END)
+        return RT_ERR_NOT_ALLOWED;
 
-        /* Clear Advanced Info */
-        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(INTRST_METER0_15, 0xFFFF)) != RT_ERR_OK)
-            return retVal;
+    return rtl8367c_setAsicField<RTL8367C_FIELD(CPU_CTRL, CPU_INSERTMODE)>(mode);
+}
+int32_t rtl8367::rtk_cpu_tagPort_set(rtk_port_t port, rtk_cpu_insert_t mode)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-        pInfo->meterMask = data & 0xFFFF;
+    /* Check port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-        /* Get Meter Mask */
-        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(INTRST_METER16_31, &data)) != RT_ERR_OK)
-            return retVal;
+    if (mode >= CPU_INSERT_END)
+        return RT_ERR_INPUT;
 
-        /* Clear Advanced Info */
-        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(INTRST_METER16_31, 0xFFFF)) != RT_ERR_OK)
-            return retVal;
+    if ((retVal = rtl8367c_setAsicCputagPortmask(1 << rtk_switch_port_L2P_get(port))) != RT_ERR_OK)
+        return retVal;
 
-        pInfo->meterMask = pInfo->meterMask | ((data << 16) & 0xFFFF0000);
+    if ((retVal = rtl8367c_setAsicCputagTrapPort(rtk_switch_port_L2P_get(port))) != RT_ERR_OK)
+        return retVal;
 
-        break;
-    default:
-        return RT_ERR_INPUT;
-    }
+    if ((retVal = rtl8367c_setAsicCputagInsertMode(mode)) != RT_ERR_OK)
+        return retVal;
 
     return RT_ERR_OK;
 }
 
-// ----------------------- MIB -----------------------
-
-#define MIB_NOT_SUPPORT (0xFFFF)
-int32_t rtl8367::_get_asic_mib_idx(rtk_stat_port_type_t cnt_idx, RTL8367C_MIBCOUNTER *pMib_idx)
+/* Function Name:
+ *      rtl8367c_getAsicCputagPortmask
+ * Description:
+ *      Get ports that can parse CPU tag
+ * Input:
+ *      pPortmask - port mask
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ * Note:
+ *     None
+ */
+int32_t rtl8367::rtl8367c_getAsicCputagPortmask(uint32_t *pPortmask)
 {
-    RTL8367C_MIBCOUNTER mib_asic_idx[STAT_PORT_CNTR_END] =
-        {
-            ifInOctets,                           /* STAT_IfInOctets */
-            dot3StatsFCSErrors,                   /* STAT_Dot3StatsFCSErrors */
-            dot3StatsSymbolErrors,                /* STAT_Dot3StatsSymbolErrors */
-            dot3InPauseFrames,                    /* STAT_Dot3InPauseFrames */
-            dot3ControlInUnknownOpcodes,          /* STAT_Dot3ControlInUnknownOpcodes */
-            etherStatsFragments,                  /* STAT_EtherStatsFragments */
-            etherStatsJabbers,                    /* STAT_EtherStatsJabbers */
-            ifInUcastPkts,                        /* STAT_IfInUcastPkts */
-            etherStatsDropEvents,                 /* STAT_EtherStatsDropEvents */
-            etherStatsOctets,                     /* STAT_EtherStatsOctets */
-            etherStatsUnderSizePkts,              /* STAT_EtherStatsUnderSizePkts */
-            etherOversizeStats,                   /* STAT_EtherOversizeStats */
-            etherStatsPkts64Octets,               /* STAT_EtherStatsPkts64Octets */
-            etherStatsPkts65to127Octets,          /* STAT_EtherStatsPkts65to127Octets */
-            etherStatsPkts128to255Octets,         /* STAT_EtherStatsPkts128to255Octets */
-            etherStatsPkts256to511Octets,         /* STAT_EtherStatsPkts256to511Octets */
-            etherStatsPkts512to1023Octets,        /* STAT_EtherStatsPkts512to1023Octets */
-            etherStatsPkts1024to1518Octets,       /* STAT_EtherStatsPkts1024to1518Octets */
-            ifInMulticastPkts,                    /* STAT_EtherStatsMulticastPkts */
-            ifInBroadcastPkts,                    /* STAT_EtherStatsBroadcastPkts */
-            ifOutOctets,                          /* STAT_IfOutOctets */
-            dot3StatsSingleCollisionFrames,       /* STAT_Dot3StatsSingleCollisionFrames */
-            dot3StatMultipleCollisionFrames,      /* STAT_Dot3StatsMultipleCollisionFrames */
-            dot3sDeferredTransmissions,           /* STAT_Dot3StatsDeferredTransmissions */
-            dot3StatsLateCollisions,              /* STAT_Dot3StatsLateCollisions */
-            etherStatsCollisions,                 /* STAT_EtherStatsCollisions */
-            dot3StatsExcessiveCollisions,         /* STAT_Dot3StatsExcessiveCollisions */
-            dot3OutPauseFrames,                   /* STAT_Dot3OutPauseFrames */
-            (RTL8367C_MIBCOUNTER)MIB_NOT_SUPPORT, /* STAT_Dot1dBasePortDelayExceededDiscards */
-            dot1dTpPortInDiscards,                /* STAT_Dot1dTpPortInDiscards */
-            ifOutUcastPkts,                       /* STAT_IfOutUcastPkts */
-            ifOutMulticastPkts,                   /* STAT_IfOutMulticastPkts */
-            ifOutBroadcastPkts,                   /* STAT_IfOutBroadcastPkts */
-            outOampduPkts,                        /* STAT_OutOampduPkts */
-            inOampduPkts,                         /* STAT_InOampduPkts */
-            (RTL8367C_MIBCOUNTER)MIB_NOT_SUPPORT, /* STAT_PktgenPkts */
-            inMldChecksumError,                   /* STAT_InMldChecksumError */
-            inIgmpChecksumError,                  /* STAT_InIgmpChecksumError */
-            inMldSpecificQuery,                   /* STAT_InMldSpecificQuery */
-            inMldGeneralQuery,                    /* STAT_InMldGeneralQuery */
-            inIgmpSpecificQuery,                  /* STAT_InIgmpSpecificQuery */
-            inIgmpGeneralQuery,                   /* STAT_InIgmpGeneralQuery */
-            inMldLeaves,                          /* STAT_InMldLeaves */
-            inIgmpLeaves,                         /* STAT_InIgmpInterfaceLeaves */
-            inIgmpJoinsSuccess,                   /* STAT_InIgmpJoinsSuccess */
-            inIgmpJoinsFail,                      /* STAT_InIgmpJoinsFail */
-            inMldJoinsSuccess,                    /* STAT_InMldJoinsSuccess */
-            inMldJoinsFail,                       /* STAT_InMldJoinsFail */
-            inReportSuppressionDrop,              /* STAT_InReportSuppressionDrop */
-            inLeaveSuppressionDrop,               /* STAT_InLeaveSuppressionDrop */
-            outIgmpReports,                       /* STAT_OutIgmpReports */
-            outIgmpLeaves,                        /* STAT_OutIgmpLeaves */
-            outIgmpGeneralQuery,                  /* STAT_OutIgmpGeneralQuery */
-            outIgmpSpecificQuery,                 /* STAT_OutIgmpSpecificQuery */
-            outMldReports,                        /* STAT_OutMldReports */
-            outMldLeaves,                         /* STAT_OutMldLeaves */
-            outMldGeneralQuery,                   /* STAT_OutMldGeneralQuery */
-            outMldSpecificQuery,                  /* STAT_OutMldSpecificQuery */
-            inKnownMulticastPkts,                 /* STAT_InKnownMulticastPkts */
-            ifInMulticastPkts,                    /* STAT_IfInMulticastPkts */
-            ifInBroadcastPkts,                    /* STAT_IfInBroadcastPkts */
-            ifOutDiscards                         /* STAT_IfOutDiscards */
-        };
+    return rtl8367c_getAsicReg(RTL8367C_CPU_PORT_MASK_REG, pPortmask);
+}
+/* Function Name:
+ *      rtl8367c_getAsicCputagTrapPort
+ * Description:
+ *      Get cpu tag trap port
+ * Input:
+ *      pPort - port number
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ * Note:
+ *     None
+ */
+int32_t rtl8367::rtl8367c_getAsicCputagTrapPort(uint32_t *pPort)
+{
+    int32_t retVal;
+    uint32_t tmpPort;
 
-    if (cnt_idx >= STAT_PORT_CNTR_END)
-        return RT_ERR_STAT_INVALID_PORT_CNTR;
+    retVal = rtl8367c_getAsicField<RTL8367C_FIELD(CPU_CTRL, CPU_TRAP_PORT)>(&tmpPort);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+    *pPort = tmpPort;
 
-    if (mib_asic_idx[cnt_idx] == MIB_NOT_SUPPORT)
-        return RT_ERR_CHIP_NOT_SUPPORTED;
+    retVal = rtl8367c_getAsicField<RTL8367C_FIELD(CPU_CTRL, CPU_TRAP_PORT_EXT)>(&tmpPort);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+    *pPort |= (tmpPort & 1) << 3;
 
-    *pMib_idx = mib_asic_idx[cnt_idx];
     return RT_ERR_OK;
 }
 /* Function Name:
- *      rtl8367c_getAsicMIBsCounter
+ *      rtl8367c_getAsicCputagInsertMode
  * Description:
- *      Get MIBs counter
+ *      Get CPU-tag insert mode
  * Input:
- *      port        - Physical port number (0~7)
- *      mibIdx      - MIB counter index
- *      pCounter    - MIB retrived counter
+ *      pMode - 0: insert to all packets; 1: insert to trapped packets; 2: don't insert
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PORT_ID          - Invalid port number
- *      RT_ERR_BUSYWAIT_TIMEOUT - MIB is busy at retrieving
- *      RT_ERR_STAT_CNTR_FAIL   - MIB is resetting
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
  * Note:
- *      Before MIBs counter retrieving, writting accessing address to ASIC at first and check the MIB
- *      control register status. If busy bit of MIB control is set, that means MIB counter have been
- *      waiting for preparing, then software must wait atfer this busy flag reset by ASIC. This driver
- *      did not recycle reading user desired counter. Software must use driver again to get MIB counter
- *      if return value is not RT_ERR_OK.
+ *     None
  */
-int32_t rtl8367::rtl8367c_getAsicMIBsCounter(uint32_t port, RTL8367C_MIBCOUNTER mibIdx, uint64_t *pCounter)
+int32_t rtl8367::rtl8367c_getAsicCputagInsertMode(uint32_t *pMode)
+{
+    return rtl8367c_getAsicField<RTL8367C_FIELD(CPU_CTRL, CPU_INSERTMODE)>(pMode);
+}
+int32_t rtl8367::rtk_cpu_tagPort_get(rtk_port_t *pPort, rtk_cpu_insert_t *pMode)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t regAddr;
-    uint32_t regData;
-    uint32_t mibAddr;
-    uint32_t mibOff = 0;
+    uint32_t pmsk, port;
 
-    /* address offset to MIBs counter */
-    const uint16_t mibLength[RTL8367C_MIBS_NUMBER] = {
-        4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-        4, 2, 2, 2, 2, 2, 2, 2, 2,
-        4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
-        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
+    if (NULL == pPort)
+        return RT_ERR_NULL_POINTER;
 
-    uint16_t i;
-    uint64_t mibCounter;
+    if (NULL == pMode)
+        return RT_ERR_NULL_POINTER;
 
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
+    if ((retVal = rtl8367c_getAsicCputagPortmask(&pmsk)) != RT_ERR_OK)
+        return retVal;
 
-    if (mibIdx >= RTL8367C_MIBS_NUMBER)
-        return RT_ERR_STAT_INVALID_CNTR;
-
-    if (dot1dTpLearnedEntryDiscards == mibIdx)
-    {
-        mibAddr = RTL8367C_MIB_LEARNENTRYDISCARD_OFFSET;
-    }
-    else
-    {
-        i = 0;
-        mibOff = RTL8367C_MIB_PORT_OFFSET * port;
-
-        if (port > 7)
-            mibOff = mibOff + 68;
-
-        while (i < mibIdx)
-        {
-            mibOff += mibLength[i];
-            i++;
-        }
-
-        mibAddr = mibOff;
-    }
-
-    /* Read MIB addr before writing */
-    retVal = rtl8367c_getAsicReg(RTL8367C_REG_MIB_ADDRESS, &regData);
-    if (retVal != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicCputagTrapPort(&port)) != RT_ERR_OK)
         return retVal;
 
-    if (regData == (mibAddr >> 2))
-    {
-        /* Write MIB addr to an alternate value */
-        retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, (mibAddr >> 2) + 1);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-
-        while (1)
-        {
-            retVal = rtl8367c_getAsicReg(RTL8367C_REG_MIB_ADDRESS, &regData);
-            if (retVal != RT_ERR_OK)
-                return retVal;
-
-            if (regData == ((mibAddr >> 2) + 1))
-            {
-                break;
-            }
-
-            retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, (mibAddr >> 2) + 1);
-            if (retVal != RT_ERR_OK)
-                return retVal;
-        }
-
-        /* polling busy flag */
-        i = 100;
-        while (i > 0)
-        {
-            /*read MIB control register*/
-            retVal = rtl8367c_getAsicReg(RTL8367C_MIB_CTRL_REG, &regData);
-            if (retVal != RT_ERR_OK)
-                return retVal;
-
-            if ((regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK) == 0)
-            {
-                break;
-            }
-
-            i--;
-        }
-
-        if (regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK)
-            return RT_ERR_BUSYWAIT_TIMEOUT;
-
-        if (regData & RTL8367C_RESET_FLAG_MASK)
-            return RT_ERR_STAT_CNTR_FAIL;
-    }
+    *pPort = (rtk_port_t)rtk_switch_port_P2L_get(port);
 
-    /*writing access counter address first*/
-    /*This address is SRAM address, and SRAM address = MIB register address >> 2*/
-    /*then ASIC will prepare 64bits counter wait for being retrived*/
-    /*Write Mib related address to access control register*/
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, (mibAddr >> 2));
-    if (retVal != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicCputagInsertMode((uint32_t *)pMode)) != RT_ERR_OK)
         return retVal;
 
-    /* polling MIB Addr register */
-    while (1)
-    {
-        retVal = rtl8367c_getAsicReg(RTL8367C_REG_MIB_ADDRESS, &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-
-        if (regData == (mibAddr >> 2))
-        {
-            break;
-        }
-
-        retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, (mibAddr >> 2));
-        if (retVal != RT_ERR_OK)
-            return retVal;
-    }
-
-    /* polling busy flag */
-    i = 100;
-    while (i > 0)
-    {
-        /*read MIB control register*/
-        retVal = rtl8367c_getAsicReg(RTL8367C_MIB_CTRL_REG, &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-
-        if ((regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK) == 0)
-        {
-            break;
-        }
-
-        i--;
-    }
-
-    if (regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK)
-        return RT_ERR_BUSYWAIT_TIMEOUT;
-
-    if (regData & RTL8367C_RESET_FLAG_MASK)
-        return RT_ERR_STAT_CNTR_FAIL;
-
-    mibCounter = 0;
-    i = mibLength[mibIdx];
-    if (4 == i)
-        regAddr = RTL8367C_MIB_COUNTER_BASE_REG + 3;
-    else
-        regAddr = RTL8367C_MIB_COUNTER_BASE_REG + ((mibOff + 1) % 4);
-
-    while (i)
-    {
-        retVal = rtl8367c_getAsicReg(regAddr, &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-
-        mibCounter = (mibCounter << 16) | (regData & 0xFFFF);
-
-        regAddr--;
-        i--;
-    }
-
-    *pCounter = mibCounter;
-
     return RT_ERR_OK;
 }
-int32_t rtl8367::rtk_stat_port_get(rtk_port_t port, rtk_stat_port_type_t cntr_idx, uint64_t *pCntr)
-{
-    int32_t retVal;
-    RTL8367C_MIBCOUNTER mib_idx;
-    uint64_t second_cnt;
-
-    if (NULL == pCntr)
-        return RT_ERR_NULL_POINTER;
-
-    /* Check port valid */
-    RTK_CHK_PORT_VALID(port);
-
-    if (cntr_idx >= STAT_PORT_CNTR_END)
-        return RT_ERR_STAT_INVALID_PORT_CNTR;
-
-    if ((retVal = _get_asic_mib_idx(cntr_idx, &mib_idx)) != RT_ERR_OK)
-        return retVal;
-
-    if (mib_idx == MIB_NOT_SUPPORT)
-        return RT_ERR_CHIP_NOT_SUPPORTED;
-
-    if ((retVal = rtl8367c_getAsicMIBsCounter(rtk_switch_port_L2P_get(port), mib_idx, pCntr)) != RT_ERR_OK)
-        return retVal;
-
-    if (cntr_idx == STAT_EtherStatsMulticastPkts)
-    {
-        if ((retVal = _get_asic_mib_idx(STAT_IfOutMulticastPkts, &mib_idx)) != RT_ERR_OK)
-            return retVal;
-
-        if ((retVal = rtl8367c_getAsicMIBsCounter(rtk_switch_port_L2P_get(port), mib_idx, &second_cnt)) != RT_ERR_OK)
-            return retVal;
-
-        *pCntr += second_cnt;
-    }
-
-    if (cntr_idx == STAT_EtherStatsBroadcastPkts)
-    {
-        if ((retVal = _get_asic_mib_idx(STAT_IfOutBroadcastPkts, &mib_idx)) != RT_ERR_OK)
-            return retVal;
-
-        if ((retVal = rtl8367c_getAsicMIBsCounter(rtk_switch_port_L2P_get(port), mib_idx, &second_cnt)) != RT_ERR_OK)
-            return retVal;
 
-        *pCntr += second_cnt;
-    }
-
-    return RT_ERR_OK;
-}
+// -------------- INTERRUPT --------------
 
 /* Function Name:
- *      rtl8367c_setAsicMIBsCounterReset
+ *      rtl8367c_setAsicInterruptPolarity
  * Description:
- *      Reset global/queue manage or per-port MIB counter
+ *      Set interrupt trigger polarity
  * Input:
- *      greset  - Global reset
- *      qmreset - Queue maganement reset
- *      portmask    - Port reset mask
+ *      polarity    - 0:pull high 1: pull low
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicMIBsCounterReset(uint32_t greset, uint32_t qmreset, uint32_t portmask)
+int32_t rtl8367::rtl8367c_setAsicInterruptPolarity(uint32_t polarity)
 {
-    int32_t retVal;
-    uint32_t regData;
-    uint32_t regBits;
-
-    regBits = RTL8367C_GLOBAL_RESET_MASK |
-              RTL8367C_QM_RESET_MASK |
-              RTL8367C_MIB_PORT07_MASK |
-              ((uint32_t)0x7 << 13);
-    regData = ((greset << RTL8367C_GLOBAL_RESET_OFFSET) & RTL8367C_GLOBAL_RESET_MASK) |
-              ((qmreset << RTL8367C_QM_RESET_OFFSET) & RTL8367C_QM_RESET_MASK) |
-              (((portmask & 0xFF) << RTL8367C_PORT0_RESET_OFFSET) & RTL8367C_MIB_PORT07_MASK) |
-              (((portmask >> 8) & 0x7) << 13);
-
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_MIB_CTRL0, regBits, (regData >> RTL8367C_PORT0_RESET_OFFSET));
-
-    return retVal;
+    return rtl8367c_setAsicRegBit(RTL8367C_REG_INTR_CTRL, RTL8367C_INTR_CTRL_OFFSET, polarity);
 }
-int32_t rtl8367::rtk_stat_port_reset(rtk_port_t port)
+int32_t rtl8367::rtk_int_polarity_set(rtk_int_polarity_t type)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
-    /* Check port valid */
-    RTK_CHK_PORT_VALID(port);
+    if (type >= INT_POLAR_END)
+        return RT_ERR_INPUT;
 
-    if ((retVal = rtl8367c_setAsicMIBsCounterReset(0, 0, 1 << rtk_switch_port_L2P_get(port))) != RT_ERR_OK)
+    if ((retVal = rtl8367c_setAsicInterruptPolarity(type)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
-// ---------------------- PHY -------------------------
-
 /* Function Name:
- *      rtl8370_setAsicPortEnableAll
+ *      rtl8367c_getAsicInterruptPolarity
  * Description:
- *      Set ALL ports enable.
- * Input:s
- *      enable - enable all ports.
+ *      Get interrupt trigger polarity
+ * Input:
+ *      pPolarity   - 0:pull high 1: pull low
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicPortEnableAll(uint32_t enable)
+int32_t rtl8367::rtl8367c_getAsicInterruptPolarity(uint32_t *pPolarity)
 {
-    if (enable >= 2)
-        return RT_ERR_INPUT;
-
-    return rtl8367c_setAsicRegBit(RTL8367C_REG_PHY_AD, RTL8367C_PDNPHY_OFFSET, !enable);
+    return rtl8367c_getAsicRegBit(RTL8367C_REG_INTR_CTRL, RTL8367C_INTR_CTRL_OFFSET, pPolarity);
 }
 
-int32_t rtl8367::_rtk_port_phyReg_get(rtk_port_t port, rtk_port_phy_reg_t reg, uint32_t *pData)
+int32_t rtl8367::rtk_int_polarity_get(rtk_int_polarity_t *pType)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_UTP(port);
+    if (NULL == pType)
+        return RT_ERR_NULL_POINTER;
 
-    if ((retVal = rtl8367c_getAsicPHYReg(rtk_switch_port_L2P_get(port), reg, pData)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicInterruptPolarity((uint32_t *)pType)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicPHYOCPReg
+ *      rtl8367c_getAsicInterruptMask
  * Description:
- *      Set PHY OCP registers
+ *      Get interrupt enable mask
  * Input:
- *      phyNo   - Physical port number (0~7)
- *      ocpAddr - OCP address
- *      ocpData - Writing data
+ *      pImr    - Interrupt mask
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PHY_REG_ID       - invalid PHY address
- *      RT_ERR_PHY_ID           - invalid PHY no
- *      RT_ERR_BUSYWAIT_TIMEOUT - PHY access busy
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicPHYOCPReg(uint32_t phyNo, uint32_t ocpAddr, uint32_t ocpData)
+int32_t rtl8367::rtl8367c_getAsicInterruptMask(uint32_t *pImr)
 {
-    int32_t retVal;
-    uint32_t regData;
-    uint32_t busyFlag, checkCounter;
-    uint32_t ocpAddrPrefix, ocpAddr9_6, ocpAddr5_1;
-
-    /*Check internal phy access busy or not*/
-    /*retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_INDRECT_ACCESS_STATUS, RTL8367C_INDRECT_ACCESS_STATUS_OFFSET,&busyFlag);*/
-    retVal = rtl8367c_getAsicReg(RTL8367C_REG_INDRECT_ACCESS_STATUS, &busyFlag);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-
-    if (busyFlag)
-        return RT_ERR_BUSYWAIT_TIMEOUT;
-
-    /* OCP prefix */
-    ocpAddrPrefix = ((ocpAddr & 0xFC00) >> 10);
-    if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_GPHY_OCP_MSB_0, RTL8367C_CFG_CPU_OCPADR_MSB_MASK, ocpAddrPrefix)) != RT_ERR_OK)
-        return retVal;
-
-    /*prepare access data*/
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_INDRECT_ACCESS_WRITE_DATA, ocpData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-
-    /*prepare access address*/
-    ocpAddr9_6 = ((ocpAddr >> 6) & 0x000F);
-    ocpAddr5_1 = ((ocpAddr >> 1) & 0x001F);
-    regData = RTL8367C_PHY_BASE | (ocpAddr9_6 << 8) | (phyNo << RTL8367C_PHY_OFFSET) | ocpAddr5_1;
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_INDRECT_ACCESS_ADDRESS, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-
-    /*Set WRITE Command*/
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_INDRECT_ACCESS_CTRL, RTL8367C_CMD_MASK | RTL8367C_RW_MASK);
-
-    checkCounter = 100;
-    while (checkCounter)
-    {
-        retVal = rtl8367c_getAsicReg(RTL8367C_REG_INDRECT_ACCESS_STATUS, &busyFlag);
-        if ((retVal != RT_ERR_OK) || busyFlag)
-        {
-            checkCounter--;
-            if (0 == checkCounter)
-                return RT_ERR_BUSYWAIT_TIMEOUT;
-        }
-        else
-        {
-            checkCounter = 0;
-        }
-    }
-
-    return retVal;
+    return rtl8367c_getAsicReg(RTL8367C_REG_INTR_IMR, pImr);
 }
 /* Function Name:
- *      rtl8367c_setAsicPHYReg
+ *      rtl8367c_setAsicInterruptMask
  * Description:
- *      Set PHY registers
+ *      Set interrupt enable mask
  * Input:
- *      phyNo   - Physical port number (0~7)
- *      phyAddr - PHY address (0~31)
- *      phyData - Writing data
+ *      imr     - Interrupt mask
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PHY_REG_ID       - invalid PHY address
- *      RT_ERR_PHY_ID           - invalid PHY no
- *      RT_ERR_BUSYWAIT_TIMEOUT - PHY access busy
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicPHYReg(uint32_t phyNo, uint32_t phyAddr, uint32_t phyData)
+int32_t rtl8367::rtl8367c_setAsicInterruptMask(uint32_t imr)
 {
-    uint32_t ocp_addr;
-
-    if (phyAddr > RTL8367C_PHY_REGNOMAX)
-        return RT_ERR_PHY_REG_ID;
-
-    ocp_addr = 0xa400 + phyAddr * 2;
-
-    return rtl8367c_setAsicPHYOCPReg(phyNo, ocp_addr, phyData);
+    return rtl8367c_setAsicReg(RTL8367C_REG_INTR_IMR, imr);
 }
-
-int32_t rtl8367::_rtk_port_phyReg_set(rtk_port_t port, rtk_port_phy_reg_t reg, uint32_t regData)
+int32_t rtl8367::rtk_int_control_set(rtk_int_type_t type, rtk_enable_t enable)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t mask;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_UTP(port);
+    if (type >= INT_TYPE_END)
+        return RT_ERR_INPUT;
 
-    if ((retVal = rtl8367c_setAsicPHYReg(rtk_switch_port_L2P_get(port), reg, regData)) != RT_ERR_OK)
+    if (type == INT_TYPE_RESERVED)
+        return RT_ERR_INPUT;
+
+    if ((retVal = rtl8367c_getAsicInterruptMask(&mask)) != RT_ERR_OK)
+        return retVal;
+
+    if (ENABLED == enable)
+        mask = mask | (1 << type);
+    else if (DISABLED == enable)
+        mask = mask & ~(1 << type);
+    else
+        return RT_ERR_INPUT;
+
+    if ((retVal = rtl8367c_setAsicInterruptMask(mask)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_port_phyEnableAll_set(rtk_enable_t enable)
+int32_t rtl8367::rtk_int_control_get(rtk_int_type_t type, rtk_enable_t *pEnable)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t data;
-    uint32_t port;
+    uint32_t mask;
 
-    if (enable >= RTK_ENABLE_END)
-        return RT_ERR_ENABLE;
+    if (NULL == pEnable)
+        return RT_ERR_NULL_POINTER;
 
-    if ((retVal = rtl8367c_setAsicPortEnableAll(enable)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicInterruptMask(&mask)) != RT_ERR_OK)
         return retVal;
 
-    RTK_SCAN_ALL_LOG_PORT(port)
-    {
-        if (rtk_switch_isUtpPort(port) == RT_ERR_OK)
-        {
-            if ((retVal = _rtk_port_phyReg_get((rtk_port_t)port, (rtk_port_phy_reg_t)PHY_CONTROL_REG, &data)) != RT_ERR_OK)
-                return retVal;
-
-            if (ENABLED == enable)
-            {
-                data &= 0xF7FF;
-                data |= 0x0200;
-            }
-            else
-            {
-                data |= 0x0800;
-            }
-
-            if ((retVal = _rtk_port_phyReg_set((rtk_port_t)port, (rtk_port_phy_reg_t)PHY_CONTROL_REG, data)) != RT_ERR_OK)
-                return retVal;
-        }
-    }
+    if (0 == (mask & (1 << type)))
+        *pEnable = (rtk_enable_t)0;
+    else
+        *pEnable = (rtk_enable_t)1;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtk_switch_isComboPort
+ *      rtl8367c_getAsicInterruptStatus
  * Description:
- *      Check is logical port a Combo port
+ *      Get interrupt enable mask
  * Input:
- *      logicalPort     - logical port ID
+ *      pIms    - Interrupt status mask
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Port ID is a combo port
- *      RT_ERR_FAILED   - Port ID is not a combo port
- *      RT_ERR_NOT_INIT - Not Initialize
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
  * Note:
- *
+ *      None
  */
-int32_t rtl8367::rtk_switch_isComboPort(rtk_port_t logicalPort)
+int32_t rtl8367::rtl8367c_getAsicInterruptStatus(uint32_t *pIms)
 {
-    if (logicalPort >= RTK_SWITCH_PORT_NUM)
-        return RT_ERR_FAILED;
-
-    if (halCtrl.combo_logical_port == logicalPort)
-        return RT_ERR_OK;
-    else
-        return RT_ERR_FAILED;
+    return rtl8367c_getAsicReg(RTL8367C_REG_INTR_IMS, pIms);
 }
 
-int32_t rtl8367::_rtk_port_phyComboPortMedia_get(rtk_port_t port, rtk_port_media_t *pMedia)
+int32_t rtl8367::rtk_int_status_get(rtk_int_status_t *pStatusMask)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t regData;
-    uint32_t data;
-
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_UTP(port);
-
-    /* Check Combo Port ID */
-    RTK_CHK_PORT_IS_COMBO(port);
-
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
-        return retVal;
+    uint32_t ims_mask;
 
-    if ((retVal = rtl8367c_getAsicReg(0x1300, &regData)) != RT_ERR_OK)
-        return retVal;
+    if (NULL == pStatusMask)
+        return RT_ERR_NULL_POINTER;
 
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicInterruptStatus(&ims_mask)) != RT_ERR_OK)
         return retVal;
 
-    if (regData != 0x6367)
-    {
-        *pMedia = PORT_MEDIA_COPPER;
-    }
-    else
-    {
-        if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_UTP_FIB_DET, RTL8367C_UTP_FIRST_OFFSET, &data)) != RT_ERR_OK)
-            return retVal;
-
-        if (data == 1)
-            *pMedia = PORT_MEDIA_COPPER;
-        else
-            *pMedia = PORT_MEDIA_FIBER;
-    }
-
+    pStatusMask->value[0] = (ims_mask & 0x00000FFF);
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::_rtk_port_FiberModeAbility_set(rtk_port_t port, rtk_port_phy_ability_t *pAbility)
+/* Function Name:
+ *      rtl8367c_setAsicInterruptMask
+ * Description:
+ *      Clear interrupt enable mask
+ * Input:
+ *      ims     - Interrupt status mask
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      This API can be used to clear ASIC interrupt status and register will be cleared by writting 1.
+ *      [0]:Link change,
+ *      [1]:Share meter exceed,
+ *      [2]:Learn number overed,
+ *      [3]:Speed Change,
+ *      [4]:Tx special congestion
+ *      [5]:1 second green feature
+ *      [6]:loop detection
+ *      [7]:interrupt from 8051
+ *      [8]:Cable diagnostic finish
+ *      [9]:ACL action interrupt trigger
+ *      [11]: Silent Start
+ */
+int32_t rtl8367::rtl8367c_setAsicInterruptStatus(uint32_t ims)
+{
+    return rtl8367c_setAsicReg(RTL8367C_REG_INTR_IMS, ims);
+}
+int32_t rtl8367::rtk_int_status_set(rtk_int_status_t *pStatusMask)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t regData;
 
-    /* Check Combo port or not */
-    RTK_CHK_PORT_IS_COMBO(port);
+    if (NULL == pStatusMask)
+        return RT_ERR_NULL_POINTER;
 
-    /* Flow Control */
-    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FIB0_CFG04, &regData)) != RT_ERR_OK)
+    if (pStatusMask->value[0] & (0x0001 << INT_TYPE_RESERVED))
+        return RT_ERR_INPUT;
+
+    if (pStatusMask->value[0] >= (0x0001 << INT_TYPE_END))
+        return RT_ERR_INPUT;
+
+    if ((retVal = rtl8367c_setAsicInterruptStatus((uint32_t)pStatusMask->value[0])) != RT_ERR_OK)
         return retVal;
 
-    if (pAbility->AsyFC == 1)
-        regData |= (0x0001 << 8);
-    else
-        regData &= ~(0x0001 << 8);
+    return RT_ERR_OK;
+}
 
-    if (pAbility->FC == 1)
-        regData |= (0x0001 << 7);
-    else
-        regData &= ~(0x0001 << 7);
+int32_t rtl8367::_rtk_int_Advidx_get(rtk_int_advType_t adv_type, uint32_t *pAsic_idx)
+{
+    uint32_t asic_idx[ADV_END] =
+        {
+            INTRST_L2_LEARN,
+            INTRST_SPEED_CHANGE,
+            INTRST_SPECIAL_CONGESTION,
+            INTRST_PORT_LINKDOWN,
+            INTRST_PORT_LINKUP,
+            ADV_NOT_SUPPORT,
+            INTRST_RLDP_LOOPED,
+            INTRST_RLDP_RELEASED,
+        };
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG04, regData)) != RT_ERR_OK)
-        return retVal;
+    if (adv_type >= ADV_END)
+        return RT_ERR_INPUT;
 
-    /* Speed ability */
-    if ((pAbility->Full_1000 == 1) && (pAbility->Full_100 == 1) && (pAbility->AutoNegotiation == 1))
-    {
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_MODE_OFFSET, 0)) != RT_ERR_OK)
-            return retVal;
+    if (asic_idx[adv_type] == ADV_NOT_SUPPORT)
+        return RT_ERR_CHIP_NOT_SUPPORTED;
 
-        if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_MODE_MASK, 7)) != RT_ERR_OK)
-            return retVal;
+    *pAsic_idx = asic_idx[adv_type];
+    return RT_ERR_OK;
+}
 
-        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG00, 0x1140)) != RT_ERR_OK)
+/* Function Name:
+ *      rtl8367c_getAsicInterruptRelatedStatus
+ * Description:
+ *      Get interrupt status
+ * Input:
+ *      type    - per port Learn over, per-port speed change, per-port special congest, share meter exceed status
+ *      pStatus     - exceed status, write 1 to clear
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicInterruptRelatedStatus(uint32_t type, uint32_t *pStatus)
+{
+    const uint32_t indicatorAddress[INTRST_END] = {RTL8367C_REG_LEARN_OVER_INDICATOR,
+                                                   RTL8367C_REG_SPEED_CHANGE_INDICATOR,
+                                                   RTL8367C_REG_SPECIAL_CONGEST_INDICATOR,
+                                                   RTL8367C_REG_PORT_LINKDOWN_INDICATOR,
+                                                   RTL8367C_REG_PORT_LINKUP_INDICATOR,
+                                                   RTL8367C_REG_METER_OVERRATE_INDICATOR0,
+                                                   RTL8367C_REG_METER_OVERRATE_INDICATOR1,
+                                                   RTL8367C_REG_RLDP_LOOPED_INDICATOR,
+                                                   RTL8367C_REG_RLDP_RELEASED_INDICATOR,
+                                                   RTL8367C_REG_SYSTEM_LEARN_OVER_INDICATOR};
+
+    if (type >= INTRST_END)
+        return RT_ERR_OUT_OF_RANGE;
+
+    return rtl8367c_getAsicReg(indicatorAddress[type], pStatus);
+}
+/* Function Name:
+ *      rtl8367c_setAsicInterruptRelatedStatus
+ * Description:
+ *      Clear interrupt status
+ * Input:
+ *      type    - per port Learn over, per-port speed change, per-port special congest, share meter exceed status
+ *      status  - exceed status, write 1 to clear
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicInterruptRelatedStatus(uint32_t type, uint32_t status)
+{
+    const uint32_t indicatorAddress[INTRST_END] = {RTL8367C_REG_LEARN_OVER_INDICATOR,
+                                                   RTL8367C_REG_SPEED_CHANGE_INDICATOR,
+                                                   RTL8367C_REG_SPECIAL_CONGEST_INDICATOR,
+                                                   RTL8367C_REG_PORT_LINKDOWN_INDICATOR,
+                                                   RTL8367C_REG_PORT_LINKUP_INDICATOR,
+                                                   RTL8367C_REG_METER_OVERRATE_INDICATOR0,
+                                                   RTL8367C_REG_METER_OVERRATE_INDICATOR1,
+                                                   RTL8367C_REG_RLDP_LOOPED_INDICATOR,
+                                                   RTL8367C_REG_RLDP_RELEASED_INDICATOR,
+                                                   RTL8367C_REG_SYSTEM_LEARN_OVER_INDICATOR};
+
+    if (type >= INTRST_END)
+        return RT_ERR_OUT_OF_RANGE;
+
+    return rtl8367c_setAsicReg(indicatorAddress[type], status);
+}
+int32_t rtl8367::rtk_int_advanceInfo_get(rtk_int_advType_t adv_type, rtk_int_info_t *pInfo)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t data;
+    uint32_t intAdvType;
+
+    if (adv_type >= ADV_END)
+        return RT_ERR_INPUT;
+
+    if (NULL == pInfo)
+        return RT_ERR_NULL_POINTER;
+
+    if (adv_type != ADV_METER_EXCEED_MASK)
+    {
+        if ((retVal = _rtk_int_Advidx_get(adv_type, &intAdvType)) != RT_ERR_OK)
             return retVal;
     }
-    else if (pAbility->Full_1000 == 1)
+
+    switch (adv_type)
     {
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_MODE_OFFSET, 1)) != RT_ERR_OK)
+    case ADV_L2_LEARN_PORT_MASK:
+        /* Get physical portmask */
+        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(intAdvType, &data)) != RT_ERR_OK)
             return retVal;
 
-        if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_MODE_MASK, 4)) != RT_ERR_OK)
+        /* Clear Advanced Info */
+        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(intAdvType, 0xFFFF)) != RT_ERR_OK)
             return retVal;
 
-        if (pAbility->AutoNegotiation == 1)
-        {
-            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG00, 0x1140)) != RT_ERR_OK)
-                return retVal;
-        }
-        else
-        {
-            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG00, 0x0140)) != RT_ERR_OK)
-                return retVal;
-        }
-    }
-    else if (pAbility->Full_100 == 1)
-    {
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_MODE_OFFSET, 1)) != RT_ERR_OK)
+        /* Translate to logical portmask */
+        if ((retVal = rtk_switch_portmask_P2L_get(data, &(pInfo->portMask))) != RT_ERR_OK)
             return retVal;
 
-        if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_MODE_MASK, 5)) != RT_ERR_OK)
+        /* Get system learn */
+        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(INTRST_SYS_LEARN, &data)) != RT_ERR_OK)
             return retVal;
 
-        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG00, 0x2100)) != RT_ERR_OK)
+        /* Clear system learn */
+        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(INTRST_SYS_LEARN, 0x0001)) != RT_ERR_OK)
             return retVal;
-    }
 
-    /* Digital software reset */
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0003)) != RT_ERR_OK)
-        return retVal;
+        pInfo->systemLearnOver = data;
+        break;
+    case ADV_SPEED_CHANGE_PORT_MASK:
+    case ADV_SPECIAL_CONGESTION_PORT_MASK:
+    case ADV_PORT_LINKDOWN_PORT_MASK:
+    case ADV_PORT_LINKUP_PORT_MASK:
+    case ADV_RLDP_LOOPED:
+    case ADV_RLDP_RELEASED:
+        /* Get physical portmask */
+        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(intAdvType, &data)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x0080)) != RT_ERR_OK)
-        return retVal;
+        /* Clear Advanced Info */
+        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(intAdvType, 0xFFFF)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_SDS_INDACS_DATA, &regData)) != RT_ERR_OK)
-        return retVal;
+        /* Translate to logical portmask */
+        if ((retVal = rtk_switch_portmask_P2L_get(data, &(pInfo->portMask))) != RT_ERR_OK)
+            return retVal;
 
-    regData |= (0x0001 << 6);
+        break;
+    case ADV_METER_EXCEED_MASK:
+        /* Get Meter Mask */
+        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(INTRST_METER0_15, &data)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, regData)) != RT_ERR_OK)
-        return retVal;
+        /* Clear Advanced Info */
+        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(INTRST_METER0_15, 0xFFFF)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0003)) != RT_ERR_OK)
-        return retVal;
+        pInfo->meterMask = data & 0xFFFF;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-        return retVal;
+        /* Get Meter Mask */
+        if ((retVal = rtl8367c_getAsicInterruptRelatedStatus(INTRST_METER16_31, &data)) != RT_ERR_OK)
+            return retVal;
 
-    regData &= ~(0x0001 << 6);
+        /* Clear Advanced Info */
+        if ((retVal = rtl8367c_setAsicInterruptRelatedStatus(INTRST_METER16_31, 0xFFFF)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, regData)) != RT_ERR_OK)
-        return retVal;
+        pInfo->meterMask = pInfo->meterMask | ((data << 16) & 0xFFFF0000);
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0003)) != RT_ERR_OK)
-        return retVal;
+        break;
+    default:
+        return RT_ERR_INPUT;
+    }
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-        return retVal;
+    return RT_ERR_OK;
+}
 
-    /* CDR reset */
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x1401)) != RT_ERR_OK)
-        return retVal;
+#ifdef RTL8367_INT_EVENT
+rtl8367 *volatile rtl8367::intEventOwner = NULL;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0000)) != RT_ERR_OK)
-        return retVal;
+/* INT pin handler: no SMI here, only a stamp for rtk_int_event_service */
+void RTL8367_ISR_ATTR rtl8367::intEventIsr()
+{
+    rtl8367 *pSwitch = intEventOwner;
+    uint8_t head, next;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-        return retVal;
+    if (pSwitch == NULL)
+        return;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x1403)) != RT_ERR_OK)
-        return retVal;
+    head = pSwitch->intQueueHead;
+    next = (head + 1) & (RTL8367_INT_QUEUE_SIZE - 1);
+    /* pairs with the release of intQueueTail, the slot is free once seen */
+    if (next == __atomic_load_n(&pSwitch->intQueueTail, __ATOMIC_ACQUIRE))
+        return;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0000)) != RT_ERR_OK)
-        return retVal;
+    pSwitch->intQueue[head] = millis();
+    /* the stamp must be in place before the service sees the new head */
+    __atomic_store_n(&pSwitch->intQueueHead, next, __ATOMIC_RELEASE);
+}
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-        return retVal;
+/* stop the INT pin handler and forget the callbacks */
+void rtl8367::intEventClear()
+{
+    if (intEventOwner == this)
+    {
+        detachInterrupt(digitalPinToInterrupt(intPin));
+        intEventOwner = NULL;
+    }
 
-    return RT_ERR_OK;
+    intQueueHead = 0;
+    intQueueTail = 0;
+    intCallbackMask = 0;
+    memset(intCallback, 0, sizeof(intCallback));
+    memset(intCallbackArg, 0, sizeof(intCallbackArg));
 }
-int32_t rtl8367::rtk_port_phyAutoNegoAbility_set(rtk_port_t port, rtk_port_phy_ability_t *pAbility)
+
+/* Function Name:
+ *      rtk_int_event_attach
+ * Description:
+ *      Drive the interrupt callbacks from the switch INT pin
+ * Input:
+ *      pin         - MCU pin wired to the switch INT output
+ *      polarity    - INT_POLAR_HIGH or INT_POLAR_LOW
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_INPUT        - Invalid input parameters.
+ *      RT_ERR_NOT_ALLOWED  - Another instance owns the INT pin handler
+ * Note:
+ *      Sets the switch INT polarity and attaches a handler to the active
+ *      edge of the pin. The handler only queues a time stamp, the callbacks
+ *      run from rtk_int_event_service(). One switch per application can use
+ *      the handler. reset() detaches it and drops the callbacks, since the
+ *      switch forgets the INT polarity and mask.
+ */
+int32_t rtl8367::rtk_int_event_attach(uint8_t pin, rtk_int_polarity_t polarity)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t phyData;
-    uint32_t phyEnMsk0;
-    uint32_t phyEnMsk4;
-    uint32_t phyEnMsk9;
-    rtk_port_media_t media_type;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_UTP(port);
+    if ((intEventOwner != NULL) && (intEventOwner != this))
+        return RT_ERR_NOT_ALLOWED;
 
-    if (NULL == pAbility)
-        return RT_ERR_NULL_POINTER;
+    if ((retVal = rtk_int_polarity_set(polarity)) != RT_ERR_OK)
+        return retVal;
 
-    if (pAbility->Half_10 >= RTK_ENABLE_END || pAbility->Full_10 >= RTK_ENABLE_END ||
-        pAbility->Half_100 >= RTK_ENABLE_END || pAbility->Full_100 >= RTK_ENABLE_END ||
-        pAbility->Full_1000 >= RTK_ENABLE_END || pAbility->AutoNegotiation >= RTK_ENABLE_END ||
-        pAbility->AsyFC >= RTK_ENABLE_END || pAbility->FC >= RTK_ENABLE_END)
-        return RT_ERR_INPUT;
-
-    if (rtk_switch_isComboPort(port) == RT_ERR_OK)
-    {
-        if ((retVal = _rtk_port_phyComboPortMedia_get(port, &media_type)) != RT_ERR_OK)
-            return retVal;
-
-        if (media_type == PORT_MEDIA_FIBER)
-        {
-            return _rtk_port_FiberModeAbility_set(port, pAbility);
-        }
-    }
-
-    /*for PHY auto mode setup*/
-    pAbility->AutoNegotiation = 1;
-
-    phyEnMsk0 = 0;
-    phyEnMsk4 = 0;
-    phyEnMsk9 = 0;
-
-    if (1 == pAbility->Half_10)
-    {
-        /*10BASE-TX half duplex capable in reg 4.5*/
-        phyEnMsk4 = phyEnMsk4 | (1 << 5);
-
-        /*Speed selection [1:0] */
-        /* 11=Reserved*/
-        /* 10= 1000Mpbs*/
-        /* 01= 100Mpbs*/
-        /* 00= 10Mpbs*/
-        phyEnMsk0 = phyEnMsk0 & (~(1 << 6));
-        phyEnMsk0 = phyEnMsk0 & (~(1 << 13));
-    }
-
-    if (1 == pAbility->Full_10)
-    {
-        /*10BASE-TX full duplex capable in reg 4.6*/
-        phyEnMsk4 = phyEnMsk4 | (1 << 6);
-        /*Speed selection [1:0] */
-        /* 11=Reserved*/
-        /* 10= 1000Mpbs*/
-        /* 01= 100Mpbs*/
-        /* 00= 10Mpbs*/
-        phyEnMsk0 = phyEnMsk0 & (~(1 << 6));
-        phyEnMsk0 = phyEnMsk0 & (~(1 << 13));
-
-        /*Full duplex mode in reg 0.8*/
-        phyEnMsk0 = phyEnMsk0 | (1 << 8);
-    }
-
-    if (1 == pAbility->Half_100)
-    {
-        /*100BASE-TX half duplex capable in reg 4.7*/
-        phyEnMsk4 = phyEnMsk4 | (1 << 7);
-        /*Speed selection [1:0] */
-        /* 11=Reserved*/
-        /* 10= 1000Mpbs*/
-        /* 01= 100Mpbs*/
-        /* 00= 10Mpbs*/
-        phyEnMsk0 = phyEnMsk0 & (~(1 << 6));
-        phyEnMsk0 = phyEnMsk0 | (1 << 13);
-    }
+    if (intEventOwner == this)
+        detachInterrupt(digitalPinToInterrupt(intPin));
 
-    if (1 == pAbility->Full_100)
-    {
-        /*100BASE-TX full duplex capable in reg 4.8*/
-        phyEnMsk4 = phyEnMsk4 | (1 << 8);
-        /*Speed selection [1:0] */
-        /* 11=Reserved*/
-        /* 10= 1000Mpbs*/
-        /* 01= 100Mpbs*/
-        /* 00= 10Mpbs*/
-        phyEnMsk0 = phyEnMsk0 & (~(1 << 6));
-        phyEnMsk0 = phyEnMsk0 | (1 << 13);
-        /*Full duplex mode in reg 0.8*/
-        phyEnMsk0 = phyEnMsk0 | (1 << 8);
-    }
-
-    if (1 == pAbility->Full_1000)
-    {
-        /*1000 BASE-T FULL duplex capable setting in reg 9.9*/
-        phyEnMsk9 = phyEnMsk9 | (1 << 9);
-
-        /*Speed selection [1:0] */
-        /* 11=Reserved*/
-        /* 10= 1000Mpbs*/
-        /* 01= 100Mpbs*/
-        /* 00= 10Mpbs*/
-        phyEnMsk0 = phyEnMsk0 | (1 << 6);
-        phyEnMsk0 = phyEnMsk0 & (~(1 << 13));
-
-        /*Auto-Negotiation setting in reg 0.12*/
-        phyEnMsk0 = phyEnMsk0 | (1 << 12);
-    }
+    intPin = pin;
+    intActiveLevel = (polarity == INT_POLAR_LOW) ? LOW : HIGH;
+    intQueueTail = intQueueHead;
+    pinMode(pin, (polarity == INT_POLAR_LOW) ? INPUT_PULLUP : INPUT);
+    intEventOwner = this;
+    attachInterrupt(digitalPinToInterrupt(pin), intEventIsr, (polarity == INT_POLAR_LOW) ? FALLING : RISING);
 
-    if (1 == pAbility->AutoNegotiation)
-    {
-        /*Auto-Negotiation setting in reg 0.12*/
-        phyEnMsk0 = phyEnMsk0 | (1 << 12);
-    }
+    return RT_ERR_OK;
+}
 
-    if (1 == pAbility->AsyFC)
-    {
-        /*Asymetric flow control in reg 4.11*/
-        phyEnMsk4 = phyEnMsk4 | (1 << 11);
-    }
-    if (1 == pAbility->FC)
+/* Function Name:
+ *      rtk_int_event_detach
+ * Description:
+ *      Stop the INT pin handler
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      None
+ * Note:
+ *      The callbacks and the switch interrupt mask are kept, so a later
+ *      rtk_int_event_attach() picks up where this left off.
+ */
+void rtl8367::rtk_int_event_detach()
+{
+    if (intEventOwner == this)
     {
-        /*Flow control in reg 4.10*/
-        phyEnMsk4 = phyEnMsk4 | (1 << 10);
+        detachInterrupt(digitalPinToInterrupt(intPin));
+        intEventOwner = NULL;
     }
+}
 
-    /*1000 BASE-T control register setting*/
-    if ((retVal = rtl8367c_getAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_1000_BASET_CONTROL_REG, &phyData)) != RT_ERR_OK)
-        return retVal;
-
-    phyData = (phyData & (~0x0200)) | phyEnMsk9;
-
-    if ((retVal = rtl8367c_setAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_1000_BASET_CONTROL_REG, phyData)) != RT_ERR_OK)
-        return retVal;
-
-    /*Auto-Negotiation control register setting*/
-    if ((retVal = rtl8367c_getAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_AN_ADVERTISEMENT_REG, &phyData)) != RT_ERR_OK)
-        return retVal;
+/* Function Name:
+ *      rtk_int_callback_set
+ * Description:
+ *      Set the callback of an interrupt type
+ * Input:
+ *      type        - Interrupt type.
+ *      callback    - Function run by rtk_int_event_service, NULL to remove
+ *      pArg        - Passed to callback
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - OK
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_INPUT    - Invalid input parameters.
+ * Note:
+ *      Enables the interrupt type on the switch when a callback is set and
+ *      disables it when it is removed.
+ */
+int32_t rtl8367::rtk_int_callback_set(rtk_int_type_t type, rtk_int_callback_t callback, void *pArg)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-    phyData = (phyData & (~0x0DE0)) | phyEnMsk4;
-    if ((retVal = rtl8367c_setAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_AN_ADVERTISEMENT_REG, phyData)) != RT_ERR_OK)
-        return retVal;
+    if ((type >= INT_TYPE_END) || (type == INT_TYPE_RESERVED))
+        return RT_ERR_INPUT;
 
-    /*Control register setting and restart auto*/
-    if ((retVal = rtl8367c_getAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_CONTROL_REG, &phyData)) != RT_ERR_OK)
+    if ((retVal = rtk_int_control_set(type, (callback != NULL) ? ENABLED : (rtk_enable_t)DISABLED)) != RT_ERR_OK)
         return retVal;
 
-    phyData = (phyData & (~0x3140)) | phyEnMsk0;
-    /*If have auto-negotiation capable, then restart auto negotiation*/
-    if (1 == pAbility->AutoNegotiation)
-    {
-        phyData = phyData | (1 << 9);
-    }
-
-    if ((retVal = rtl8367c_setAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_CONTROL_REG, phyData)) != RT_ERR_OK)
-        return retVal;
+    intCallback[type] = callback;
+    intCallbackArg[type] = pArg;
+    if (callback != NULL)
+        intCallbackMask |= (1 << type);
+    else
+        intCallbackMask &= ~(1 << type);
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::_rtk_port_FiberModeAbility_get(rtk_port_t port, rtk_port_phy_ability_t *pAbility)
+/* Function Name:
+ *      rtk_int_event_service
+ * Description:
+ *      Handle the pending switch interrupts
+ * Input:
+ *      None
+ * Output:
+ *      pNum    - callbacks run, may be NULL
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NOT_INIT     - rtk_int_event_attach() was not called
+ * Note:
+ *      Call it from loop(). Without a queued edge and with the INT line
+ *      released it returns at once, without SMI traffic. Otherwise the
+ *      status bits of the types with a callback are cleared, their advance
+ *      info is read and cleared into one rtk_int_event_t and the callbacks
+ *      run in rtk_int_type_t order. Clearing the status before the advance
+ *      info lets an event arriving meanwhile assert the line again, which
+ *      is checked up to RTL8367_INT_SERVICE_ROUNDS times per call.
+ *      Types enabled with rtk_int_control_set() but without a callback are
+ *      left to the application.
+ */
+int32_t rtl8367::rtk_int_event_service(uint32_t *pNum)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t data, regData;
-
-    /* Check Combo port or not */
-    RTK_CHK_PORT_IS_COMBO(port);
-
-    memset(pAbility, 0x00, sizeof(rtk_port_phy_ability_t));
-
-    /* Flow Control */
-    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_REG4_OFFSET, 1)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_REG4_FIB100_OFFSET, 0)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0044)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x0080)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_SDS_INDACS_DATA, &regData)) != RT_ERR_OK)
-        return retVal;
+    uint32_t ims, type, round;
+    uint32_t num = 0;
+    uint32_t ms;
+    uint8_t tail, head;
+    rtk_int_event_t event;
+    rtk_int_info_t info;
+
+    if (pNum != NULL)
+        *pNum = 0;
+
+    if (intEventOwner != this)
+        return RT_ERR_NOT_INIT;
+
+    tail = intQueueTail;
+    /* pairs with the release in intEventIsr, the stamps up to head are in place */
+    head = __atomic_load_n(&intQueueHead, __ATOMIC_ACQUIRE);
+    if ((tail == head) && (digitalRead(intPin) != intActiveLevel))
+        return RT_ERR_OK;
 
-    if (regData & (0x0001 << 8))
-        pAbility->AsyFC = 1;
+    /* the status read below covers every edge queued so far */
+    ms = (tail != head) ? intQueue[tail] : millis();
+    /* the stamp is read before the handler may reuse its slot */
+    __atomic_store_n(&intQueueTail, head, __ATOMIC_RELEASE);
 
-    if (regData & (0x0001 << 7))
-        pAbility->FC = 1;
+    for (round = 0; round < RTL8367_INT_SERVICE_ROUNDS; round++)
+    {
+        if ((retVal = rtl8367c_getAsicInterruptStatus(&ims)) != RT_ERR_OK)
+            return retVal;
 
-    /* Speed ability */
-    if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_MODE_OFFSET, &data)) != RT_ERR_OK)
-        return retVal;
+        ims &= intCallbackMask;
+        if (ims == 0)
+            break;
 
-    if (data == 0)
-    {
-        pAbility->AutoNegotiation = 1;
-        pAbility->Full_1000 = 1;
-        pAbility->Full_100 = 1;
-    }
-    else
-    {
-        if ((retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_MODE_MASK, &data)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_setAsicInterruptStatus(ims)) != RT_ERR_OK)
             return retVal;
 
-        if (data == 4)
-        {
-            pAbility->Full_1000 = 1;
+        memset(&event, 0, sizeof(event));
+        event.ms = ms;
+        event.status = ims;
 
-            if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FIB0_CFG00, &data)) != RT_ERR_OK)
+        if (ims & (1 << INT_TYPE_LINK_STATUS))
+        {
+            if ((retVal = rtk_int_advanceInfo_get(ADV_PORT_LINKUP_PORT_MASK, &info)) != RT_ERR_OK)
+                return retVal;
+            event.linkUp = info.portMask;
+            if ((retVal = rtk_int_advanceInfo_get(ADV_PORT_LINKDOWN_PORT_MASK, &info)) != RT_ERR_OK)
+                return retVal;
+            event.linkDown = info.portMask;
+        }
+        if (ims & (1 << INT_TYPE_LINK_SPEED))
+        {
+            if ((retVal = rtk_int_advanceInfo_get(ADV_SPEED_CHANGE_PORT_MASK, &info)) != RT_ERR_OK)
+                return retVal;
+            event.speedChange = info.portMask;
+        }
+        if (ims & (1 << INT_TYPE_LEARN_LIMIT))
+        {
+            if ((retVal = rtk_int_advanceInfo_get(ADV_L2_LEARN_PORT_MASK, &info)) != RT_ERR_OK)
+                return retVal;
+            event.learnOver = info.portMask;
+            event.systemLearnOver = info.systemLearnOver;
+        }
+        if (ims & (1 << INT_TYPE_CONGEST))
+        {
+            if ((retVal = rtk_int_advanceInfo_get(ADV_SPECIAL_CONGESTION_PORT_MASK, &info)) != RT_ERR_OK)
+                return retVal;
+            event.congest = info.portMask;
+        }
+        if (ims & (1 << INT_TYPE_METER_EXCEED))
+        {
+            if ((retVal = rtk_int_advanceInfo_get(ADV_METER_EXCEED_MASK, &info)) != RT_ERR_OK)
+                return retVal;
+            event.meterMask = info.meterMask;
+        }
+        if (ims & (1 << INT_TYPE_LOOP_DETECT))
+        {
+            if ((retVal = rtk_int_advanceInfo_get(ADV_RLDP_LOOPED, &info)) != RT_ERR_OK)
+                return retVal;
+            event.looped = info.portMask;
+            if ((retVal = rtk_int_advanceInfo_get(ADV_RLDP_RELEASED, &info)) != RT_ERR_OK)
                 return retVal;
+            event.released = info.portMask;
+        }
 
-            if (data & 0x1000)
-                pAbility->AutoNegotiation = 1;
-            else
-                pAbility->AutoNegotiation = 0;
+        for (type = 0; type < INT_TYPE_END; type++)
+        {
+            if ((ims & (1 << type)) && (intCallback[type] != NULL))
+            {
+                intCallback[type](&event, intCallbackArg[type]);
+                num++;
+            }
         }
-        else if (data == 5)
-            pAbility->Full_100 = 1;
-        else
-            return RT_ERR_FAILED;
+
+        if (digitalRead(intPin) != intActiveLevel)
+            break;
+
+        ms = millis();
     }
 
+    if (pNum != NULL)
+        *pNum = num;
+
     return RT_ERR_OK;
 }
+#endif
 
-int32_t rtl8367::rtk_port_phyAutoNegoAbility_get(rtk_port_t port, rtk_port_phy_ability_t *pAbility)
-{
-    int32_t retVal;
-    uint32_t phyData0;
-    uint32_t phyData4;
-    uint32_t phyData9;
-    rtk_port_media_t media_type;
-
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_UTP(port);
-
-    if (NULL == pAbility)
-        return RT_ERR_NULL_POINTER;
+// ----------------------- MIB -----------------------
 
-    if (rtk_switch_isComboPort(port) == RT_ERR_OK)
-    {
-        if ((retVal = _rtk_port_phyComboPortMedia_get(port, &media_type)) != RT_ERR_OK)
-            return retVal;
-
-        if (media_type == PORT_MEDIA_FIBER)
+#define MIB_NOT_SUPPORT (0xFFFF)
+int32_t rtl8367::_get_asic_mib_idx(rtk_stat_port_type_t cnt_idx, RTL8367C_MIBCOUNTER *pMib_idx)
+{
+    static const RTL8367C_MIBCOUNTER mib_asic_idx[STAT_PORT_CNTR_END] =
         {
-            return _rtk_port_FiberModeAbility_get(port, pAbility);
-        }
-    }
-
-    /*Control register setting and restart auto*/
-    if ((retVal = rtl8367c_getAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_CONTROL_REG, &phyData0)) != RT_ERR_OK)
-        return retVal;
-
-    /*Auto-Negotiation control register setting*/
-    if ((retVal = rtl8367c_getAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_AN_ADVERTISEMENT_REG, &phyData4)) != RT_ERR_OK)
-        return retVal;
-
-    /*1000 BASE-T control register setting*/
-    if ((retVal = rtl8367c_getAsicPHYReg(rtk_switch_port_L2P_get(port), PHY_1000_BASET_CONTROL_REG, &phyData9)) != RT_ERR_OK)
-        return retVal;
-
-    if (phyData9 & (1 << 9))
-        pAbility->Full_1000 = 1;
-    else
-        pAbility->Full_1000 = 0;
-
-    if (phyData4 & (1 << 11))
-        pAbility->AsyFC = 1;
-    else
-        pAbility->AsyFC = 0;
-
-    if (phyData4 & (1 << 10))
-        pAbility->FC = 1;
-    else
-        pAbility->FC = 0;
+            ifInOctets,                           /* STAT_IfInOctets */
+            dot3StatsFCSErrors,                   /* STAT_Dot3StatsFCSErrors */
+            dot3StatsSymbolErrors,                /* STAT_Dot3StatsSymbolErrors */
+            dot3InPauseFrames,                    /* STAT_Dot3InPauseFrames */
+            dot3ControlInUnknownOpcodes,          /* STAT_Dot3ControlInUnknownOpcodes */
+            etherStatsFragments,                  /* STAT_EtherStatsFragments */
+            etherStatsJabbers,                    /* STAT_EtherStatsJabbers */
+            ifInUcastPkts,                        /* STAT_IfInUcastPkts */
+            etherStatsDropEvents,                 /* STAT_EtherStatsDropEvents */
+            etherStatsOctets,                     /* STAT_EtherStatsOctets */
+            etherStatsUnderSizePkts,              /* STAT_EtherStatsUnderSizePkts */
+            etherOversizeStats,                   /* STAT_EtherOversizeStats */
+            etherStatsPkts64Octets,               /* STAT_EtherStatsPkts64Octets */
+            etherStatsPkts65to127Octets,          /* STAT_EtherStatsPkts65to127Octets */
+            etherStatsPkts128to255Octets,         /* STAT_EtherStatsPkts128to255Octets */
+            etherStatsPkts256to511Octets,         /* STAT_EtherStatsPkts256to511Octets */
+            etherStatsPkts512to1023Octets,        /* STAT_EtherStatsPkts512to1023Octets */
+            etherStatsPkts1024to1518Octets,       /* STAT_EtherStatsPkts1024to1518Octets */
+            ifInMulticastPkts,                    /* STAT_EtherStatsMulticastPkts */
+            ifInBroadcastPkts,                    /* STAT_EtherStatsBroadcastPkts */
+            ifOutOctets,                          /* STAT_IfOutOctets */
+            dot3StatsSingleCollisionFrames,       /* STAT_Dot3StatsSingleCollisionFrames */
+            dot3StatMultipleCollisionFrames,      /* STAT_Dot3StatsMultipleCollisionFrames */
+            dot3sDeferredTransmissions,           /* STAT_Dot3StatsDeferredTransmissions */
+            dot3StatsLateCollisions,              /* STAT_Dot3StatsLateCollisions */
+            etherStatsCollisions,                 /* STAT_EtherStatsCollisions */
+            dot3StatsExcessiveCollisions,         /* STAT_Dot3StatsExcessiveCollisions */
+            dot3OutPauseFrames,                   /* STAT_Dot3OutPauseFrames */
+            (RTL8367C_MIBCOUNTER)MIB_NOT_SUPPORT, /* STAT_Dot1dBasePortDelayExceededDiscards */
+            dot1dTpPortInDiscards,                /* STAT_Dot1dTpPortInDiscards */
+            ifOutUcastPkts,                       /* STAT_IfOutUcastPkts */
+            ifOutMulticastPkts,                   /* STAT_IfOutMulticastPkts */
+            ifOutBroadcastPkts,                   /* STAT_IfOutBroadcastPkts */
+            outOampduPkts,                        /* STAT_OutOampduPkts */
+            inOampduPkts,                         /* STAT_InOampduPkts */
+            (RTL8367C_MIBCOUNTER)MIB_NOT_SUPPORT, /* STAT_PktgenPkts */
+            inMldChecksumError,                   /* STAT_InMldChecksumError */
+            inIgmpChecksumError,                  /* STAT_InIgmpChecksumError */
+            inMldSpecificQuery,                   /* STAT_InMldSpecificQuery */
+            inMldGeneralQuery,                    /* STAT_InMldGeneralQuery */
+            inIgmpSpecificQuery,                  /* STAT_InIgmpSpecificQuery */
+            inIgmpGeneralQuery,                   /* STAT_InIgmpGeneralQuery */
+            inMldLeaves,                          /* STAT_InMldLeaves */
+            inIgmpLeaves,                         /* STAT_InIgmpInterfaceLeaves */
+            inIgmpJoinsSuccess,                   /* STAT_InIgmpJoinsSuccess */
+            inIgmpJoinsFail,                      /* STAT_InIgmpJoinsFail */
+            inMldJoinsSuccess,                    /* STAT_InMldJoinsSuccess */
+            inMldJoinsFail,                       /* STAT_InMldJoinsFail */
+            inReportSuppressionDrop,              /* STAT_InReportSuppressionDrop */
+            inLeaveSuppressionDrop,               /* STAT_InLeaveSuppressionDrop */
+            outIgmpReports,                       /* STAT_OutIgmpReports */
+            outIgmpLeaves,                        /* STAT_OutIgmpLeaves */
+            outIgmpGeneralQuery,                  /* STAT_OutIgmpGeneralQuery */
+            outIgmpSpecificQuery,                 /* STAT_OutIgmpSpecificQuery */
+            outMldReports,                        /* STAT_OutMldReports */
+            outMldLeaves,                         /* STAT_OutMldLeaves */
+            outMldGeneralQuery,                   /* STAT_OutMldGeneralQuery */
+            outMldSpecificQuery,                  /* STAT_OutMldSpecificQuery */
+            inKnownMulticastPkts,                 /* STAT_InKnownMulticastPkts */
+            ifInMulticastPkts,                    /* STAT_IfInMulticastPkts */
+            ifInBroadcastPkts,                    /* STAT_IfInBroadcastPkts */
+            ifOutDiscards                         /* STAT_IfOutDiscards */
+        };
 
-    if (phyData4 & (1 << 8))
-        pAbility->Full_100 = 1;
-    else
-        pAbility->Full_100 = 0;
+    if (cnt_idx >= STAT_PORT_CNTR_END)
+        return RT_ERR_STAT_INVALID_PORT_CNTR;
 
-    if (phyData4 & (1 << 7))
-        pAbility->Half_100 = 1;
-    else
-        pAbility->Half_100 = 0;
+    if (mib_asic_idx[cnt_idx] == MIB_NOT_SUPPORT)
+        return RT_ERR_CHIP_NOT_SUPPORTED;
 
-    if (phyData4 & (1 << 6))
-        pAbility->Full_10 = 1;
-    else
-        pAbility->Full_10 = 0;
+    *pMib_idx = mib_asic_idx[cnt_idx];
+    return RT_ERR_OK;
+}
 
-    if (phyData4 & (1 << 5))
-        pAbility->Half_10 = 1;
-    else
-        pAbility->Half_10 = 0;
+/* word offset of a counter inside the per port MIB block and its length in words */
+void rtl8367::_get_asic_mib_layout(RTL8367C_MIBCOUNTER mibIdx, uint32_t *pOffset, uint32_t *pLength)
+{
+    static const uint8_t mibOffset[RTL8367C_MIBS_NUMBER] = {
+        0, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38,
+        40, 44, 46, 48, 50, 52, 54, 56, 58,
+        60, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90,
+        92, 94, 96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122};
 
-    if (phyData0 & (1 << 12))
-        pAbility->AutoNegotiation = 1;
+    *pOffset = mibOffset[mibIdx];
+    if ((ifInOctets == mibIdx) || (etherStatsOctets == mibIdx) || (ifOutOctets == mibIdx))
+        *pLength = 4;
     else
-        pAbility->AutoNegotiation = 0;
-
-    return RT_ERR_OK;
+        *pLength = 2;
 }
 
-// -------------------------- LED --------------------------
-
 /* Function Name:
- *      rtk_switch_isCPUPort
+ *      rtl8367c_getAsicMIBsCounter
  * Description:
- *      Check is logical port a CPU port
+ *      Get MIBs counter
  * Input:
- *      logicalPort     - logical port ID
+ *      port        - Physical port number (0~7)
+ *      mibIdx      - MIB counter index
+ *      pCounter    - MIB retrived counter
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Port ID is a CPU port
- *      RT_ERR_FAILED   - Port ID is not a CPU port
- *      RT_ERR_NOT_INIT - Not Initialize
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_BUSYWAIT_TIMEOUT - MIB is busy at retrieving
+ *      RT_ERR_STAT_CNTR_FAIL   - MIB is resetting
  * Note:
- *
+ *      Before MIBs counter retrieving, writting accessing address to ASIC at first and check the MIB
+ *      control register status. If busy bit of MIB control is set, that means MIB counter have been
+ *      waiting for preparing, then software must wait atfer this busy flag reset by ASIC. This driver
+ *      did not recycle reading user desired counter. Software must use driver again to get MIB counter
+ *      if return value is not RT_ERR_OK.
  */
-int32_t rtl8367::rtk_switch_isCPUPort(uint32_t logicalPort)
+int32_t rtl8367::rtl8367c_getAsicMIBsCounter(uint32_t port, RTL8367C_MIBCOUNTER mibIdx, uint64_t *pCounter)
 {
+    int32_t retVal;
+    uint32_t regAddr;
+    uint32_t regData;
+    uint32_t mibAddr;
+    uint32_t mibOff = 0;
+    uint32_t mibLen;
+    uint16_t i;
+    uint64_t mibCounter;
 
-    if (logicalPort >= RTK_SWITCH_PORT_NUM)
-        return RT_ERR_FAILED;
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    if (((0x01 << logicalPort) & halCtrl.valid_cpu_portmask) != 0)
-        return RT_ERR_OK;
+    if (mibIdx >= RTL8367C_MIBS_NUMBER)
+        return RT_ERR_STAT_INVALID_CNTR;
+
+    _get_asic_mib_layout(mibIdx, &mibOff, &mibLen);
+    if (dot1dTpLearnedEntryDiscards == mibIdx)
+    {
+        mibOff = RTL8367C_MIB_LEARNENTRYDISCARD_OFFSET;
+        mibAddr = mibOff;
+    }
     else
-        return RT_ERR_FAILED;
-}
+    {
+        mibOff += RTL8367C_MIB_PORT_OFFSET * port;
 
-/*
-@func int32_t | rtl8367c_setAsicLedGroupEnable | Turn on/off Led of all system ports
-@parm uint32_t | group | LED group id.
-@parm uint32_t | portmask | LED port mask.
-@rvalue RT_ERR_OK | Success.
-@rvalue RT_ERR_SMI | SMI access error.
-@rvalue RT_ERR_PORT_ID | Invalid port number.
-@rvalue RT_ERR_INPUT | Invalid input value.
-@comm
-    The API can turn on/off leds of dedicated port while indicated information configuration of LED group is set to force mode.
- */
-int32_t rtl8367::rtl8367c_setAsicLedGroupEnable(uint32_t group, uint32_t portmask)
-{
-    int32_t retVal;
-    uint32_t regAddr;
-    uint32_t regDataMask;
+        if (port > 7)
+            mibOff = mibOff + 68;
 
-    if (group >= RTL8367C_LEDGROUPNO)
-        return RT_ERR_INPUT;
+        mibAddr = mibOff;
+    }
 
-    regAddr = RTL8367C_REG_PARA_LED_IO_EN1 + group / 2;
-    regDataMask = 0xFF << ((group % 2) * 8);
-    retVal = rtl8367c_setAsicRegBits(regAddr, regDataMask, portmask & 0xff);
+    /* Read MIB addr before writing */
+    retVal = rtl8367c_getAsicReg(RTL8367C_REG_MIB_ADDRESS, &regData);
     if (retVal != RT_ERR_OK)
         return retVal;
 
-    regAddr = RTL8367C_REG_PARA_LED_IO_EN3;
-    regDataMask = 0x3 << (group * 2);
-    retVal = rtl8367c_setAsicRegBits(regAddr, regDataMask, (portmask >> 8) & 0x7);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (regData == (mibAddr >> 2))
+    {
+        /* Write MIB addr to an alternate value */
+        retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, (mibAddr >> 2) + 1);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    return RT_ERR_OK;
-}
+        while (1)
+        {
+            retVal = rtl8367c_getAsicReg(RTL8367C_REG_MIB_ADDRESS, &regData);
+            if (retVal != RT_ERR_OK)
+                return retVal;
 
-int32_t rtl8367::rtk_led_enable_set(rtk_led_group_t group, rtk_portmask_t *pPortmask)
-{
-    int32_t retVal;
-    uint32_t pmask;
-    uint32_t port;
+            if (regData == ((mibAddr >> 2) + 1))
+            {
+                break;
+            }
 
-    if (group >= LED_GROUP_END)
-        return RT_ERR_INPUT;
+            retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, (mibAddr >> 2) + 1);
+            if (retVal != RT_ERR_OK)
+                return retVal;
+        }
 
-    RTK_CHK_PORTMASK_VALID(pPortmask);
+        /* polling busy flag */
+        i = 100;
+        while (i > 0)
+        {
+            /*read MIB control register*/
+            retVal = rtl8367c_getAsicReg(RTL8367C_MIB_CTRL_REG, &regData);
+            if (retVal != RT_ERR_OK)
+                return retVal;
 
-    RTK_PORTMASK_SCAN((*pPortmask), port)
-    {
-        if (rtk_switch_isCPUPort(port) == RT_ERR_OK)
-            return RT_ERR_PORT_MASK;
-    }
+            if ((regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK) == 0)
+            {
+                break;
+            }
 
-    if ((retVal = rtk_switch_portmask_L2P_get(pPortmask, &pmask)) != RT_ERR_OK)
-        return retVal;
+            i--;
+        }
 
-    if ((retVal = rtl8367c_setAsicLedGroupEnable(group, pmask)) != RT_ERR_OK)
-        return retVal;
+        if (regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK)
+            return RT_ERR_BUSYWAIT_TIMEOUT;
 
-    return RT_ERR_OK;
-}
-
-/*
-@func int32_t | rtl8367c_setAsicLedOperationMode | Set LED operation mode
-@parm uint32_t | mode | LED mode. 1:scan mode 1, 2:parallel mode, 3:mdx mode (serial mode)
-@rvalue RT_ERR_OK | Success.
-@rvalue RT_ERR_SMI | SMI access error.
-@rvalue RT_ERR_INPUT | Invalid input value.
-@comm
-    The API can turn on/off led serial mode and set signal to active high/low.
- */
-int32_t rtl8367::rtl8367c_setAsicLedOperationMode(uint32_t mode)
-{
-    int32_t retVal;
+        if (regData & RTL8367C_RESET_FLAG_MASK)
+            return RT_ERR_STAT_CNTR_FAIL;
+    }
 
-    /* Invalid input parameter */
-    if (mode >= LEDOP_END)
-        return RT_ERR_INPUT;
+    /*writing access counter address first*/
+    /*This address is SRAM address, and SRAM address = MIB register address >> 2*/
+    /*then ASIC will prepare 64bits counter wait for being retrived*/
+    /*Write Mib related address to access control register*/
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, (mibAddr >> 2));
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-    switch (mode)
+    /* polling MIB Addr register */
+    while (1)
     {
-    case LEDOP_PARALLEL:
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_LED_SYS_CONFIG, RTL8367C_LED_SELECT_OFFSET, 0)) != RT_ERR_OK)
-            return retVal;
-        /*Disable serial CLK mode*/
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCAN0_LED_IO_EN1, RTL8367C_LED_SERI_CLK_EN_OFFSET, 0)) != RT_ERR_OK)
-            return retVal;
-        /*Disable serial DATA mode*/
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCAN0_LED_IO_EN1, RTL8367C_LED_SERI_DATA_EN_OFFSET, 0)) != RT_ERR_OK)
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_MIB_ADDRESS, &regData);
+        if (retVal != RT_ERR_OK)
             return retVal;
-        break;
-    case LEDOP_SERIAL:
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_LED_SYS_CONFIG, RTL8367C_LED_SELECT_OFFSET, 1)) != RT_ERR_OK)
+
+        if (regData == (mibAddr >> 2))
+        {
+            break;
+        }
+
+        retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, (mibAddr >> 2));
+        if (retVal != RT_ERR_OK)
             return retVal;
-        /*Enable serial CLK mode*/
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCAN0_LED_IO_EN1, RTL8367C_LED_SERI_CLK_EN_OFFSET, 1)) != RT_ERR_OK)
+    }
+
+    /* polling busy flag */
+    i = 100;
+    while (i > 0)
+    {
+        /*read MIB control register*/
+        retVal = rtl8367c_getAsicReg(RTL8367C_MIB_CTRL_REG, &regData);
+        if (retVal != RT_ERR_OK)
             return retVal;
-        /*Enable serial DATA mode*/
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCAN0_LED_IO_EN1, RTL8367C_LED_SERI_DATA_EN_OFFSET, 1)) != RT_ERR_OK)
+
+        if ((regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK) == 0)
+        {
+            break;
+        }
+
+        i--;
+    }
+
+    if (regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK)
+        return RT_ERR_BUSYWAIT_TIMEOUT;
+
+    if (regData & RTL8367C_RESET_FLAG_MASK)
+        return RT_ERR_STAT_CNTR_FAIL;
+
+    mibCounter = 0;
+    i = mibLen;
+    if (4 == i)
+        regAddr = RTL8367C_MIB_COUNTER_BASE_REG + 3;
+    else
+        regAddr = RTL8367C_MIB_COUNTER_BASE_REG + ((mibOff + 1) % 4);
+
+    while (i)
+    {
+        retVal = rtl8367c_getAsicReg(regAddr, &regData);
+        if (retVal != RT_ERR_OK)
             return retVal;
-        break;
-    default:
-        return RT_ERR_INPUT;
-        break;
+
+        mibCounter = (mibCounter << 16) | (regData & 0xFFFF);
+
+        regAddr--;
+        i--;
     }
 
+    *pCounter = mibCounter;
+
     return RT_ERR_OK;
 }
-int32_t rtl8367::rtk_led_operation_set(rtk_led_operation_t mode)
+int32_t rtl8367::rtk_stat_port_get(rtk_port_t port, rtk_stat_port_type_t cntr_idx, uint64_t *pCntr)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t regData;
+    RTL8367C_MIBCOUNTER mib_idx;
+    uint64_t second_cnt;
 
-    if (mode >= LED_OP_END)
-        return RT_ERR_INPUT;
+    if (NULL == pCntr)
+        return RT_ERR_NULL_POINTER;
 
-    switch (mode)
-    {
-    case LED_OP_PARALLEL:
-        regData = LEDOP_PARALLEL;
-        break;
-    case LED_OP_SERIAL:
-        regData = LEDOP_SERIAL;
-        break;
-    default:
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (cntr_idx >= STAT_PORT_CNTR_END)
+        return RT_ERR_STAT_INVALID_PORT_CNTR;
+
+    if ((retVal = _get_asic_mib_idx(cntr_idx, &mib_idx)) != RT_ERR_OK)
+        return retVal;
+
+    if (mib_idx == MIB_NOT_SUPPORT)
         return RT_ERR_CHIP_NOT_SUPPORTED;
-        break;
-    }
 
-    if ((retVal = rtl8367c_setAsicLedOperationMode(regData)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicMIBsCounter(rtk_switch_port_L2P_get(port), mib_idx, pCntr)) != RT_ERR_OK)
         return retVal;
 
-    return RT_ERR_OK;
-}
+    if (cntr_idx == STAT_EtherStatsMulticastPkts)
+    {
+        if ((retVal = _get_asic_mib_idx(STAT_IfOutMulticastPkts, &mib_idx)) != RT_ERR_OK)
+            return retVal;
 
-/* Function Name:
- *      rtl8367c_setAsicLedBlinkRate
- * Description:
- *      Set led blinking rate at mode 0 to mode 3
- * Input:
- *      blinkRate   - Support 6 blink rates
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_OUT_OF_RANGE - input parameter out of range
- * Note:
- *      LED blink rate can be at 43ms, 84ms, 120ms, 170ms, 340ms and 670ms
- */
-int32_t rtl8367::rtl8367c_setAsicLedBlinkRate(uint32_t blinkRate)
-{
-    if (blinkRate >= LEDBLINKRATE_END)
-        return RT_ERR_OUT_OF_RANGE;
+        if ((retVal = rtl8367c_getAsicMIBsCounter(rtk_switch_port_L2P_get(port), mib_idx, &second_cnt)) != RT_ERR_OK)
+            return retVal;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_REG_LED_MODE, RTL8367C_SEL_LEDRATE_MASK, blinkRate);
-}
+        *pCntr += second_cnt;
+    }
 
-int32_t rtl8367::rtk_led_blinkRate_set(rtk_led_blink_rate_t blinkRate)
-{
-    int32_t retVal;
+    if (cntr_idx == STAT_EtherStatsBroadcastPkts)
+    {
+        if ((retVal = _get_asic_mib_idx(STAT_IfOutBroadcastPkts, &mib_idx)) != RT_ERR_OK)
+            return retVal;
 
-    if (blinkRate >= LED_BLINKRATE_END)
-        return RT_ERR_FAILED;
+        if ((retVal = rtl8367c_getAsicMIBsCounter(rtk_switch_port_L2P_get(port), mib_idx, &second_cnt)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_setAsicLedBlinkRate(blinkRate)) != RT_ERR_OK)
-        return retVal;
+        *pCntr += second_cnt;
+    }
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicLedIndicateInfoConfig
+ *      rtl8367c_setAsicMIBsCounterReset
  * Description:
- *      Set Leds indicated information mode
+ *      Reset global/queue manage or per-port MIB counter
  * Input:
- *      ledno   - LED group number. There are 1 to 1 led mapping to each port in each led group
- *      config  - Support 16 types configuration
+ *      greset  - Global reset
+ *      qmreset - Queue maganement reset
+ *      portmask    - Port reset mask
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
  * Note:
- *      The API can set LED indicated information configuration for each LED group with 1 to 1 led mapping to each port.
- *      Definition        LED Statuses            Description
- *      0000        LED_Off                LED pin Tri-State.
- *      0001        Dup/Col                Collision, Full duplex Indicator. Blinking every 43ms when collision happens. Low for full duplex, and high for half duplex mode.
- *      0010        Link/Act               Link, Activity Indicator. Low for link established. Link/Act Blinks every 43ms when the corresponding port is transmitting or receiving.
- *      0011        Spd1000                1000Mb/s Speed Indicator. Low for 1000Mb/s.
- *      0100        Spd100                 100Mb/s Speed Indicator. Low for 100Mb/s.
- *      0101        Spd10                  10Mb/s Speed Indicator. Low for 10Mb/s.
- *      0110        Spd1000/Act            1000Mb/s Speed/Activity Indicator. Low for 1000Mb/s. Blinks every 43ms when the corresponding port is transmitting or receiving.
- *      0111        Spd100/Act             100Mb/s Speed/Activity Indicator. Low for 100Mb/s. Blinks every 43ms when the corresponding port is transmitting or receiving.
- *      1000        Spd10/Act              10Mb/s Speed/Activity Indicator. Low for 10Mb/s. Blinks every 43ms when the corresponding port is transmitting or receiving.
- *      1001        Spd100 (10)/Act        10/100Mb/s Speed/Activity Indicator. Low for 10/100Mb/s. Blinks every 43ms when the corresponding port is transmitting or receiving.
- *      1010        Fiber                  Fiber link Indicator. Low for Fiber.
- *      1011        Fault                  Auto-negotiation     Fault Indicator. Low for Fault.
- *      1100        Link/Rx                Link, Activity Indicator. Low for link established. Link/Rx Blinks every 43ms when the corresponding port is transmitting.
- *      1101        Link/Tx                Link, Activity Indicator. Low for link established. Link/Tx Blinks every 43ms when the corresponding port is receiving.
- *      1110        Master                 Link on Master Indicator. Low for link Master established.
- *      1111        LED_Force              Force LED output, LED output value reference
+ *      None
  */
-int32_t rtl8367::rtl8367c_setAsicLedIndicateInfoConfig(uint32_t ledno, uint32_t config)
+int32_t rtl8367::rtl8367c_setAsicMIBsCounterReset(uint32_t greset, uint32_t qmreset, uint32_t portmask)
 {
     int32_t retVal;
-    const uint16_t bits[RTL8367C_LEDGROUPNO] = {RTL8367C_LED0_CFG_MASK, RTL8367C_LED1_CFG_MASK, RTL8367C_LED2_CFG_MASK};
-
-    if (ledno >= RTL8367C_LEDGROUPNO)
-        return RT_ERR_OUT_OF_RANGE;
+    uint32_t regData;
+    uint32_t regBits;
 
-    if (config >= LEDCONF_END)
-        return RT_ERR_OUT_OF_RANGE;
+    regBits = RTL8367C_GLOBAL_RESET_MASK |
+              RTL8367C_QM_RESET_MASK |
+              RTL8367C_MIB_PORT07_MASK |
+              ((uint32_t)0x7 << 13);
+    regData = ((greset << RTL8367C_GLOBAL_RESET_OFFSET) & RTL8367C_GLOBAL_RESET_MASK) |
+              ((qmreset << RTL8367C_QM_RESET_OFFSET) & RTL8367C_QM_RESET_MASK) |
+              (((portmask & 0xFF) << RTL8367C_PORT0_RESET_OFFSET) & RTL8367C_MIB_PORT07_MASK) |
+              (((portmask >> 8) & 0x7) << 13);
 
-    retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_LED_CONFIGURATION, RTL8367C_LED_CONFIG_SEL_OFFSET, 0);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_MIB_CTRL0, regBits, (regData >> RTL8367C_PORT0_RESET_OFFSET));
+#ifdef RTL8367_STAT_RATE
+    if (retVal == RT_ERR_OK)
+        statRateZero(greset ? 0xFF : portmask);
+#endif
 
-    return rtl8367c_setAsicRegBits(RTL8367C_REG_LED_CONFIGURATION, bits[ledno], config);
+    return retVal;
 }
-int32_t rtl8367::rtk_led_groupConfig_set(rtk_led_group_t group, rtk_led_congig_t config)
+int32_t rtl8367::rtk_stat_port_reset(rtk_port_t port)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
-    if (LED_GROUP_END <= group)
-        return RT_ERR_FAILED;
-
-    if (LED_CONFIG_END <= config)
-        return RT_ERR_FAILED;
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if ((retVal = rtl8367c_setAsicLedIndicateInfoConfig(group, config)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_setAsicMIBsCounterReset(0, 0, 1 << rtk_switch_port_L2P_get(port))) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
-// ------------------------------- RMA -----------------------------------------
-
 /* Function Name:
- *      rtl8367c_getAsicRma
+ *      rtl8367c_setAsicMIBsAddr
  * Description:
- *      Get reserved multicast address for CPU trapping
+ *      Latch a MIB snapshot at a counter address
  * Input:
- *      index     - reserved multicast LSB byte, 0x00~0x2F is available value
- *      rmacfg     - type of RMA for trapping frame type setting
+ *      mibAddr - SRAM address of the counters (MIB register address >> 2)
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK         - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_RMA_ADDR - Invalid RMA address index
- * Note:
- *      None
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_BUSYWAIT_TIMEOUT - MIB is busy at retrieving
+ *      RT_ERR_STAT_CNTR_FAIL   - MIB is resetting
+ * Note:
+ *      Writes the address, reads it back until it holds and waits for the
+ *      busy flag, like rtl8367c_getAsicMIBsCounter does for each write.
  */
-int32_t rtl8367::rtl8367c_getAsicRma(uint32_t index, rtl8367c_rma_t *pRmacfg)
+int32_t rtl8367::rtl8367c_setAsicMIBsAddr(uint32_t mibAddr)
 {
     int32_t retVal;
     uint32_t regData;
+    uint16_t busyCounter;
 
-    if (index > RTL8367C_RMAMAX)
-        return RT_ERR_RMA_ADDR;
+    busyCounter = 100;
+    while (1)
+    {
+        retVal = rtl8367c_setAsicReg(RTL8367C_REG_MIB_ADDRESS, mibAddr);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    if ((index >= 0x4 && index <= 0x7) || (index >= 0x9 && index <= 0x0C) || (0x0F == index))
-        index = 0x04;
-    else if ((index >= 0x13 && index <= 0x17) || (0x19 == index) || (index >= 0x1B && index <= 0x1f))
-        index = 0x13;
-    else if (index >= 0x22 && index <= 0x2F)
-        index = 0x22;
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_MIB_ADDRESS, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    retVal = rtl8367c_getAsicReg(RTL8367C_REG_RMA_CTRL00 + index, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+        if (regData == mibAddr)
+            break;
 
-    pRmacfg->operation = ((regData >> 7) & 0x0003);
-    pRmacfg->discard_storm_filter = ((regData >> 6) & 0x0001);
-    pRmacfg->trap_priority = ((regData >> 3) & 0x0007);
-    pRmacfg->keep_format = ((regData >> 2) & 0x0001);
-    pRmacfg->vlan_leaky = ((regData >> 1) & 0x0001);
-    pRmacfg->portiso_leaky = (regData & 0x0001);
+        busyCounter--;
+        if (busyCounter == 0)
+            return RT_ERR_BUSYWAIT_TIMEOUT;
+    }
 
-    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    busyCounter = 100;
+    while (1)
+    {
+        retVal = rtl8367c_getAsicReg(RTL8367C_MIB_CTRL_REG, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    pRmacfg->trap_priority = regData;
+        if ((regData & RTL8367C_MIB_CTRL0_BUSY_FLAG_MASK) == 0)
+            break;
+
+        busyCounter--;
+        if (busyCounter == 0)
+            return RT_ERR_BUSYWAIT_TIMEOUT;
+    }
+
+    if (regData & RTL8367C_RESET_FLAG_MASK)
+        return RT_ERR_STAT_CNTR_FAIL;
 
     return RT_ERR_OK;
 }
+
 /* Function Name:
- *      rtl8367c_setAsicRma
+ *      rtl8367c_getAsicMIBsPort
  * Description:
- *      Set reserved multicast address for CPU trapping
+ *      Get the whole MIB block of a port
  * Input:
- *      index     - reserved multicast LSB byte, 0x00~0x2F is available value
- *      pRmacfg     - type of RMA for trapping frame type setting
+ *      port        - Physical port number (0~10)
+ *      pLastAddr   - value known to be in the MIB address register, 0xFFFFFFFF if unknown
  * Output:
- *      None
+ *      pLastAddr   - value left in the MIB address register, 0xFFFFFFFF after an error
+ *      pMib        - RTL8367C_MIB_PORT_OFFSET words, laid out as _get_asic_mib_layout tells
  * Return:
- *      RT_ERR_OK         - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_BUSYWAIT_TIMEOUT - MIB is busy at retrieving
+ *      RT_ERR_STAT_CNTR_FAIL   - MIB is resetting
  * Note:
- *      None
+ *      Every address write latches four words, all of them belong to the
+ *      port's counters, so the block costs one latch (write, read-back and
+ *      busy poll) and four reads per four words. pLastAddr only saves the
+ *      initial read of the address: pass 0xFFFFFFFF unless the previous call
+ *      returned it and nothing else wrote the MIB address in between.
+ *      Ports 8~10 follow ports 0~7 after a gap of 68 words.
  */
-int32_t rtl8367::rtl8367c_setAsicRma(uint32_t index, rtl8367c_rma_t *pRmacfg)
+int32_t rtl8367::rtl8367c_getAsicMIBsPort(uint32_t port, uint32_t *pLastAddr, uint16_t *pMib)
 {
-    uint32_t regData = 0;
     int32_t retVal;
+    uint32_t regData;
+    uint32_t mibAddr, block, i;
 
-    if (index > RTL8367C_RMAMAX)
-        return RT_ERR_RMA_ADDR;
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    regData |= (pRmacfg->portiso_leaky & 0x0001);
-    regData |= ((pRmacfg->vlan_leaky & 0x0001) << 1);
-    regData |= ((pRmacfg->keep_format & 0x0001) << 2);
-    regData |= ((pRmacfg->trap_priority & 0x0007) << 3);
-    regData |= ((pRmacfg->discard_storm_filter & 0x0001) << 6);
-    regData |= ((pRmacfg->operation & 0x0003) << 7);
+    mibAddr = RTL8367C_MIB_PORT_OFFSET * port;
+    if (port > 7)
+        mibAddr = mibAddr + 68;
+    mibAddr = mibAddr >> 2;
 
-    if ((index >= 0x4 && index <= 0x7) || (index >= 0x9 && index <= 0x0C) || (0x0F == index))
-        index = 0x04;
-    else if ((index >= 0x13 && index <= 0x17) || (0x19 == index) || (index >= 0x1B && index <= 0x1f))
-        index = 0x13;
-    else if (index >= 0x22 && index <= 0x2F)
-        index = 0x22;
+    if (*pLastAddr == 0xFFFFFFFF)
+    {
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_MIB_ADDRESS, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, pRmacfg->trap_priority);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+        *pLastAddr = regData;
+    }
 
-    return rtl8367c_setAsicReg(RTL8367C_REG_RMA_CTRL00 + index, regData);
+    for (block = 0; block < (RTL8367C_MIB_PORT_OFFSET >> 2); block++)
+    {
+        /* the same address again would not latch, go through an alternate one */
+        if (*pLastAddr == (mibAddr + block))
+        {
+            *pLastAddr = 0xFFFFFFFF;
+            if ((retVal = rtl8367c_setAsicMIBsAddr(mibAddr + block + 1)) != RT_ERR_OK)
+                return retVal;
+        }
+
+        *pLastAddr = 0xFFFFFFFF;
+        if ((retVal = rtl8367c_setAsicMIBsAddr(mibAddr + block)) != RT_ERR_OK)
+            return retVal;
+
+        *pLastAddr = mibAddr + block;
+
+        for (i = 0; i < 4; i++)
+        {
+            retVal = rtl8367c_getAsicReg(RTL8367C_MIB_COUNTER_BASE_REG + i, &regData);
+            if (retVal != RT_ERR_OK)
+            {
+                *pLastAddr = 0xFFFFFFFF;
+                return retVal;
+            }
+
+            pMib[(block << 2) + i] = regData;
+        }
+    }
+
+    return RT_ERR_OK;
+}
+
+/* counters of a port out of its MIB block, see rtk_stat_port_get */
+void rtl8367::_rtk_stat_port_decode(uint16_t *pMib, rtk_stat_port_cntr_t *pPort_cntrs)
+{
+    uint32_t cntr_idx;
+    uint32_t mibOff, mibLen;
+    RTL8367C_MIBCOUNTER mib_idx;
+    uint64_t value;
+
+    for (cntr_idx = 0; cntr_idx < STAT_PORT_CNTR_END; cntr_idx++)
+    {
+        value = 0;
+        if (_get_asic_mib_idx((rtk_stat_port_type_t)cntr_idx, &mib_idx) == RT_ERR_OK)
+        {
+            _get_asic_mib_layout(mib_idx, &mibOff, &mibLen);
+            while (mibLen)
+            {
+                value = (value << 16) | pMib[mibOff + mibLen - 1];
+                mibLen--;
+            }
+        }
+
+        pPort_cntrs->cntr[cntr_idx] = value;
+    }
+
+    pPort_cntrs->cntr[STAT_EtherStatsMulticastPkts] += pPort_cntrs->cntr[STAT_IfOutMulticastPkts];
+    pPort_cntrs->cntr[STAT_EtherStatsBroadcastPkts] += pPort_cntrs->cntr[STAT_IfOutBroadcastPkts];
 }
 
 /* Function Name:
- *      rtl8367c_getAsicRmaCdp
+ *      rtk_stat_port_getAll
  * Description:
- *      Get CDP(Cisco Discovery Protocol) for CPU trapping
+ *      Get all counters of one specified port in the specified device.
  * Input:
- *      None
+ *      port        - port id.
  * Output:
- *      pRmacfg     - type of RMA for trapping frame type setting
+ *      pPort_cntrs - buffer pointer of counter value, indexed by rtk_stat_port_type_t.
  * Return:
- *      RT_ERR_OK         - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_FAILED           - Failed
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_INPUT            - Invalid input parameters.
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ *      RT_ERR_BUSYWAIT_TIMEOUT - MIB is busy at retrieving
+ *      RT_ERR_STAT_CNTR_FAIL   - MIB is resetting
  * Note:
- *      None
+ *      Reads the MIB block of the port in one pass instead of one counter per
+ *      call. Counters the chip does not support read 0.
  */
-int32_t rtl8367::rtl8367c_getAsicRmaCdp(rtl8367c_rma_t *pRmacfg)
+int32_t rtl8367::rtk_stat_port_getAll(rtk_port_t port, rtk_stat_port_cntr_t *pPort_cntrs)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t regData;
+    uint32_t lastAddr = 0xFFFFFFFF;
+    uint16_t mib[RTL8367C_MIB_PORT_OFFSET];
 
-    retVal = rtl8367c_getAsicReg(RTL8367C_REG_RMA_CTRL_CDP, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (NULL == pPort_cntrs)
+        return RT_ERR_NULL_POINTER;
 
-    pRmacfg->operation = ((regData >> 7) & 0x0003);
-    pRmacfg->discard_storm_filter = ((regData >> 6) & 0x0001);
-    pRmacfg->trap_priority = ((regData >> 3) & 0x0007);
-    pRmacfg->keep_format = ((regData >> 2) & 0x0001);
-    pRmacfg->vlan_leaky = ((regData >> 1) & 0x0001);
-    pRmacfg->portiso_leaky = (regData & 0x0001);
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
 
-    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, &regData);
-    if (retVal != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicMIBsPort(rtk_switch_port_L2P_get(port), &lastAddr, mib)) != RT_ERR_OK)
         return retVal;
 
-    pRmacfg->trap_priority = regData;
+    _rtk_stat_port_decode(mib, pPort_cntrs);
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicRmaCdp
+ *      rtk_stat_all_ports_get
  * Description:
- *      Set CDP(Cisco Discovery Protocol) for CPU trapping
+ *      Get all counters of several ports in the specified device.
  * Input:
- *      pRmacfg     - type of RMA for trapping frame type setting
+ *      pPortmask   - ports to read.
  * Output:
- *      None
+ *      pPort_cntrs - one entry per port of pPortmask, in ascending port order.
  * Return:
- *      RT_ERR_OK         - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_FAILED           - Failed
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_MASK        - Invalid portmask.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ *      RT_ERR_BUSYWAIT_TIMEOUT - MIB is busy at retrieving
+ *      RT_ERR_STAT_CNTR_FAIL   - MIB is resetting
  * Note:
- *      None
+ *      The MIB address register is read at most once for all ports.
  */
-int32_t rtl8367::rtl8367c_setAsicRmaCdp(rtl8367c_rma_t *pRmacfg)
+int32_t rtl8367::rtk_stat_all_ports_get(rtk_portmask_t *pPortmask, rtk_stat_port_cntr_t *pPort_cntrs)
 {
-    uint32_t regData = 0;
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t port;
+    uint32_t lastAddr = 0xFFFFFFFF;
+    uint16_t mib[RTL8367C_MIB_PORT_OFFSET];
 
-    if (pRmacfg->operation >= RMAOP_END)
-        return RT_ERR_RMA_ACTION;
+    if ((NULL == pPortmask) || (NULL == pPort_cntrs))
+        return RT_ERR_NULL_POINTER;
 
-    if (pRmacfg->trap_priority > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    RTK_CHK_PORTMASK_VALID(pPortmask);
 
-    regData |= (pRmacfg->portiso_leaky & 0x0001);
-    regData |= ((pRmacfg->vlan_leaky & 0x0001) << 1);
-    regData |= ((pRmacfg->keep_format & 0x0001) << 2);
-    regData |= ((pRmacfg->trap_priority & 0x0007) << 3);
-    regData |= ((pRmacfg->discard_storm_filter & 0x0001) << 6);
-    regData |= ((pRmacfg->operation & 0x0003) << 7);
+    RTK_PORTMASK_SCAN((*pPortmask), port)
+    {
+        if ((retVal = rtl8367c_getAsicMIBsPort(rtk_switch_port_L2P_get(port), &lastAddr, mib)) != RT_ERR_OK)
+            return retVal;
 
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, pRmacfg->trap_priority);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+        _rtk_stat_port_decode(mib, pPort_cntrs);
+        pPort_cntrs++;
+    }
 
-    return rtl8367c_setAsicReg(RTL8367C_REG_RMA_CTRL_CDP, regData);
+    return RT_ERR_OK;
+}
+
+#ifdef RTL8367_STAT_RATE
+/* the counters of the ports in portmask went back to 0 */
+void rtl8367::statRateZero(uint32_t portmask)
+{
+    uint32_t port;
+
+    for (port = 0; port < 8; port++)
+    {
+        if (portmask & (1 << port))
+            memset(statRatePrev[port], 0, sizeof(statRatePrev[port]));
+    }
 }
 
 /* Function Name:
- *      rtl8367c_setAsicRmaCsstp
+ *      rtk_stat_port_rate_get
  * Description:
- *      Set CSSTP(Cisco Shared Spanning Tree Protocol) for CPU trapping
+ *      Get the counter increase and rates of a port since the previous call
  * Input:
- *      pRmacfg     - type of RMA for trapping frame type setting
+ *      port    - port id.
  * Output:
- *      None
+ *      pRate   - deltas over pRate->ms and per second rates
  * Return:
- *      RT_ERR_OK         - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_FAILED           - Failed
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ *      RT_ERR_BUSYWAIT_TIMEOUT - MIB is busy at retrieving
+ *      RT_ERR_STAT_CNTR_FAIL   - MIB is resetting
  * Note:
- *      None
+ *      The first call for a port only takes the reference sample and
+ *      reports ms 0. The 32-bit packet counters may wrap once between calls,
+ *      so call at least every 45 minutes for a port running at line rate
+ *      (the byte counters are 64-bit). Counters cleared by rtk_stat_port_reset
+ *      or reset() count from 0, and a port whose 64-bit counters went back
+ *      is taken as cleared by someone else. Physical ports 8~10 are RT_ERR_PORT_ID.
  */
-int32_t rtl8367::rtl8367c_setAsicRmaCsstp(rtl8367c_rma_t *pRmacfg)
+int32_t rtl8367::rtk_stat_port_rate_get(rtk_port_t port, rtk_stat_port_rate_t *pRate)
 {
-    uint32_t regData = 0;
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t phyPort, cntr_idx, i;
+    uint32_t mibOff, mibLen, now, cleared;
+    uint32_t lastAddr = 0xFFFFFFFF;
+    uint16_t mib[RTL8367C_MIB_PORT_OFFSET];
+    uint64_t cur, prev;
+    RTL8367C_MIBCOUNTER mib_idx;
+    uint64_t *pDelta;
 
-    if (pRmacfg->operation >= RMAOP_END)
-        return RT_ERR_RMA_ACTION;
+    if (NULL == pRate)
+        return RT_ERR_NULL_POINTER;
 
-    if (pRmacfg->trap_priority > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
 
-    regData |= (pRmacfg->portiso_leaky & 0x0001);
-    regData |= ((pRmacfg->vlan_leaky & 0x0001) << 1);
-    regData |= ((pRmacfg->keep_format & 0x0001) << 2);
-    regData |= ((pRmacfg->trap_priority & 0x0007) << 3);
-    regData |= ((pRmacfg->discard_storm_filter & 0x0001) << 6);
-    regData |= ((pRmacfg->operation & 0x0003) << 7);
+    /* the reference samples cover physical ports 0~7 only */
+    phyPort = rtk_switch_port_L2P_get(port);
+    if (phyPort > 7)
+        return RT_ERR_PORT_ID;
 
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, pRmacfg->trap_priority);
-    if (retVal != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicMIBsPort(phyPort, &lastAddr, mib)) != RT_ERR_OK)
         return retVal;
 
-    return rtl8367c_setAsicReg(RTL8367C_REG_RMA_CTRL_CSSTP, regData);
-}
-/* Function Name:
- *      rtl8367c_getAsicRmaCsstp
- * Description:
- *      Get CSSTP(Cisco Shared Spanning Tree Protocol) for CPU trapping
- * Input:
- *      None
- * Output:
- *      pRmacfg     - type of RMA for trapping frame type setting
- * Return:
- *      RT_ERR_OK         - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_RMA_ADDR - Invalid RMA address index
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicRmaCsstp(rtl8367c_rma_t *pRmacfg)
-{
-    int32_t retVal;
-    uint32_t regData;
+    now = millis();
+    memset(pRate, 0, sizeof(rtk_stat_port_rate_t));
 
-    retVal = rtl8367c_getAsicReg(RTL8367C_REG_RMA_CTRL_CSSTP, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (statRateValid & (1 << phyPort))
+    {
+        pRate->ms = now - statRateMs[phyPort];
 
-    pRmacfg->operation = ((regData >> 7) & 0x0003);
-    pRmacfg->discard_storm_filter = ((regData >> 6) & 0x0001);
-    pRmacfg->trap_priority = ((regData >> 3) & 0x0007);
-    pRmacfg->keep_format = ((regData >> 2) & 0x0001);
-    pRmacfg->vlan_leaky = ((regData >> 1) & 0x0001);
-    pRmacfg->portiso_leaky = (regData & 0x0001);
+        /* 64-bit counters never wrap, going back means they were cleared */
+        cleared = 0;
+        for (cntr_idx = 0; cntr_idx < STAT_PORT_CNTR_END; cntr_idx++)
+        {
+            if (_get_asic_mib_idx((rtk_stat_port_type_t)cntr_idx, &mib_idx) != RT_ERR_OK)
+                continue;
 
-    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+            _get_asic_mib_layout(mib_idx, &mibOff, &mibLen);
+            cur = 0;
+            prev = 0;
+            for (i = mibLen; i > 0; i--)
+            {
+                cur = (cur << 16) | mib[mibOff + i - 1];
+                prev = (prev << 16) | statRatePrev[phyPort][mibOff + i - 1];
+            }
 
-    pRmacfg->trap_priority = regData;
+            if ((mibLen == 4) && (cur < prev))
+                cleared = 1;
+
+            pRate->delta.cntr[cntr_idx] = (mibLen == 4) ? (cur - prev) : (uint32_t)(cur - prev);
+        }
+
+        /* cleared counters count from 0 */
+        if (cleared)
+            _rtk_stat_port_decode(mib, &pRate->delta);
+        else
+        {
+            pDelta = pRate->delta.cntr;
+            pDelta[STAT_EtherStatsMulticastPkts] += pDelta[STAT_IfOutMulticastPkts];
+            pDelta[STAT_EtherStatsBroadcastPkts] += pDelta[STAT_IfOutBroadcastPkts];
+        }
+    }
+
+    memcpy(statRatePrev[phyPort], mib, sizeof(mib));
+    statRateMs[phyPort] = now;
+    statRateValid |= (1 << phyPort);
+
+    if (pRate->ms == 0)
+        return RT_ERR_OK;
+
+    pDelta = pRate->delta.cntr;
+    pRate->inBytesPerSec = pDelta[STAT_IfInOctets] * 1000 / pRate->ms;
+    pRate->outBytesPerSec = pDelta[STAT_IfOutOctets] * 1000 / pRate->ms;
+    pRate->inPktsPerSec = (pDelta[STAT_IfInUcastPkts] + pDelta[STAT_IfInMulticastPkts] + pDelta[STAT_IfInBroadcastPkts]) * 1000 / pRate->ms;
+    pRate->outPktsPerSec = (pDelta[STAT_IfOutUcastPkts] + pDelta[STAT_IfOutMulticastPkts] + pDelta[STAT_IfOutBroadcastPkts]) * 1000 / pRate->ms;
+    pRate->inErrorsPerSec = (pDelta[STAT_Dot3StatsFCSErrors] + pDelta[STAT_Dot3StatsSymbolErrors] + pDelta[STAT_EtherStatsFragments] +
+                             pDelta[STAT_EtherStatsJabbers] + pDelta[STAT_EtherStatsUnderSizePkts] + pDelta[STAT_EtherOversizeStats] +
+                             pDelta[STAT_EtherStatsDropEvents]) *
+                            1000 / pRate->ms;
+    pRate->outErrorsPerSec = (pDelta[STAT_Dot3StatsLateCollisions] + pDelta[STAT_Dot3StatsExcessiveCollisions] + pDelta[STAT_IfOutDiscards]) * 1000 / pRate->ms;
 
     return RT_ERR_OK;
 }
+#endif
+
+// --------------------- BUFFER ----------------------
 
 /* Function Name:
- *      rtl8367c_setAsicRmaLldp
+ *      rtl8367c_getAsicPortPage
  * Description:
- *      Set LLDP for CPU trapping
+ *      Get the packet buffer pages of a port and their peak
  * Input:
- *      pRmacfg     - type of RMA for trapping frame type setting
+ *      port    - Physical port number (0~10)
  * Output:
- *      None
+ *      pPage       - pages held now
+ *      pPageMax    - peak since the last clear
  * Return:
- *      RT_ERR_OK         - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicRmaLldp(uint32_t enabled, rtl8367c_rma_t *pRmacfg)
+int32_t rtl8367::rtl8367c_getAsicPortPage(uint32_t port, uint32_t *pPage, uint32_t *pPageMax)
 {
-    uint32_t regData = 0;
     int32_t retVal;
+    uint32_t regAddr;
 
-    if (enabled > 1)
-        return RT_ERR_ENABLE;
-
-    if (pRmacfg->operation >= RMAOP_END)
-        return RT_ERR_RMA_ACTION;
-
-    if (pRmacfg->trap_priority > RTL8367C_PRIMAX)
-        return RT_ERR_QOS_INT_PRIORITY;
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_RMA_LLDP_EN, RTL8367C_RMA_LLDP_EN_OFFSET, enabled);
-    if (retVal != RT_ERR_OK)
+    regAddr = (port < 8) ? (RTL8367C_REG_FLOWCTRL_PORT0_PAGE_COUNTER + port) : (RTL8367C_REG_FLOWCTRL_PORT8_PAGE_COUNTER + port - 8);
+    if ((retVal = rtl8367c_getAsicReg(regAddr, pPage)) != RT_ERR_OK)
         return retVal;
 
-    regData |= (pRmacfg->portiso_leaky & 0x0001);
-    regData |= ((pRmacfg->vlan_leaky & 0x0001) << 1);
-    regData |= ((pRmacfg->keep_format & 0x0001) << 2);
-    regData |= ((pRmacfg->trap_priority & 0x0007) << 3);
-    regData |= ((pRmacfg->discard_storm_filter & 0x0001) << 6);
-    regData |= ((pRmacfg->operation & 0x0003) << 7);
-
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, pRmacfg->trap_priority);
-    if (retVal != RT_ERR_OK)
+    regAddr = (port < 8) ? (RTL8367C_REG_FLOWCTRL_PORT0_PAGE_MAX + port) : (RTL8367C_REG_FLOWCTRL_PORT8_PAGE_MAX + port - 8);
+    if ((retVal = rtl8367c_getAsicReg(regAddr, pPageMax)) != RT_ERR_OK)
         return retVal;
 
-    return rtl8367c_setAsicReg(RTL8367C_REG_RMA_CTRL_LLDP, regData);
+    *pPage &= RTL8367C_FLOWCTRL_PORT0_PAGE_COUNTER_MASK;
+    *pPageMax &= RTL8367C_FLOWCTRL_PORT0_PAGE_MAX_MASK;
+
+    return RT_ERR_OK;
 }
+
 /* Function Name:
- *      rtl8367c_getAsicRmaLldp
+ *      rtl8367c_getAsicQueuePage
  * Description:
- *      Get LLDP for CPU trapping
+ *      Get the packet buffer pages of the egress queues of a port
  * Input:
- *      None
+ *      port    - Physical port number (0~10)
  * Output:
- *      pRmacfg     - type of RMA for trapping frame type setting
+ *      pPage       - pages held now, per queue
+ *      pPageMax    - peak since the last clear, per queue
  * Return:
- *      RT_ERR_OK         - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
  * Note:
- *      None
+ *      FLOWCTRL_DEBUG_CTRL0 selects the port shown by the
+ *      FLOWCTRL_QUEUEn_PAGE_COUNT/MAX_PAGE_COUNT registers.
  */
-int32_t rtl8367::rtl8367c_getAsicRmaLldp(uint32_t *pEnabled, rtl8367c_rma_t *pRmacfg)
+int32_t rtl8367::rtl8367c_getAsicQueuePage(uint32_t port, uint16_t *pPage, uint16_t *pPageMax)
 {
     int32_t retVal;
-    uint32_t regData;
+    uint32_t qid, regData;
 
-    retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_RMA_LLDP_EN, RTL8367C_RMA_LLDP_EN_OFFSET, pEnabled);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    retVal = rtl8367c_getAsicReg(RTL8367C_REG_RMA_CTRL_LLDP, &regData);
-    if (retVal != RT_ERR_OK)
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FLOWCTRL_DEBUG_CTRL0, port)) != RT_ERR_OK)
         return retVal;
 
-    pRmacfg->operation = ((regData >> 7) & 0x0003);
-    pRmacfg->discard_storm_filter = ((regData >> 6) & 0x0001);
-    pRmacfg->trap_priority = ((regData >> 3) & 0x0007);
-    pRmacfg->keep_format = ((regData >> 2) & 0x0001);
-    pRmacfg->vlan_leaky = ((regData >> 1) & 0x0001);
-    pRmacfg->portiso_leaky = (regData & 0x0001);
-
-    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    for (qid = 0; qid < RTK_MAX_NUM_OF_QUEUE; qid++)
+    {
+        if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FLOWCTRL_QUEUE0_PAGE_COUNT + qid, &regData)) != RT_ERR_OK)
+            return retVal;
+        pPage[qid] = regData & RTL8367C_FLOWCTRL_QUEUE0_PAGE_COUNT_MASK;
+    }
 
-    pRmacfg->trap_priority = regData;
+    for (qid = 0; qid < RTK_MAX_NUM_OF_QUEUE; qid++)
+    {
+        if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FLOWCTRL_QUEUE0_MAX_PAGE_COUNT + qid, &regData)) != RT_ERR_OK)
+            return retVal;
+        pPageMax[qid] = regData & RTL8367C_FLOWCTRL_QUEUE0_MAX_PAGE_COUNT_MASK;
+    }
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_trap_rmaAction_set(rtk_trap_type_t type, rtk_trap_rma_action_t rma_action)
+/* Function Name:
+ *      rtl8367c_setAsicPageMaxClear
+ * Description:
+ *      Restart the port, total and public page peaks
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ * Note:
+ *      One pulse of PAGE_COUNT_CLEAR restarts the peaks of all ports at once.
+ */
+int32_t rtl8367::rtl8367c_setAsicPageMaxClear()
 {
     int32_t retVal;
-    rtl8367c_rma_t rmacfg;
-    uint32_t tmp;
-
-    if (type >= TRAP_END)
-        return RT_ERR_INPUT;
-
-    if (rma_action >= RMA_ACTION_END)
-        return RT_ERR_RMA_ACTION;
-
-    if (type >= 0 && type <= TRAP_UNDEF_GARP_2F)
-    {
-        if ((retVal = rtl8367c_getAsicRma(type, &rmacfg)) != RT_ERR_OK)
-            return retVal;
+    uint32_t regData;
 
-        rmacfg.operation = rma_action;
+    /* keep DIS_SKIP_FP, read once for both writes */
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FLOWCTRL_PAGE_COUNT_CLEAR, &regData)) != RT_ERR_OK)
+        return retVal;
 
-        if ((retVal = rtl8367c_setAsicRma(type, &rmacfg)) != RT_ERR_OK)
-            return retVal;
-    }
-    else if (type == TRAP_CDP)
-    {
-        if ((retVal = rtl8367c_getAsicRmaCdp(&rmacfg)) != RT_ERR_OK)
-            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FLOWCTRL_PAGE_COUNT_CLEAR, regData | RTL8367C_PAGE_COUNT_CLEAR_MASK)) != RT_ERR_OK)
+        return retVal;
 
-        rmacfg.operation = rma_action;
+    return rtl8367c_setAsicReg(RTL8367C_REG_FLOWCTRL_PAGE_COUNT_CLEAR, regData & ~RTL8367C_PAGE_COUNT_CLEAR_MASK);
+}
 
-        if ((retVal = rtl8367c_setAsicRmaCdp(&rmacfg)) != RT_ERR_OK)
-            return retVal;
-    }
-    else if (type == TRAP_CSSTP)
-    {
-        if ((retVal = rtl8367c_getAsicRmaCsstp(&rmacfg)) != RT_ERR_OK)
-            return retVal;
+/* Function Name:
+ *      rtk_buf_portPage_get
+ * Description:
+ *      Get the buffer occupancy of a port and its queues
+ * Input:
+ *      port    - port id.
+ * Output:
+ *      pPage   - current and peak pages of the port and its queues
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      The peaks count from the last rtk_buf_pageMax_clear (port) or
+ *      rtk_buf_queuePageMax_clear (queues). A page holds 128 bytes.
+ */
+int32_t rtl8367::rtk_buf_portPage_get(rtk_port_t port, rtk_buf_port_page_t *pPage)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t phyPort, page, pageMax;
 
-        rmacfg.operation = rma_action;
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
 
-        if ((retVal = rtl8367c_setAsicRmaCsstp(&rmacfg)) != RT_ERR_OK)
-            return retVal;
-    }
-    else if (type == TRAP_LLDP)
-    {
-        if ((retVal = rtl8367c_getAsicRmaLldp(&tmp, &rmacfg)) != RT_ERR_OK)
-            return retVal;
+    if (NULL == pPage)
+        return RT_ERR_NULL_POINTER;
 
-        rmacfg.operation = rma_action;
+    phyPort = rtk_switch_port_L2P_get(port);
+    if ((retVal = rtl8367c_getAsicPortPage(phyPort, &page, &pageMax)) != RT_ERR_OK)
+        return retVal;
 
-        if ((retVal = rtl8367c_setAsicRmaLldp(tmp, &rmacfg)) != RT_ERR_OK)
-            return retVal;
-    }
-    else
-        return RT_ERR_INPUT;
+    pPage->page = page;
+    pPage->pageMax = pageMax;
 
-    return RT_ERR_OK;
+    return rtl8367c_getAsicQueuePage(phyPort, pPage->queuePage, pPage->queuePageMax);
 }
 
-int32_t rtl8367::rtk_trap_rmaAction_get(rtk_trap_type_t type, rtk_trap_rma_action_t *pRma_action)
+/* Function Name:
+ *      rtk_buf_systemPage_get
+ * Description:
+ *      Get the occupancy of the whole packet buffer
+ * Input:
+ *      None
+ * Output:
+ *      pPage   - current and peak pages in use, in total and in the public part
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_buf_systemPage_get(rtk_buf_system_page_t *pPage)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    rtl8367c_rma_t rmacfg;
-    uint32_t tmp;
-
-    if (type >= TRAP_END)
-        return RT_ERR_INPUT;
+    uint32_t regData;
 
-    if (NULL == pRma_action)
+    if (NULL == pPage)
         return RT_ERR_NULL_POINTER;
 
-    if (type >= 0 && type <= TRAP_UNDEF_GARP_2F)
-    {
-        if ((retVal = rtl8367c_getAsicRma(type, &rmacfg)) != RT_ERR_OK)
-            return retVal;
-
-        *pRma_action = (rtk_trap_rma_action_t)rmacfg.operation;
-    }
-    else if (type == TRAP_CDP)
-    {
-        if ((retVal = rtl8367c_getAsicRmaCdp(&rmacfg)) != RT_ERR_OK)
-            return retVal;
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FLOWCTRL_TOTAL_PAGE_COUNTER, &regData)) != RT_ERR_OK)
+        return retVal;
+    pPage->total = regData & RTL8367C_FLOWCTRL_TOTAL_PAGE_COUNTER_MASK;
 
-        *pRma_action = (rtk_trap_rma_action_t)rmacfg.operation;
-    }
-    else if (type == TRAP_CSSTP)
-    {
-        if ((retVal = rtl8367c_getAsicRmaCsstp(&rmacfg)) != RT_ERR_OK)
-            return retVal;
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FLOWCTRL_PUBLIC_PAGE_COUNTER, &regData)) != RT_ERR_OK)
+        return retVal;
+    pPage->publicPage = regData & RTL8367C_FLOWCTRL_PUBLIC_PAGE_COUNTER_MASK;
 
-        *pRma_action = (rtk_trap_rma_action_t)rmacfg.operation;
-    }
-    else if (type == TRAP_LLDP)
-    {
-        if ((retVal = rtl8367c_getAsicRmaLldp(&tmp, &rmacfg)) != RT_ERR_OK)
-            return retVal;
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FLOWCTRL_TOTAL_PAGE_MAX, &regData)) != RT_ERR_OK)
+        return retVal;
+    pPage->totalMax = regData & RTL8367C_FLOWCTRL_TOTAL_PAGE_MAX_MASK;
 
-        *pRma_action = (rtk_trap_rma_action_t)rmacfg.operation;
-    }
-    else
-        return RT_ERR_INPUT;
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FLOWCTRL_PUBLIC_PAGE_MAX, &regData)) != RT_ERR_OK)
+        return retVal;
+    pPage->publicMax = regData & RTL8367C_FLOWCTRL_PUBLIC_PAGE_MAX_MASK;
 
     return RT_ERR_OK;
 }
 
-// ----------------------------- STORM FILTERING CONTROL -----------------------------
-
 /* Function Name:
- *      rtl8367c_setAsicStormFilterUnknownUnicastEnable
+ *      rtk_buf_pageMax_clear
  * Description:
- *      Set per-port unknown unicast storm filter enable/disable
+ *      Restart the page peaks of every port and of the whole buffer
  * Input:
- *      port    - Physical port number (0~7)
- *      enabled - 1: enabled, 0: disabled
+ *      None
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
  * Note:
- *      None
+ *      All ports restart together, so peaks read afterwards cover the
+ *      same interval. rtk_buf_sample calls this after each sample.
  */
-int32_t rtl8367::rtl8367c_setAsicStormFilterUnknownUnicastEnable(uint32_t port, uint32_t enabled)
+int32_t rtl8367::rtk_buf_pageMax_clear()
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    RTK_SMI_STATS_SCOPE();
 
-    return rtl8367c_setAsicRegBit(RTL8367C_STORM_UNKNOWN_UCAST_REG, port, enabled);
+    return rtl8367c_setAsicPageMaxClear();
 }
 
 /* Function Name:
- *      rtl8367c_setAsicStormFilterUnknownMulticastEnable
+ *      rtk_buf_queuePageMax_clear
  * Description:
- *      Set per-port unknown multicast storm filter enable/disable
+ *      Restart the page peaks of the egress queues of a port
  * Input:
- *      port    - Physical port number (0~7)
- *      enabled - 1: enabled, 0: disabled
+ *      port    - port id.
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number.
  * Note:
- *      None
+ *      Pulses the QMAX_MASK bits of FLOWCTRL_DEBUG_CTRL1 with the port
+ *      selected in FLOWCTRL_DEBUG_CTRL0.
  */
-int32_t rtl8367::rtl8367c_setAsicStormFilterUnknownMulticastEnable(uint32_t port, uint32_t enabled)
+int32_t rtl8367::rtk_buf_queuePageMax_clear(rtk_port_t port)
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-    return rtl8367c_setAsicRegBit(RTL8367C_STORM_UNKNOWN_MCAST_REG, port, enabled);
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FLOWCTRL_DEBUG_CTRL0, rtk_switch_port_L2P_get(port))) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FLOWCTRL_DEBUG_CTRL1, RTL8367C_QMAX_MASK_MASK)) != RT_ERR_OK)
+        return retVal;
+
+    return rtl8367c_setAsicReg(RTL8367C_REG_FLOWCTRL_DEBUG_CTRL1, 0);
 }
 
-/* Function Name:
- *      rtl8367c_setAsicStormFilterMulticastEnable
- * Description:
- *      Set per-port multicast storm filter enable/disable
- * Input:
- *      port    - Physical port number (0~7)
- *      enabled - 1: enabled, 0: disabled
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicStormFilterMulticastEnable(uint32_t port, uint32_t enabled)
+#ifdef RTL8367_BUF_HIST
+/* histogram bucket of a page count, see rtk_buf_hist_t */
+static uint32_t _rtk_buf_bucket(uint32_t page)
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    uint32_t bucket;
 
-    return rtl8367c_setAsicRegBit(RTL8367C_STORM_MCAST_REG, port, enabled);
+    if (page == 0)
+        return 0;
+
+    bucket = 32 - __builtin_clz(page);
+
+    return (bucket < RTK_BUF_HIST_BUCKETS) ? bucket : (RTK_BUF_HIST_BUCKETS - 1);
 }
+
 /* Function Name:
- *      rtl8367c_setAsicStormFilterBroadcastEnable
+ *      rtk_buf_sample
  * Description:
- *      Set per-port broadcast storm filter enable/disable
+ *      Add the buffer occupancy of ports to their histograms
  * Input:
- *      port    - Physical port number (0~7)
- *      enabled - 1: enabled, 0: disabled
+ *      pPortmask   - ports to sample
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_MASK        - Invalid portmask.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
  * Note:
- *      None
+ *      Reads the current pages and the peak of every port in the mask, then
+ *      restarts the peaks of all ports with rtk_buf_pageMax_clear. Each
+ *      peak therefore covers the time since the previous sample and shows
+ *      bursts that the current pages miss. Two reads per port and two
+ *      writes per call.
  */
-int32_t rtl8367::rtl8367c_setAsicStormFilterBroadcastEnable(uint32_t port, uint32_t enabled)
-{
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    return rtl8367c_setAsicRegBit(RTL8367C_STORM_BCAST_REG, port, enabled);
-}
-int32_t rtl8367::rtk_rate_stormControlPortEnable_set(rtk_port_t port, rtk_rate_storm_group_t stormType, rtk_enable_t enable)
+int32_t rtl8367::rtk_buf_sample(rtk_portmask_t *pPortmask)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t port, phyPort, page, pageMax;
+    rtk_buf_hist_t *pHist;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
-
-    if (stormType >= STORM_GROUP_END)
-        return RT_ERR_SFC_UNKNOWN_GROUP;
+    if (NULL == pPortmask)
+        return RT_ERR_NULL_POINTER;
 
-    if (enable >= RTK_ENABLE_END)
-        return RT_ERR_ENABLE;
+    RTK_CHK_PORTMASK_VALID(pPortmask);
 
-    switch (stormType)
+    RTK_PORTMASK_SCAN((*pPortmask), port)
     {
-    case STORM_GROUP_UNKNOWN_UNICAST:
-        if ((retVal = rtl8367c_setAsicStormFilterUnknownUnicastEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_UNKNOWN_MULTICAST:
-        if ((retVal = rtl8367c_setAsicStormFilterUnknownMulticastEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
+        phyPort = rtk_switch_port_L2P_get(port);
+        if ((retVal = rtl8367c_getAsicPortPage(phyPort, &page, &pageMax)) != RT_ERR_OK)
             return retVal;
-        break;
-    case STORM_GROUP_MULTICAST:
-        if ((retVal = rtl8367c_setAsicStormFilterMulticastEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_BROADCAST:
-        if ((retVal = rtl8367c_setAsicStormFilterBroadcastEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
-            return retVal;
-        break;
-    default:
-        break;
+
+        pHist = &bufHist[phyPort];
+        pHist->samples++;
+        pHist->page[_rtk_buf_bucket(page)]++;
+        pHist->peak[_rtk_buf_bucket(pageMax)]++;
+        if (pageMax > pHist->pageMax)
+            pHist->pageMax = pageMax;
     }
 
-    return RT_ERR_OK;
+    return rtl8367c_setAsicPageMaxClear();
 }
 
 /* Function Name:
- *      rtl8367c_getAsicStormFilterUnknownUnicastEnable
+ *      rtk_buf_hist_get
  * Description:
- *      get per-port unknown unicast storm filter enable/disable
+ *      Get the buffer occupancy histogram of a port
  * Input:
- *      port    - Physical port number (0~7)
- *      pEnabled - 1: enabled, 0: disabled
+ *      port    - port id.
  * Output:
- *      None
+ *      pHist   - samples taken by rtk_buf_sample since the last clear
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
  * Note:
- *      None
+ *      No SMI access.
  */
-int32_t rtl8367::rtl8367c_getAsicStormFilterUnknownUnicastEnable(uint32_t port, uint32_t *pEnabled)
+int32_t rtl8367::rtk_buf_hist_get(rtk_port_t port, rtk_buf_hist_t *pHist)
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
 
-    return rtl8367c_getAsicRegBit(RTL8367C_STORM_UNKNOWN_UCAST_REG, port, pEnabled);
+    if (NULL == pHist)
+        return RT_ERR_NULL_POINTER;
+
+    *pHist = bufHist[rtk_switch_port_L2P_get(port)];
+
+    return RT_ERR_OK;
 }
+
 /* Function Name:
- *      rtl8367c_getAsicStormFilterUnknownMulticastEnable
+ *      rtk_buf_hist_clear
  * Description:
- *      Get per-port unknown multicast storm filter enable/disable
+ *      Empty the buffer occupancy histograms of all ports
  * Input:
- *      port    - Physical port number (0~7)
- *      pEnabled - 1: enabled, 0: disabled
+ *      None
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      None
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicStormFilterUnknownMulticastEnable(uint32_t port, uint32_t *pEnabled)
+void rtl8367::rtk_buf_hist_clear()
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    return rtl8367c_getAsicRegBit(RTL8367C_STORM_UNKNOWN_MCAST_REG, port, pEnabled);
+    memset(bufHist, 0, sizeof(bufHist));
 }
+#endif
+
+// --------------------- PKTGEN ----------------------
+
 /* Function Name:
- *      rtl8367c_getAsicStormFilterMulticastEnable
+ *      rtl8367c_setAsicPktGen
  * Description:
- *      Get per-port multicast storm filter enable/disable
+ *      Set the frames sent by the packet generator of a port
  * Input:
  *      port    - Physical port number (0~7)
- *      pEnabled - 1: enabled, 0: disabled
+ *      pCfg    - addresses, length, count and CRC of the frames
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
  * Note:
- *      None
+ *      Word 0 of DA/SA holds the last two octets, as the other MAC registers.
  */
-int32_t rtl8367::rtl8367c_getAsicStormFilterMulticastEnable(uint32_t port, uint32_t *pEnabled)
+int32_t rtl8367::rtl8367c_setAsicPktGen(uint32_t port, rtk_pktgen_cfg_t *pCfg)
 {
-    if (port >= RTL8367C_PORTNO)
+    int32_t retVal;
+    uint32_t i;
+
+    if (port > RTL8367C_PKTGEN_PORTIDMAX)
         return RT_ERR_PORT_ID;
 
-    return rtl8367c_getAsicRegBit(RTL8367C_STORM_MCAST_REG, port, pEnabled);
+    for (i = 0; i < 3; i++)
+    {
+        if ((retVal = rtl8367c_setAsicReg(RTL8367C_PKTGEN_DA_REG(port) + i, (pCfg->dmac.octet[4 - 2 * i] << 8) | pCfg->dmac.octet[5 - 2 * i])) != RT_ERR_OK)
+            return retVal;
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        if ((retVal = rtl8367c_setAsicReg(RTL8367C_PKTGEN_SA_REG(port) + i, (pCfg->smac.octet[4 - 2 * i] << 8) | pCfg->smac.octet[5 - 2 * i])) != RT_ERR_OK)
+            return retVal;
+    }
+
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_PKTGEN_COUNTER_REG(port), pCfg->count & 0xFFFF)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_PKTGEN_COUNTER_REG(port) + 1, (pCfg->count >> 16) & RTL8367C_PKTGEN_PORT0_COUNTER1_MASK)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_PKTGEN_LENGTH_REG(port), pCfg->length & RTL8367C_PKTGEN_PORT0_TX_LENGTH_MASK)) != RT_ERR_OK)
+        return retVal;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_PKTGEN_CTRL_REG(port), RTL8367C_PKTGEN_PORT0_CTRL_CRC_NO_ERROR_OFFSET, (pCfg->crc == PKTGEN_CRC_GOOD) ? 1 : 0);
 }
+
 /* Function Name:
- *      rtl8367c_getAsicStormFilterBroadcastEnable
+ *      rtl8367c_getAsicPktGen
  * Description:
- *      Get per-port broadcast storm filter enable/disable
+ *      Get the frames sent by the packet generator of a port
  * Input:
  *      port    - Physical port number (0~7)
- *      pEnabled - 1: enabled, 0: disabled
  * Output:
- *      None
+ *      pCfg    - addresses, length, count and CRC of the frames
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicStormFilterBroadcastEnable(uint32_t port, uint32_t *pEnabled)
-{
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    return rtl8367c_getAsicRegBit(RTL8367C_STORM_BCAST_REG, port, pEnabled);
-}
-int32_t rtl8367::rtk_rate_stormControlPortEnable_get(rtk_port_t port, rtk_rate_storm_group_t stormType, rtk_enable_t *pEnable)
+int32_t rtl8367::rtl8367c_getAsicPktGen(uint32_t port, rtk_pktgen_cfg_t *pCfg)
 {
     int32_t retVal;
+    uint32_t i, regData;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
-
-    if (stormType >= STORM_GROUP_END)
-        return RT_ERR_SFC_UNKNOWN_GROUP;
-
-    if (NULL == pEnable)
-        return RT_ERR_ENABLE;
+    if (port > RTL8367C_PKTGEN_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    switch (stormType)
+    for (i = 0; i < 3; i++)
     {
-    case STORM_GROUP_UNKNOWN_UNICAST:
-        if ((retVal = rtl8367c_getAsicStormFilterUnknownUnicastEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_UNKNOWN_MULTICAST:
-        if ((retVal = rtl8367c_getAsicStormFilterUnknownMulticastEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_MULTICAST:
-        if ((retVal = rtl8367c_getAsicStormFilterMulticastEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_getAsicReg(RTL8367C_PKTGEN_DA_REG(port) + i, &regData)) != RT_ERR_OK)
             return retVal;
-        break;
-    case STORM_GROUP_BROADCAST:
-        if ((retVal = rtl8367c_getAsicStormFilterBroadcastEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
+        pCfg->dmac.octet[4 - 2 * i] = (regData >> 8) & 0xFF;
+        pCfg->dmac.octet[5 - 2 * i] = regData & 0xFF;
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        if ((retVal = rtl8367c_getAsicReg(RTL8367C_PKTGEN_SA_REG(port) + i, &regData)) != RT_ERR_OK)
             return retVal;
-        break;
-    default:
-        break;
+        pCfg->smac.octet[4 - 2 * i] = (regData >> 8) & 0xFF;
+        pCfg->smac.octet[5 - 2 * i] = regData & 0xFF;
     }
 
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_PKTGEN_COUNTER_REG(port), &regData)) != RT_ERR_OK)
+        return retVal;
+    pCfg->count = regData;
+
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_PKTGEN_COUNTER_REG(port) + 1, &regData)) != RT_ERR_OK)
+        return retVal;
+    pCfg->count |= (regData & RTL8367C_PKTGEN_PORT0_COUNTER1_MASK) << 16;
+
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_PKTGEN_LENGTH_REG(port), &regData)) != RT_ERR_OK)
+        return retVal;
+    pCfg->length = regData & RTL8367C_PKTGEN_PORT0_TX_LENGTH_MASK;
+
+    if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_PKTGEN_CTRL_REG(port), RTL8367C_PKTGEN_PORT0_CTRL_CRC_NO_ERROR_OFFSET, &regData)) != RT_ERR_OK)
+        return retVal;
+    pCfg->crc = regData ? PKTGEN_CRC_GOOD : PKTGEN_CRC_BAD;
+
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicStormFilterUnknownUnicastMeter
+ *      rtl8367c_setAsicPktGenCommand
  * Description:
- *      Set per-port unknown unicast storm filter meter
+ *      Start or stop the selected packet generators
  * Input:
- *      port    - Physical port number (0~7)
- *      meter   - meter index (0~31)
+ *      cmdMask     - RTL8367C_PKTGEN_START_MASK or RTL8367C_PKTGEN_STOP_MASK
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PORT_ID          - Invalid port number
- *      RT_ERR_FILTER_METER_ID  - Invalid meter index
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
  * Note:
- *      None
+ *      Keeps the flow control bypass bit.
  */
-int32_t rtl8367::rtl8367c_setAsicStormFilterUnknownUnicastMeter(uint32_t port, uint32_t meter)
+int32_t rtl8367::rtl8367c_setAsicPktGenCommand(uint32_t cmdMask)
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    int32_t retVal;
+    uint32_t regData;
 
-    if (meter > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_PKTGEN_COMMAND, &regData)) != RT_ERR_OK)
+        return retVal;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_STORM_UNDA_METER_CTRL_REG(port), RTL8367C_STORM_UNDA_METER_CTRL_MASK(port), meter);
+    return rtl8367c_setAsicReg(RTL8367C_REG_PKTGEN_COMMAND, (regData & RTL8367C_PKTGEN_BYPASS_FLOWCONTROL_MASK) | cmdMask);
 }
+
 /* Function Name:
- *      rtl8367c_setAsicStormFilterUnknownMulticastMeter
+ *      rtk_pktgen_port_set
  * Description:
- *      Set per-port unknown multicast storm filter meter
+ *      Set the frames sent by the packet generator of a port
  * Input:
- *      port    - Physical port number (0~7)
- *      meter   - meter index (0~31)
+ *      port    - port id.
+ *      pCfg    - destination/source MAC, frame length, frame count and CRC
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
+ *      RT_ERR_OK               - OK
  *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PORT_ID          - Invalid port number
- *      RT_ERR_FILTER_METER_ID  - Invalid meter index
+ *      RT_ERR_PORT_ID          - Invalid port number, or a port without generator.
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
  * Note:
- *      None
+ *      The generator sends from the MAC of the port, so the port needs a link
+ *      (or MAC loopback). Ports with physical number above 7 have no generator.
  */
-int32_t rtl8367::rtl8367c_setAsicStormFilterUnknownMulticastMeter(uint32_t port, uint32_t meter)
+int32_t rtl8367::rtk_pktgen_port_set(rtk_port_t port, rtk_pktgen_cfg_t *pCfg)
 {
-    int32_t retVal;
+    RTK_SMI_STATS_SCOPE();
+    uint32_t phyPort;
 
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if (meter > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
+    if (NULL == pCfg)
+        return RT_ERR_NULL_POINTER;
 
-    if (port < 8)
-    {
-        retVal = rtl8367c_setAsicRegBits(RTL8367C_STORM_UNMC_METER_CTRL_REG(port), RTL8367C_STORM_UNMC_METER_CTRL_MASK(port), meter);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-    }
-    else
-    {
-        retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_STORM_UNMC_METER_CTRL4 + ((port - 8) >> 1), RTL8367C_STORM_UNMC_METER_CTRL_MASK(port), meter);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-    }
+    phyPort = rtk_switch_port_L2P_get(port);
+    if (phyPort > RTL8367C_PKTGEN_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    return RT_ERR_OK;
+    if ((pCfg->length < RTK_PKTGEN_LENGTH_MIN) || (pCfg->length > RTK_PKTGEN_LENGTH_MAX))
+        return RT_ERR_INPUT;
+
+    if ((pCfg->count == 0) || (pCfg->count > RTK_PKTGEN_COUNT_MAX))
+        return RT_ERR_INPUT;
+
+    if (pCfg->crc >= PKTGEN_CRC_END)
+        return RT_ERR_INPUT;
+
+    return rtl8367c_setAsicPktGen(phyPort, pCfg);
 }
+
 /* Function Name:
- *      rtl8367c_setAsicStormFilterMulticastMeter
+ *      rtk_pktgen_port_get
  * Description:
- *      Set per-port multicast storm filter meter
+ *      Get the frames sent by the packet generator of a port
  * Input:
- *      port    - Physical port number (0~7)
- *      meter   - meter index (0~31)
+ *      port    - port id.
  * Output:
- *      None
+ *      pCfg    - destination/source MAC, frame length, frame count and CRC
  * Return:
- *      RT_ERR_OK               - Success
+ *      RT_ERR_OK               - OK
  *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PORT_ID          - Invalid port number
- *      RT_ERR_FILTER_METER_ID  - Invalid meter index
+ *      RT_ERR_PORT_ID          - Invalid port number, or a port without generator.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicStormFilterMulticastMeter(uint32_t port, uint32_t meter)
+int32_t rtl8367::rtk_pktgen_port_get(rtk_port_t port, rtk_pktgen_cfg_t *pCfg)
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    RTK_SMI_STATS_SCOPE();
+    uint32_t phyPort;
 
-    if (meter > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
 
-    return rtl8367c_setAsicRegBits(RTL8367C_STORM_MCAST_METER_CTRL_REG(port), RTL8367C_STORM_MCAST_METER_CTRL_MASK(port), meter);
+    if (NULL == pCfg)
+        return RT_ERR_NULL_POINTER;
+
+    phyPort = rtk_switch_port_L2P_get(port);
+    if (phyPort > RTL8367C_PKTGEN_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_getAsicPktGen(phyPort, pCfg);
 }
+
 /* Function Name:
- *      rtl8367c_setAsicStormFilterBroadcastMeter
+ *      rtk_pktgen_start
  * Description:
- *      Set per-port broadcast storm filter meter
+ *      Start the packet generators of ports
  * Input:
- *      port    - Physical port number (0~7)
- *      meter   - meter index (0~31)
+ *      pPortmask   - ports to send from
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
+ *      RT_ERR_OK               - OK
  *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_PORT_ID          - Invalid port number
- *      RT_ERR_FILTER_METER_ID  - Invalid meter index
+ *      RT_ERR_PORT_MASK        - Invalid portmask, or a port without generator.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
  * Note:
- *      None
+ *      Selects exactly the ports of the mask and starts them together; each
+ *      stops by itself after its frame count, see rtk_pktgen_status_get.
  */
-int32_t rtl8367::rtl8367c_setAsicStormFilterBroadcastMeter(uint32_t port, uint32_t meter)
-{
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    if (meter > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
-
-    return rtl8367c_setAsicRegBits(RTL8367C_STORM_BCAST_METER_CTRL_REG(port), RTL8367C_STORM_BCAST_METER_CTRL_MASK(port), meter);
-}
-int32_t rtl8367::rtk_rate_stormControlMeterIdx_set(rtk_port_t port, rtk_rate_storm_group_t stormType, uint32_t index)
+int32_t rtl8367::rtk_pktgen_start(rtk_portmask_t *pPortmask)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t phyMask, port;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
+    if (NULL == pPortmask)
+        return RT_ERR_NULL_POINTER;
 
-    if (stormType >= STORM_GROUP_END)
-        return RT_ERR_SFC_UNKNOWN_GROUP;
+    RTK_CHK_PORTMASK_VALID(pPortmask);
 
-    if (index > halCtrl.max_meter_id)
-        return RT_ERR_FILTER_METER_ID;
+    if ((retVal = rtk_switch_portmask_L2P_get(pPortmask, &phyMask)) != RT_ERR_OK)
+        return retVal;
 
-    switch (stormType)
+    if (phyMask & ~((1 << (RTL8367C_PKTGEN_PORTIDMAX + 1)) - 1))
+        return RT_ERR_PORT_MASK;
+
+    for (port = 0; port <= RTL8367C_PKTGEN_PORTIDMAX; port++)
     {
-    case STORM_GROUP_UNKNOWN_UNICAST:
-        if ((retVal = rtl8367c_setAsicStormFilterUnknownUnicastMeter(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_UNKNOWN_MULTICAST:
-        if ((retVal = rtl8367c_setAsicStormFilterUnknownMulticastMeter(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_MULTICAST:
-        if ((retVal = rtl8367c_setAsicStormFilterMulticastMeter(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_BROADCAST:
-        if ((retVal = rtl8367c_setAsicStormFilterBroadcastMeter(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_PKTGEN_CTRL_REG(port), RTL8367C_PKTGEN_PORT0_CTRL_CMD_START_OFFSET, (phyMask >> port) & 1)) != RT_ERR_OK)
             return retVal;
-        break;
-    default:
-        break;
     }
 
-    return RT_ERR_OK;
+    return rtl8367c_setAsicPktGenCommand(RTL8367C_PKTGEN_START_MASK);
 }
 
 /* Function Name:
- *      rtl8367c_getAsicStormFilterUnknownUnicastMeter
+ *      rtk_pktgen_stop
  * Description:
- *      Get per-port unknown unicast storm filter meter
+ *      Stop all packet generators
  * Input:
- *      port    - Physical port number (0~7)
- *      pMeter  - meter index (0~31)
+ *      None
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
  * Note:
- *      None
+ *      The generators share one start/stop command, so this stops every
+ *      port started by rtk_pktgen_start.
  */
-int32_t rtl8367::rtl8367c_getAsicStormFilterUnknownUnicastMeter(uint32_t port, uint32_t *pMeter)
+int32_t rtl8367::rtk_pktgen_stop()
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    RTK_SMI_STATS_SCOPE();
 
-    return rtl8367c_getAsicRegBits(RTL8367C_STORM_UNDA_METER_CTRL_REG(port), RTL8367C_STORM_UNDA_METER_CTRL_MASK(port), pMeter);
+    return rtl8367c_setAsicPktGenCommand(RTL8367C_PKTGEN_STOP_MASK);
 }
+
 /* Function Name:
- *      rtl8367c_getAsicStormFilterUnknownMulticastMeter
+ *      rtk_pktgen_status_get
  * Description:
- *      Get per-port unknown multicast storm filter meter
+ *      Get the ports whose packet generator is still sending
  * Input:
- *      port    - Physical port number (0~7)
- *      pMeter  - meter index (0~31)
- * Output:
  *      None
+ * Output:
+ *      pPortmask   - ports still sending
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
  * Note:
- *      None
+ *      One SMI read for all ports.
  */
-int32_t rtl8367::rtl8367c_getAsicStormFilterUnknownMulticastMeter(uint32_t port, uint32_t *pMeter)
+int32_t rtl8367::rtk_pktgen_status_get(rtk_portmask_t *pPortmask)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t regData;
 
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    if (NULL == pPortmask)
+        return RT_ERR_NULL_POINTER;
 
-    if (port < 8)
-    {
-        retVal = rtl8367c_getAsicRegBits(RTL8367C_STORM_UNMC_METER_CTRL_REG(port), RTL8367C_STORM_UNMC_METER_CTRL_MASK(port), pMeter);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-    }
-    else
-    {
-        retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_STORM_UNMC_METER_CTRL4 + ((port - 8) >> 1), RTL8367C_STORM_UNMC_METER_CTRL_MASK(port), pMeter);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-    }
+    if ((retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_HWPKT_GEN_MISC, RTL8367C_PKT_GEN_STATUS_MASK, &regData)) != RT_ERR_OK)
+        return retVal;
 
-    return RT_ERR_OK;
+    return rtk_switch_portmask_P2L_get(regData, pPortmask);
 }
+
 /* Function Name:
- *      rtl8367c_getAsicStormFilterMulticastMeter
+ *      rtk_pktgen_flowCtrlBypass_set
  * Description:
- *      Get per-port multicast storm filter meter
+ *      Set whether the packet generators ignore PAUSE frames
  * Input:
- *      port    - Physical port number (0~7)
- *      pMeter  - meter index (0~31)
+ *      enable  - ENABLED to keep sending while the link partner sends PAUSE
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_ENABLE           - Invalid enable input.
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicStormFilterMulticastMeter(uint32_t port, uint32_t *pMeter)
+int32_t rtl8367::rtk_pktgen_flowCtrlBypass_set(rtk_enable_t enable)
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    RTK_SMI_STATS_SCOPE();
 
-    return rtl8367c_getAsicRegBits(RTL8367C_STORM_MCAST_METER_CTRL_REG(port), RTL8367C_STORM_MCAST_METER_CTRL_MASK(port), pMeter);
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
+
+    return rtl8367c_setAsicReg(RTL8367C_REG_PKTGEN_COMMAND, (enable == ENABLED) ? RTL8367C_PKTGEN_BYPASS_FLOWCONTROL_MASK : 0);
 }
+
 /* Function Name:
- *      rtl8367c_getAsicStormFilterBroadcastMeter
+ *      rtk_pktgen_flowCtrlBypass_get
  * Description:
- *      Get per-port broadcast storm filter meter
+ *      Get whether the packet generators ignore PAUSE frames
  * Input:
- *      port    - Physical port number (0~7)
- *      pMeter  - meter index (0~31)
- * Output:
  *      None
+ * Output:
+ *      pEnable - ENABLED when PAUSE frames are ignored
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicStormFilterBroadcastMeter(uint32_t port, uint32_t *pMeter)
-{
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    return rtl8367c_getAsicRegBits(RTL8367C_STORM_BCAST_METER_CTRL_REG(port), RTL8367C_STORM_BCAST_METER_CTRL_MASK(port), pMeter);
-}
-int32_t rtl8367::rtk_rate_stormControlMeterIdx_get(rtk_port_t port, rtk_rate_storm_group_t stormType, uint32_t *pIndex)
+int32_t rtl8367::rtk_pktgen_flowCtrlBypass_get(rtk_enable_t *pEnable)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
-
-    if (stormType >= STORM_GROUP_END)
-        return RT_ERR_SFC_UNKNOWN_GROUP;
+    uint32_t regData;
 
-    if (NULL == pIndex)
+    if (NULL == pEnable)
         return RT_ERR_NULL_POINTER;
 
-    switch (stormType)
-    {
-    case STORM_GROUP_UNKNOWN_UNICAST:
-        if ((retVal = rtl8367c_getAsicStormFilterUnknownUnicastMeter(rtk_switch_port_L2P_get(port), pIndex)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_UNKNOWN_MULTICAST:
-        if ((retVal = rtl8367c_getAsicStormFilterUnknownMulticastMeter(rtk_switch_port_L2P_get(port), pIndex)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_MULTICAST:
-        if ((retVal = rtl8367c_getAsicStormFilterMulticastMeter(rtk_switch_port_L2P_get(port), pIndex)) != RT_ERR_OK)
-            return retVal;
-        break;
-    case STORM_GROUP_BROADCAST:
-        if ((retVal = rtl8367c_getAsicStormFilterBroadcastMeter(rtk_switch_port_L2P_get(port), pIndex)) != RT_ERR_OK)
-            return retVal;
-        break;
-    default:
-        break;
-    }
+    if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_PKTGEN_COMMAND, RTL8367C_PKTGEN_BYPASS_FLOWCONTROL_OFFSET, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    *pEnable = regData ? ENABLED : (rtk_enable_t)DISABLED;
 
     return RT_ERR_OK;
 }
 
-// --------------------------- PORT MIRROR ------------------------------------
+/* counters compared by rtk_pktgen_test */
+static const RTL8367C_MIBCOUNTER pktgenMib[] = {
+    ifOutUcastPkts, ifOutMulticastPkts, ifOutBroadcastPkts, ifOutDiscards,
+    ifInUcastPkts, ifInMulticastPkts, ifInBroadcastPkts, dot3StatsFCSErrors, dot3StatsSymbolErrors};
+#define PKTGEN_MIB_NUM (sizeof(pktgenMib) / sizeof(pktgenMib[0]))
 
-/* Function Name:
- *      rtk_switch_maxLogicalPort_get
- * Description:
- *      Get Max logical port ID
- * Input:
- *      None
- * Output:
- *      None
- * Return:
- *      Max logical port
- * Note:
- *      This API can get max logical port
- */
-rtk_port_t rtl8367::rtk_switch_maxLogicalPort_get()
+int32_t rtl8367::_rtk_pktgen_mib_get(uint32_t phyPort, uint64_t *pCntr)
 {
-    rtk_port_t port, maxLogicalPort = UTP_PORT0;
+    int32_t retVal;
+    uint32_t i;
 
-    for (uint8_t port1 = 0; port1 < RTK_SWITCH_PORT_NUM; port1++)
+    for (i = 0; i < PKTGEN_MIB_NUM; i++)
     {
-        if ((halCtrl.log_port_type[port] == UTP_PORT) || (halCtrl.log_port_type[port] == EXT_PORT))
-            maxLogicalPort = port;
+        if ((retVal = rtl8367c_getAsicMIBsCounter(phyPort, pktgenMib[i], &pCntr[i])) != RT_ERR_OK)
+            return retVal;
     }
 
-    return maxLogicalPort;
+    return RT_ERR_OK;
 }
+
 /* Function Name:
- *      rtl8367c_setAsicPortMirror
+ *      rtk_pktgen_test
  * Description:
- *      Set port mirror function
+ *      Run the packet generator of a port and measure what went out and came back
  * Input:
- *      source  - Source port
- *      monitor - Monitor (destination) port
+ *      port        - port id.
+ *      pCfg        - frames to send, see rtk_pktgen_port_set
+ *      msTimeout   - longest run, the generator is stopped after it
  * Output:
- *      None
+ *      pResult     - counter increase over the run and the rates they give
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number, or a port without generator.
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
  * Note:
- *      None
+ *      Line rate and cabling self test without external traffic generator:
+ *      the port MIB counters are read before the start and after the
+ *      generator finished (done = 1) or msTimeout passed (done = 0), polling
+ *      the status every millisecond. txPkts short of the frame count, tx
+ *      discards or, with a loopback plug, rxPkts short of txPkts and rx
+ *      errors point at the link. Other traffic on the port is counted too.
  */
-int32_t rtl8367::rtl8367c_setAsicPortMirror(uint32_t source, uint32_t monitor)
+int32_t rtl8367::rtk_pktgen_test(rtk_port_t port, rtk_pktgen_cfg_t *pCfg, uint32_t msTimeout, rtk_pktgen_result_t *pResult)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t phyPort, regData, i;
+    uint64_t before[PKTGEN_MIB_NUM], after[PKTGEN_MIB_NUM];
+    unsigned long start;
+    rtk_portmask_t portmask;
 
-    if ((source > RTL8367C_PORTIDMAX) || (monitor > RTL8367C_PORTIDMAX))
-        return RT_ERR_PORT_ID;
+    if (NULL == pResult)
+        return RT_ERR_NULL_POINTER;
 
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_MIRROR_CTRL_REG, RTL8367C_MIRROR_SOURCE_PORT_MASK, source);
-    if (retVal != RT_ERR_OK)
+    if ((retVal = rtk_pktgen_port_set(port, pCfg)) != RT_ERR_OK)
         return retVal;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_MIRROR_CTRL_REG, RTL8367C_MIRROR_MONITOR_PORT_MASK, monitor);
+    phyPort = rtk_switch_port_L2P_get(port);
+    if ((retVal = _rtk_pktgen_mib_get(phyPort, before)) != RT_ERR_OK)
+        return retVal;
+
+    RTK_PORTMASK_CLEAR(portmask);
+    RTK_PORTMASK_PORT_SET(portmask, port);
+    if ((retVal = rtk_pktgen_start(&portmask)) != RT_ERR_OK)
+        return retVal;
+
+    start = millis();
+    pResult->done = 0;
+    while (1)
+    {
+        if ((retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_HWPKT_GEN_MISC, RTL8367C_PKT_GEN_STATUS_MASK, &regData)) != RT_ERR_OK)
+            return retVal;
+
+        pResult->ms = millis() - start;
+        if ((regData & (1 << phyPort)) == 0)
+        {
+            pResult->done = 1;
+            break;
+        }
+
+        if (pResult->ms >= msTimeout)
+        {
+            if ((retVal = rtl8367c_setAsicPktGenCommand(RTL8367C_PKTGEN_STOP_MASK)) != RT_ERR_OK)
+                return retVal;
+            break;
+        }
+
+        delay(1);
+    }
+
+    if ((retVal = _rtk_pktgen_mib_get(phyPort, after)) != RT_ERR_OK)
+        return retVal;
+
+    for (i = 0; i < PKTGEN_MIB_NUM; i++)
+        after[i] -= before[i];
+
+    pResult->txPkts = after[0] + after[1] + after[2];
+    pResult->txDiscards = after[3];
+    pResult->rxPkts = after[4] + after[5] + after[6];
+    pResult->rxErrors = after[7] + after[8];
+    pResult->txPktsPerSec = pResult->ms ? (uint32_t)((uint64_t)pResult->txPkts * 1000 / pResult->ms) : 0;
+    pResult->rxPktsPerSec = pResult->ms ? (uint32_t)((uint64_t)pResult->rxPkts * 1000 / pResult->ms) : 0;
+
+    return RT_ERR_OK;
 }
+
+// ---------------------- PHY -------------------------
+
 /* Function Name:
- *      rtl8367c_setAsicPortMirrorMask
+ *      rtl8370_setAsicPortEnableAll
  * Description:
- *      Set mirror source port mask
- * Input:
- *      SourcePortmask  - Source Portmask
+ *      Set ALL ports enable.
+ * Input:s
+ *      enable - enable all ports.
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_MASK- Port Mask Error
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicPortMirrorMask(uint32_t SourcePortmask)
+int32_t rtl8367::rtl8367c_setAsicPortEnableAll(uint32_t enable)
 {
-    if (SourcePortmask > RTL8367C_PORTMASK)
-        return RT_ERR_PORT_MASK;
+    if (enable >= 2)
+        return RT_ERR_INPUT;
 
-    return rtl8367c_setAsicRegBits(RTL8367C_REG_MIRROR_SRC_PMSK, RTL8367C_MIRROR_SRC_PMSK_MASK, SourcePortmask);
+    return rtl8367c_setAsicRegBit(RTL8367C_REG_PHY_AD, RTL8367C_PDNPHY_OFFSET, !enable);
 }
-/* Function Name:
- *      rtl8367c_setAsicPortMirrorRxFunction
- * Description:
- *      Set the mirror function on RX of the mirrored
- * Input:
- *      enabled     - 1: enabled, 0: disabled
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicPortMirrorRxFunction(uint32_t enabled)
+
+int32_t rtl8367::_rtk_port_phyReg_get(rtk_port_t port, rtk_port_phy_reg_t reg, uint32_t *pData)
 {
-    return rtl8367c_setAsicRegBit(RTL8367C_MIRROR_CTRL_REG, RTL8367C_MIRROR_RX_OFFSET, enabled);
+    int32_t retVal;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_UTP(port);
+
+    if ((retVal = rtl8367c_getAsicPHYReg(rtk_switch_port_L2P_get(port), reg, pData)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
 }
+
 /* Function Name:
- *      rtl8367c_setAsicPortMirrorTxFunction
+ *      rtl8367c_setAsicPHYOCPReg
  * Description:
- *      Set the mirror function on TX of the mirrored
+ *      Set PHY OCP registers
  * Input:
- *      enabled     - 1: enabled, 0: disabled
+ *      phyNo   - Physical port number (0~7)
+ *      ocpAddr - OCP address
+ *      ocpData - Writing data
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PHY_REG_ID       - invalid PHY address
+ *      RT_ERR_PHY_ID           - invalid PHY no
+ *      RT_ERR_BUSYWAIT_TIMEOUT - PHY access busy
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicPortMirrorTxFunction(uint32_t enabled)
-{
-    return rtl8367c_setAsicRegBit(RTL8367C_MIRROR_CTRL_REG, RTL8367C_MIRROR_TX_OFFSET, enabled);
-}
-int32_t rtl8367::rtk_mirror_portBased_set(rtk_port_t mirroring_port, rtk_portmask_t *pMirrored_rx_portmask, rtk_portmask_t *pMirrored_tx_portmask)
+int32_t rtl8367::rtl8367c_setAsicPHYOCPReg(uint32_t phyNo, uint32_t ocpAddr, uint32_t ocpData)
 {
     int32_t retVal;
-    rtk_enable_t mirRx, mirTx;
-    uint32_t i, pmask;
-    uint32_t source_port;
+    uint32_t busyFlag;
 
-    /* Check port valid */
-    RTK_CHK_PORT_VALID(mirroring_port);
+    /*Check internal phy access busy or not*/
+    /*retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_INDRECT_ACCESS_STATUS, RTL8367C_INDRECT_ACCESS_STATUS_OFFSET,&busyFlag);*/
+    retVal = rtl8367c_getAsicReg(RTL8367C_REG_INDRECT_ACCESS_STATUS, &busyFlag);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-    if (NULL == pMirrored_rx_portmask)
-        return RT_ERR_NULL_POINTER;
+    if (busyFlag)
+        return RT_ERR_BUSYWAIT_TIMEOUT;
 
-    if (NULL == pMirrored_tx_portmask)
-        return RT_ERR_NULL_POINTER;
+    return _rtl8367c_setAsicPHYOCPReg(phyNo, ocpAddr, ocpData);
+}
 
-    RTK_CHK_PORTMASK_VALID(pMirrored_rx_portmask);
+/* rtl8367c_setAsicPHYOCPReg once the indirect access is known to be idle */
+int32_t rtl8367::_rtl8367c_setAsicPHYOCPReg(uint32_t phyNo, uint32_t ocpAddr, uint32_t ocpData)
+{
+    int32_t retVal;
+    uint32_t regData;
+    uint32_t busyFlag, checkCounter;
+    uint32_t ocpAddr9_6, ocpAddr5_1;
 
-    RTK_CHK_PORTMASK_VALID(pMirrored_tx_portmask);
+    /* OCP prefix */
+    if ((retVal = _rtl8367c_setAsicPHYOCPPrefix(ocpAddr)) != RT_ERR_OK)
+        return retVal;
 
-    /*Mirror Sorce Port Mask Check*/
-    if (pMirrored_tx_portmask->bits[0] != pMirrored_rx_portmask->bits[0] && pMirrored_tx_portmask->bits[0] != 0 && pMirrored_rx_portmask->bits[0] != 0)
-        return RT_ERR_PORT_MASK;
+    /*prepare access data*/
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_INDRECT_ACCESS_WRITE_DATA, ocpData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-    /*mirror port != source port*/
-    if (RTK_PORTMASK_IS_PORT_SET((*pMirrored_tx_portmask), mirroring_port) || RTK_PORTMASK_IS_PORT_SET((*pMirrored_rx_portmask), mirroring_port))
-        return RT_ERR_PORT_MASK;
+    /*prepare access address*/
+    ocpAddr9_6 = ((ocpAddr >> 6) & 0x000F);
+    ocpAddr5_1 = ((ocpAddr >> 1) & 0x001F);
+    regData = RTL8367C_PHY_BASE | (ocpAddr9_6 << 8) | (phyNo << RTL8367C_PHY_OFFSET) | ocpAddr5_1;
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_INDRECT_ACCESS_ADDRESS, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-    source_port = rtk_switch_maxLogicalPort_get();
+    /*Set WRITE Command*/
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_INDRECT_ACCESS_CTRL, RTL8367C_CMD_MASK | RTL8367C_RW_MASK);
 
-    RTK_SCAN_ALL_LOG_PORT(i)
+    checkCounter = 100;
+    while (checkCounter)
     {
-        if (pMirrored_tx_portmask->bits[0] & (1 << i))
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_INDRECT_ACCESS_STATUS, &busyFlag);
+        if ((retVal != RT_ERR_OK) || busyFlag)
         {
-            source_port = i;
-            break;
+            checkCounter--;
+            if (0 == checkCounter)
+                return RT_ERR_BUSYWAIT_TIMEOUT;
         }
-
-        if (pMirrored_rx_portmask->bits[0] & (1 << i))
+        else
         {
-            source_port = i;
-            break;
+            checkCounter = 0;
         }
     }
 
-    if ((retVal = rtl8367c_setAsicPortMirror(rtk_switch_port_L2P_get(source_port), rtk_switch_port_L2P_get(mirroring_port))) != RT_ERR_OK)
-        return retVal;
-    if (pMirrored_rx_portmask->bits[0] != 0)
-    {
-        if ((retVal = rtk_switch_portmask_L2P_get(pMirrored_rx_portmask, &pmask)) != RT_ERR_OK)
-            return retVal;
-        if ((retVal = rtl8367c_setAsicPortMirrorMask(pmask)) != RT_ERR_OK)
-            return retVal;
-    }
-    else
-    {
-        if ((retVal = rtk_switch_portmask_L2P_get(pMirrored_tx_portmask, &pmask)) != RT_ERR_OK)
-            return retVal;
-        if ((retVal = rtl8367c_setAsicPortMirrorMask(pmask)) != RT_ERR_OK)
-            return retVal;
-    }
-
-    if (pMirrored_rx_portmask->bits[0])
-        mirRx = ENABLED;
-    else
-        mirRx = DISABLED_RTK;
-
-    if ((retVal = rtl8367c_setAsicPortMirrorRxFunction(mirRx)) != RT_ERR_OK)
-        return retVal;
-
-    if (pMirrored_tx_portmask->bits[0])
-        mirTx = ENABLED;
-    else
-        mirTx = DISABLED_RTK;
-
-    if ((retVal = rtl8367c_setAsicPortMirrorTxFunction(mirTx)) != RT_ERR_OK)
-        return retVal;
-
-    return RT_ERR_OK;
-}
-
-// ---------------------------- FORCE EXTERNAL INTERFACE ----------------------------
-
-int32_t rtl8367::rtk_switch_isExtPort(rtk_port_t logicalPort)
-{
-
-    if (logicalPort >= RTK_SWITCH_PORT_NUM)
-        return RT_ERR_FAILED;
-
-    if (halCtrl.log_port_type[logicalPort] == EXT_PORT)
-        return RT_ERR_OK;
-    else
-        return RT_ERR_FAILED;
+    return retVal;
 }
-
 /* Function Name:
- *      rtk_switch_isHsgPort
+ *      rtl8367c_setAsicPHYReg
  * Description:
- *      Check is logical port a HSG port
+ *      Set PHY registers
  * Input:
- *      logicalPort     - logical port ID
+ *      phyNo   - Physical port number (0~7)
+ *      phyAddr - PHY address (0~31)
+ *      phyData - Writing data
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Port ID is a HSG port
- *      RT_ERR_FAILED   - Port ID is not a HSG port
- *      RT_ERR_NOT_INIT - Not Initialize
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PHY_REG_ID       - invalid PHY address
+ *      RT_ERR_PHY_ID           - invalid PHY no
+ *      RT_ERR_BUSYWAIT_TIMEOUT - PHY access busy
  * Note:
- *
+ *      None
  */
-int32_t rtl8367::rtk_switch_isHsgPort(rtk_port_t logicalPort)
+int32_t rtl8367::rtl8367c_setAsicPHYReg(uint32_t phyNo, uint32_t phyAddr, uint32_t phyData)
 {
+    uint32_t ocp_addr;
 
-    if (logicalPort >= RTK_SWITCH_PORT_NUM)
-        return RT_ERR_FAILED;
+    if (phyAddr > RTL8367C_PHY_REGNOMAX)
+        return RT_ERR_PHY_REG_ID;
 
-    if (logicalPort == halCtrl.hsg_logical_port)
-        return RT_ERR_OK;
-    else
-        return RT_ERR_FAILED;
+    ocp_addr = 0xa400 + phyAddr * 2;
+
+    return rtl8367c_setAsicPHYOCPReg(phyNo, ocp_addr, phyData);
 }
 
 /* Function Name:
- *      rtl8367c_getAiscSdsReg
+ *      rtl8367c_setAsicPHYRegs
  * Description:
- *      Get Serdes registers
+ *      Set several PHY registers of one PHY
  * Input:
- *      sdsId   - sdsid (0~1)
- *      sdsReg - reg address (0~31)
- *      sdsPage - Writing data
+ *      phyNo       - Physical port number (0~7)
+ *      pPhyAddr    - PHY addresses (0~31)
+ *      pRegData    - Writing data, in pPhyAddr order
+ *      num         - number of registers
  * Output:
  *      None
  * Return:
  *      RT_ERR_OK               - Success
-
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PHY_REG_ID       - invalid PHY address
+ *      RT_ERR_BUSYWAIT_TIMEOUT - PHY access busy
  * Note:
- *      None
+ *      The registers are written in pPhyAddr order.
  */
-int32_t rtl8367::rtl8367c_getAsicSdsReg(uint32_t sdsId, uint32_t sdsReg, uint32_t sdsPage, uint32_t *value)
+int32_t rtl8367::rtl8367c_setAsicPHYRegs(uint32_t phyNo, const uint32_t *pPhyAddr, const uint32_t *pRegData, uint32_t num)
 {
-    uint32_t retVal, busy;
+    int32_t retVal;
+    uint32_t busyFlag, i;
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (sdsPage << 5) | sdsReg)) != RT_ERR_OK)
-        return retVal;
+    for (i = 0; i < num; i++)
+    {
+        if (pPhyAddr[i] > RTL8367C_PHY_REGNOMAX)
+            return RT_ERR_PHY_REG_ID;
+    }
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x0080 | sdsId)) != RT_ERR_OK)
+    retVal = rtl8367c_getAsicReg(RTL8367C_REG_INDRECT_ACCESS_STATUS, &busyFlag);
+    if (retVal != RT_ERR_OK)
         return retVal;
 
-    while (1)
+    if (busyFlag)
+        return RT_ERR_BUSYWAIT_TIMEOUT;
+
+    for (i = 0; i < num; i++)
     {
-        if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_SDS_INDACS_CMD, &busy)) != RT_ERR_OK)
+        if ((retVal = _rtl8367c_setAsicPHYOCPReg(phyNo, 0xa400 + pPhyAddr[i] * 2, pRegData[i])) != RT_ERR_OK)
             return retVal;
-
-        if ((busy & 0x100) == 0)
-            break;
     }
 
-    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_SDS_INDACS_DATA, value)) != RT_ERR_OK)
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::_rtk_port_phyReg_set(rtk_port_t port, rtk_port_phy_reg_t reg, uint32_t regData)
+{
+    int32_t retVal;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_UTP(port);
+
+    if ((retVal = rtl8367c_setAsicPHYReg(rtk_switch_port_L2P_get(port), reg, regData)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicSdsReg
+ *      rtk_port_phyRegs_get
  * Description:
- *      Set Serdes registers
+ *      Get several PHY registers of a port
  * Input:
- *      sdsId   - sdsid (0~1)
- *      sdsReg - reg address (0~31)
- *      sdsPage - Writing data
+ *      port    - port id.
+ *      pRegs   - PHY register numbers (0~31), e.g. PHY_REG_CONTROL
+ *      num     - number of registers
  * Output:
- *      None
+ *      pData   - register values, in pRegs order
  * Return:
- *      RT_ERR_OK               - Success
-
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_PHY_REG_ID       - Invalid PHY register number
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ *      RT_ERR_BUSYWAIT_TIMEOUT - PHY access busy
  * Note:
- *      None
+ *      Costs one busy check and one OCP page setup for the whole
+ *      sequence instead of one per register.
  */
-
-int32_t rtl8367::rtl8367c_setAsicSdsReg(uint32_t sdsId, uint32_t sdsReg, uint32_t sdsPage, uint32_t value)
+int32_t rtl8367::rtk_port_phyRegs_get(rtk_port_t port, const uint32_t *pRegs, uint32_t num, uint32_t *pData)
 {
-    uint32_t retVal;
+    RTK_SMI_STATS_SCOPE();
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, value)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (sdsPage << 5) | sdsReg)) != RT_ERR_OK)
-        return retVal;
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_UTP(port);
 
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0 | sdsId)) != RT_ERR_OK)
-        return retVal;
+    if ((NULL == pRegs) || (NULL == pData))
+        return RT_ERR_NULL_POINTER;
 
-    return RT_ERR_OK;
+    return rtl8367c_getAsicPHYRegs(rtk_switch_port_L2P_get(port), pRegs, num, pData);
 }
+
 /* Function Name:
- *      rtl8367c_setAsicPortForceLinkExt
+ *      rtk_port_phyRegs_set
  * Description:
- *      Set external interface force linking configuration
+ *      Set several PHY registers of a port
  * Input:
- *      id          - external interface id (0~2)
- *      portAbility - port ability configuration
+ *      port    - port id.
+ *      pRegs   - PHY register numbers (0~31), e.g. PHY_REG_CONTROL
+ *      pData   - register values, in pRegs order
+ *      num     - number of registers
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_PHY_REG_ID       - Invalid PHY register number
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ *      RT_ERR_BUSYWAIT_TIMEOUT - PHY access busy
  * Note:
- *      None
+ *      The registers are written in pRegs order, put PHY_REG_CONTROL last
+ *      when it restarts auto negotiation.
  */
-int32_t rtl8367::rtl8367c_setAsicPortForceLinkExt(uint32_t id, rtl8367c_port_ability_t *pPortAbility)
+int32_t rtl8367::rtk_port_phyRegs_set(rtk_port_t port, const uint32_t *pRegs, const uint32_t *pData, uint32_t num)
 {
-    uint32_t retVal, regValue, regValue2, type, sgmiibit, hisgmiibit;
-    uint32_t reg_data = 0;
-    uint32_t i = 0;
+    RTK_SMI_STATS_SCOPE();
 
-    /* Invalid input parameter */
-    if (id >= RTL8367C_EXTNO)
-        return RT_ERR_OUT_OF_RANGE;
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_UTP(port);
 
-    reg_data |= pPortAbility->forcemode << 12;
-    reg_data |= pPortAbility->mstfault << 9;
-    reg_data |= pPortAbility->mstmode << 8;
-    reg_data |= pPortAbility->nway << 7;
-    reg_data |= pPortAbility->txpause << 6;
-    reg_data |= pPortAbility->rxpause << 5;
-    reg_data |= pPortAbility->link << 4;
-    reg_data |= pPortAbility->duplex << 2;
-    reg_data |= pPortAbility->speed;
+    if ((NULL == pRegs) || (NULL == pData))
+        return RT_ERR_NULL_POINTER;
 
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
-        return retVal;
-    /*get chip ID */
-    if ((retVal = rtl8367c_getAsicReg(0x1300, &regValue)) != RT_ERR_OK)
-        return retVal;
+    return rtl8367c_setAsicPHYRegs(rtk_switch_port_L2P_get(port), pRegs, pData, num);
+}
 
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
-        return retVal;
+int32_t rtl8367::rtk_port_phyEnableAll_set(rtk_enable_t enable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t data;
+    uint32_t port;
 
-    type = 0;
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
 
-    switch (regValue)
-    {
-    case 0x0276:
-    case 0x0597:
-    case 0x6367:
-        type = 1;
-        break;
-    case 0x0652:
-    case 0x6368:
-        type = 2;
-        break;
-    case 0x0801:
-    case 0x6511:
-        type = 3;
-        break;
-    default:
-        return RT_ERR_FAILED;
-    }
+    if ((retVal = rtl8367c_setAsicPortEnableAll(enable)) != RT_ERR_OK)
+        return retVal;
 
-    if (1 == type)
+    RTK_SCAN_ALL_LOG_PORT(port)
     {
-        if (1 == id)
+        if (rtk_switch_isUtpPort(port) == RT_ERR_OK)
         {
-            if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_REG_TO_ECO4, &regValue)) != RT_ERR_OK)
+            if ((retVal = _rtk_port_phyReg_get((rtk_port_t)port, (rtk_port_phy_reg_t)PHY_CONTROL_REG, &data)) != RT_ERR_OK)
                 return retVal;
 
-            if ((regValue & (0x0001 << 5)) && (regValue & (0x0001 << 7)))
+            if (ENABLED == enable)
             {
-                return RT_ERR_OK;
+                data &= 0xF7FF;
+                data |= 0x0200;
+            }
+            else
+            {
+                data |= 0x0800;
             }
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
+            if ((retVal = _rtk_port_phyReg_set((rtk_port_t)port, (rtk_port_phy_reg_t)PHY_CONTROL_REG, data)) != RT_ERR_OK)
                 return retVal;
+        }
+    }
 
-            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
-                return retVal;
+    return RT_ERR_OK;
+}
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
-                return retVal;
+/* Function Name:
+ *      rtk_switch_isComboPort
+ * Description:
+ *      Check is logical port a Combo port
+ * Input:
+ *      logicalPort     - logical port ID
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Port ID is a combo port
+ *      RT_ERR_FAILED   - Port ID is not a combo port
+ *      RT_ERR_NOT_INIT - Not Initialize
+ * Note:
+ *
+ */
+int32_t rtl8367::rtk_switch_isComboPort(rtk_port_t logicalPort)
+{
+    if (logicalPort >= RTK_SWITCH_PORT_NUM)
+        return RT_ERR_FAILED;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
-                return retVal;
+    if (halCtrl.combo_logical_port == logicalPort)
+        return RT_ERR_OK;
+    else
+        return RT_ERR_FAILED;
+}
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
-                return retVal;
-        }
+int32_t rtl8367::_rtk_port_phyComboPortMedia_get(rtk_port_t port, rtk_port_media_t *pMedia)
+{
+    int32_t retVal;
+    uint32_t regData;
+    uint32_t data;
 
-        if (0 == id || 1 == id)
-            return rtl8367c_setAsicReg(RTL8367C_REG_DIGITAL_INTERFACE0_FORCE + id, reg_data);
-        else
-            return rtl8367c_setAsicReg(RTL8367C_REG_DIGITAL_INTERFACE2_FORCE, reg_data);
-    }
-    else if (2 == type)
-    {
-        if (1 == id)
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 2, pPortAbility->duplex)) != RT_ERR_OK)
-                return retVal;
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_UTP(port);
 
-            if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, pPortAbility->speed)) != RT_ERR_OK)
-                return retVal;
+    /* Check Combo Port ID */
+    RTK_CHK_PORT_IS_COMBO(port);
 
-            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, pPortAbility->link)) != RT_ERR_OK)
-                return retVal;
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 6, pPortAbility->txpause)) != RT_ERR_OK)
-                return retVal;
+    if ((retVal = rtl8367c_getAsicReg(0x1300, &regData)) != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 5, pPortAbility->rxpause)) != RT_ERR_OK)
-                return retVal;
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 12, pPortAbility->forcemode)) != RT_ERR_OK)
-                return retVal;
+    if (regData != 0x6367)
+    {
+        *pMedia = PORT_MEDIA_COPPER;
+    }
+    else
+    {
+        if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_UTP_FIB_DET, RTL8367C_UTP_FIRST_OFFSET, &data)) != RT_ERR_OK)
+            return retVal;
 
-            if (pPortAbility->link == 1)
-            {
-                if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 0)) != RT_ERR_OK)
-                    return retVal;
+        if (data == 1)
+            *pMedia = PORT_MEDIA_COPPER;
+        else
+            *pMedia = PORT_MEDIA_FIBER;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 1)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else
-            {
-                if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, 2)) != RT_ERR_OK)
-                    return retVal;
-            }
+    return RT_ERR_OK;
+}
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
-                return retVal;
+int32_t rtl8367::_rtk_port_FiberModeAbility_set(rtk_port_t port, rtk_port_phy_ability_t *pAbility)
+{
+    int32_t retVal;
+    uint32_t regData;
 
-            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
-                return retVal;
+    /* Check Combo port or not */
+    RTK_CHK_PORT_IS_COMBO(port);
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
-                return retVal;
+    /* Flow Control */
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FIB0_CFG04, &regData)) != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
-                return retVal;
-
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
-                return retVal;
-        }
-        else if (2 == id)
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 2, pPortAbility->duplex)) != RT_ERR_OK)
-                return retVal;
-
-            if ((retVal = rtl8367c_setAsicRegBits(0x13c4, 0x3, pPortAbility->speed)) != RT_ERR_OK)
-                return retVal;
-
-            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, pPortAbility->link)) != RT_ERR_OK)
-                return retVal;
-
-            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 6, pPortAbility->txpause)) != RT_ERR_OK)
-                return retVal;
-
-            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 5, pPortAbility->rxpause)) != RT_ERR_OK)
-                return retVal;
+    if (pAbility->AsyFC == 1)
+        regData |= (0x0001 << 8);
+    else
+        regData &= ~(0x0001 << 8);
 
-            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 12, pPortAbility->forcemode)) != RT_ERR_OK)
-                return retVal;
+    if (pAbility->FC == 1)
+        regData |= (0x0001 << 7);
+    else
+        regData &= ~(0x0001 << 7);
 
-            if (pPortAbility->link == 1)
-            {
-                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, 0)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG04, regData)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, 1)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else
-            {
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c4, 0x3, 2)) != RT_ERR_OK)
-                    return retVal;
-            }
+    /* Speed ability */
+    if ((pAbility->Full_1000 == 1) && (pAbility->Full_100 == 1) && (pAbility->AutoNegotiation == 1))
+    {
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_MODE_OFFSET, 0)) != RT_ERR_OK)
+            return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(0x1dc1, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
-                return retVal;
+        if ((retVal = rtl8367c_setAsicField<RTL8367C_FIELD(FIBER_CFG_1, SDS_MODE), 7>()) != RT_ERR_OK)
+            return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBits(0x1dc1, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
-                return retVal;
+        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG00, 0x1140)) != RT_ERR_OK)
+            return retVal;
+    }
+    else if (pAbility->Full_1000 == 1)
+    {
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_MODE_OFFSET, 1)) != RT_ERR_OK)
+            return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(0x1dc1, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
-                return retVal;
+        if ((retVal = rtl8367c_setAsicField<RTL8367C_FIELD(FIBER_CFG_1, SDS_MODE), 4>()) != RT_ERR_OK)
+            return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(0x1dc1, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
+        if (pAbility->AutoNegotiation == 1)
+        {
+            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG00, 0x1140)) != RT_ERR_OK)
                 return retVal;
-
-            if ((retVal = rtl8367c_setAsicRegBit(0x1dc1, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
+        }
+        else
+        {
+            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG00, 0x0140)) != RT_ERR_OK)
                 return retVal;
         }
     }
-    else if (3 == type)
+    else if (pAbility->Full_100 == 1)
     {
-        if (1 == id)
-        {
-            if ((retVal = rtl8367c_getAsicRegBit(0x1d11, 6, &sgmiibit)) != RT_ERR_OK)
-                return retVal;
-            if ((retVal = rtl8367c_getAsicRegBit(0x1d11, 11, &hisgmiibit)) != RT_ERR_OK)
-                return retVal;
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_MODE_OFFSET, 1)) != RT_ERR_OK)
+            return retVal;
 
-            if ((sgmiibit == 1) || (hisgmiibit == 1))
-            {
-                /*for 1000x/100fx/1000x_100fx, param has to be set to serdes registers*/
-                if ((retVal = rtl8367c_getAsicReg(0x1d41, &regValue)) != RT_ERR_OK)
-                    return retVal;
+        if ((retVal = rtl8367c_setAsicField<RTL8367C_FIELD(FIBER_CFG_1, SDS_MODE), 5>()) != RT_ERR_OK)
+            return retVal;
 
-                if ((regValue & 0xa0) == 0xa0)
-                {
+        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_FIB0_CFG00, 0x2100)) != RT_ERR_OK)
+            return retVal;
+    }
 
-                    if ((retVal = rtl8367c_getAsicRegBits(0x1d95, 0x1f00, &regValue2)) != RT_ERR_OK)
-                        return retVal;
+    /* Digital software reset */
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0003)) != RT_ERR_OK)
+        return retVal;
 
-                    /*1000X*/
-                    if (regValue2 == 0x4)
-                    {
-                        /* Enable new sds mode config */
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x0080)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 4 0  bit 12  set 1,  bit15~13 = 4*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFF0FFF;
-                        reg_data |= 0x9000;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_SDS_INDACS_DATA, &regData)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 0 2  bit 6  set 1,  bit13 set to 0, bit12 nway_en*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFDFFF;
-                        reg_data |= 0x40;
-                        if (pPortAbility->forcemode)
-                            reg_data &= 0xffffefff;
-                        else
-                            reg_data |= 0x1000;
+    regData |= (0x0001 << 6);
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, regData)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0003)) != RT_ERR_OK)
+        return retVal;
 
-                        if (pPortAbility->txpause)
-                            reg_data |= 0x80;
-                        else
-                            reg_data &= (~0x80);
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+        return retVal;
 
-                        if (pPortAbility->rxpause)
-                            reg_data |= 0x100;
-                        else
-                            reg_data &= (~0x100);
+    regData &= ~(0x0001 << 6);
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, regData)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 4 0  bit 12  set 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFEFFF;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0003)) != RT_ERR_OK)
+        return retVal;
 
-                        /*new_cfg_sds_mode=1000x*/
-                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x4)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                    else if (regValue2 == 0x5)
-                    {
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+        return retVal;
 
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                            return retVal;
+    /* CDR reset */
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x1401)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 4 0  bit 12  set 1,  bit15~13 = 5*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFF0FFF;
-                        reg_data |= 0xB000;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0000)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 0 2  bit 6  set 0,  bit13 set to 1, bit12 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFFFBF;
-                        reg_data |= 0x2000;
-                        reg_data &= 0xffffefff;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+        return retVal;
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x1403)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        if (pPortAbility->txpause)
-                            reg_data |= 0x80;
-                        else
-                            reg_data &= (~0x80);
-                        if (pPortAbility->rxpause)
-                            reg_data |= 0x100;
-                        else
-                            reg_data &= (~0x100);
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0000)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 4 0  bit 12  set 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFEFFF;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        /* new_cfg_sds_mode=1000x */
-                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x5)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                    else if (regValue2 == 0x7)
-                    {
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 4 0  bit 12  set 1,  bit15~13 = 4*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFF0FFF;
-                        reg_data |= 0x9000;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    return RT_ERR_OK;
+}
+int32_t rtl8367::rtk_port_phyAutoNegoAbility_set(rtk_port_t port, rtk_port_phy_ability_t *pAbility)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    const uint32_t phyRegs[3] = {PHY_1000_BASET_CONTROL_REG, PHY_AN_ADVERTISEMENT_REG, PHY_CONTROL_REG};
+    uint32_t phyData[3];
+    uint32_t phyEnMsk0;
+    uint32_t phyEnMsk4;
+    uint32_t phyEnMsk9;
+    rtk_port_media_t media_type;
 
-                        /* 0 0 2  bit 6  set 1,  bit13 set to 0, bit12 nway_en*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFDFFF;
-                        reg_data |= 0x40;
-                        if (pPortAbility->forcemode)
-                            reg_data &= 0xffffefff;
-                        else
-                            reg_data |= 0x1000;
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_UTP(port);
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (NULL == pAbility)
+        return RT_ERR_NULL_POINTER;
 
-                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        if (pPortAbility->txpause)
-                            reg_data |= 0x80;
-                        else
-                            reg_data &= (~0x80);
-                        if (pPortAbility->rxpause)
-                            reg_data |= 0x100;
-                        else
-                            reg_data &= (~0x100);
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
-
-                        /* 0 4 0  bit 12  set 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFEFFF;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (pAbility->Half_10 >= RTK_ENABLE_END || pAbility->Full_10 >= RTK_ENABLE_END ||
+        pAbility->Half_100 >= RTK_ENABLE_END || pAbility->Full_100 >= RTK_ENABLE_END ||
+        pAbility->Full_1000 >= RTK_ENABLE_END || pAbility->AutoNegotiation >= RTK_ENABLE_END ||
+        pAbility->AsyFC >= RTK_ENABLE_END || pAbility->FC >= RTK_ENABLE_END)
+        return RT_ERR_INPUT;
 
-                        /* 0 4 0  bit 12  set 1,  bit15~13 = 5*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFF0FFF;
-                        reg_data |= 0xB000;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (rtk_switch_isComboPort(port) == RT_ERR_OK)
+    {
+        if ((retVal = _rtk_port_phyComboPortMedia_get(port, &media_type)) != RT_ERR_OK)
+            return retVal;
 
-                        /* 0 0 2  bit 6  set 0,  bit13 set to 1, bit12 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFFFBF;
-                        reg_data |= 0x2000;
-                        reg_data &= 0xffffefff;
+        if (media_type == PORT_MEDIA_FIBER)
+        {
+            return _rtk_port_FiberModeAbility_set(port, pAbility);
+        }
+    }
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    /*for PHY auto mode setup*/
+    pAbility->AutoNegotiation = 1;
 
-                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        if (pPortAbility->txpause)
-                            reg_data |= 0x80;
-                        else
-                            reg_data &= 0xffffff7f;
-                        if (pPortAbility->rxpause)
-                            reg_data |= 0x100;
-                        else
-                            reg_data &= 0xfffffeff;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    phyEnMsk0 = 0;
+    phyEnMsk4 = 0;
+    phyEnMsk9 = 0;
 
-                        /* 0 4 0  bit 12  set 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFEFFF;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        /*sds_mode:*/
-                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x7)) != RT_ERR_OK)
-                            return retVal;
-                    }
+    if (1 == pAbility->Half_10)
+    {
+        /*10BASE-TX half duplex capable in reg 4.5*/
+        phyEnMsk4 = phyEnMsk4 | (1 << 5);
 
-                    /*disable force ability   ---      */
-                    if ((retVal = rtl8367c_setAsicRegBit(0x137c, 12, 0)) != RT_ERR_OK)
-                        return retVal;
-                    return RT_ERR_OK;
-                }
+        /*Speed selection [1:0] */
+        /* 11=Reserved*/
+        /* 10= 1000Mpbs*/
+        /* 01= 100Mpbs*/
+        /* 00= 10Mpbs*/
+        phyEnMsk0 = phyEnMsk0 & (~(1 << 6));
+        phyEnMsk0 = phyEnMsk0 & (~(1 << 13));
+    }
 
-                /* new_cfg_sds_mode */
-                if ((retVal = rtl8367c_getAsicRegBits(0x1d95, 0x1f00, &regValue2)) != RT_ERR_OK)
-                    return retVal;
-                if (regValue2 == 0x2)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                        return retVal;
+    if (1 == pAbility->Full_10)
+    {
+        /*10BASE-TX full duplex capable in reg 4.6*/
+        phyEnMsk4 = phyEnMsk4 | (1 << 6);
+        /*Speed selection [1:0] */
+        /* 11=Reserved*/
+        /* 10= 1000Mpbs*/
+        /* 01= 100Mpbs*/
+        /* 00= 10Mpbs*/
+        phyEnMsk0 = phyEnMsk0 & (~(1 << 6));
+        phyEnMsk0 = phyEnMsk0 & (~(1 << 13));
 
-                    for (i = 0; i < 0xfff; i++)
-                        ;
+        /*Full duplex mode in reg 0.8*/
+        phyEnMsk0 = phyEnMsk0 | (1 << 8);
+    }
 
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x2)) != RT_ERR_OK)
-                        return retVal;
+    if (1 == pAbility->Half_100)
+    {
+        /*100BASE-TX half duplex capable in reg 4.7*/
+        phyEnMsk4 = phyEnMsk4 | (1 << 7);
+        /*Speed selection [1:0] */
+        /* 11=Reserved*/
+        /* 10= 1000Mpbs*/
+        /* 01= 100Mpbs*/
+        /* 00= 10Mpbs*/
+        phyEnMsk0 = phyEnMsk0 & (~(1 << 6));
+        phyEnMsk0 = phyEnMsk0 | (1 << 13);
+    }
 
-                    for (i = 0; i < 0xfff; i++)
-                        ;
+    if (1 == pAbility->Full_100)
+    {
+        /*100BASE-TX full duplex capable in reg 4.8*/
+        phyEnMsk4 = phyEnMsk4 | (1 << 8);
+        /*Speed selection [1:0] */
+        /* 11=Reserved*/
+        /* 10= 1000Mpbs*/
+        /* 01= 100Mpbs*/
+        /* 00= 10Mpbs*/
+        phyEnMsk0 = phyEnMsk0 & (~(1 << 6));
+        phyEnMsk0 = phyEnMsk0 | (1 << 13);
+        /*Full duplex mode in reg 0.8*/
+        phyEnMsk0 = phyEnMsk0 | (1 << 8);
+    }
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
-                        return retVal;
+    if (1 == pAbility->Full_1000)
+    {
+        /*1000 BASE-T FULL duplex capable setting in reg 9.9*/
+        phyEnMsk9 = phyEnMsk9 | (1 << 9);
 
-                    if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
-                        return retVal;
+        /*Speed selection [1:0] */
+        /* 11=Reserved*/
+        /* 10= 1000Mpbs*/
+        /* 01= 100Mpbs*/
+        /* 00= 10Mpbs*/
+        phyEnMsk0 = phyEnMsk0 | (1 << 6);
+        phyEnMsk0 = phyEnMsk0 & (~(1 << 13));
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
-                        return retVal;
+        /*Auto-Negotiation setting in reg 0.12*/
+        phyEnMsk0 = phyEnMsk0 | (1 << 12);
+    }
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
-                        return retVal;
+    if (1 == pAbility->AutoNegotiation)
+    {
+        /*Auto-Negotiation setting in reg 0.12*/
+        phyEnMsk0 = phyEnMsk0 | (1 << 12);
+    }
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
-                        return retVal;
+    if (1 == pAbility->AsyFC)
+    {
+        /*Asymetric flow control in reg 4.11*/
+        phyEnMsk4 = phyEnMsk4 | (1 << 11);
+    }
+    if (1 == pAbility->FC)
+    {
+        /*Flow control in reg 4.10*/
+        phyEnMsk4 = phyEnMsk4 | (1 << 10);
+    }
 
-                    /*disable force ability   ---      */
-                    if ((retVal = rtl8367c_setAsicRegBit(0x137c, 12, 0)) != RT_ERR_OK)
-                        return retVal;
-                    return RT_ERR_OK;
-                }
-                else if (regValue2 == 0x12)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                        return retVal;
+    /*1000 BASE-T control, Auto-Negotiation control and control register, written in that order*/
+    if ((retVal = rtl8367c_getAsicPHYRegs(rtk_switch_port_L2P_get(port), phyRegs, 3, phyData)) != RT_ERR_OK)
+        return retVal;
 
-                    for (i = 0; i < 0xfff; i++)
-                        ;
+    phyData[0] = (phyData[0] & (~0x0200)) | phyEnMsk9;
+    phyData[1] = (phyData[1] & (~0x0DE0)) | phyEnMsk4;
+    phyData[2] = (phyData[2] & (~0x3140)) | phyEnMsk0;
+    /*If have auto-negotiation capable, then restart auto negotiation*/
+    if (1 == pAbility->AutoNegotiation)
+    {
+        phyData[2] = phyData[2] | (1 << 9);
+    }
 
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x12)) != RT_ERR_OK)
-                        return retVal;
+    if ((retVal = rtl8367c_setAsicPHYRegs(rtk_switch_port_L2P_get(port), phyRegs, phyData, 3)) != RT_ERR_OK)
+        return retVal;
 
-                    for (i = 0; i < 0xfff; i++)
-                        ;
+    return RT_ERR_OK;
+}
 
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0x1)) != RT_ERR_OK)
-                        return retVal;
+int32_t rtl8367::_rtk_port_FiberModeAbility_get(rtk_port_t port, rtk_port_phy_ability_t *pAbility)
+{
+    int32_t retVal;
+    uint32_t data, regData;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
-                        return retVal;
+    /* Check Combo port or not */
+    RTK_CHK_PORT_IS_COMBO(port);
 
-                    if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
-                        return retVal;
+    memset(pAbility, 0x00, sizeof(rtk_port_phy_ability_t));
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
-                        return retVal;
+    /* Flow Control */
+    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_REG4_OFFSET, 1)) != RT_ERR_OK)
+        return retVal;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
-                        return retVal;
+    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_REG4_FIB100_OFFSET, 0)) != RT_ERR_OK)
+        return retVal;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
-                        return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0044)) != RT_ERR_OK)
+        return retVal;
 
-                    /*disable force ability   ---      */
-                    if ((retVal = rtl8367c_setAsicRegBit(0x137c, 12, 0)) != RT_ERR_OK)
-                        return retVal;
-                    return RT_ERR_OK;
-                }
-            }
-            else
-            {
-                if ((retVal = rtl8367c_getAsicRegBits(0x1d3d, 10, &regValue2)) != RT_ERR_OK)
-                    return retVal;
-                if (regValue2 == 0)
-                {
-                    /*ext1_force_ablty*/
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 2, pPortAbility->duplex)) != RT_ERR_OK)
-                        return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x0080)) != RT_ERR_OK)
+        return retVal;
 
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, pPortAbility->speed)) != RT_ERR_OK)
-                        return retVal;
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_SDS_INDACS_DATA, &regData)) != RT_ERR_OK)
+        return retVal;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, pPortAbility->link)) != RT_ERR_OK)
-                        return retVal;
-
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 6, pPortAbility->txpause)) != RT_ERR_OK)
-                        return retVal;
-
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 5, pPortAbility->rxpause)) != RT_ERR_OK)
-                        return retVal;
+    if (regData & (0x0001 << 8))
+        pAbility->AsyFC = 1;
 
-                    /*force mode for ext1*/
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 12, pPortAbility->forcemode)) != RT_ERR_OK)
-                        return retVal;
+    if (regData & (0x0001 << 7))
+        pAbility->FC = 1;
 
-                    if (pPortAbility->link == 1)
-                    {
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 0)) != RT_ERR_OK)
-                            return retVal;
+    /* Speed ability */
+    if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_FIBER_CFG_1, RTL8367C_SDS_FRC_MODE_OFFSET, &data)) != RT_ERR_OK)
+        return retVal;
 
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 1)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                    else
-                    {
-                        if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, 2)) != RT_ERR_OK)
-                            return retVal;
-                    }
+    if (data == 0)
+    {
+        pAbility->AutoNegotiation = 1;
+        pAbility->Full_1000 = 1;
+        pAbility->Full_100 = 1;
+    }
+    else
+    {
+        if ((retVal = rtl8367c_getAsicField<RTL8367C_FIELD(FIBER_CFG_1, SDS_MODE)>(&data)) != RT_ERR_OK)
+            return retVal;
 
-                    /*disable force ability   ---      */
-                    if ((retVal = rtl8367c_setAsicRegBit(0x137c, 12, 0)) != RT_ERR_OK)
-                        return retVal;
-                    return RT_ERR_OK;
-                }
-            }
-        }
-        else if (2 == id)
+        if (data == 4)
         {
+            pAbility->Full_1000 = 1;
 
-            if ((retVal = rtl8367c_getAsicRegBit(0x1d95, 0, &sgmiibit)) != RT_ERR_OK)
+            if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_FIB0_CFG00, &data)) != RT_ERR_OK)
                 return retVal;
-            if (sgmiibit == 1)
-            {
-                /*for 1000x/100fx/1000x_100fx, param has to bet set to serdes registers*/
-                if ((retVal = rtl8367c_getAsicReg(0x1d95, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                /*cfg_mac7_sel_sgmii=1 & cfg_mac7_fib =1*/
-                if ((regValue & 0x3) == 0x3)
-                {
-                    if ((retVal = rtl8367c_getAsicRegBits(0x1d95, 0x1f00, &regValue2)) != RT_ERR_OK)
-                        return retVal;
 
-                    if (regValue2 == 0x4)
-                    {
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                            return retVal;
+            if (data & 0x1000)
+                pAbility->AutoNegotiation = 1;
+            else
+                pAbility->AutoNegotiation = 0;
+        }
+        else if (data == 5)
+            pAbility->Full_100 = 1;
+        else
+            return RT_ERR_FAILED;
+    }
 
-                        /* 0 4 0  bit 12  set 1,  bit15~13 = 4*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFF0FFF;
-                        reg_data |= 0x9000;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    return RT_ERR_OK;
+}
 
-                        /* 0 0 2  bit 6  set 1,  bit13 set to 0, bit12 nway_en*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFDFFF;
-                        reg_data |= 0x40;
-                        if (pPortAbility->forcemode)
-                            reg_data &= 0xffffefff;
-                        else
-                            reg_data |= 0x1000;
+int32_t rtl8367::rtk_port_phyAutoNegoAbility_get(rtk_port_t port, rtk_port_phy_ability_t *pAbility)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t phyData0;
+    uint32_t phyData4;
+    uint32_t phyData9;
+    const uint32_t phyRegs[3] = {PHY_CONTROL_REG, PHY_AN_ADVERTISEMENT_REG, PHY_1000_BASET_CONTROL_REG};
+    uint32_t phyData[3];
+    rtk_port_media_t media_type;
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_UTP(port);
 
-                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        if (pPortAbility->txpause)
-                            reg_data |= 0x80;
-                        else
-                            reg_data &= 0xffffff7f;
-                        if (pPortAbility->rxpause)
-                            reg_data |= 0x100;
-                        else
-                            reg_data &= 0xfffffeff;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (NULL == pAbility)
+        return RT_ERR_NULL_POINTER;
 
-                        /* 0 4 0  bit 12  set 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFEFFF;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (rtk_switch_isComboPort(port) == RT_ERR_OK)
+    {
+        if ((retVal = _rtk_port_phyComboPortMedia_get(port, &media_type)) != RT_ERR_OK)
+            return retVal;
 
-                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x4)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                    else if (regValue2 == 0x5)
-                    {
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                            return retVal;
+        if (media_type == PORT_MEDIA_FIBER)
+        {
+            return _rtk_port_FiberModeAbility_get(port, pAbility);
+        }
+    }
 
-                        /* 0 4 0  bit 12  set 1,  bit15~13 = 5*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFF0FFF;
-                        reg_data |= 0xB000;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    /*Control, Auto-Negotiation control and 1000 BASE-T control register*/
+    if ((retVal = rtl8367c_getAsicPHYRegs(rtk_switch_port_L2P_get(port), phyRegs, 3, phyData)) != RT_ERR_OK)
+        return retVal;
 
-                        /* 0 0 2  bit 6  set 0,  bit13 set to 1, bit12 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFFFBF;
-                        reg_data |= 0x2000;
-                        reg_data &= 0xffffefff;
+    phyData0 = phyData[0];
+    phyData4 = phyData[1];
+    phyData9 = phyData[2];
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (phyData9 & (1 << 9))
+        pAbility->Full_1000 = 1;
+    else
+        pAbility->Full_1000 = 0;
 
-                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        if (pPortAbility->txpause)
-                            reg_data |= 0x80;
-                        else
-                            reg_data &= 0xffffff7f;
-                        if (pPortAbility->rxpause)
-                            reg_data |= 0x100;
-                        else
-                            reg_data &= 0xfffffeff;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (phyData4 & (1 << 11))
+        pAbility->AsyFC = 1;
+    else
+        pAbility->AsyFC = 0;
 
-                        /* 0 4 0  bit 12  set 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFEFFF;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (phyData4 & (1 << 10))
+        pAbility->FC = 1;
+    else
+        pAbility->FC = 0;
 
-                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x5)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                    else if (regValue2 == 0x7)
-                    {
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                            return retVal;
+    if (phyData4 & (1 << 8))
+        pAbility->Full_100 = 1;
+    else
+        pAbility->Full_100 = 0;
 
-                        /* 0 4 0  bit 12  set 1,  bit15~13 = 4*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFF0FFF;
-                        reg_data |= 0x9000;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (phyData4 & (1 << 7))
+        pAbility->Half_100 = 1;
+    else
+        pAbility->Half_100 = 0;
 
-                        /* 0 0 2  bit 6  set 1,  bit13 set to 0, bit12 nway_en*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFDFFF;
-                        reg_data |= 0x40;
-                        if (pPortAbility->forcemode)
-                            reg_data &= 0xffffefff;
-                        else
-                            reg_data |= 0x1000;
+    if (phyData4 & (1 << 6))
+        pAbility->Full_10 = 1;
+    else
+        pAbility->Full_10 = 0;
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (phyData4 & (1 << 5))
+        pAbility->Half_10 = 1;
+    else
+        pAbility->Half_10 = 0;
 
-                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        if (pPortAbility->txpause)
-                            reg_data |= 0x80;
-                        else
-                            reg_data &= 0xffffff7f;
-                        if (pPortAbility->rxpause)
-                            reg_data |= 0x100;
-                        else
-                            reg_data &= 0xfffffeff;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (phyData0 & (1 << 12))
+        pAbility->AutoNegotiation = 1;
+    else
+        pAbility->AutoNegotiation = 0;
 
-                        /* 0 4 0  bit 12  set 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFEFFF;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    return RT_ERR_OK;
+}
 
-                        /* 0 4 0  bit 12  set 1,  bit15~13 = 5*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFF0FFF;
-                        reg_data |= 0xB000;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+// -------------------------- LED --------------------------
 
-                        /* 0 0 2  bit 6  set 0,  bit13 set to 1, bit12 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFFFBF;
-                        reg_data |= 0x2000;
-                        reg_data &= 0xffffefff;
+/* Function Name:
+ *      rtk_switch_isCPUPort
+ * Description:
+ *      Check is logical port a CPU port
+ * Input:
+ *      logicalPort     - logical port ID
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Port ID is a CPU port
+ *      RT_ERR_FAILED   - Port ID is not a CPU port
+ *      RT_ERR_NOT_INIT - Not Initialize
+ * Note:
+ *
+ */
+int32_t rtl8367::rtk_switch_isCPUPort(uint32_t logicalPort)
+{
 
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (logicalPort >= RTK_SWITCH_PORT_NUM)
+        return RT_ERR_FAILED;
 
-                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        if (pPortAbility->txpause)
-                            reg_data |= 0x80;
-                        else
-                            reg_data &= 0xffffff7f;
-                        if (pPortAbility->rxpause)
-                            reg_data |= 0x100;
-                        else
-                            reg_data &= 0xfffffeff;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
-                            return retVal;
+    if (((0x01 << logicalPort) & halCtrl.valid_cpu_portmask) != 0)
+        return RT_ERR_OK;
+    else
+        return RT_ERR_FAILED;
+}
 
-                        /* 0 4 0  bit 12  set 0*/
-                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
-                            return retVal;
-                        reg_data &= 0xFFFFEFFF;
-                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
-                            return retVal;
+/*
+@func int32_t | rtl8367c_setAsicLedGroupEnable | Turn on/off Led of all system ports
+@parm uint32_t | group | LED group id.
+@parm uint32_t | portmask | LED port mask.
+@rvalue RT_ERR_OK | Success.
+@rvalue RT_ERR_SMI | SMI access error.
+@rvalue RT_ERR_PORT_ID | Invalid port number.
+@rvalue RT_ERR_INPUT | Invalid input value.
+@comm
+    The API can turn on/off leds of dedicated port while indicated information configuration of LED group is set to force mode.
+ */
+int32_t rtl8367::rtl8367c_setAsicLedGroupEnable(uint32_t group, uint32_t portmask)
+{
+    int32_t retVal;
+    uint32_t regAddr;
+    uint32_t regDataMask;
 
-                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x7)) != RT_ERR_OK)
-                            return retVal;
-                    }
+    if (group >= RTL8367C_LEDGROUPNO)
+        return RT_ERR_INPUT;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(0x137d, 12, 0)) != RT_ERR_OK)
-                        return retVal;
-                    return RT_ERR_OK;
-                }
+    regAddr = RTL8367C_REG_PARA_LED_IO_EN1 + group / 2;
+    regDataMask = 0xFF << ((group % 2) * 8);
+    retVal = rtl8367c_setAsicRegBits(regAddr, regDataMask, portmask & 0xff);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_getAsicRegBits(0x1d95, 0x1f00, &regValue2)) != RT_ERR_OK)
-                    return retVal;
-                if (regValue2 == 0x2)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                        return retVal;
+    regAddr = RTL8367C_REG_PARA_LED_IO_EN3;
+    regDataMask = 0x3 << (group * 2);
+    retVal = rtl8367c_setAsicRegBits(regAddr, regDataMask, (portmask >> 8) & 0x7);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                    for (i = 0; i < 0xfff; i++)
-                        ;
+    return RT_ERR_OK;
+}
 
-                    /* 0 2 0  bit 8-9  nway*/
-                    if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
-                        return retVal;
-                    reg_data &= 0xfffffcff;
-                    if (pPortAbility->nway)
-                        reg_data &= 0xfffffcff;
-                    else
-                        reg_data |= 0x100;
-                    if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
-                        return retVal;
+int32_t rtl8367::rtk_led_enable_set(rtk_led_group_t group, rtk_portmask_t *pPortmask)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmask;
+    uint32_t port;
 
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x2)) != RT_ERR_OK)
-                        return retVal;
+    if (group >= LED_GROUP_END)
+        return RT_ERR_INPUT;
 
-                    for (i = 0; i < 0xfff; i++)
-                        ;
+    RTK_CHK_PORTMASK_VALID(pPortmask);
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
-                        return retVal;
+    RTK_PORTMASK_SCAN((*pPortmask), port)
+    {
+        if (rtk_switch_isCPUPort(port) == RT_ERR_OK)
+            return RT_ERR_PORT_MASK;
+    }
 
-                    if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
-                        return retVal;
+    if ((retVal = rtk_switch_portmask_L2P_get(pPortmask, &pmask)) != RT_ERR_OK)
+        return retVal;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
-                        return retVal;
+    if ((retVal = rtl8367c_setAsicLedGroupEnable(group, pmask)) != RT_ERR_OK)
+        return retVal;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
-                        return retVal;
+    return RT_ERR_OK;
+}
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
-                        return retVal;
+/*
+@func int32_t | rtl8367c_setAsicLedOperationMode | Set LED operation mode
+@parm uint32_t | mode | LED mode. 1:scan mode 1, 2:parallel mode, 3:mdx mode (serial mode)
+@rvalue RT_ERR_OK | Success.
+@rvalue RT_ERR_SMI | SMI access error.
+@rvalue RT_ERR_INPUT | Invalid input value.
+@comm
+    The API can turn on/off led serial mode and set signal to active high/low.
+ */
+int32_t rtl8367::rtl8367c_setAsicLedOperationMode(uint32_t mode)
+{
+    int32_t retVal;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(0x137d, 12, 0)) != RT_ERR_OK)
-                        return retVal;
-                    return RT_ERR_OK;
-                }
-            }
-            else
-            {
+    /* Invalid input parameter */
+    if (mode >= LEDOP_END)
+        return RT_ERR_INPUT;
 
-                /*ext2_force_ablty*/
-                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 2, pPortAbility->duplex)) != RT_ERR_OK)
-                    return retVal;
+    switch (mode)
+    {
+    case LEDOP_PARALLEL:
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_LED_SYS_CONFIG, RTL8367C_LED_SELECT_OFFSET, 0)) != RT_ERR_OK)
+            return retVal;
+        /*Disable serial CLK mode*/
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCAN0_LED_IO_EN1, RTL8367C_LED_SERI_CLK_EN_OFFSET, 0)) != RT_ERR_OK)
+            return retVal;
+        /*Disable serial DATA mode*/
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCAN0_LED_IO_EN1, RTL8367C_LED_SERI_DATA_EN_OFFSET, 0)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case LEDOP_SERIAL:
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_LED_SYS_CONFIG, RTL8367C_LED_SELECT_OFFSET, 1)) != RT_ERR_OK)
+            return retVal;
+        /*Enable serial CLK mode*/
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCAN0_LED_IO_EN1, RTL8367C_LED_SERI_CLK_EN_OFFSET, 1)) != RT_ERR_OK)
+            return retVal;
+        /*Enable serial DATA mode*/
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCAN0_LED_IO_EN1, RTL8367C_LED_SERI_DATA_EN_OFFSET, 1)) != RT_ERR_OK)
+            return retVal;
+        break;
+    default:
+        return RT_ERR_INPUT;
+        break;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c4, 0x3, pPortAbility->speed)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
+int32_t rtl8367::rtk_led_operation_set(rtk_led_operation_t mode)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t regData;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, pPortAbility->link)) != RT_ERR_OK)
-                    return retVal;
+    if (mode >= LED_OP_END)
+        return RT_ERR_INPUT;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 6, pPortAbility->txpause)) != RT_ERR_OK)
-                    return retVal;
+    switch (mode)
+    {
+    case LED_OP_PARALLEL:
+        regData = LEDOP_PARALLEL;
+        break;
+    case LED_OP_SERIAL:
+        regData = LEDOP_SERIAL;
+        break;
+    default:
+        return RT_ERR_CHIP_NOT_SUPPORTED;
+        break;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 5, pPortAbility->rxpause)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicLedOperationMode(regData)) != RT_ERR_OK)
+        return retVal;
 
-                /*force mode for ext2*/
-                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 12, pPortAbility->forcemode)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
 
-                if (pPortAbility->link == 1)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, 0)) != RT_ERR_OK)
-                        return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicLedBlinkRate
+ * Description:
+ *      Set led blinking rate at mode 0 to mode 3
+ * Input:
+ *      blinkRate   - Support 6 blink rates
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ * Note:
+ *      LED blink rate can be at 43ms, 84ms, 120ms, 170ms, 340ms and 670ms
+ */
+int32_t rtl8367::rtl8367c_setAsicLedBlinkRate(uint32_t blinkRate)
+{
+    if (blinkRate >= LEDBLINKRATE_END)
+        return RT_ERR_OUT_OF_RANGE;
 
-                    if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, 1)) != RT_ERR_OK)
-                        return retVal;
-                }
-                else
-                {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x13c4, 0x3, 2)) != RT_ERR_OK)
-                        return retVal;
-                }
-
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                if (reg_data == 1)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 2, pPortAbility->duplex)) != RT_ERR_OK)
-                        return retVal;
-
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, pPortAbility->speed)) != RT_ERR_OK)
-                        return retVal;
-
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, pPortAbility->link)) != RT_ERR_OK)
-                        return retVal;
-
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 6, pPortAbility->txpause)) != RT_ERR_OK)
-                        return retVal;
-
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 5, pPortAbility->rxpause)) != RT_ERR_OK)
-                        return retVal;
-
-                    /*force mode for ext1*/
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 12, pPortAbility->forcemode)) != RT_ERR_OK)
-                        return retVal;
+    return rtl8367c_setAsicField<RTL8367C_FIELD(LED_MODE, SEL_LEDRATE)>(blinkRate);
+}
 
-                    if (pPortAbility->link == 1)
-                    {
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 0)) != RT_ERR_OK)
-                            return retVal;
+int32_t rtl8367::rtk_led_blinkRate_set(rtk_led_blink_rate_t blinkRate)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-                        if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 1)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                    else
-                    {
-                        if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, 2)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                }
-            }
+    if (blinkRate >= LED_BLINKRATE_END)
+        return RT_ERR_FAILED;
 
-            /*disable force ability   ---      */
-            if ((retVal = rtl8367c_setAsicRegBit(0x137d, 12, 0)) != RT_ERR_OK)
-                return retVal;
-        }
-    }
+    if ((retVal = rtl8367c_setAsicLedBlinkRate(blinkRate)) != RT_ERR_OK)
+        return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicPortExtMode
+ *      rtl8367c_setAsicLedIndicateInfoConfig
  * Description:
- *      Set external interface mode configuration
+ *      Set Leds indicated information mode
  * Input:
- *      id      - external interface id (0~2)
- *      mode    - external interface mode
+ *      ledno   - LED group number. There are 1 to 1 led mapping to each port in each led group
+ *      config  - Support 16 types configuration
  * Output:
  *      None
  * Return:
@@ -9067,4914 +10297,9539 @@ int32_t rtl8367::rtl8367c_setAsicPortForceLinkExt(uint32_t id, rtl8367c_port_abi
  *      RT_ERR_SMI          - SMI access error
  *      RT_ERR_OUT_OF_RANGE - input parameter out of range
  * Note:
- *      None
+ *      The API can set LED indicated information configuration for each LED group with 1 to 1 led mapping to each port.
+ *      Definition        LED Statuses            Description
+ *      0000        LED_Off                LED pin Tri-State.
+ *      0001        Dup/Col                Collision, Full duplex Indicator. Blinking every 43ms when collision happens. Low for full duplex, and high for half duplex mode.
+ *      0010        Link/Act               Link, Activity Indicator. Low for link established. Link/Act Blinks every 43ms when the corresponding port is transmitting or receiving.
+ *      0011        Spd1000                1000Mb/s Speed Indicator. Low for 1000Mb/s.
+ *      0100        Spd100                 100Mb/s Speed Indicator. Low for 100Mb/s.
+ *      0101        Spd10                  10Mb/s Speed Indicator. Low for 10Mb/s.
+ *      0110        Spd1000/Act            1000Mb/s Speed/Activity Indicator. Low for 1000Mb/s. Blinks every 43ms when the corresponding port is transmitting or receiving.
+ *      0111        Spd100/Act             100Mb/s Speed/Activity Indicator. Low for 100Mb/s. Blinks every 43ms when the corresponding port is transmitting or receiving.
+ *      1000        Spd10/Act              10Mb/s Speed/Activity Indicator. Low for 10Mb/s. Blinks every 43ms when the corresponding port is transmitting or receiving.
+ *      1001        Spd100 (10)/Act        10/100Mb/s Speed/Activity Indicator. Low for 10/100Mb/s. Blinks every 43ms when the corresponding port is transmitting or receiving.
+ *      1010        Fiber                  Fiber link Indicator. Low for Fiber.
+ *      1011        Fault                  Auto-negotiation     Fault Indicator. Low for Fault.
+ *      1100        Link/Rx                Link, Activity Indicator. Low for link established. Link/Rx Blinks every 43ms when the corresponding port is transmitting.
+ *      1101        Link/Tx                Link, Activity Indicator. Low for link established. Link/Tx Blinks every 43ms when the corresponding port is receiving.
+ *      1110        Master                 Link on Master Indicator. Low for link Master established.
+ *      1111        LED_Force              Force LED output, LED output value reference
  */
-int32_t rtl8367::rtl8367c_setAsicPortExtMode(uint32_t id, uint32_t mode)
+int32_t rtl8367::rtl8367c_setAsicLedIndicateInfoConfig(uint32_t ledno, uint32_t config)
 {
     int32_t retVal;
-    uint32_t i, regValue, type, option, reg_data;
-    uint32_t idx;
-    uint32_t redData[][2] = {{0x04D7, 0x0480}, {0xF994, 0x0481}, {0x21A2, 0x0482}, {0x6960, 0x0483}, {0x9728, 0x0484}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x83F2, 0x002E}};
-    uint32_t redDataSB[][2] = {{0x04D7, 0x0480}, {0xF994, 0x0481}, {0x31A2, 0x0482}, {0x6960, 0x0483}, {0x9728, 0x0484}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x83F2, 0x002E}};
-    uint32_t redData1[][2] = {{0x82F1, 0x0500}, {0xF195, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
-    uint32_t redData5[][2] = {{0x82F1, 0x0500}, {0xF195, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
-    uint32_t redData6[][2] = {{0x82F1, 0x0500}, {0xF195, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
-    uint32_t redData8[][2] = {{0x82F1, 0x0500}, {0xF995, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
-    uint32_t redData9[][2] = {{0x82F1, 0x0500}, {0xF995, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
-    uint32_t redDataHB[][2] = {{0x82F0, 0x0500}, {0xF195, 0x0501}, {0x31A2, 0x0502}, {0x7960, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
+    const uint16_t bits[RTL8367C_LEDGROUPNO] = {RTL8367C_LED0_CFG_MASK, RTL8367C_LED1_CFG_MASK, RTL8367C_LED2_CFG_MASK};
 
-    if (id >= RTL8367C_EXTNO)
+    if (ledno >= RTL8367C_LEDGROUPNO)
         return RT_ERR_OUT_OF_RANGE;
 
-    if (mode >= EXT_END)
+    if (config >= LEDCONF_END)
         return RT_ERR_OUT_OF_RANGE;
 
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_getAsicReg(0x1300, &regValue)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
+    retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_LED_CONFIGURATION, RTL8367C_LED_CONFIG_SEL_OFFSET, 0);
+    if (retVal != RT_ERR_OK)
         return retVal;
 
-    type = 0;
+    return rtl8367c_setAsicRegBits(RTL8367C_REG_LED_CONFIGURATION, bits[ledno], config);
+}
+int32_t rtl8367::rtk_led_groupConfig_set(rtk_led_group_t group, rtk_led_congig_t config)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-    switch (regValue)
-    {
-    case 0x0276:
-    case 0x0597:
-    case 0x6367:
-        type = 1;
-        break;
-    case 0x0652:
-    case 0x6368:
-        type = 2;
-        break;
-    case 0x0801:
-    case 0x6511:
-        type = 3;
-        break;
-    default:
+    if (LED_GROUP_END <= group)
         return RT_ERR_FAILED;
-    }
 
-    if (1 == type)
-    {
-        if ((mode == EXT_1000X_100FX) || (mode == EXT_1000X) || (mode == EXT_100FX))
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_REG_TO_ECO4, 5, 1)) != RT_ERR_OK)
-                return retVal;
+    if (LED_CONFIG_END <= config)
+        return RT_ERR_FAILED;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_REG_TO_ECO4, 7, 1)) != RT_ERR_OK)
-                return retVal;
+    if ((retVal = rtl8367c_setAsicLedIndicateInfoConfig(group, config)) != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 1)) != RT_ERR_OK)
-                return retVal;
+    return RT_ERR_OK;
+}
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_MISCELLANEOUS_CONFIGURE0, RTL8367C_DW8051_EN_OFFSET, 1)) != RT_ERR_OK)
-                return retVal;
+// ------------------------------- RMA -----------------------------------------
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 1)) != RT_ERR_OK)
-                return retVal;
+/* Function Name:
+ *      rtl8367c_getAsicRma
+ * Description:
+ *      Get reserved multicast address for CPU trapping
+ * Input:
+ *      index     - reserved multicast LSB byte, 0x00~0x2F is available value
+ *      rmacfg     - type of RMA for trapping frame type setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK         - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicRma(uint32_t index, rtl8367c_rma_t *pRmacfg)
+{
+    int32_t retVal;
+    uint32_t regData;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
-                return retVal;
+    if (index > RTL8367C_RMAMAX)
+        return RT_ERR_RMA_ADDR;
 
-            if (mode == EXT_1000X_100FX)
-            {
-                for (idx = 0; idx < FIBER2_AUTO_INIT_SIZE; idx++)
-                {
-                    if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Fiber2_Auto[idx])) != RT_ERR_OK)
-                        return retVal;
-                }
-            }
+    if ((index >= 0x4 && index <= 0x7) || (index >= 0x9 && index <= 0x0C) || (0x0F == index))
+        index = 0x04;
+    else if ((index >= 0x13 && index <= 0x17) || (0x19 == index) || (index >= 0x1B && index <= 0x1f))
+        index = 0x13;
+    else if (index >= 0x22 && index <= 0x2F)
+        index = 0x22;
 
-            if (mode == EXT_1000X)
-            {
-                for (idx = 0; idx < FIBER2_1G_INIT_SIZE; idx++)
-                {
-                    if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Fiber2_1G[idx])) != RT_ERR_OK)
-                        return retVal;
-                }
-            }
+    retVal = rtl8367c_getAsicReg(RTL8367C_REG_RMA_CTRL00 + index, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-            if (mode == EXT_100FX)
-            {
-                for (idx = 0; idx < FIBER2_100M_INIT_SIZE; idx++)
-                {
-                    if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Fiber2_100M[idx])) != RT_ERR_OK)
-                        return retVal;
-                }
-            }
+    pRmacfg->operation = ((regData >> 7) & 0x0003);
+    pRmacfg->discard_storm_filter = ((regData >> 6) & 0x0001);
+    pRmacfg->trap_priority = ((regData >> 3) & 0x0007);
+    pRmacfg->keep_format = ((regData >> 2) & 0x0001);
+    pRmacfg->vlan_leaky = ((regData >> 1) & 0x0001);
+    pRmacfg->portiso_leaky = (regData & 0x0001);
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
-                return retVal;
+    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 0)) != RT_ERR_OK)
-                return retVal;
+    pRmacfg->trap_priority = regData;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 0)) != RT_ERR_OK)
-                return retVal;
-        }
+    return RT_ERR_OK;
+}
+/* Function Name:
+ *      rtl8367c_setAsicRma
+ * Description:
+ *      Set reserved multicast address for CPU trapping
+ * Input:
+ *      index     - reserved multicast LSB byte, 0x00~0x2F is available value
+ *      pRmacfg     - type of RMA for trapping frame type setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK         - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicRma(uint32_t index, rtl8367c_rma_t *pRmacfg)
+{
+    uint32_t regData = 0;
+    int32_t retVal;
 
-        if (mode == EXT_GMII)
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_EXT0_RGMXF, RTL8367C_EXT0_RGTX_INV_OFFSET, 1)) != RT_ERR_OK)
-                return retVal;
+    if (index > RTL8367C_RMAMAX)
+        return RT_ERR_RMA_ADDR;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_EXT1_RGMXF, RTL8367C_EXT1_RGTX_INV_OFFSET, 1)) != RT_ERR_OK)
-                return retVal;
-
-            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_EXT_TXC_DLY, RTL8367C_EXT1_GMII_TX_DELAY_MASK, 5)) != RT_ERR_OK)
-                return retVal;
+    regData |= (pRmacfg->portiso_leaky & 0x0001);
+    regData |= ((pRmacfg->vlan_leaky & 0x0001) << 1);
+    regData |= ((pRmacfg->keep_format & 0x0001) << 2);
+    regData |= ((pRmacfg->trap_priority & 0x0007) << 3);
+    regData |= ((pRmacfg->discard_storm_filter & 0x0001) << 6);
+    regData |= ((pRmacfg->operation & 0x0003) << 7);
 
-            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_EXT_TXC_DLY, RTL8367C_EXT0_GMII_TX_DELAY_MASK, 6)) != RT_ERR_OK)
-                return retVal;
-        }
+    if ((index >= 0x4 && index <= 0x7) || (index >= 0x9 && index <= 0x0C) || (0x0F == index))
+        index = 0x04;
+    else if ((index >= 0x13 && index <= 0x17) || (0x19 == index) || (index >= 0x1B && index <= 0x1f))
+        index = 0x13;
+    else if (index >= 0x22 && index <= 0x2F)
+        index = 0x22;
 
-        /* Serdes reset */
-        if ((mode == EXT_TMII_MAC) || (mode == EXT_TMII_PHY))
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_BYPASS_LINE_RATE, id, 1)) != RT_ERR_OK)
-                return retVal;
-        }
-        else
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_BYPASS_LINE_RATE, id, 0)) != RT_ERR_OK)
-                return retVal;
-        }
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, pRmacfg->trap_priority);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-        if ((mode == EXT_SGMII) || (mode == EXT_HSGMII))
-        {
-            if (id != 1)
-                return RT_ERR_PORT_ID;
+    return rtl8367c_setAsicReg(RTL8367C_REG_RMA_CTRL00 + index, regData);
+}
 
-            if ((retVal = rtl8367c_setAsicReg(0x13C0, 0x0249)) != RT_ERR_OK)
-                return retVal;
+/* Function Name:
+ *      rtl8367c_getAsicRmaCdp
+ * Description:
+ *      Get CDP(Cisco Discovery Protocol) for CPU trapping
+ * Input:
+ *      None
+ * Output:
+ *      pRmacfg     - type of RMA for trapping frame type setting
+ * Return:
+ *      RT_ERR_OK         - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicRmaCdp(rtl8367c_rma_t *pRmacfg)
+{
+    int32_t retVal;
+    uint32_t regData;
 
-            if ((retVal = rtl8367c_getAsicReg(0x13C1, &option)) != RT_ERR_OK)
-                return retVal;
+    retVal = rtl8367c_getAsicReg(RTL8367C_REG_RMA_CTRL_CDP, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicReg(0x13C0, 0x0000)) != RT_ERR_OK)
-                return retVal;
-        }
+    pRmacfg->operation = ((regData >> 7) & 0x0003);
+    pRmacfg->discard_storm_filter = ((regData >> 6) & 0x0001);
+    pRmacfg->trap_priority = ((regData >> 3) & 0x0007);
+    pRmacfg->keep_format = ((regData >> 2) & 0x0001);
+    pRmacfg->vlan_leaky = ((regData >> 1) & 0x0001);
+    pRmacfg->portiso_leaky = (regData & 0x0001);
 
-        if (mode == EXT_SGMII)
-        {
-            if (option == 0)
-            {
-                for (i = 0; i <= 7; i++)
-                {
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData[i][0])) != RT_ERR_OK)
-                        return retVal;
+    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData[i][1])) != RT_ERR_OK)
-                        return retVal;
+    pRmacfg->trap_priority = regData;
 
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                        return retVal;
-                }
-            }
-            else
-            {
-                for (i = 0; i <= 7; i++)
-                {
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redDataSB[i][0])) != RT_ERR_OK)
-                        return retVal;
+    return RT_ERR_OK;
+}
 
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redDataSB[i][1])) != RT_ERR_OK)
-                        return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicRmaCdp
+ * Description:
+ *      Set CDP(Cisco Discovery Protocol) for CPU trapping
+ * Input:
+ *      pRmacfg     - type of RMA for trapping frame type setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK         - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicRmaCdp(rtl8367c_rma_t *pRmacfg)
+{
+    uint32_t regData = 0;
+    int32_t retVal;
 
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                        return retVal;
-                }
-            }
-        }
+    if (pRmacfg->operation >= RMAOP_END)
+        return RT_ERR_RMA_ACTION;
 
-        if (mode == EXT_HSGMII)
-        {
-            if (option == 0)
-            {
-                if ((retVal = rtl8367c_setAsicReg(0x13c2, 0x0249)) != RT_ERR_OK)
-                    return retVal;
+    if (pRmacfg->trap_priority > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
 
-                if ((retVal = rtl8367c_getAsicReg(0x1301, &regValue)) != RT_ERR_OK)
-                    return retVal;
+    regData |= (pRmacfg->portiso_leaky & 0x0001);
+    regData |= ((pRmacfg->vlan_leaky & 0x0001) << 1);
+    regData |= ((pRmacfg->keep_format & 0x0001) << 2);
+    regData |= ((pRmacfg->trap_priority & 0x0007) << 3);
+    regData |= ((pRmacfg->discard_storm_filter & 0x0001) << 6);
+    regData |= ((pRmacfg->operation & 0x0003) << 7);
 
-                if ((retVal = rtl8367c_setAsicReg(0x13c2, 0x0000)) != RT_ERR_OK)
-                    return retVal;
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, pRmacfg->trap_priority);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                if (((regValue & 0x00F0) >> 4) == 0x0001)
-                {
-                    for (i = 0; i <= 8; i++)
-                    {
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData1[i][0])) != RT_ERR_OK)
-                            return retVal;
+    return rtl8367c_setAsicReg(RTL8367C_REG_RMA_CTRL_CDP, regData);
+}
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData1[i][1])) != RT_ERR_OK)
-                            return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicRmaCsstp
+ * Description:
+ *      Set CSSTP(Cisco Shared Spanning Tree Protocol) for CPU trapping
+ * Input:
+ *      pRmacfg     - type of RMA for trapping frame type setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK         - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicRmaCsstp(rtl8367c_rma_t *pRmacfg)
+{
+    uint32_t regData = 0;
+    int32_t retVal;
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                }
-                else if (((regValue & 0x00F0) >> 4) == 0x0005)
-                {
-                    for (i = 0; i <= 8; i++)
-                    {
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData5[i][0])) != RT_ERR_OK)
-                            return retVal;
+    if (pRmacfg->operation >= RMAOP_END)
+        return RT_ERR_RMA_ACTION;
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData5[i][1])) != RT_ERR_OK)
-                            return retVal;
+    if (pRmacfg->trap_priority > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                }
-                else if (((regValue & 0x00F0) >> 4) == 0x0006)
-                {
-                    for (i = 0; i <= 8; i++)
-                    {
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData6[i][0])) != RT_ERR_OK)
-                            return retVal;
+    regData |= (pRmacfg->portiso_leaky & 0x0001);
+    regData |= ((pRmacfg->vlan_leaky & 0x0001) << 1);
+    regData |= ((pRmacfg->keep_format & 0x0001) << 2);
+    regData |= ((pRmacfg->trap_priority & 0x0007) << 3);
+    regData |= ((pRmacfg->discard_storm_filter & 0x0001) << 6);
+    regData |= ((pRmacfg->operation & 0x0003) << 7);
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData6[i][1])) != RT_ERR_OK)
-                            return retVal;
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, pRmacfg->trap_priority);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                }
-                else if (((regValue & 0x00F0) >> 4) == 0x0008)
-                {
-                    for (i = 0; i <= 8; i++)
-                    {
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData8[i][0])) != RT_ERR_OK)
-                            return retVal;
+    return rtl8367c_setAsicReg(RTL8367C_REG_RMA_CTRL_CSSTP, regData);
+}
+/* Function Name:
+ *      rtl8367c_getAsicRmaCsstp
+ * Description:
+ *      Get CSSTP(Cisco Shared Spanning Tree Protocol) for CPU trapping
+ * Input:
+ *      None
+ * Output:
+ *      pRmacfg     - type of RMA for trapping frame type setting
+ * Return:
+ *      RT_ERR_OK         - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicRmaCsstp(rtl8367c_rma_t *pRmacfg)
+{
+    int32_t retVal;
+    uint32_t regData;
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData8[i][1])) != RT_ERR_OK)
-                            return retVal;
+    retVal = rtl8367c_getAsicReg(RTL8367C_REG_RMA_CTRL_CSSTP, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                }
-                else if (((regValue & 0x00F0) >> 4) == 0x0009)
-                {
-                    for (i = 0; i <= 8; i++)
-                    {
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData9[i][0])) != RT_ERR_OK)
-                            return retVal;
+    pRmacfg->operation = ((regData >> 7) & 0x0003);
+    pRmacfg->discard_storm_filter = ((regData >> 6) & 0x0001);
+    pRmacfg->trap_priority = ((regData >> 3) & 0x0007);
+    pRmacfg->keep_format = ((regData >> 2) & 0x0001);
+    pRmacfg->vlan_leaky = ((regData >> 1) & 0x0001);
+    pRmacfg->portiso_leaky = (regData & 0x0001);
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData9[i][1])) != RT_ERR_OK)
-                            return retVal;
+    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                            return retVal;
-                    }
-                }
-            }
-            else
-            {
-                for (i = 0; i <= 8; i++)
-                {
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redDataHB[i][0])) != RT_ERR_OK)
-                        return retVal;
+    pRmacfg->trap_priority = regData;
 
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redDataHB[i][1])) != RT_ERR_OK)
-                        return retVal;
+    return RT_ERR_OK;
+}
 
-                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                        return retVal;
-                }
-            }
-        }
+/* Function Name:
+ *      rtl8367c_setAsicRmaLldp
+ * Description:
+ *      Set LLDP for CPU trapping
+ * Input:
+ *      pRmacfg     - type of RMA for trapping frame type setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK         - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicRmaLldp(uint32_t enabled, rtl8367c_rma_t *pRmacfg)
+{
+    uint32_t regData = 0;
+    int32_t retVal;
 
-        /* Only one ext port should care SGMII setting */
-        if (id == 1)
-        {
+    if (enabled > 1)
+        return RT_ERR_ENABLE;
 
-            if (mode == EXT_SGMII)
-            {
-                if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, 1)) != RT_ERR_OK)
-                    return retVal;
+    if (pRmacfg->operation >= RMAOP_END)
+        return RT_ERR_RMA_ACTION;
 
-                if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_HSGMII)
-            {
-                if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, 0)) != RT_ERR_OK)
-                    return retVal;
+    if (pRmacfg->trap_priority > RTL8367C_PRIMAX)
+        return RT_ERR_QOS_INT_PRIORITY;
 
-                if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, 1)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else
-            {
+    retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_RMA_LLDP_EN, RTL8367C_RMA_LLDP_EN_OFFSET, enabled);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                if ((mode != EXT_1000X_100FX) && (mode != EXT_1000X) && (mode != EXT_100FX))
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, 0)) != RT_ERR_OK)
-                        return retVal;
+    regData |= (pRmacfg->portiso_leaky & 0x0001);
+    regData |= ((pRmacfg->vlan_leaky & 0x0001) << 1);
+    regData |= ((pRmacfg->keep_format & 0x0001) << 2);
+    regData |= ((pRmacfg->trap_priority & 0x0007) << 3);
+    regData |= ((pRmacfg->discard_storm_filter & 0x0001) << 6);
+    regData |= ((pRmacfg->operation & 0x0003) << 7);
 
-                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, 0)) != RT_ERR_OK)
-                        return retVal;
-                }
-            }
-        }
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, pRmacfg->trap_priority);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-        if (0 == id || 1 == id)
-        {
-            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_DIGITAL_INTERFACE_SELECT, RTL8367C_SELECT_GMII_0_MASK << (id * RTL8367C_SELECT_GMII_1_OFFSET), mode)) != RT_ERR_OK)
-                return retVal;
-        }
-        else
-        {
-            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_DIGITAL_INTERFACE_SELECT_1, RTL8367C_SELECT_GMII_2_MASK, mode)) != RT_ERR_OK)
-                return retVal;
-        }
+    return rtl8367c_setAsicReg(RTL8367C_REG_RMA_CTRL_LLDP, regData);
+}
+/* Function Name:
+ *      rtl8367c_getAsicRmaLldp
+ * Description:
+ *      Get LLDP for CPU trapping
+ * Input:
+ *      None
+ * Output:
+ *      pRmacfg     - type of RMA for trapping frame type setting
+ * Return:
+ *      RT_ERR_OK         - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_RMA_ADDR - Invalid RMA address index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicRmaLldp(uint32_t *pEnabled, rtl8367c_rma_t *pRmacfg)
+{
+    int32_t retVal;
+    uint32_t regData;
 
-        /* Serdes not reset */
-        if ((mode == EXT_SGMII) || (mode == EXT_HSGMII))
-        {
-            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x7106)) != RT_ERR_OK)
-                return retVal;
+    retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_RMA_LLDP_EN, RTL8367C_RMA_LLDP_EN_OFFSET, pEnabled);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0003)) != RT_ERR_OK)
-                return retVal;
+    retVal = rtl8367c_getAsicReg(RTL8367C_REG_RMA_CTRL_LLDP, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                return retVal;
-        }
+    pRmacfg->operation = ((regData >> 7) & 0x0003);
+    pRmacfg->discard_storm_filter = ((regData >> 6) & 0x0001);
+    pRmacfg->trap_priority = ((regData >> 3) & 0x0007);
+    pRmacfg->keep_format = ((regData >> 2) & 0x0001);
+    pRmacfg->vlan_leaky = ((regData >> 1) & 0x0001);
+    pRmacfg->portiso_leaky = (regData & 0x0001);
 
-        if ((mode == EXT_SGMII) || (mode == EXT_HSGMII))
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 1)) != RT_ERR_OK)
-                return retVal;
+    retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_RMA_CTRL00, RTL8367C_TRAP_PRIORITY_MASK, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_MISCELLANEOUS_CONFIGURE0, RTL8367C_DW8051_EN_OFFSET, 1)) != RT_ERR_OK)
-                return retVal;
+    pRmacfg->trap_priority = regData;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 1)) != RT_ERR_OK)
-                return retVal;
+    return RT_ERR_OK;
+}
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
-                return retVal;
+int32_t rtl8367::rtk_trap_rmaAction_set(rtk_trap_type_t type, rtk_trap_rma_action_t rma_action)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    rtl8367c_rma_t rmacfg;
+    uint32_t tmp;
 
-            for (idx = 0; idx < SGMII_INIT_SIZE; idx++)
-            {
-                if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Sgmii_Init[idx])) != RT_ERR_OK)
-                    return retVal;
-            }
+    if (type >= TRAP_END)
+        return RT_ERR_INPUT;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
-                return retVal;
+    if (rma_action >= RMA_ACTION_END)
+        return RT_ERR_RMA_ACTION;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 0)) != RT_ERR_OK)
-                return retVal;
+    if (type >= 0 && type <= TRAP_UNDEF_GARP_2F)
+    {
+        if ((retVal = rtl8367c_getAsicRma(type, &rmacfg)) != RT_ERR_OK)
+            return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 0)) != RT_ERR_OK)
-                return retVal;
-        }
+        rmacfg.operation = rma_action;
+
+        if ((retVal = rtl8367c_setAsicRma(type, &rmacfg)) != RT_ERR_OK)
+            return retVal;
     }
-    else if (2 == type)
+    else if (type == TRAP_CDP)
     {
-
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 1)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_getAsicRmaCdp(&rmacfg)) != RT_ERR_OK)
             return retVal;
 
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_MISCELLANEOUS_CONFIGURE0, RTL8367C_DW8051_EN_OFFSET, 1)) != RT_ERR_OK)
-            return retVal;
+        rmacfg.operation = rma_action;
 
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 1)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_setAsicRmaCdp(&rmacfg)) != RT_ERR_OK)
             return retVal;
-
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
+    }
+    else if (type == TRAP_CSSTP)
+    {
+        if ((retVal = rtl8367c_getAsicRmaCsstp(&rmacfg)) != RT_ERR_OK)
             return retVal;
 
-        for (idx = 0; idx < FIBER1_2_INIT_SIZE; idx++)
-        {
-            if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Fiber1_2_Init[idx])) != RT_ERR_OK)
-                return retVal;
-        }
+        rmacfg.operation = rma_action;
 
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_setAsicRmaCsstp(&rmacfg)) != RT_ERR_OK)
             return retVal;
-
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 0)) != RT_ERR_OK)
+    }
+    else if (type == TRAP_LLDP)
+    {
+        if ((retVal = rtl8367c_getAsicRmaLldp(&tmp, &rmacfg)) != RT_ERR_OK)
             return retVal;
 
-        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 0)) != RT_ERR_OK)
-            return retVal;
+        rmacfg.operation = rma_action;
 
-        if ((mode == EXT_TMII_MAC) || (mode == EXT_TMII_PHY))
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_BYPASS_LINE_RATE, id + 2, 1)) != RT_ERR_OK)
-                return retVal;
-        }
-        else
-        {
-            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_BYPASS_LINE_RATE, id + 2, 0)) != RT_ERR_OK)
-                return retVal;
-        }
+        if ((retVal = rtl8367c_setAsicRmaLldp(tmp, &rmacfg)) != RT_ERR_OK)
+            return retVal;
+    }
+    else
+        return RT_ERR_INPUT;
 
-        if (id == 1)
-        {
-            if (mode == EXT_HSGMII)
-                return RT_ERR_PORT_ID;
+    return RT_ERR_OK;
+}
 
-            if (mode == EXT_SGMII)
-            {
-
-                if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
-                    return retVal;
+int32_t rtl8367::rtk_trap_rmaAction_get(rtk_trap_type_t type, rtk_trap_rma_action_t *pRma_action)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    rtl8367c_rma_t rmacfg;
+    uint32_t tmp;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 14, 1)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_1000X || mode == EXT_100FX || mode == EXT_1000X_100FX)
-            {
+    if (type >= TRAP_END)
+        return RT_ERR_INPUT;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
-                    return retVal;
+    if (NULL == pRma_action)
+        return RT_ERR_NULL_POINTER;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 14, 0)) != RT_ERR_OK)
-                    return retVal;
+    if (type >= 0 && type <= TRAP_UNDEF_GARP_2F)
+    {
+        if ((retVal = rtl8367c_getAsicRma(type, &rmacfg)) != RT_ERR_OK)
+            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x6210, 11, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else
-            {
+        *pRma_action = (rtk_trap_rma_action_t)rmacfg.operation;
+    }
+    else if (type == TRAP_CDP)
+    {
+        if ((retVal = rtl8367c_getAsicRmaCdp(&rmacfg)) != RT_ERR_OK)
+            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, mode)) != RT_ERR_OK)
-                    return retVal;
+        *pRma_action = (rtk_trap_rma_action_t)rmacfg.operation;
+    }
+    else if (type == TRAP_CSSTP)
+    {
+        if ((retVal = rtl8367c_getAsicRmaCsstp(&rmacfg)) != RT_ERR_OK)
+            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 14, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
+        *pRma_action = (rtk_trap_rma_action_t)rmacfg.operation;
+    }
+    else if (type == TRAP_LLDP)
+    {
+        if ((retVal = rtl8367c_getAsicRmaLldp(&tmp, &rmacfg)) != RT_ERR_OK)
+            return retVal;
 
-            if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 0x1f)) != RT_ERR_OK)
-                return retVal;
-        }
-        else if (id == 2)
-        {
-            if (mode == EXT_HSGMII)
-            {
-                if ((retVal = rtl8367c_setAsicReg(0x130, 7)) != RT_ERR_OK)
-                    return retVal;
+        *pRma_action = (rtk_trap_rma_action_t)rmacfg.operation;
+    }
+    else
+        return RT_ERR_INPUT;
 
-                if ((retVal = rtl8367c_setAsicReg(0x39f, 7)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
 
-                if ((retVal = rtl8367c_setAsicReg(0x3fa, 7)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else
-            {
-                if ((retVal = rtl8367c_setAsicReg(0x130, 1)) != RT_ERR_OK)
-                    return retVal;
+// ----------------------------- STORM FILTERING CONTROL -----------------------------
 
-                if ((retVal = rtl8367c_setAsicReg(0x39f, 1)) != RT_ERR_OK)
-                    return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicStormFilterUnknownUnicastEnable
+ * Description:
+ *      Set per-port unknown unicast storm filter enable/disable
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      enabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicStormFilterUnknownUnicastEnable(uint32_t port, uint32_t enabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicReg(0x3fa, 4)) != RT_ERR_OK)
-                    return retVal;
-            }
+    return rtl8367c_setAsicRegBit(RTL8367C_STORM_UNKNOWN_UCAST_REG, port, enabled);
+}
 
-            if (mode == EXT_SGMII)
-            {
+/* Function Name:
+ *      rtl8367c_setAsicStormFilterUnknownMulticastEnable
+ * Description:
+ *      Set per-port unknown multicast storm filter enable/disable
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      enabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicStormFilterUnknownMulticastEnable(uint32_t port, uint32_t enabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_setAsicRegBit(RTL8367C_STORM_UNKNOWN_MCAST_REG, port, enabled);
+}
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 6, 1)) != RT_ERR_OK)
-                    return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicStormFilterMulticastEnable
+ * Description:
+ *      Set per-port multicast storm filter enable/disable
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      enabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicStormFilterMulticastEnable(uint32_t port, uint32_t enabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 7, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_HSGMII)
-            {
+    return rtl8367c_setAsicRegBit(RTL8367C_STORM_MCAST_REG, port, enabled);
+}
+/* Function Name:
+ *      rtl8367c_setAsicStormFilterBroadcastEnable
+ * Description:
+ *      Set per-port broadcast storm filter enable/disable
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      enabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicStormFilterBroadcastEnable(uint32_t port, uint32_t enabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_setAsicRegBit(RTL8367C_STORM_BCAST_REG, port, enabled);
+}
+int32_t rtl8367::rtk_rate_stormControlPortEnable_set(rtk_port_t port, rtk_rate_storm_group_t stormType, rtk_enable_t enable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 6, 0)) != RT_ERR_OK)
-                    return retVal;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 7, 1)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_1000X || mode == EXT_100FX || mode == EXT_1000X_100FX)
-            {
+    if (stormType >= STORM_GROUP_END)
+        return RT_ERR_SFC_UNKNOWN_GROUP;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
-                    return retVal;
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 6, 0)) != RT_ERR_OK)
-                    return retVal;
+    switch (stormType)
+    {
+    case STORM_GROUP_UNKNOWN_UNICAST:
+        if ((retVal = rtl8367c_setAsicStormFilterUnknownUnicastEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_UNKNOWN_MULTICAST:
+        if ((retVal = rtl8367c_setAsicStormFilterUnknownMulticastEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_MULTICAST:
+        if ((retVal = rtl8367c_setAsicStormFilterMulticastEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_BROADCAST:
+        if ((retVal = rtl8367c_setAsicStormFilterBroadcastEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
+            return retVal;
+        break;
+    default:
+        break;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 7, 0)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x6200, 11, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else
-            {
+/* Function Name:
+ *      rtl8367c_getAsicStormFilterUnknownUnicastEnable
+ * Description:
+ *      get per-port unknown unicast storm filter enable/disable
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pEnabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicStormFilterUnknownUnicastEnable(uint32_t port, uint32_t *pEnabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, mode)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_getAsicRegBit(RTL8367C_STORM_UNKNOWN_UCAST_REG, port, pEnabled);
+}
+/* Function Name:
+ *      rtl8367c_getAsicStormFilterUnknownMulticastEnable
+ * Description:
+ *      Get per-port unknown multicast storm filter enable/disable
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pEnabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicStormFilterUnknownMulticastEnable(uint32_t port, uint32_t *pEnabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 6, 0)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_getAsicRegBit(RTL8367C_STORM_UNKNOWN_MCAST_REG, port, pEnabled);
+}
+/* Function Name:
+ *      rtl8367c_getAsicStormFilterMulticastEnable
+ * Description:
+ *      Get per-port multicast storm filter enable/disable
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pEnabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicStormFilterMulticastEnable(uint32_t port, uint32_t *pEnabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 7, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
+    return rtl8367c_getAsicRegBit(RTL8367C_STORM_MCAST_REG, port, pEnabled);
+}
+/* Function Name:
+ *      rtl8367c_getAsicStormFilterBroadcastEnable
+ * Description:
+ *      Get per-port broadcast storm filter enable/disable
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pEnabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicStormFilterBroadcastEnable(uint32_t port, uint32_t *pEnabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-            if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 0x1f)) != RT_ERR_OK)
-                return retVal;
-        }
+    return rtl8367c_getAsicRegBit(RTL8367C_STORM_BCAST_REG, port, pEnabled);
+}
+int32_t rtl8367::rtk_rate_stormControlPortEnable_get(rtk_port_t port, rtk_rate_storm_group_t stormType, rtk_enable_t *pEnable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-        if (mode == EXT_RGMII)
-        {
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_PARA_LED_IO_EN3, 0)) != RT_ERR_OK)
-                return retVal;
+    if (stormType >= STORM_GROUP_END)
+        return RT_ERR_SFC_UNKNOWN_GROUP;
 
-            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_PARA_LED_IO_EN1, 0)) != RT_ERR_OK)
-                return retVal;
+    if (NULL == pEnable)
+        return RT_ERR_ENABLE;
 
-            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_PARA_LED_IO_EN2, 0)) != RT_ERR_OK)
-                return retVal;
+    switch (stormType)
+    {
+    case STORM_GROUP_UNKNOWN_UNICAST:
+        if ((retVal = rtl8367c_getAsicStormFilterUnknownUnicastEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_UNKNOWN_MULTICAST:
+        if ((retVal = rtl8367c_getAsicStormFilterUnknownMulticastEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_MULTICAST:
+        if ((retVal = rtl8367c_getAsicStormFilterMulticastEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_BROADCAST:
+        if ((retVal = rtl8367c_getAsicStormFilterBroadcastEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
+            return retVal;
+        break;
+    default:
+        break;
+    }
 
-            if (id == 1)
-            {
+    return RT_ERR_OK;
+}
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 9, 1)) != RT_ERR_OK)
-                    return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicStormFilterUnknownUnicastMeter
+ * Description:
+ *      Set per-port unknown unicast storm filter meter
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      meter   - meter index (0~31)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicStormFilterUnknownUnicastMeter(uint32_t port, uint32_t meter)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 6, 1)) != RT_ERR_OK)
-                    return retVal;
+    if (meter > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 4, 1)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_setAsicRegBits(RTL8367C_STORM_UNDA_METER_CTRL_REG(port), RTL8367C_STORM_UNDA_METER_CTRL_MASK(port), meter);
+}
+/* Function Name:
+ *      rtl8367c_setAsicStormFilterUnknownMulticastMeter
+ * Description:
+ *      Set per-port unknown multicast storm filter meter
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      meter   - meter index (0~31)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicStormFilterUnknownMulticastMeter(uint32_t port, uint32_t meter)
+{
+    int32_t retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 1, 0)) != RT_ERR_OK)
-                    return retVal;
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1307, 3, 1)) != RT_ERR_OK)
-                    return retVal;
+    if (meter > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13f9, 0x38, 0)) != RT_ERR_OK)
-                    return retVal;
+    if (port < 8)
+    {
+        retVal = rtl8367c_setAsicRegBits(RTL8367C_STORM_UNMC_METER_CTRL_REG(port), RTL8367C_STORM_UNMC_METER_CTRL_MASK(port), meter);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+    else
+    {
+        retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_STORM_UNMC_METER_CTRL4 + ((port - 8) >> 1), RTL8367C_STORM_UNMC_METER_CTRL_MASK(port), meter);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1307, 0x7, 0)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
+/* Function Name:
+ *      rtl8367c_setAsicStormFilterMulticastMeter
+ * Description:
+ *      Set per-port multicast storm filter meter
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      meter   - meter index (0~31)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicStormFilterMulticastMeter(uint32_t port, uint32_t meter)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1304, 0x7000, 4)) != RT_ERR_OK)
-                    return retVal;
+    if (meter > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13f9, 0x700, 4)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (id == 2)
-            {
+    return rtl8367c_setAsicRegBits(RTL8367C_STORM_MCAST_METER_CTRL_REG(port), RTL8367C_STORM_MCAST_METER_CTRL_MASK(port), meter);
+}
+/* Function Name:
+ *      rtl8367c_setAsicStormFilterBroadcastMeter
+ * Description:
+ *      Set per-port broadcast storm filter meter
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      meter   - meter index (0~31)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicStormFilterBroadcastMeter(uint32_t port, uint32_t meter)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 10, 1)) != RT_ERR_OK)
-                    return retVal;
+    if (meter > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-                /*drving 1*/
-                if ((retVal = rtl8367c_setAsicRegBit(0x13e2, 2, 1)) != RT_ERR_OK)
-                    return retVal;
-
-                /*drving 1*/
-                if ((retVal = rtl8367c_setAsicRegBit(0x13e2, 1, 1)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x13e2, 0, 0)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x13c5, 3, 1)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_setAsicRegBits(RTL8367C_STORM_BCAST_METER_CTRL_REG(port), RTL8367C_STORM_BCAST_METER_CTRL_MASK(port), meter);
+}
+int32_t rtl8367::rtk_rate_stormControlMeterIdx_set(rtk_port_t port, rtk_rate_storm_group_t stormType, uint32_t index)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13f9, 0x1c0, 0)) != RT_ERR_OK)
-                    return retVal;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c5, 0x7, 0)) != RT_ERR_OK)
-                    return retVal;
+    if (stormType >= STORM_GROUP_END)
+        return RT_ERR_SFC_UNKNOWN_GROUP;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13e2, 0x1c0, 4)) != RT_ERR_OK)
-                    return retVal;
+    if (index > halCtrl.max_meter_id)
+        return RT_ERR_FILTER_METER_ID;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13e2, 0x38, 4)) != RT_ERR_OK)
-                    return retVal;
-            }
-        }
-        else if (mode == EXT_SGMII)
-        {
-            if (id == 1)
-            {
-                /*sds 1     reg 1    page 0x21     write value  0xec91*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0xec91)) != RT_ERR_OK)
-                    return retVal;
+    switch (stormType)
+    {
+    case STORM_GROUP_UNKNOWN_UNICAST:
+        if ((retVal = rtl8367c_setAsicStormFilterUnknownUnicastMeter(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_UNKNOWN_MULTICAST:
+        if ((retVal = rtl8367c_setAsicStormFilterUnknownMulticastMeter(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_MULTICAST:
+        if ((retVal = rtl8367c_setAsicStormFilterMulticastMeter(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_BROADCAST:
+        if ((retVal = rtl8367c_setAsicStormFilterBroadcastMeter(rtk_switch_port_L2P_get(port), index)) != RT_ERR_OK)
+            return retVal;
+        break;
+    default:
+        break;
+    }
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x21 << 5) | 1)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C1)) != RT_ERR_OK)
-                    return retVal;
+/* Function Name:
+ *      rtl8367c_getAsicStormFilterUnknownUnicastMeter
+ * Description:
+ *      Get per-port unknown unicast storm filter meter
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pMeter  - meter index (0~31)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicStormFilterUnknownUnicastMeter(uint32_t port, uint32_t *pMeter)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                /*sds 1     reg 5    page 0x24     write value  0x5825*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x5825)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_getAsicRegBits(RTL8367C_STORM_UNDA_METER_CTRL_REG(port), RTL8367C_STORM_UNDA_METER_CTRL_MASK(port), pMeter);
+}
+/* Function Name:
+ *      rtl8367c_getAsicStormFilterUnknownMulticastMeter
+ * Description:
+ *      Get per-port unknown multicast storm filter meter
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pMeter  - meter index (0~31)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicStormFilterUnknownMulticastMeter(uint32_t port, uint32_t *pMeter)
+{
+    int32_t retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x24 << 5) | 5)) != RT_ERR_OK)
-                    return retVal;
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C1)) != RT_ERR_OK)
-                    return retVal;
+    if (port < 8)
+    {
+        retVal = rtl8367c_getAsicRegBits(RTL8367C_STORM_UNMC_METER_CTRL_REG(port), RTL8367C_STORM_UNMC_METER_CTRL_MASK(port), pMeter);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+    else
+    {
+        retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_STORM_UNMC_METER_CTRL4 + ((port - 8) >> 1), RTL8367C_STORM_UNMC_METER_CTRL_MASK(port), pMeter);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 2)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
+/* Function Name:
+ *      rtl8367c_getAsicStormFilterMulticastMeter
+ * Description:
+ *      Get per-port multicast storm filter meter
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pMeter  - meter index (0~31)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicStormFilterMulticastMeter(uint32_t port, uint32_t *pMeter)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                /*?????????????????*/
-            }
-            else if (id == 2)
-            {
-                /*sds 0     reg 0    page 0x28     write value  0x942c*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x942c)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_getAsicRegBits(RTL8367C_STORM_MCAST_METER_CTRL_REG(port), RTL8367C_STORM_MCAST_METER_CTRL_MASK(port), pMeter);
+}
+/* Function Name:
+ *      rtl8367c_getAsicStormFilterBroadcastMeter
+ * Description:
+ *      Get per-port broadcast storm filter meter
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pMeter  - meter index (0~31)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicStormFilterBroadcastMeter(uint32_t port, uint32_t *pMeter)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x28 << 5) | 0)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_getAsicRegBits(RTL8367C_STORM_BCAST_METER_CTRL_REG(port), RTL8367C_STORM_BCAST_METER_CTRL_MASK(port), pMeter);
+}
+int32_t rtl8367::rtk_rate_stormControlMeterIdx_get(rtk_port_t port, rtk_rate_storm_group_t stormType, uint32_t *pIndex)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                    return retVal;
+    if (stormType >= STORM_GROUP_END)
+        return RT_ERR_SFC_UNKNOWN_GROUP;
 
-                /*sds 0     reg 0    page 0x24     write value  0x942c*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x942c)) != RT_ERR_OK)
-                    return retVal;
+    if (NULL == pIndex)
+        return RT_ERR_NULL_POINTER;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x24 << 5) | 0)) != RT_ERR_OK)
-                    return retVal;
+    switch (stormType)
+    {
+    case STORM_GROUP_UNKNOWN_UNICAST:
+        if ((retVal = rtl8367c_getAsicStormFilterUnknownUnicastMeter(rtk_switch_port_L2P_get(port), pIndex)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_UNKNOWN_MULTICAST:
+        if ((retVal = rtl8367c_getAsicStormFilterUnknownMulticastMeter(rtk_switch_port_L2P_get(port), pIndex)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_MULTICAST:
+        if ((retVal = rtl8367c_getAsicStormFilterMulticastMeter(rtk_switch_port_L2P_get(port), pIndex)) != RT_ERR_OK)
+            return retVal;
+        break;
+    case STORM_GROUP_BROADCAST:
+        if ((retVal = rtl8367c_getAsicStormFilterBroadcastMeter(rtk_switch_port_L2P_get(port), pIndex)) != RT_ERR_OK)
+            return retVal;
+        break;
+    default:
+        break;
+    }
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
 
-                /*sds 0     reg 5    page 0x21     write value  0x8dc3*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x8dc3)) != RT_ERR_OK)
-                    return retVal;
+// --------------------------- PORT MIRROR ------------------------------------
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x21 << 5) | 5)) != RT_ERR_OK)
-                    return retVal;
+/* Function Name:
+ *      rtk_switch_maxLogicalPort_get
+ * Description:
+ *      Get Max logical port ID
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      Max logical port
+ * Note:
+ *      This API can get max logical port
+ */
+rtk_port_t rtl8367::rtk_switch_maxLogicalPort_get()
+{
+    rtk_port_t port, maxLogicalPort = UTP_PORT0;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                    return retVal;
+    for (uint8_t port1 = 0; port1 < RTK_SWITCH_PORT_NUM; port1++)
+    {
+        if ((halCtrl.log_port_type[port] == UTP_PORT) || (halCtrl.log_port_type[port] == EXT_PORT))
+            maxLogicalPort = port;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 2)) != RT_ERR_OK)
-                    return retVal;
-
-                /*?????????????????*/
-            }
-        }
-        else if (mode == EXT_HSGMII)
-        {
-            if (id == 2)
-            {
-                /*sds 0     reg 0    page 0x28     write value  0x942c*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x942c)) != RT_ERR_OK)
-                    return retVal;
+    return maxLogicalPort;
+}
+/* Function Name:
+ *      rtl8367c_setAsicPortMirror
+ * Description:
+ *      Set port mirror function
+ * Input:
+ *      source  - Source port
+ *      monitor - Monitor (destination) port
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicPortMirror(uint32_t source, uint32_t monitor)
+{
+    int32_t retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x28 << 5) | 0)) != RT_ERR_OK)
-                    return retVal;
+    if ((source > RTL8367C_PORTIDMAX) || (monitor > RTL8367C_PORTIDMAX))
+        return RT_ERR_PORT_ID;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                    return retVal;
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_MIRROR_CTRL_REG, RTL8367C_MIRROR_SOURCE_PORT_MASK, source);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-                /*sds 0     reg 0    page 0x24     write value  0x942c*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x942c)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_setAsicRegBits(RTL8367C_MIRROR_CTRL_REG, RTL8367C_MIRROR_MONITOR_PORT_MASK, monitor);
+}
+/* Function Name:
+ *      rtl8367c_setAsicPortMirrorMask
+ * Description:
+ *      Set mirror source port mask
+ * Input:
+ *      SourcePortmask  - Source Portmask
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_MASK- Port Mask Error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicPortMirrorMask(uint32_t SourcePortmask)
+{
+    if (SourcePortmask > RTL8367C_PORTMASK)
+        return RT_ERR_PORT_MASK;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x24 << 5) | 0)) != RT_ERR_OK)
-                    return retVal;
+    return rtl8367c_setAsicRegBits(RTL8367C_REG_MIRROR_SRC_PMSK, RTL8367C_MIRROR_SRC_PMSK_MASK, SourcePortmask);
+}
+/* Function Name:
+ *      rtl8367c_setAsicPortMirrorRxFunction
+ * Description:
+ *      Set the mirror function on RX of the mirrored
+ * Input:
+ *      enabled     - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicPortMirrorRxFunction(uint32_t enabled)
+{
+    return rtl8367c_setAsicRegBit(RTL8367C_MIRROR_CTRL_REG, RTL8367C_MIRROR_RX_OFFSET, enabled);
+}
+/* Function Name:
+ *      rtl8367c_setAsicPortMirrorTxFunction
+ * Description:
+ *      Set the mirror function on TX of the mirrored
+ * Input:
+ *      enabled     - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicPortMirrorTxFunction(uint32_t enabled)
+{
+    return rtl8367c_setAsicRegBit(RTL8367C_MIRROR_CTRL_REG, RTL8367C_MIRROR_TX_OFFSET, enabled);
+}
+int32_t rtl8367::rtk_mirror_portBased_set(rtk_port_t mirroring_port, rtk_portmask_t *pMirrored_rx_portmask, rtk_portmask_t *pMirrored_tx_portmask)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    rtk_enable_t mirRx, mirTx;
+    uint32_t i, pmask;
+    uint32_t source_port;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                    return retVal;
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(mirroring_port);
 
-                /*sds 0     reg 5    page 0x21     write value  0x8dc3*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x8dc3)) != RT_ERR_OK)
-                    return retVal;
+    if (NULL == pMirrored_rx_portmask)
+        return RT_ERR_NULL_POINTER;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x21 << 5) | 5)) != RT_ERR_OK)
-                    return retVal;
+    if (NULL == pMirrored_tx_portmask)
+        return RT_ERR_NULL_POINTER;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                    return retVal;
+    RTK_CHK_PORTMASK_VALID(pMirrored_rx_portmask);
 
-                /* optimizing HISGMII performance while RGMII used & */
-                /*sds 0     reg 9     page 0x21     write value 0x3931*/
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x3931)) != RT_ERR_OK)
-                    return retVal;
+    RTK_CHK_PORTMASK_VALID(pMirrored_tx_portmask);
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x21 << 5) | 9)) != RT_ERR_OK)
-                    return retVal;
+    /*Mirror Sorce Port Mask Check*/
+    if (pMirrored_tx_portmask->bits[0] != pMirrored_rx_portmask->bits[0] && pMirrored_tx_portmask->bits[0] != 0 && pMirrored_rx_portmask->bits[0] != 0)
+        return RT_ERR_PORT_MASK;
 
-                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
-                    return retVal;
+    /*mirror port != source port*/
+    if (RTK_PORTMASK_IS_PORT_SET((*pMirrored_tx_portmask), mirroring_port) || RTK_PORTMASK_IS_PORT_SET((*pMirrored_rx_portmask), mirroring_port))
+        return RT_ERR_PORT_MASK;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 0x12)) != RT_ERR_OK)
-                    return retVal;
+    source_port = rtk_switch_maxLogicalPort_get();
 
-                /*?????????????????*/
-            }
-        }
-        else if (mode == EXT_1000X)
+    RTK_SCAN_ALL_LOG_PORT(i)
+    {
+        if (pMirrored_tx_portmask->bits[0] & (1 << i))
         {
-            if (id == 1)
-            {
+            source_port = i;
+            break;
+        }
 
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 1, 0x21, 0xec91)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 5, 0x24, 0x5825)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 4)) != RT_ERR_OK)
-                    return retVal;
+        if (pMirrored_rx_portmask->bits[0] & (1 << i))
+        {
+            source_port = i;
+            break;
+        }
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicPortMirror(rtk_switch_port_L2P_get(source_port), rtk_switch_port_L2P_get(mirroring_port))) != RT_ERR_OK)
+        return retVal;
+    if (pMirrored_rx_portmask->bits[0] != 0)
+    {
+        if ((retVal = rtk_switch_portmask_L2P_get(pMirrored_rx_portmask, &pmask)) != RT_ERR_OK)
+            return retVal;
+        if ((retVal = rtl8367c_setAsicPortMirrorMask(pmask)) != RT_ERR_OK)
+            return retVal;
+    }
+    else
+    {
+        if ((retVal = rtk_switch_portmask_L2P_get(pMirrored_tx_portmask, &pmask)) != RT_ERR_OK)
+            return retVal;
+        if ((retVal = rtl8367c_setAsicPortMirrorMask(pmask)) != RT_ERR_OK)
+            return retVal;
+    }
 
-                /*patch speed change sds1 1000M*/
-                if ((retVal = rtl8367c_getAsicSdsReg(1, 4, 0, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFF0FFF;
-                regValue |= 0x9000;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 4, 0, regValue)) != RT_ERR_OK)
-                    return retVal;
+    if (pMirrored_rx_portmask->bits[0])
+        mirRx = ENABLED;
+    else
+        mirRx = DISABLED_RTK;
 
-                if ((retVal = rtl8367c_getAsicSdsReg(1, 0, 2, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFFdFFF;
-                regValue |= 0x40;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 0, 2, regValue)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicPortMirrorRxFunction(mirRx)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_getAsicSdsReg(1, 4, 0, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFFEFFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 4, 0, regValue)) != RT_ERR_OK)
-                    return retVal;
+    if (pMirrored_tx_portmask->bits[0])
+        mirTx = ENABLED;
+    else
+        mirTx = DISABLED_RTK;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 4)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x6000, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (id == 2)
-            {
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x28, 0x942c)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x24, 0x942c)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 5, 0x21, 0x8dc3)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicPortMirrorTxFunction(mirTx)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 4)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
 
-                /*patch speed change sds0 1000M*/
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 0x1f)) != RT_ERR_OK)
-                    return retVal;
+// ---------------------------- FORCE EXTERNAL INTERFACE ----------------------------
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFF0FFF;
-                regValue |= 0x9000;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, regValue)) != RT_ERR_OK)
-                    return retVal;
+int32_t rtl8367::rtk_switch_isExtPort(rtk_port_t logicalPort)
+{
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFFDFFF;
-                regValue |= 0x40;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, regValue)) != RT_ERR_OK)
-                    return retVal;
+    if (logicalPort >= RTK_SWITCH_PORT_NUM)
+        return RT_ERR_FAILED;
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFFEFFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, regValue)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 4)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0xe0, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-        }
-        else if (mode == EXT_100FX)
-        {
-            if (id == 1)
-            {
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 1, 0x21, 0xec91)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 5, 0x24, 0x5825)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 5)) != RT_ERR_OK)
-                    return retVal;
+    if (halCtrl.log_port_type[logicalPort] == EXT_PORT)
+        return RT_ERR_OK;
+    else
+        return RT_ERR_FAILED;
+}
 
-                /*patch speed change sds1 100M*/
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_getAsicSdsReg(1, 4, 0, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFF0FFF;
-                regValue |= 0xb000;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 4, 0, regValue)) != RT_ERR_OK)
-                    return retVal;
+/* Function Name:
+ *      rtk_switch_isHsgPort
+ * Description:
+ *      Check is logical port a HSG port
+ * Input:
+ *      logicalPort     - logical port ID
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Port ID is a HSG port
+ *      RT_ERR_FAILED   - Port ID is not a HSG port
+ *      RT_ERR_NOT_INIT - Not Initialize
+ * Note:
+ *
+ */
+int32_t rtl8367::rtk_switch_isHsgPort(rtk_port_t logicalPort)
+{
 
-                if ((retVal = rtl8367c_getAsicSdsReg(1, 0, 2, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFFFFBF;
-                regValue |= 0x2000;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 0, 2, regValue)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_getAsicSdsReg(1, 4, 0, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFFEFFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 4, 0, regValue)) != RT_ERR_OK)
-                    return retVal;
+    if (logicalPort >= RTK_SWITCH_PORT_NUM)
+        return RT_ERR_FAILED;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 5)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x6000, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (id == 2)
-            {
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x28, 0x942c)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x24, 0x942c)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 5, 0x21, 0x8dc3)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 5)) != RT_ERR_OK)
-                    return retVal;
+    if (logicalPort == halCtrl.hsg_logical_port)
+        return RT_ERR_OK;
+    else
+        return RT_ERR_FAILED;
+}
 
-                /*patch speed change sds0 100M*/
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 0x1f)) != RT_ERR_OK)
-                    return retVal;
+/* Function Name:
+ *      rtl8367c_getAiscSdsReg
+ * Description:
+ *      Get Serdes registers
+ * Input:
+ *      sdsId   - sdsid (0~1)
+ *      sdsReg - reg address (0~31)
+ *      sdsPage - Writing data
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFF0FFF;
-                regValue |= 0xb000;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, regValue)) != RT_ERR_OK)
-                    return retVal;
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicSdsReg(uint32_t sdsId, uint32_t sdsReg, uint32_t sdsPage, uint32_t *value)
+{
+    uint32_t retVal, busy;
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFFFFBF;
-                regValue |= 0x2000;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, regValue)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (sdsPage << 5) | sdsReg)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue &= 0xFFFFEFFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, regValue)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x0080 | sdsId)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 5)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0xe0, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-        }
-        else if (mode == EXT_1000X_100FX)
-        {
-            if (id == 1)
-            {
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 1, 0x21, 0xec91)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 5, 0x24, 0x5825)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 13, 0, 0x4616)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(1, 1, 0, 0xf20)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 7)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (id == 2)
-            {
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x28, 0x942c)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x24, 0x942c)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 5, 0x21, 0x8dc3)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 13, 0, 0x4616)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 1, 0, 0xf20)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 7)) != RT_ERR_OK)
-                    return retVal;
-            }
-        }
-    }
-    else if (3 == type)
+    while (1)
     {
-
-        /*restore patch, by designer. patch Tx FIFO issue, when not HSGMII 2.5G mode
-         #sds0, page 1, reg 1, bit4=0*/
-        if ((retVal = rtl8367c_getAsicSdsReg(0, 1, 1, &regValue)) != RT_ERR_OK)
-            return retVal;
-        regValue &= 0xFFFFFFEF;
-        if ((retVal = rtl8367c_setAsicSdsReg(0, 1, 1, regValue)) != RT_ERR_OK)
+        if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_SDS_INDACS_CMD, &busy)) != RT_ERR_OK)
             return retVal;
 
-        /*set for mac 6*/
-        if (1 == id)
-        {
-
-            if ((retVal = rtl8367c_setAsicReg(0x137c, 0x1000)) != RT_ERR_OK)
-                return retVal;
-
-            if ((retVal = rtl8367c_getAsicRegBit(0x1d9d, 6, &reg_data)) != RT_ERR_OK)
-                return retVal;
-            while (reg_data == 0)
-            {
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d9d, 6, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-            }
-
-            if (mode == EXT_SGMII)
-            {
-
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                if (reg_data == 0)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
-                        return retVal;
-                }
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
-                    return retVal;
+        if ((busy & 0x100) == 0)
+            break;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 1, 0)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_SDS_INDACS_DATA, value)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 0, 0)) != RT_ERR_OK)
-                    return retVal;
+    return RT_ERR_OK;
+}
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 9, 0)) != RT_ERR_OK)
-                    return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicSdsReg
+ * Description:
+ *      Set Serdes registers
+ * Input:
+ *      sdsId   - sdsid (0~1)
+ *      sdsReg - reg address (0~31)
+ *      sdsPage - Writing data
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
-                    return retVal;
+ * Note:
+ *      None
+ */
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                    return retVal;
+int32_t rtl8367::rtl8367c_setAsicSdsReg(uint32_t sdsId, uint32_t sdsReg, uint32_t sdsPage, uint32_t value)
+{
+    uint32_t retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, value)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (sdsPage << 5) | sdsReg)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x2)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0 | sdsId)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 2, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_HSGMII)
-            {
+    return RT_ERR_OK;
+}
+/* Function Name:
+ *      rtl8367c_setAsicPortForceLinkExt
+ * Description:
+ *      Set external interface force linking configuration
+ * Input:
+ *      id          - external interface id (0~2)
+ *      portAbility - port ability configuration
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicPortForceLinkExt(uint32_t id, rtl8367c_port_ability_t *pPortAbility)
+{
+    uint32_t retVal, regValue, regValue2, type, sgmiibit, hisgmiibit;
+    uint32_t reg_data = 0;
+    uint32_t i = 0;
 
-                /*restore patch, by designer. patch Tx FIFO issue, when  HSGMII 2.5G mode
-                 #sds0, page 1, reg 1, bit4=1*/
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 1, 1, &regValue)) != RT_ERR_OK)
-                    return retVal;
-                regValue |= 0x10;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 1, 1, regValue)) != RT_ERR_OK)
-                    return retVal;
+    /* Invalid input parameter */
+    if (id >= RTL8367C_EXTNO)
+        return RT_ERR_OUT_OF_RANGE;
 
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                if (reg_data == 0)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
-                        return retVal;
-                }
+    reg_data |= pPortAbility->forcemode << 12;
+    reg_data |= pPortAbility->mstfault << 9;
+    reg_data |= pPortAbility->mstmode << 8;
+    reg_data |= pPortAbility->nway << 7;
+    reg_data |= pPortAbility->txpause << 6;
+    reg_data |= pPortAbility->rxpause << 5;
+    reg_data |= pPortAbility->link << 4;
+    reg_data |= pPortAbility->duplex << 2;
+    reg_data |= pPortAbility->speed;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
+        return retVal;
+    /*get chip ID */
+    if ((retVal = rtl8367c_getAsicReg(0x1300, &regValue)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
-                    return retVal;
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
+        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 1, 0)) != RT_ERR_OK)
-                    return retVal;
+    type = 0;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 0, 0)) != RT_ERR_OK)
-                    return retVal;
+    switch (regValue)
+    {
+    case 0x0276:
+    case 0x0597:
+    case 0x6367:
+        type = 1;
+        break;
+    case 0x0652:
+    case 0x6368:
+        type = 2;
+        break;
+    case 0x0801:
+    case 0x6511:
+        type = 3;
+        break;
+    default:
+        return RT_ERR_FAILED;
+    }
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 9, 0)) != RT_ERR_OK)
-                    return retVal;
+    if (1 == type)
+    {
+        if (1 == id)
+        {
+            if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_REG_TO_ECO4, &regValue)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 1)) != RT_ERR_OK)
-                    return retVal;
+            if ((regValue & (0x0001 << 5)) && (regValue & (0x0001 << 7)))
+            {
+                return RT_ERR_OK;
+            }
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 0)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0xd0, 7)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicReg(0x399, 7)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicReg(0x3fa, 7)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x12)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 2, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_1000X)
-            {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
+                return retVal;
+        }
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                reg_data &= 0xFFFFFCFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
-                    return retVal;
+        if (0 == id || 1 == id)
+            return rtl8367c_setAsicReg(RTL8367C_REG_DIGITAL_INTERFACE0_FORCE + id, reg_data);
+        else
+            return rtl8367c_setAsicReg(RTL8367C_REG_DIGITAL_INTERFACE2_FORCE, reg_data);
+    }
+    else if (2 == type)
+    {
+        if (1 == id)
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 2, pPortAbility->duplex)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                if (reg_data == 0)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
-                        return retVal;
-                }
+            if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, pPortAbility->speed)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, pPortAbility->link)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 6, pPortAbility->txpause)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 5, pPortAbility->rxpause)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x13eb, 0x15bb)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x1311, 12, pPortAbility->forcemode)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x13e7, 0xc)) != RT_ERR_OK)
+            if (pPortAbility->link == 1)
+            {
+                if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 0)) != RT_ERR_OK)
                     return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 1)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 1)) != RT_ERR_OK)
                     return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 1)) != RT_ERR_OK)
+            }
+            else
+            {
+                if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, 2)) != RT_ERR_OK)
                     return retVal;
+            }
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x4)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_100FX)
-            {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                reg_data &= 0xFFFFFCFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                if (reg_data == 0)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
-                        return retVal;
-                }
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
+                return retVal;
+        }
+        else if (2 == id)
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 2, pPortAbility->duplex)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBits(0x13c4, 0x3, pPortAbility->speed)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, pPortAbility->link)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 6, pPortAbility->txpause)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x13eb, 0x15bb)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 5, pPortAbility->rxpause)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x13e7, 0xc)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 12, pPortAbility->forcemode)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 1)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 1)) != RT_ERR_OK)
+            if (pPortAbility->link == 1)
+            {
+                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, 0)) != RT_ERR_OK)
                     return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x5)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, 1)) != RT_ERR_OK)
                     return retVal;
             }
-            else if (mode == EXT_1000X_100FX)
+            else
             {
-                /* 0 2 0  bit 8~9  set 0, force n-way*/
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                reg_data &= 0xFFFFFCFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                if (reg_data == 0)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
-                        return retVal;
-                }
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicReg(0x13eb, 0x15bb)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicReg(0x13e7, 0xc)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 1)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 1)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x7)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c4, 0x3, 2)) != RT_ERR_OK)
                     return retVal;
             }
-            else if (mode < EXT_SGMII)
-            {
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d3d, 10, 0)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
-                    return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 0)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(0x1dc1, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
+                return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
-                    return retVal;
+            if ((retVal = rtl8367c_setAsicRegBits(0x1dc1, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
+                return retVal;
 
-                if (mode < EXT_GMII)
-                {
-                    /* set mac6 mode*/
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, mode)) != RT_ERR_OK)
-                        return retVal;
-                }
-                else if (mode == EXT_RMII_MAC)
-                {
+            if ((retVal = rtl8367c_setAsicRegBit(0x1dc1, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
+                return retVal;
 
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 7)) != RT_ERR_OK)
-                        return retVal;
-                }
-                else if (mode == EXT_RMII_PHY)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 8)) != RT_ERR_OK)
-                        return retVal;
-                }
+            if ((retVal = rtl8367c_setAsicRegBit(0x1dc1, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
+                return retVal;
 
-                if ((mode == EXT_TMII_MAC) || (mode == EXT_TMII_PHY))
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 1)) != RT_ERR_OK)
-                        return retVal;
-                }
-            }
+            if ((retVal = rtl8367c_setAsicRegBit(0x1dc1, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
+                return retVal;
         }
-        else if (2 == id)
+    }
+    else if (3 == type)
+    {
+        if (1 == id)
         {
-
-            /*force port7 linkdown*/
-            if ((retVal = rtl8367c_setAsicReg(0x137d, 0x1000)) != RT_ERR_OK)
+            if ((retVal = rtl8367c_getAsicRegBit(0x1d11, 6, &sgmiibit)) != RT_ERR_OK)
                 return retVal;
-
-            if ((retVal = rtl8367c_getAsicRegBit(0x1d9d, 7, &reg_data)) != RT_ERR_OK)
+            if ((retVal = rtl8367c_getAsicRegBit(0x1d11, 11, &hisgmiibit)) != RT_ERR_OK)
                 return retVal;
-            while (reg_data == 0)
-            {
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d9d, 7, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-            }
 
-            if (mode == EXT_SGMII)
+            if ((sgmiibit == 1) || (hisgmiibit == 1))
             {
-
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
-                    return retVal;
-
-                if ((retVal = rtl8367c_setAsicReg(0x13c4, 0)) != RT_ERR_OK)
+                /*for 1000x/100fx/1000x_100fx, param has to be set to serdes registers*/
+                if ((retVal = rtl8367c_getAsicReg(0x1d41, &regValue)) != RT_ERR_OK)
                     return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
-                    return retVal;
+                if ((regValue & 0xa0) == 0xa0)
+                {
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_getAsicRegBits(0x1d95, 0x1f00, &regValue2)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
-                    return retVal;
+                    /*1000X*/
+                    if (regValue2 == 0x4)
+                    {
+                        /* Enable new sds mode config */
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 0  bit 12  set 1,  bit15~13 = 4*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFF0FFF;
+                        reg_data |= 0x9000;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 0 2  bit 6  set 1,  bit13 set to 0, bit12 nway_en*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFDFFF;
+                        reg_data |= 0x40;
+                        if (pPortAbility->forcemode)
+                            reg_data &= 0xffffefff;
+                        else
+                            reg_data |= 0x1000;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                    return retVal;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 0, 1)) != RT_ERR_OK)
-                    return retVal;
+                        if (pPortAbility->txpause)
+                            reg_data |= 0x80;
+                        else
+                            reg_data &= (~0x80);
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x2)) != RT_ERR_OK)
-                    return retVal;
+                        if (pPortAbility->rxpause)
+                            reg_data |= 0x100;
+                        else
+                            reg_data &= (~0x100);
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 2, 0)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_1000X)
-            {
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 0  bit 12  set 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFEFFF;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x13c4, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /*new_cfg_sds_mode=1000x*/
+                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x4)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                    else if (regValue2 == 0x5)
+                    {
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                reg_data &= 0xFFFFFCFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
-                    return retVal;
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 0  bit 12  set 1,  bit15~13 = 5*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFF0FFF;
+                        reg_data |= 0xB000;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 0 2  bit 6  set 0,  bit13 set to 1, bit12 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFFFBF;
+                        reg_data |= 0x2000;
+                        reg_data &= 0xffffefff;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                    return retVal;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        if (pPortAbility->txpause)
+                            reg_data |= 0x80;
+                        else
+                            reg_data &= (~0x80);
+                        if (pPortAbility->rxpause)
+                            reg_data |= 0x100;
+                        else
+                            reg_data &= (~0x100);
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 0  bit 12  set 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFEFFF;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        /* new_cfg_sds_mode=1000x */
+                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x5)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                    else if (regValue2 == 0x7)
+                    {
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 3)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 0  bit 12  set 1,  bit15~13 = 4*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFF0FFF;
+                        reg_data |= 0x9000;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x4)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_100FX)
-            {
+                        /* 0 0 2  bit 6  set 1,  bit13 set to 0, bit12 nway_en*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFDFFF;
+                        reg_data |= 0x40;
+                        if (pPortAbility->forcemode)
+                            reg_data &= 0xffffefff;
+                        else
+                            reg_data |= 0x1000;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
-                    return retVal;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x13c4, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        if (pPortAbility->txpause)
+                            reg_data |= 0x80;
+                        else
+                            reg_data &= (~0x80);
+                        if (pPortAbility->rxpause)
+                            reg_data |= 0x100;
+                        else
+                            reg_data &= (~0x100);
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                reg_data &= 0xFFFFFCFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 0  bit 12  set 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFEFFF;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 0  bit 12  set 1,  bit15~13 = 5*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFF0FFF;
+                        reg_data |= 0xB000;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 0 2  bit 6  set 0,  bit13 set to 1, bit12 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFFFBF;
+                        reg_data |= 0x2000;
+                        reg_data &= 0xffffefff;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                    return retVal;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        if (pPortAbility->txpause)
+                            reg_data |= 0x80;
+                        else
+                            reg_data &= 0xffffff7f;
+                        if (pPortAbility->rxpause)
+                            reg_data |= 0x100;
+                        else
+                            reg_data &= 0xfffffeff;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 0  bit 12  set 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFEFFF;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        /*sds_mode:*/
+                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x7)) != RT_ERR_OK)
+                            return retVal;
+                    }
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 3)) != RT_ERR_OK)
-                    return retVal;
+                    /*disable force ability   ---      */
+                    if ((retVal = rtl8367c_setAsicRegBit(0x137c, 12, 0)) != RT_ERR_OK)
+                        return retVal;
+                    return RT_ERR_OK;
+                }
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x5)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode == EXT_1000X_100FX)
-            {
-                /*  disable mac7 MII/TMM/RMII/GMII/RGMII mode, mode_ext2 = disable  */
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
+                /* new_cfg_sds_mode */
+                if ((retVal = rtl8367c_getAsicRegBits(0x1d95, 0x1f00, &regValue2)) != RT_ERR_OK)
                     return retVal;
+                if (regValue2 == 0x2)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicReg(0x13c4, 0)) != RT_ERR_OK)
-                    return retVal;
+                    for (i = 0; i < 0xfff; i++)
+                        ;
 
-                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                reg_data &= 0xFFFFFCFF;
-                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x2)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
-                    return retVal;
+                    for (i = 0; i < 0xfff; i++)
+                        ;
 
-                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
-                    return retVal;
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 3)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x7)) != RT_ERR_OK)
-                    return retVal;
-            }
-            else if (mode < EXT_SGMII)
-            {
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d3d, 10, 0)) != RT_ERR_OK)
-                    return retVal;
+                    /*disable force ability   ---      */
+                    if ((retVal = rtl8367c_setAsicRegBit(0x137c, 12, 0)) != RT_ERR_OK)
+                        return retVal;
+                    return RT_ERR_OK;
+                }
+                else if (regValue2 == 0x12)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
-                    return retVal;
+                    for (i = 0; i < 0xfff; i++)
+                        ;
 
-                if ((retVal = rtl8367c_setAsicReg(0x1d95, 0x1f00)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x12)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
-                    return retVal;
+                    for (i = 0; i < 0xfff; i++)
+                        ;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, mode)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0x1)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((mode == EXT_TMII_MAC) || (mode == EXT_TMII_PHY))
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 1)) != RT_ERR_OK)
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
                         return retVal;
-                }
-            }
-            else if ((mode < EXT_END) && (mode > EXT_100FX))
-            {
-                if ((retVal = rtl8367c_setAsicRegBits(0x13C3, 0xf, 0)) != RT_ERR_OK)
-                    return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_setAsicRegBit(0x1d3d, 10, 1)) != RT_ERR_OK)
-                    return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_getAsicRegBit(0x1d11, 11, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-                if (reg_data == 0)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
                         return retVal;
-                }
 
-                if (mode < EXT_RMII_MAC_2)
-                {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, (mode - 13))) != RT_ERR_OK)
+                    /*disable force ability   ---      */
+                    if ((retVal = rtl8367c_setAsicRegBit(0x137c, 12, 0)) != RT_ERR_OK)
                         return retVal;
+                    return RT_ERR_OK;
                 }
-                else
+            }
+            else
+            {
+                if ((retVal = rtl8367c_getAsicRegBits(0x1d3d, 10, &regValue2)) != RT_ERR_OK)
+                    return retVal;
+                if (regValue2 == 0)
                 {
-                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, (mode - 12))) != RT_ERR_OK)
+                    /*ext1_force_ablty*/
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 2, pPortAbility->duplex)) != RT_ERR_OK)
                         return retVal;
-                }
 
-                if ((mode == EXT_TMII_MAC_2) || (mode == EXT_TMII_PHY_2))
-                {
-                    if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 1)) != RT_ERR_OK)
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, pPortAbility->speed)) != RT_ERR_OK)
                         return retVal;
-                }
-            }
-        }
-    }
-    return RT_ERR_OK;
-}
-
-/* Function Name:
- *      rtl8367c_getAsicPortExtMode
- * Description:
- *      Get external interface mode configuration
- * Input:
- *      id      - external interface id (0~1)
- *      pMode   - external interface mode
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_OUT_OF_RANGE - input parameter out of range
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicPortExtMode(uint32_t id, uint32_t *pMode)
-{
-    int32_t retVal;
-    uint32_t regData, regValue, type;
-
-    if (id >= RTL8367C_EXTNO)
-        return RT_ERR_OUT_OF_RANGE;
 
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
-        return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, pPortAbility->link)) != RT_ERR_OK)
+                        return retVal;
 
-    if ((retVal = rtl8367c_getAsicReg(0x1300, &regValue)) != RT_ERR_OK)
-        return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 6, pPortAbility->txpause)) != RT_ERR_OK)
+                        return retVal;
 
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
-        return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 5, pPortAbility->rxpause)) != RT_ERR_OK)
+                        return retVal;
 
-    type = 0;
+                    /*force mode for ext1*/
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 12, pPortAbility->forcemode)) != RT_ERR_OK)
+                        return retVal;
 
-    switch (regValue)
-    {
-    case 0x0276:
-    case 0x0597:
-    case 0x6367:
-        type = 1;
-        break;
-    case 0x0652:
-    case 0x6368:
-        type = 2;
-        break;
-    case 0x0801:
-    case 0x6511:
-        type = 3;
-        break;
-    default:
-        return RT_ERR_FAILED;
-    }
+                    if (pPortAbility->link == 1)
+                    {
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 0)) != RT_ERR_OK)
+                            return retVal;
 
-    if (1 == type)
-    {
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 1)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                    else
+                    {
+                        if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, 2)) != RT_ERR_OK)
+                            return retVal;
+                    }
 
-        if (1 == id)
+                    /*disable force ability   ---      */
+                    if ((retVal = rtl8367c_setAsicRegBit(0x137c, 12, 0)) != RT_ERR_OK)
+                        return retVal;
+                    return RT_ERR_OK;
+                }
+            }
+        }
+        else if (2 == id)
         {
-            if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, &regData)) != RT_ERR_OK)
-                return retVal;
 
-            if (1 == regData)
+            if ((retVal = rtl8367c_getAsicRegBit(0x1d95, 0, &sgmiibit)) != RT_ERR_OK)
+                return retVal;
+            if (sgmiibit == 1)
             {
-                *pMode = EXT_SGMII;
-                return RT_ERR_OK;
-            }
+                /*for 1000x/100fx/1000x_100fx, param has to bet set to serdes registers*/
+                if ((retVal = rtl8367c_getAsicReg(0x1d95, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                /*cfg_mac7_sel_sgmii=1 & cfg_mac7_fib =1*/
+                if ((regValue & 0x3) == 0x3)
+                {
+                    if ((retVal = rtl8367c_getAsicRegBits(0x1d95, 0x1f00, &regValue2)) != RT_ERR_OK)
+                        return retVal;
 
-            if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, &regData)) != RT_ERR_OK)
-                return retVal;
+                    if (regValue2 == 0x4)
+                    {
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                            return retVal;
 
-            if (1 == regData)
-            {
-                *pMode = EXT_HSGMII;
-                return RT_ERR_OK;
-            }
-        }
+                        /* 0 4 0  bit 12  set 1,  bit15~13 = 4*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFF0FFF;
+                        reg_data |= 0x9000;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-        if (0 == id || 1 == id)
-            return rtl8367c_getAsicRegBits(RTL8367C_REG_DIGITAL_INTERFACE_SELECT, RTL8367C_SELECT_GMII_0_MASK << (id * RTL8367C_SELECT_GMII_1_OFFSET), pMode);
-        else
-            return rtl8367c_getAsicRegBits(RTL8367C_REG_DIGITAL_INTERFACE_SELECT_1, RTL8367C_SELECT_GMII_2_MASK, pMode);
-    }
-    else if (2 == type)
-    {
-        if (1 == id)
-        {
-            if ((retVal = rtl8367c_getAsicReg(0x1d92, &regData)) != RT_ERR_OK)
-                return retVal;
+                        /* 0 0 2  bit 6  set 1,  bit13 set to 0, bit12 nway_en*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFDFFF;
+                        reg_data |= 0x40;
+                        if (pPortAbility->forcemode)
+                            reg_data &= 0xffffefff;
+                        else
+                            reg_data |= 0x1000;
 
-            if (regData & 0x4000)
-            {
-                *pMode = EXT_SGMII;
-                return RT_ERR_OK;
-            }
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-            else if (((regData >> 8) & 0x1f) == 4)
-            {
-                *pMode = EXT_1000X;
-                return RT_ERR_OK;
-            }
-            else if (((regData >> 8) & 0x1f) == 5)
-            {
-                *pMode = EXT_100FX;
-                return RT_ERR_OK;
-            }
-            else if (((regData >> 8) & 0x1f) == 7)
-            {
-                *pMode = EXT_1000X_100FX;
-                return RT_ERR_OK;
-            }
+                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        if (pPortAbility->txpause)
+                            reg_data |= 0x80;
+                        else
+                            reg_data &= 0xffffff7f;
+                        if (pPortAbility->rxpause)
+                            reg_data |= 0x100;
+                        else
+                            reg_data &= 0xfffffeff;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-            return rtl8367c_getAsicRegBits(0x1305, 0xf0, pMode);
-        }
-        else if (2 == id)
-        {
-            if ((retVal = rtl8367c_getAsicReg(0x1d92, &regData)) != RT_ERR_OK)
-                return retVal;
+                        /* 0 4 0  bit 12  set 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFEFFF;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-            if (regData & 0x40)
-            {
-                *pMode = EXT_SGMII;
-                return RT_ERR_OK;
-            }
-            else if (regData & 0x80)
-            {
-                *pMode = EXT_HSGMII;
-                return RT_ERR_OK;
-            }
-            else if ((regData & 0x1f) == 4)
-            {
-                *pMode = EXT_1000X;
-                return RT_ERR_OK;
-            }
-            else if ((regData & 0x1f) == 5)
-            {
-                *pMode = EXT_100FX;
-                return RT_ERR_OK;
-            }
-            else if ((regData & 0x1f) == 7)
-            {
-                *pMode = EXT_1000X_100FX;
-                return RT_ERR_OK;
-            }
+                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x4)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                    else if (regValue2 == 0x5)
+                    {
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                            return retVal;
 
-            return rtl8367c_getAsicRegBits(0x1305, 0xf, pMode);
-        }
-    }
-    else if (3 == type)
-    {
-        if (1 == id)
-        {
-            /* SDS_CFG_NEW */
-            if ((retVal = rtl8367c_getAsicReg(0x1d95, &regData)) != RT_ERR_OK)
-                return retVal;
+                        /* 0 4 0  bit 12  set 1,  bit15~13 = 5*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFF0FFF;
+                        reg_data |= 0xB000;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-            if ((retVal = rtl8367c_getAsicReg(0x1d41, &regValue)) != RT_ERR_OK)
-                return retVal;
+                        /* 0 0 2  bit 6  set 0,  bit13 set to 1, bit12 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFFFBF;
+                        reg_data |= 0x2000;
+                        reg_data &= 0xffffefff;
 
-            if ((regValue & 0xa0) == 0xa0)
-            {
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                regData = regData >> 8;
-                if ((regData & 0x1f) == 4)
-                {
-                    *pMode = EXT_1000X;
-                    return RT_ERR_OK;
-                }
-                else if ((regData & 0x1f) == 5)
-                {
-                    *pMode = EXT_100FX;
-                    return RT_ERR_OK;
-                }
-                else if ((regData & 0x1f) == 7)
-                {
-                    *pMode = EXT_1000X_100FX;
-                    return RT_ERR_OK;
-                }
-            }
-
-            if ((retVal = rtl8367c_getAsicReg(0x1d11, &regData)) != RT_ERR_OK)
-                return retVal;
-
-            /* check cfg_mac6_sel_sgmii */
-            if ((regData >> 6) & 1)
-            {
-                *pMode = EXT_SGMII;
-                return RT_ERR_OK;
-            }
-            else if ((regData >> 11) & 1)
-            {
-                *pMode = EXT_HSGMII;
-                return RT_ERR_OK;
-            }
-            else
-            {
-                /* check port6 MAC mode */
-                if ((retVal = rtl8367c_getAsicRegBits(0x1305, 0xf0, &regData)) != RT_ERR_OK)
-                    return retVal;
-
-                *pMode = regData;
-                return RT_ERR_OK;
-            }
-        }
-        else if (2 == id)
-        {
-            if ((retVal = rtl8367c_getAsicReg(0x1d95, &regData)) != RT_ERR_OK)
-                return retVal;
-
-            if (((regData & 0x3) == 3) && (((regData >> 8) & 0x1f) == 0x4))
-            {
-                *pMode = EXT_1000X;
-                return RT_ERR_OK;
-            }
-            else if (((regData & 0x3) == 3) && (((regData >> 8) & 0x1f) == 0x5))
-            {
-                *pMode = EXT_100FX;
-                return RT_ERR_OK;
-            }
-            else if (((regData & 0x3) == 3) && (((regData >> 8) & 0x1f) == 0x7))
-            {
-                *pMode = EXT_1000X_100FX;
-                return RT_ERR_OK;
-            }
-            else if (regData & 1)
-            {
-                *pMode = EXT_SGMII;
-                return RT_ERR_OK;
-            }
-            else
-            {
-
-                if ((retVal = rtl8367c_getAsicRegBits(0x13c3, 0xf, &regData)) != RT_ERR_OK)
-                    return retVal;
+                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        if (pPortAbility->txpause)
+                            reg_data |= 0x80;
+                        else
+                            reg_data &= 0xffffff7f;
+                        if (pPortAbility->rxpause)
+                            reg_data |= 0x100;
+                        else
+                            reg_data &= 0xfffffeff;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                *pMode = regData;
+                        /* 0 4 0  bit 12  set 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFEFFF;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                return RT_ERR_OK;
-            }
-        }
-    }
+                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x5)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                    else if (regValue2 == 0x7)
+                    {
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                            return retVal;
 
-    return RT_ERR_OK;
-}
-/* Function Name:
- *      rtl8367c_getAsicPortForceLinkExt
- * Description:
- *      Get external interface force linking configuration
- * Input:
- *      id          - external interface id (0~1)
- *      pPortAbility - port ability configuration
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_OUT_OF_RANGE - input parameter out of range
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicPortForceLinkExt(uint32_t id, rtl8367c_port_ability_t *pPortAbility)
-{
-    uint32_t reg_data, regValue, type;
-    uint32_t sgmiiSel;
-    uint32_t hsgmiiSel;
-    uint32_t Mode;
-    int32_t retVal;
+                        /* 0 4 0  bit 12  set 1,  bit15~13 = 4*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFF0FFF;
+                        reg_data |= 0x9000;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-    if (id >= RTL8367C_EXTNO)
-        return RT_ERR_OUT_OF_RANGE;
+                        /* 0 0 2  bit 6  set 1,  bit13 set to 0, bit12 nway_en*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFDFFF;
+                        reg_data |= 0x40;
+                        if (pPortAbility->forcemode)
+                            reg_data &= 0xffffefff;
+                        else
+                            reg_data |= 0x1000;
 
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
-        return retVal;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-    if ((retVal = rtl8367c_getAsicReg(0x1300, &regValue)) != RT_ERR_OK)
-        return retVal;
+                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        if (pPortAbility->txpause)
+                            reg_data |= 0x80;
+                        else
+                            reg_data &= 0xffffff7f;
+                        if (pPortAbility->rxpause)
+                            reg_data |= 0x100;
+                        else
+                            reg_data &= 0xfffffeff;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
-        return retVal;
+                        /* 0 4 0  bit 12  set 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFEFFF;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-    type = 0;
+                        /* 0 4 0  bit 12  set 1,  bit15~13 = 5*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFF0FFF;
+                        reg_data |= 0xB000;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-    switch (regValue)
-    {
-    case 0x0276:
-    case 0x0597:
-    case 0x6367:
-        type = 1;
-        break;
-    case 0x0652:
-    case 0x6368:
-        type = 2;
-        break;
-    case 0x0801:
-    case 0x6511:
-        type = 3;
-        break;
-    default:
-        return RT_ERR_FAILED;
-    }
+                        /* 0 0 2  bit 6  set 0,  bit13 set to 1, bit12 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFFFBF;
+                        reg_data |= 0x2000;
+                        reg_data &= 0xffffefff;
 
-    if (1 == type)
-    {
-        if (1 == id)
-        {
-            if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, &sgmiiSel)) != RT_ERR_OK)
-                return retVal;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-            if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, &hsgmiiSel)) != RT_ERR_OK)
-                return retVal;
+                        /* 0 4 2  bit 8  rx pause,  bit7 tx pause*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 2, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        if (pPortAbility->txpause)
+                            reg_data |= 0x80;
+                        else
+                            reg_data &= 0xffffff7f;
+                        if (pPortAbility->rxpause)
+                            reg_data |= 0x100;
+                        else
+                            reg_data &= 0xfffffeff;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 2, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-            if ((sgmiiSel == 1) || (hsgmiiSel == 1))
-            {
-                memset(pPortAbility, 0x00, sizeof(rtl8367c_port_ability_t));
-                pPortAbility->forcemode = 1;
+                        /* 0 4 0  bit 12  set 0*/
+                        if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &reg_data)) != RT_ERR_OK)
+                            return retVal;
+                        reg_data &= 0xFFFFEFFF;
+                        if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, reg_data)) != RT_ERR_OK)
+                            return retVal;
 
-                if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, &reg_data)) != RT_ERR_OK)
-                    return retVal;
+                        if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x7)) != RT_ERR_OK)
+                            return retVal;
+                    }
 
-                pPortAbility->duplex = reg_data;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x137d, 12, 0)) != RT_ERR_OK)
+                        return retVal;
+                    return RT_ERR_OK;
+                }
 
-                if ((retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, &reg_data)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_getAsicRegBits(0x1d95, 0x1f00, &regValue2)) != RT_ERR_OK)
                     return retVal;
+                if (regValue2 == 0x2)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                        return retVal;
 
-                pPortAbility->speed = reg_data;
-
-                if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, &reg_data)) != RT_ERR_OK)
-                    return retVal;
+                    for (i = 0; i < 0xfff; i++)
+                        ;
 
-                pPortAbility->link = reg_data;
-
-                if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, &reg_data)) != RT_ERR_OK)
-                    return retVal;
-
-                pPortAbility->txpause = reg_data;
-
-                if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, &reg_data)) != RT_ERR_OK)
-                    return retVal;
+                    /* 0 2 0  bit 8-9  nway*/
+                    if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
+                        return retVal;
+                    reg_data &= 0xfffffcff;
+                    if (pPortAbility->nway)
+                        reg_data &= 0xfffffcff;
+                    else
+                        reg_data |= 0x100;
+                    if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
+                        return retVal;
 
-                pPortAbility->rxpause = reg_data;
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x2)) != RT_ERR_OK)
+                        return retVal;
 
-                return RT_ERR_OK;
-            }
-        }
+                    for (i = 0; i < 0xfff; i++)
+                        ;
 
-        if (0 == id || 1 == id)
-            retVal = rtl8367c_getAsicReg(RTL8367C_REG_DIGITAL_INTERFACE0_FORCE + id, &reg_data);
-        else
-            retVal = rtl8367c_getAsicReg(RTL8367C_REG_DIGITAL_INTERFACE2_FORCE, &reg_data);
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, pPortAbility->duplex)) != RT_ERR_OK)
+                        return retVal;
 
-        if (retVal != RT_ERR_OK)
-            return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, pPortAbility->speed)) != RT_ERR_OK)
+                        return retVal;
 
-        pPortAbility->forcemode = (reg_data >> 12) & 0x0001;
-        pPortAbility->mstfault = (reg_data >> 9) & 0x0001;
-        pPortAbility->mstmode = (reg_data >> 8) & 0x0001;
-        pPortAbility->nway = (reg_data >> 7) & 0x0001;
-        pPortAbility->txpause = (reg_data >> 6) & 0x0001;
-        pPortAbility->rxpause = (reg_data >> 5) & 0x0001;
-        pPortAbility->link = (reg_data >> 4) & 0x0001;
-        pPortAbility->duplex = (reg_data >> 2) & 0x0001;
-        pPortAbility->speed = reg_data & 0x0003;
-    }
-    else if (2 == type)
-    {
-        if (id == 1)
-        {
-            if ((retVal = rtl8367c_getAsicReg(0x1311, &reg_data)) != RT_ERR_OK)
-                return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, pPortAbility->txpause)) != RT_ERR_OK)
+                        return retVal;
 
-            pPortAbility->forcemode = (reg_data >> 12) & 1;
-            pPortAbility->duplex = (reg_data >> 2) & 1;
-            pPortAbility->link = (reg_data >> 4) & 1;
-            pPortAbility->speed = reg_data & 3;
-            pPortAbility->rxpause = (reg_data >> 5) & 1;
-            pPortAbility->txpause = (reg_data >> 6) & 1;
-        }
-        else if (2 == id)
-        {
-            if ((retVal = rtl8367c_getAsicReg(0x13c4, &reg_data)) != RT_ERR_OK)
-                return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, pPortAbility->rxpause)) != RT_ERR_OK)
+                        return retVal;
 
-            pPortAbility->forcemode = (reg_data >> 12) & 1;
-            pPortAbility->duplex = (reg_data >> 2) & 1;
-            pPortAbility->link = (reg_data >> 4) & 1;
-            pPortAbility->speed = reg_data & 3;
-            pPortAbility->rxpause = (reg_data >> 5) & 1;
-            pPortAbility->txpause = (reg_data >> 6) & 1;
-        }
-    }
-    else if (3 == type)
-    {
-        if (id == 1)
-        {
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, pPortAbility->link)) != RT_ERR_OK)
+                        return retVal;
 
-            if ((retVal = rtl8367c_getAsicPortExtMode(id, &Mode)) != RT_ERR_OK)
-                return retVal;
-            if (Mode < EXT_SGMII)
+                    if ((retVal = rtl8367c_setAsicRegBit(0x137d, 12, 0)) != RT_ERR_OK)
+                        return retVal;
+                    return RT_ERR_OK;
+                }
+            }
+            else
             {
 
-                if ((retVal = rtl8367c_getAsicReg(0x1311, &reg_data)) != RT_ERR_OK)
+                /*ext2_force_ablty*/
+                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 2, pPortAbility->duplex)) != RT_ERR_OK)
                     return retVal;
 
-                pPortAbility->forcemode = (reg_data >> 12) & 1;
-                pPortAbility->duplex = (reg_data >> 2) & 1;
-                pPortAbility->link = (reg_data >> 4) & 1;
-                pPortAbility->speed = reg_data & 3;
-                pPortAbility->rxpause = (reg_data >> 5) & 1;
-                pPortAbility->txpause = (reg_data >> 6) & 1;
-            }
-            else if (Mode < EXT_1000X_100FX)
-            {
-                if ((retVal = rtl8367c_getAsicReg(0x1d11, &reg_data)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c4, 0x3, pPortAbility->speed)) != RT_ERR_OK)
                     return retVal;
 
-                // pPortAbility->forcemode = (reg_data >> 12) & 1;
-                pPortAbility->duplex = (reg_data >> 10) & 1;
-                pPortAbility->link = (reg_data >> 9) & 1;
-                pPortAbility->speed = (reg_data >> 7) & 3;
-                pPortAbility->rxpause = (reg_data >> 14) & 1;
-                pPortAbility->txpause = (reg_data >> 13) & 1;
-            }
-            else if (Mode < EXT_RGMII_2)
-            {
-                if ((retVal = rtl8367c_getAsicReg(0x1358, &reg_data)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, pPortAbility->link)) != RT_ERR_OK)
                     return retVal;
 
-                // pPortAbility->forcemode = (reg_data >> 12) & 1;
-                pPortAbility->duplex = (reg_data >> 2) & 1;
-                pPortAbility->link = (reg_data >> 4) & 1;
-                pPortAbility->speed = reg_data & 3;
-                pPortAbility->rxpause = (reg_data >> 5) & 1;
-                pPortAbility->txpause = (reg_data >> 6) & 1;
-            }
-        }
-        else if (2 == id)
-        {
-            if ((retVal = rtl8367c_getAsicPortExtMode(id, &Mode)) != RT_ERR_OK)
-                return retVal;
-            if (Mode < EXT_SGMII)
-            {
-
-                if ((retVal = rtl8367c_getAsicReg(0x13c4, &reg_data)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 6, pPortAbility->txpause)) != RT_ERR_OK)
                     return retVal;
 
-                pPortAbility->forcemode = (reg_data >> 12) & 1;
-                pPortAbility->duplex = (reg_data >> 2) & 1;
-                pPortAbility->link = (reg_data >> 4) & 1;
-                pPortAbility->speed = reg_data & 3;
-                pPortAbility->rxpause = (reg_data >> 5) & 1;
-                pPortAbility->txpause = (reg_data >> 6) & 1;
-            }
-            else if (Mode < EXT_1000X_100FX)
-            {
-                if ((retVal = rtl8367c_getAsicReg(0x1d11, &reg_data)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 5, pPortAbility->rxpause)) != RT_ERR_OK)
                     return retVal;
 
-                // pPortAbility->forcemode = (reg_data >> 12) & 1;
-                pPortAbility->duplex = (reg_data >> 10) & 1;
-                pPortAbility->link = (reg_data >> 9) & 1;
-                pPortAbility->speed = (reg_data >> 7) & 3;
-                pPortAbility->rxpause = (reg_data >> 14) & 1;
-                pPortAbility->txpause = (reg_data >> 13) & 1;
-            }
-            else if (Mode < EXT_RGMII_2)
-            {
-                if ((retVal = rtl8367c_getAsicReg(0x1359, &reg_data)) != RT_ERR_OK)
+                /*force mode for ext2*/
+                if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 12, pPortAbility->forcemode)) != RT_ERR_OK)
                     return retVal;
 
-                // pPortAbility->forcemode = (reg_data >> 12) & 1;
-                pPortAbility->duplex = (reg_data >> 2) & 1;
-                pPortAbility->link = (reg_data >> 4) & 1;
-                pPortAbility->speed = reg_data & 3;
-                pPortAbility->rxpause = (reg_data >> 5) & 1;
-                pPortAbility->txpause = (reg_data >> 6) & 1;
-            }
-            else if (Mode < EXT_END)
-            {
+                if (pPortAbility->link == 1)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, 0)) != RT_ERR_OK)
+                        return retVal;
 
-                if ((retVal = rtl8367c_getAsicReg(0x1311, &reg_data)) != RT_ERR_OK)
+                    if ((retVal = rtl8367c_setAsicRegBit(0x13c4, 4, 1)) != RT_ERR_OK)
+                        return retVal;
+                }
+                else
+                {
+                    if ((retVal = rtl8367c_setAsicRegBits(0x13c4, 0x3, 2)) != RT_ERR_OK)
+                        return retVal;
+                }
+
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
                     return retVal;
+                if (reg_data == 1)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 2, pPortAbility->duplex)) != RT_ERR_OK)
+                        return retVal;
 
-                pPortAbility->forcemode = (reg_data >> 12) & 1;
-                pPortAbility->duplex = (reg_data >> 2) & 1;
-                pPortAbility->link = (reg_data >> 4) & 1;
-                pPortAbility->speed = reg_data & 3;
-                pPortAbility->rxpause = (reg_data >> 5) & 1;
-                pPortAbility->txpause = (reg_data >> 6) & 1;
-            }
-        }
-    }
-    return RT_ERR_OK;
-}
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, pPortAbility->speed)) != RT_ERR_OK)
+                        return retVal;
 
-int32_t rtl8367::rtk_port_macForceLinkExt_set(rtk_port_t port, rtk_mode_ext_t mode, rtk_port_mac_ability_t *pPortability)
-{
-    int32_t retVal;
-    rtl8367c_port_ability_t ability;
-    uint32_t ext_id;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, pPortAbility->link)) != RT_ERR_OK)
+                        return retVal;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_EXT(port);
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 6, pPortAbility->txpause)) != RT_ERR_OK)
+                        return retVal;
 
-    if (NULL == pPortability)
-        return RT_ERR_NULL_POINTER;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 5, pPortAbility->rxpause)) != RT_ERR_OK)
+                        return retVal;
 
-    if (mode >= MODE_EXT_END)
-        return RT_ERR_INPUT;
+                    /*force mode for ext1*/
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1311, 12, pPortAbility->forcemode)) != RT_ERR_OK)
+                        return retVal;
 
-    if (mode == MODE_EXT_HSGMII)
-    {
-        if (pPortability->forcemode > 1 || pPortability->speed != PORT_SPEED_2500M || pPortability->duplex != PORT_FULL_DUPLEX ||
-            pPortability->link >= PORT_LINKSTATUS_END || pPortability->nway > 1 || pPortability->txpause > 1 || pPortability->rxpause > 1)
-            return RT_ERR_INPUT;
+                    if (pPortAbility->link == 1)
+                    {
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 0)) != RT_ERR_OK)
+                            return retVal;
 
-        if (rtk_switch_isHsgPort(port) != RT_ERR_OK)
-            return RT_ERR_PORT_ID;
-    }
-    else
-    {
-        if (pPortability->forcemode > 1 || pPortability->speed > PORT_SPEED_1000M || pPortability->duplex >= PORT_DUPLEX_END ||
-            pPortability->link >= PORT_LINKSTATUS_END || pPortability->nway > 1 || pPortability->txpause > 1 || pPortability->rxpause > 1)
-            return RT_ERR_INPUT;
+                        if ((retVal = rtl8367c_setAsicRegBit(0x1311, 4, 1)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                    else
+                    {
+                        if ((retVal = rtl8367c_setAsicRegBits(0x1311, 0x3, 2)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                }
+            }
+
+            /*disable force ability   ---      */
+            if ((retVal = rtl8367c_setAsicRegBit(0x137d, 12, 0)) != RT_ERR_OK)
+                return retVal;
+        }
     }
 
-    ext_id = port - 15;
+    return RT_ERR_OK;
+}
 
-    if (mode == MODE_EXT_DISABLE)
-    {
-        memset(&ability, 0x00, sizeof(rtl8367c_port_ability_t));
-        if ((retVal = rtl8367c_setAsicPortForceLinkExt(ext_id, &ability)) != RT_ERR_OK)
-            return retVal;
+/* Function Name:
+ *      rtl8367c_setAsicPortExtMode
+ * Description:
+ *      Set external interface mode configuration
+ * Input:
+ *      id      - external interface id (0~2)
+ *      mode    - external interface mode
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicPortExtMode(uint32_t id, uint32_t mode)
+{
+    int32_t retVal;
+    uint32_t i, regValue, type, option, reg_data;
+    uint32_t idx;
+    uint32_t redData[][2] = {{0x04D7, 0x0480}, {0xF994, 0x0481}, {0x21A2, 0x0482}, {0x6960, 0x0483}, {0x9728, 0x0484}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x83F2, 0x002E}};
+    uint32_t redDataSB[][2] = {{0x04D7, 0x0480}, {0xF994, 0x0481}, {0x31A2, 0x0482}, {0x6960, 0x0483}, {0x9728, 0x0484}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x83F2, 0x002E}};
+    uint32_t redData1[][2] = {{0x82F1, 0x0500}, {0xF195, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
+    uint32_t redData5[][2] = {{0x82F1, 0x0500}, {0xF195, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
+    uint32_t redData6[][2] = {{0x82F1, 0x0500}, {0xF195, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
+    uint32_t redData8[][2] = {{0x82F1, 0x0500}, {0xF995, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
+    uint32_t redData9[][2] = {{0x82F1, 0x0500}, {0xF995, 0x0501}, {0x31A2, 0x0502}, {0x796C, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
+    uint32_t redDataHB[][2] = {{0x82F0, 0x0500}, {0xF195, 0x0501}, {0x31A2, 0x0502}, {0x7960, 0x0503}, {0x9728, 0x0504}, {0x9D85, 0x0423}, {0xD810, 0x0424}, {0x0F80, 0x0001}, {0x83F2, 0x002E}};
 
-        if ((retVal = rtl8367c_setAsicPortExtMode(ext_id, mode)) != RT_ERR_OK)
-            return retVal;
-    }
-    else
-    {
-        if ((retVal = rtl8367c_setAsicPortExtMode(ext_id, mode)) != RT_ERR_OK)
-            return retVal;
+    if (id >= RTL8367C_EXTNO)
+        return RT_ERR_OUT_OF_RANGE;
 
-        if ((retVal = rtl8367c_getAsicPortForceLinkExt(ext_id, &ability)) != RT_ERR_OK)
-            return retVal;
+    if (mode >= EXT_END)
+        return RT_ERR_OUT_OF_RANGE;
 
-        ability.forcemode = pPortability->forcemode;
-        ability.speed = (mode == MODE_EXT_HSGMII) ? PORT_SPEED_1000M : pPortability->speed;
-        ability.duplex = pPortability->duplex;
-        ability.link = pPortability->link;
-        ability.nway = pPortability->nway;
-        ability.txpause = pPortability->txpause;
-        ability.rxpause = pPortability->rxpause;
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
+        return retVal;
 
-        if ((retVal = rtl8367c_setAsicPortForceLinkExt(ext_id, &ability)) != RT_ERR_OK)
-            return retVal;
+    if ((retVal = rtl8367c_getAsicReg(0x1300, &regValue)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
+        return retVal;
+
+    type = 0;
+
+    switch (regValue)
+    {
+    case 0x0276:
+    case 0x0597:
+    case 0x6367:
+        type = 1;
+        break;
+    case 0x0652:
+    case 0x6368:
+        type = 2;
+        break;
+    case 0x0801:
+    case 0x6511:
+        type = 3;
+        break;
+    default:
+        return RT_ERR_FAILED;
     }
 
-    return RT_ERR_OK;
-}
+    if (1 == type)
+    {
+        if ((mode == EXT_1000X_100FX) || (mode == EXT_1000X) || (mode == EXT_100FX))
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_REG_TO_ECO4, 5, 1)) != RT_ERR_OK)
+                return retVal;
 
-int32_t rtl8367::rtk_port_macForceLinkExt_get(rtk_port_t port, rtk_mode_ext_t *pMode, rtk_port_mac_ability_t *pPortability)
-{
-    int32_t retVal;
-    rtl8367c_port_ability_t ability;
-    uint32_t ext_id;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_REG_TO_ECO4, 7, 1)) != RT_ERR_OK)
+                return retVal;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_EXT(port);
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 1)) != RT_ERR_OK)
+                return retVal;
 
-    if (NULL == pMode)
-        return RT_ERR_NULL_POINTER;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_MISCELLANEOUS_CONFIGURE0, RTL8367C_DW8051_EN_OFFSET, 1)) != RT_ERR_OK)
+                return retVal;
 
-    if (NULL == pPortability)
-        return RT_ERR_NULL_POINTER;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 1)) != RT_ERR_OK)
+                return retVal;
 
-    ext_id = port - 15;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
+                return retVal;
 
-    if ((retVal = rtl8367c_getAsicPortExtMode(ext_id, (uint32_t *)pMode)) != RT_ERR_OK)
-        return retVal;
+            if (mode == EXT_1000X_100FX)
+            {
+                for (idx = 0; idx < FIBER2_AUTO_INIT_SIZE; idx++)
+                {
+                    if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Fiber2_Auto[idx])) != RT_ERR_OK)
+                        return retVal;
+                }
+            }
 
-    if ((retVal = rtl8367c_getAsicPortForceLinkExt(ext_id, &ability)) != RT_ERR_OK)
-        return retVal;
+            if (mode == EXT_1000X)
+            {
+                for (idx = 0; idx < FIBER2_1G_INIT_SIZE; idx++)
+                {
+                    if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Fiber2_1G[idx])) != RT_ERR_OK)
+                        return retVal;
+                }
+            }
 
-    pPortability->forcemode = ability.forcemode;
-    pPortability->speed = (*pMode == MODE_EXT_HSGMII) ? PORT_SPEED_2500M : ability.speed;
-    pPortability->duplex = ability.duplex;
-    pPortability->link = ability.link;
-    pPortability->nway = ability.nway;
-    pPortability->txpause = ability.txpause;
-    pPortability->rxpause = ability.rxpause;
+            if (mode == EXT_100FX)
+            {
+                for (idx = 0; idx < FIBER2_100M_INIT_SIZE; idx++)
+                {
+                    if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Fiber2_100M[idx])) != RT_ERR_OK)
+                        return retVal;
+                }
+            }
 
-    return RT_ERR_OK;
-}
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
+                return retVal;
 
-int32_t rtl8367::rtk_port_rgmiiDelayExt_set(rtk_port_t port, uint32_t txDelay, uint32_t rxDelay)
-{
-    int32_t retVal;
-    uint32_t regAddr, regData;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 0)) != RT_ERR_OK)
+                return retVal;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_EXT(port);
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 0)) != RT_ERR_OK)
+                return retVal;
+        }
 
-    if ((txDelay > 1) || (rxDelay > 7))
-        return RT_ERR_INPUT;
+        if (mode == EXT_GMII)
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_EXT0_RGMXF, RTL8367C_EXT0_RGTX_INV_OFFSET, 1)) != RT_ERR_OK)
+                return retVal;
 
-    if (port == EXT_PORT0)
-        regAddr = RTL8367C_REG_EXT1_RGMXF;
-    else if (port == EXT_PORT1)
-        regAddr = RTL8367C_REG_EXT2_RGMXF;
-    else
-        return RT_ERR_INPUT;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_EXT1_RGMXF, RTL8367C_EXT1_RGTX_INV_OFFSET, 1)) != RT_ERR_OK)
+                return retVal;
 
-    if ((retVal = rtl8367c_getAsicReg(regAddr, &regData)) != RT_ERR_OK)
-        return retVal;
+            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_EXT_TXC_DLY, RTL8367C_EXT1_GMII_TX_DELAY_MASK, 5)) != RT_ERR_OK)
+                return retVal;
 
-    regData = (regData & 0xFFF0) | ((txDelay << 3) & 0x0008) | (rxDelay & 0x0007);
+            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_EXT_TXC_DLY, RTL8367C_EXT0_GMII_TX_DELAY_MASK, 6)) != RT_ERR_OK)
+                return retVal;
+        }
 
-    if ((retVal = rtl8367c_setAsicReg(regAddr, regData)) != RT_ERR_OK)
-        return retVal;
+        /* Serdes reset */
+        if ((mode == EXT_TMII_MAC) || (mode == EXT_TMII_PHY))
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_BYPASS_LINE_RATE, id, 1)) != RT_ERR_OK)
+                return retVal;
+        }
+        else
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_BYPASS_LINE_RATE, id, 0)) != RT_ERR_OK)
+                return retVal;
+        }
 
-    return RT_ERR_OK;
-}
+        if ((mode == EXT_SGMII) || (mode == EXT_HSGMII))
+        {
+            if (id != 1)
+                return RT_ERR_PORT_ID;
 
-int32_t rtl8367::rtk_port_rgmiiDelayExt_get(rtk_port_t port, uint32_t *pTxDelay, uint32_t *pRxDelay)
-{
-    int32_t retVal;
-    uint32_t regAddr, regData;
+            if ((retVal = rtl8367c_setAsicReg(0x13C0, 0x0249)) != RT_ERR_OK)
+                return retVal;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_IS_EXT(port);
+            if ((retVal = rtl8367c_getAsicReg(0x13C1, &option)) != RT_ERR_OK)
+                return retVal;
 
-    if ((NULL == pTxDelay) || (NULL == pRxDelay))
-        return RT_ERR_NULL_POINTER;
+            if ((retVal = rtl8367c_setAsicReg(0x13C0, 0x0000)) != RT_ERR_OK)
+                return retVal;
+        }
 
-    if (port == EXT_PORT0)
-        regAddr = RTL8367C_REG_EXT1_RGMXF;
-    else if (port == EXT_PORT1)
-        regAddr = RTL8367C_REG_EXT2_RGMXF;
-    else
-        return RT_ERR_INPUT;
+        if (mode == EXT_SGMII)
+        {
+            if (option == 0)
+            {
+                for (i = 0; i <= 7; i++)
+                {
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData[i][0])) != RT_ERR_OK)
+                        return retVal;
 
-    if ((retVal = rtl8367c_getAsicReg(regAddr, &regData)) != RT_ERR_OK)
-        return retVal;
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData[i][1])) != RT_ERR_OK)
+                        return retVal;
 
-    *pTxDelay = (regData & 0x0008) >> 3;
-    *pRxDelay = regData & 0x0007;
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                        return retVal;
+                }
+            }
+            else
+            {
+                for (i = 0; i <= 7; i++)
+                {
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redDataSB[i][0])) != RT_ERR_OK)
+                        return retVal;
 
-    return RT_ERR_OK;
-}
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redDataSB[i][1])) != RT_ERR_OK)
+                        return retVal;
 
-// --------------------------------- PORT ISOLATION ---------------------------------
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                        return retVal;
+                }
+            }
+        }
 
-/* Function Name:
- *      rtl8367c_setAsicPortIsolationPermittedPortmask
- * Description:
- *      Set permitted port isolation portmask
- * Input:
- *      port            - Physical port number (0~10)
- *      permitPortmask  - port mask
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_PORT_ID      - Invalid port number
- *      RT_ERR_PORT_MASK    - Invalid portmask
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicPortIsolationPermittedPortmask(uint32_t port, uint32_t permitPortmask)
-{
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    if (permitPortmask > RTL8367C_PORTMASK)
-        return RT_ERR_PORT_MASK;
-
-    return rtl8367c_setAsicReg(RTL8367C_PORT_ISOLATION_PORT_MASK_REG(port), permitPortmask);
-}
-/* Function Name:
- *      rtl8367c_getAsicPortIsolationPermittedPortmask
- * Description:
- *      Get permitted port isolation portmask
- * Input:
- *      port                - Physical port number (0~10)
- *      pPermitPortmask     - port mask
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_PORT_ID      - Invalid port number
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicPortIsolationPermittedPortmask(uint32_t port, uint32_t *pPermitPortmask)
-{
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    return rtl8367c_getAsicReg(RTL8367C_PORT_ISOLATION_PORT_MASK_REG(port), pPermitPortmask);
-}
-int32_t rtl8367::rtk_port_isolation_set(rtk_port_t port, rtk_portmask_t *pPortmask)
-{
-    int32_t retVal;
-    uint32_t pmask;
+        if (mode == EXT_HSGMII)
+        {
+            if (option == 0)
+            {
+                if ((retVal = rtl8367c_setAsicReg(0x13c2, 0x0249)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
+                if ((retVal = rtl8367c_getAsicReg(0x1301, &regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    if (NULL == pPortmask)
-        return RT_ERR_NULL_POINTER;
+                if ((retVal = rtl8367c_setAsicReg(0x13c2, 0x0000)) != RT_ERR_OK)
+                    return retVal;
 
-    /* check port mask */
-    RTK_CHK_PORTMASK_VALID(pPortmask);
+                if (((regValue & 0x00F0) >> 4) == 0x0001)
+                {
+                    for (i = 0; i <= 8; i++)
+                    {
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData1[i][0])) != RT_ERR_OK)
+                            return retVal;
 
-    if ((retVal = rtk_switch_portmask_L2P_get(pPortmask, &pmask)) != RT_ERR_OK)
-        return retVal;
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData1[i][1])) != RT_ERR_OK)
+                            return retVal;
 
-    if ((retVal = rtl8367c_setAsicPortIsolationPermittedPortmask(rtk_switch_port_L2P_get(port), pmask)) != RT_ERR_OK)
-        return retVal;
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                }
+                else if (((regValue & 0x00F0) >> 4) == 0x0005)
+                {
+                    for (i = 0; i <= 8; i++)
+                    {
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData5[i][0])) != RT_ERR_OK)
+                            return retVal;
 
-    return RT_ERR_OK;
-}
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData5[i][1])) != RT_ERR_OK)
+                            return retVal;
 
-int32_t rtl8367::rtk_port_isolation_get(rtk_port_t port, rtk_portmask_t *pPortmask)
-{
-    int32_t retVal;
-    uint32_t pmask;
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                }
+                else if (((regValue & 0x00F0) >> 4) == 0x0006)
+                {
+                    for (i = 0; i <= 8; i++)
+                    {
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData6[i][0])) != RT_ERR_OK)
+                            return retVal;
 
-    /* Check Port Valid */
-    RTK_CHK_PORT_VALID(port);
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData6[i][1])) != RT_ERR_OK)
+                            return retVal;
 
-    if (NULL == pPortmask)
-        return RT_ERR_NULL_POINTER;
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                }
+                else if (((regValue & 0x00F0) >> 4) == 0x0008)
+                {
+                    for (i = 0; i <= 8; i++)
+                    {
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData8[i][0])) != RT_ERR_OK)
+                            return retVal;
 
-    if ((retVal = rtl8367c_getAsicPortIsolationPermittedPortmask(rtk_switch_port_L2P_get(port), &pmask)) != RT_ERR_OK)
-        return retVal;
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData8[i][1])) != RT_ERR_OK)
+                            return retVal;
 
-    if ((retVal = rtk_switch_portmask_P2L_get(pmask, pPortmask)) != RT_ERR_OK)
-        return retVal;
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                }
+                else if (((regValue & 0x00F0) >> 4) == 0x0009)
+                {
+                    for (i = 0; i <= 8; i++)
+                    {
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redData9[i][0])) != RT_ERR_OK)
+                            return retVal;
 
-    return RT_ERR_OK;
-}
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redData9[i][1])) != RT_ERR_OK)
+                            return retVal;
 
-// ------------------------------- MAC LEARNING LIMIT -------------------------------
+                        if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                            return retVal;
+                    }
+                }
+            }
+            else
+            {
+                for (i = 0; i <= 8; i++)
+                {
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, redDataHB[i][0])) != RT_ERR_OK)
+                        return retVal;
 
-/* Function Name:
- *      rtl8367c_setAsicLutLearnLimitNo
- * Description:
- *      Set per-Port auto learning limit number
- * Input:
- *      port    - Physical port number (0~7)
- *      number  - ASIC auto learning entries limit number
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK                   - Success
- *      RT_ERR_SMI                  - SMI access error
- *      RT_ERR_PORT_ID              - Invalid port number
- *      RT_ERR_LIMITED_L2ENTRY_NUM  - Invalid auto learning limit number
- * Note:
- *      None
- */
-/*�޸�: RTL8367C_PORTIDMAX, RTL8367C_LUT_LEARNLIMITMAX, RTL8367C_LUT_PORT_LEARN_LIMITNO_REG*/
-int32_t rtl8367::rtl8367c_setAsicLutLearnLimitNo(uint32_t port, uint32_t number)
-{
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, redDataHB[i][1])) != RT_ERR_OK)
+                        return retVal;
 
-    if (number > RTL8367C_LUT_LEARNLIMITMAX)
-        return RT_ERR_LIMITED_L2ENTRY_NUM;
+                    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                        return retVal;
+                }
+            }
+        }
 
-    if (port < 8)
-        return rtl8367c_setAsicReg(RTL8367C_LUT_PORT_LEARN_LIMITNO_REG(port), number);
-    else
-        return rtl8367c_setAsicReg(RTL8367C_REG_LUT_PORT8_LEARN_LIMITNO + port - 8, number);
-}
-/* Function Name:
- *      rtl8367c_getAsicLutLearnLimitNo
- * Description:
- *      Get per-Port auto learning limit number
- * Input:
- *      port    - Physical port number (0~7)
- *      pNumber     - ASIC auto learning entries limit number
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
- * Note:
- *      None
- */
-/*�޸�: RTL8367C_PORTIDMAX, RTL8367C_LUT_PORT_LEARN_LIMITNO_REG*/
-int32_t rtl8367::rtl8367c_getAsicLutLearnLimitNo(uint32_t port, uint32_t *pNumber)
-{
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
+        /* Only one ext port should care SGMII setting */
+        if (id == 1)
+        {
 
-    if (port < 8)
-        return rtl8367c_getAsicReg(RTL8367C_LUT_PORT_LEARN_LIMITNO_REG(port), pNumber);
-    else
-        return rtl8367c_getAsicReg(RTL8367C_REG_LUT_PORT8_LEARN_LIMITNO + port - 8, pNumber);
-}
+            if (mode == EXT_SGMII)
+            {
+                if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, 1)) != RT_ERR_OK)
+                    return retVal;
 
-int32_t rtl8367::rtk_l2_limitLearningCnt_set(rtk_port_t port, uint32_t mac_cnt)
-{
-    int32_t retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_HSGMII)
+            {
+                if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    /* check port valid */
-    RTK_CHK_PORT_VALID(port);
+                if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, 1)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else
+            {
 
-    if (mac_cnt > halCtrl.max_lut_addr_num)
-        return RT_ERR_LIMITED_L2ENTRY_NUM;
+                if ((mode != EXT_1000X_100FX) && (mode != EXT_1000X) && (mode != EXT_100FX))
+                {
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, 0)) != RT_ERR_OK)
+                        return retVal;
 
-    if ((retVal = rtl8367c_setAsicLutLearnLimitNo(rtk_switch_port_L2P_get(port), mac_cnt)) != RT_ERR_OK)
-        return retVal;
+                    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, 0)) != RT_ERR_OK)
+                        return retVal;
+                }
+            }
+        }
 
-    return RT_ERR_OK;
-}
+        if (0 == id || 1 == id)
+        {
+            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_DIGITAL_INTERFACE_SELECT, RTL8367C_SELECT_GMII_0_MASK << (id * RTL8367C_SELECT_GMII_1_OFFSET), mode)) != RT_ERR_OK)
+                return retVal;
+        }
+        else
+        {
+            if ((retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_DIGITAL_INTERFACE_SELECT_1, RTL8367C_SELECT_GMII_2_MASK, mode)) != RT_ERR_OK)
+                return retVal;
+        }
 
-int32_t rtl8367::rtk_l2_limitLearningCnt_get(rtk_port_t port, uint32_t *pMac_cnt)
-{
-    int32_t retVal;
+        /* Serdes not reset */
+        if ((mode == EXT_SGMII) || (mode == EXT_HSGMII))
+        {
+            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x7106)) != RT_ERR_OK)
+                return retVal;
 
-    /* check port valid */
-    RTK_CHK_PORT_VALID(port);
+            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, 0x0003)) != RT_ERR_OK)
+                return retVal;
 
-    if (NULL == pMac_cnt)
-        return RT_ERR_NULL_POINTER;
+            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                return retVal;
+        }
 
-    if ((retVal = rtl8367c_getAsicLutLearnLimitNo(rtk_switch_port_L2P_get(port), pMac_cnt)) != RT_ERR_OK)
-        return retVal;
+        if ((mode == EXT_SGMII) || (mode == EXT_HSGMII))
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 1)) != RT_ERR_OK)
+                return retVal;
 
-    return RT_ERR_OK;
-}
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_MISCELLANEOUS_CONFIGURE0, RTL8367C_DW8051_EN_OFFSET, 1)) != RT_ERR_OK)
+                return retVal;
 
-/* Function Name:
- *      rtl8367c_getAsicLutLearnNo
- * Description:
- *      Get per-Port auto learning number
- * Input:
- *      port    - Physical port number (0~7)
- *      pNumber     - ASIC auto learning entries number
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
- * Note:
- *      None
- */
-/*�޸�RTL8367C_PORTIDMAX, RTL8367C_REG_L2_LRN_CNT_REG, port10 reg is not contnious, wait for updating of base.h*/
-int32_t rtl8367::rtl8367c_getAsicLutLearnNo(uint32_t port, uint32_t *pNumber)
-{
-    int32_t retVal;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 1)) != RT_ERR_OK)
+                return retVal;
 
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
+                return retVal;
 
-    if (port < 10)
-    {
-        retVal = rtl8367c_getAsicReg(RTL8367C_REG_L2_LRN_CNT_REG(port), pNumber);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+            for (idx = 0; idx < SGMII_INIT_SIZE; idx++)
+            {
+                if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Sgmii_Init[idx])) != RT_ERR_OK)
+                    return retVal;
+            }
+
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
+                return retVal;
+
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 0)) != RT_ERR_OK)
+                return retVal;
+
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 0)) != RT_ERR_OK)
+                return retVal;
+        }
     }
-    else
+    else if (2 == type)
     {
-        retVal = rtl8367c_getAsicReg(RTL8367C_REG_L2_LRN_CNT_CTRL10, pNumber);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-    }
 
-    return RT_ERR_OK;
-}
-int32_t rtl8367::rtk_l2_learningCnt_get(rtk_port_t port, uint32_t *pMac_cnt)
-{
-    int32_t retVal;
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 1)) != RT_ERR_OK)
+            return retVal;
 
-    /* check port valid */
-    RTK_CHK_PORT_VALID(port);
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_MISCELLANEOUS_CONFIGURE0, RTL8367C_DW8051_EN_OFFSET, 1)) != RT_ERR_OK)
+            return retVal;
 
-    if (NULL == pMac_cnt)
-        return RT_ERR_NULL_POINTER;
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 1)) != RT_ERR_OK)
+            return retVal;
 
-    if ((retVal = rtl8367c_getAsicLutLearnNo(rtk_switch_port_L2P_get(port), pMac_cnt)) != RT_ERR_OK)
-        return retVal;
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
+            return retVal;
 
-    return RT_ERR_OK;
-}
+        for (idx = 0; idx < FIBER1_2_INIT_SIZE; idx++)
+        {
+            if ((retVal = rtl8367c_setAsicReg(0xE000 + idx, (uint32_t)Fiber1_2_Init[idx])) != RT_ERR_OK)
+                return retVal;
+        }
 
-// -------------------------------- ACL ---------------------------------------
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_IROM_MSB_OFFSET, 0)) != RT_ERR_OK)
+            return retVal;
 
-/* Function Name:
- *      rtl8367c_setAsicAclActCtrl
- * Description:
- *      Set ACL rule matched Action Control Bits
- * Input:
- *      index       - ACL rule index (0-95) of 96 ACL rules
- *      aclActCtrl  - 6 ACL Control Bits
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
- * Note:
- *      ACL Action Control Bits Indicate which actions will be take when a rule matches
- */
-int32_t rtl8367::rtl8367c_setAsicAclActCtrl(uint32_t index, uint32_t aclActCtrl)
-{
-    int32_t retVal;
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_DW8051_RDY, RTL8367C_ACS_IROM_ENABLE_OFFSET, 0)) != RT_ERR_OK)
+            return retVal;
 
-    if (index > RTL8367C_ACLRULEMAX)
-        return RT_ERR_OUT_OF_RANGE;
+        if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_CHIP_RESET, RTL8367C_DW8051_RST_OFFSET, 0)) != RT_ERR_OK)
+            return retVal;
 
-    if (index >= 64)
-        retVal = rtl8367c_setAsicRegBits(RTL8367C_ACL_ACTION_CTRL2_REG(index), RTL8367C_ACL_OP_ACTION_MASK(index), aclActCtrl);
-    else
-        retVal = rtl8367c_setAsicRegBits(RTL8367C_ACL_ACTION_CTRL_REG(index), RTL8367C_ACL_OP_ACTION_MASK(index), aclActCtrl);
+        if ((mode == EXT_TMII_MAC) || (mode == EXT_TMII_PHY))
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_BYPASS_LINE_RATE, id + 2, 1)) != RT_ERR_OK)
+                return retVal;
+        }
+        else
+        {
+            if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_BYPASS_LINE_RATE, id + 2, 0)) != RT_ERR_OK)
+                return retVal;
+        }
 
-    return retVal;
-}
-/* Function Name:
- *      rtl8367c_setAsicAclNot
- * Description:
- *      Set rule comparison result inversion / no inversion
- * Input:
- *      index   - ACL rule index (0-95) of 96 ACL rules
- *      not     - 1: inverse, 0: don't inverse
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicAclNot(uint32_t index, uint32_t nott)
-{
-    if (index > RTL8367C_ACLRULEMAX)
-        return RT_ERR_OUT_OF_RANGE;
+        if (id == 1)
+        {
+            if (mode == EXT_HSGMII)
+                return RT_ERR_PORT_ID;
 
-    if (index < 64)
-        return rtl8367c_setAsicRegBit(RTL8367C_ACL_ACTION_CTRL_REG(index), RTL8367C_ACL_OP_NOT_OFFSET(index), nott);
-    else
-        return rtl8367c_setAsicRegBit(RTL8367C_ACL_ACTION_CTRL2_REG(index), RTL8367C_ACL_OP_NOT_OFFSET(index), nott);
-}
-int32_t rtl8367::_rtk_filter_igrAcl_cfg_delAll()
-{
-    uint32_t i;
-    int32_t ret;
+            if (mode == EXT_SGMII)
+            {
 
-    for (i = 0; i < RTL8367C_ACLRULENO; i++)
-    {
-        if ((ret = rtl8367c_setAsicAclActCtrl(i, FILTER_ENACT_INIT_MASK)) != RT_ERR_OK)
-            return ret;
-        if ((ret = rtl8367c_setAsicAclNot(i, DISABLED)) != RT_ERR_OK)
-            return ret;
-    }
+                if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    return rtl8367c_setAsicRegBit(RTL8367C_REG_ACL_RESET_CFG, RTL8367C_ACL_RESET_CFG_OFFSET, 1);
-}
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 14, 1)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_1000X || mode == EXT_100FX || mode == EXT_1000X_100FX)
+            {
 
-/* Function Name:
- *      rtl8367c_setAsicAclTemplate
- * Description:
- *      Set fields of a ACL Template
- * Input:
- *      index   - ACL template index(0~4)
- *      pAclType - ACL type stucture for setting
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL template index(0~4)
- * Note:
- *      The API can set type field of the 5 ACL rule templates.
- *      Each type has 8 fields. One field means what data in one field of a ACL rule means
- *      8 fields of ACL rule 0~95 is descripted by one type in ACL group
- */
-int32_t rtl8367::rtl8367c_setAsicAclTemplate(uint32_t index, rtl8367c_acltemplate_t *pAclType)
-{
-    int32_t retVal;
-    uint32_t i;
-    uint32_t regAddr, regData;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    if (index >= RTL8367C_ACLTEMPLATENO)
-        return RT_ERR_OUT_OF_RANGE;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 14, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    regAddr = RTL8367C_ACL_RULE_TEMPLATE_CTRL_REG(index);
+                if ((retVal = rtl8367c_setAsicRegBit(0x6210, 11, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else
+            {
 
-    for (i = 0; i < (RTL8367C_ACLRULEFIELDNO / 2); i++)
-    {
-        regData = pAclType->field[i * 2 + 1];
-        regData = regData << 8 | pAclType->field[i * 2];
+                if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, mode)) != RT_ERR_OK)
+                    return retVal;
 
-        retVal = rtl8367c_setAsicReg(regAddr + i, regData);
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 14, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
 
-        if (retVal != RT_ERR_OK)
-            return retVal;
-    }
-
-    return retVal;
-}
-
-/* Function Name:
- *      rtl8367c_setAsicFieldSelector
- * Description:
- *      Set user defined field selectors in HSB
- * Input:
- *      index       - index of field selector 0-15
- *      format      - Format of field selector
- *      offset      - Retrieving data offset
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK           - Success
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_OUT_OF_RANGE - input parameter out of range
- * Note:
- *      System support 16 user defined field selctors.
- *      Each selector can be enabled or disable. User can defined retrieving 16-bits in many predefiend
- *      standard l2/l3/l4 payload.
- */
-int32_t rtl8367::rtl8367c_setAsicFieldSelector(uint32_t index, uint32_t format, uint32_t offset)
-{
-    uint32_t regData;
-
-    if (index > RTL8367C_FIELDSEL_FORMAT_NUMBER)
-        return RT_ERR_OUT_OF_RANGE;
+            if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 0x1f)) != RT_ERR_OK)
+                return retVal;
+        }
+        else if (id == 2)
+        {
+            if (mode == EXT_HSGMII)
+            {
+                if ((retVal = rtl8367c_setAsicReg(0x130, 7)) != RT_ERR_OK)
+                    return retVal;
 
-    if (format >= FIELDSEL_FORMAT_END)
-        return RT_ERR_OUT_OF_RANGE;
+                if ((retVal = rtl8367c_setAsicReg(0x39f, 7)) != RT_ERR_OK)
+                    return retVal;
 
-    regData = (((format << RTL8367C_FIELD_SELECTOR_FORMAT_OFFSET) & RTL8367C_FIELD_SELECTOR_FORMAT_MASK) |
-               ((offset << RTL8367C_FIELD_SELECTOR_OFFSET_OFFSET) & RTL8367C_FIELD_SELECTOR_OFFSET_MASK));
+                if ((retVal = rtl8367c_setAsicReg(0x3fa, 7)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else
+            {
+                if ((retVal = rtl8367c_setAsicReg(0x130, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    return rtl8367c_setAsicReg(RTL8367C_FIELD_SELECTOR_REG(index), regData);
-}
-/* Function Name:
- *      rtl8367c_setAsicAcl
- * Description:
- *      Set port acl function enable/disable
- * Input:
- *      port    - Physical port number (0~10)
- *      enabled - 1: enabled, 0: disabled
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicAcl(uint32_t port, uint32_t enabled)
-{
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
+                if ((retVal = rtl8367c_setAsicReg(0x39f, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    return rtl8367c_setAsicRegBit(RTL8367C_ACL_ENABLE_REG, port, enabled);
-}
-/* Function Name:
- *      rtl8367c_setAsicAclUnmatchedPermit
- * Description:
- *      Set port acl function unmatched permit action
- * Input:
- *      port    - Physical port number (0~10)
- *      enabled - 1: enabled, 0: disabled
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicAclUnmatchedPermit(uint32_t port, uint32_t enabled)
-{
-    if (port > RTL8367C_PORTIDMAX)
-        return RT_ERR_PORT_ID;
+                if ((retVal = rtl8367c_setAsicReg(0x3fa, 4)) != RT_ERR_OK)
+                    return retVal;
+            }
 
-    return rtl8367c_setAsicRegBit(RTL8367C_ACL_UNMATCH_PERMIT_REG, port, enabled);
-}
-int32_t rtl8367::rtk_filter_igrAcl_init()
-{
-    rtl8367c_acltemplate_t aclTemp;
-    uint32_t i, j;
-    int32_t ret;
+            if (mode == EXT_SGMII)
+            {
 
-    if ((ret = _rtk_filter_igrAcl_cfg_delAll()) != RT_ERR_OK)
-        return ret;
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
-    {
-        for (j = 0; j < RTL8367C_ACLRULEFIELDNO; j++)
-            aclTemp.field[j] = filter_templateField[i][j];
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 6, 1)) != RT_ERR_OK)
+                    return retVal;
 
-        if ((ret = rtl8367c_setAsicAclTemplate(i, &aclTemp)) != RT_ERR_OK)
-            return ret;
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 7, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_HSGMII)
+            {
 
-    for (i = 0; i < RTL8367C_FIELDSEL_FORMAT_NUMBER; i++)
-    {
-        if ((ret = rtl8367c_setAsicFieldSelector(i, field_selector[i][0], field_selector[i][1])) != RT_ERR_OK)
-            return ret;
-    }
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    RTK_SCAN_ALL_PHY_PORTMASK(i)
-    {
-        if ((ret = rtl8367c_setAsicAcl(i, 1)) != RT_ERR_OK)
-            return ret;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 6, 0)) != RT_ERR_OK)
+                    return retVal;
 
-        if ((ret = rtl8367c_setAsicAclUnmatchedPermit(i, 1)) != RT_ERR_OK)
-            return ret;
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 7, 1)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_1000X || mode == EXT_100FX || mode == EXT_1000X_100FX)
+            {
 
-    return RT_ERR_OK;
-}
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
+                    return retVal;
 
-/* Function Name:
- *      rtl8367c_getAsicAclTemplate
- * Description:
- *      Get fields of a ACL Template
- * Input:
- *      index   - ACL template index(0~4)
- *      pAclType - ACL type stucture for setting
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL template index(0~4)
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicAclTemplate(uint32_t index, rtl8367c_acltemplate_t *pAclType)
-{
-    int32_t retVal;
-    uint32_t i;
-    uint32_t regData, regAddr;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 6, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    if (index >= RTL8367C_ACLTEMPLATENO)
-        return RT_ERR_OUT_OF_RANGE;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    regAddr = RTL8367C_ACL_RULE_TEMPLATE_CTRL_REG(index);
+                if ((retVal = rtl8367c_setAsicRegBit(0x6200, 11, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else
+            {
 
-    for (i = 0; i < (RTL8367C_ACLRULEFIELDNO / 2); i++)
-    {
-        retVal = rtl8367c_getAsicReg(regAddr + i, &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, mode)) != RT_ERR_OK)
+                    return retVal;
 
-        pAclType->field[i * 2] = regData & 0xFF;
-        pAclType->field[i * 2 + 1] = (regData >> 8) & 0xFF;
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 6, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    return RT_ERR_OK;
-}
-int32_t rtl8367::rtk_filter_igrAcl_template_set(rtk_filter_template_t *aclTemplate)
-{
-    int32_t retVal;
-    uint32_t idxField;
-    rtl8367c_acltemplate_t aclType;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d92, 7, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
 
-    if (aclTemplate->index >= RTK_MAX_NUM_OF_FILTER_TYPE)
-        return RT_ERR_INPUT;
+            if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 0x1f)) != RT_ERR_OK)
+                return retVal;
+        }
 
-    for (idxField = 0; idxField < RTK_MAX_NUM_OF_FILTER_FIELD; idxField++)
-    {
-        if (aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_DMAC_15_0 ||
-            (aclTemplate->fieldType[idxField] > FILTER_FIELD_RAW_CTAG && aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_IPV4_SIP_15_0) ||
-            (aclTemplate->fieldType[idxField] > FILTER_FIELD_RAW_IPV4_DIP_31_16 && aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_IPV6_SIP_15_0) ||
-            (aclTemplate->fieldType[idxField] > FILTER_FIELD_RAW_IPV6_DIP_31_16 && aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_VIDRANGE) ||
-            (aclTemplate->fieldType[idxField] > FILTER_FIELD_RAW_FIELD_VALID && aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_FIELD_SELECT00) ||
-            aclTemplate->fieldType[idxField] >= FILTER_FIELD_RAW_END)
+        if (mode == EXT_RGMII)
         {
-            return RT_ERR_INPUT;
-        }
-    }
 
-    for (idxField = 0; idxField < RTK_MAX_NUM_OF_FILTER_FIELD; idxField++)
-    {
-        aclType.field[idxField] = aclTemplate->fieldType[idxField];
-    }
+            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_PARA_LED_IO_EN3, 0)) != RT_ERR_OK)
+                return retVal;
 
-    if ((retVal = rtl8367c_setAsicAclTemplate(aclTemplate->index, &aclType)) != RT_ERR_OK)
-        return retVal;
+            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_PARA_LED_IO_EN1, 0)) != RT_ERR_OK)
+                return retVal;
 
-    return RT_ERR_OK;
-}
+            if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_PARA_LED_IO_EN2, 0)) != RT_ERR_OK)
+                return retVal;
 
-int32_t rtl8367::rtk_filter_igrAcl_template_get(rtk_filter_template_t *aclTemplate)
-{
-    int32_t ret;
-    uint32_t idxField;
-    rtl8367c_acltemplate_t aclType;
+            if (id == 1)
+            {
 
-    if (NULL == aclTemplate)
-        return RT_ERR_NULL_POINTER;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 9, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    if (aclTemplate->index >= RTK_MAX_NUM_OF_FILTER_TYPE)
-        return RT_ERR_INPUT;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 6, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    if ((ret = rtl8367c_getAsicAclTemplate(aclTemplate->index, &aclType)) != RT_ERR_OK)
-        return ret;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 4, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    for (idxField = 0; idxField < RTK_MAX_NUM_OF_FILTER_FIELD; idxField++)
-    {
-        aclTemplate->fieldType[idxField] = (rtk_filter_field_type_raw_t)aclType.field[idxField];
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    return RT_ERR_OK;
-}
+                if ((retVal = rtl8367c_setAsicRegBit(0x1307, 3, 1)) != RT_ERR_OK)
+                    return retVal;
 
-int32_t rtl8367::rtk_filter_igrAcl_field_add(rtk_filter_cfg_t *pFilter_cfg, rtk_filter_field_t *pFilter_field)
-{
-    uint32_t i;
-    rtk_filter_field_t *tailPtr;
+                if ((retVal = rtl8367c_setAsicRegBits(0x13f9, 0x38, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    if (NULL == pFilter_cfg || NULL == pFilter_field)
-        return RT_ERR_NULL_POINTER;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1307, 0x7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    if (pFilter_field->fieldType >= FILTER_FIELD_END)
-        return RT_ERR_ENTRY_INDEX;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1304, 0x7000, 4)) != RT_ERR_OK)
+                    return retVal;
 
-    if (0 == pFilter_field->fieldTemplateNo)
-    {
-        pFilter_field->fieldTemplateNo = filter_fieldSize[pFilter_field->fieldType];
+                if ((retVal = rtl8367c_setAsicRegBits(0x13f9, 0x700, 4)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (id == 2)
+            {
 
-        for (i = 0; i < pFilter_field->fieldTemplateNo; i++)
-        {
-            pFilter_field->fieldTemplateIdx[i] = filter_fieldTemplateIndex[pFilter_field->fieldType][i];
-        }
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1303, 10, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    if (NULL == pFilter_cfg->fieldHead)
-    {
-        pFilter_cfg->fieldHead = pFilter_field;
-    }
-    else
-    {
-        if (pFilter_cfg->fieldHead->next == NULL)
-        {
-            pFilter_cfg->fieldHead->next = pFilter_field;
-        }
-        else
-        {
-            tailPtr = pFilter_cfg->fieldHead->next;
-            while (tailPtr->next != NULL)
-            {
-                tailPtr = tailPtr->next;
-            }
-            tailPtr->next = pFilter_field;
-        }
-    }
+                /*drving 1*/
+                if ((retVal = rtl8367c_setAsicRegBit(0x13e2, 2, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    return RT_ERR_OK;
-}
+                /*drving 1*/
+                if ((retVal = rtl8367c_setAsicRegBit(0x13e2, 1, 1)) != RT_ERR_OK)
+                    return retVal;
 
-int32_t rtl8367::_rtk_filter_igrAcl_writeDataField(rtl8367c_aclrule *aclRule, rtk_filter_field_t *fieldPtr)
-{
-    uint32_t i, tempIdx, fieldIdx, ipValue, ipMask;
-    uint32_t ip6addr[RTK_IPV6_ADDR_WORD_LENGTH];
-    uint32_t ip6mask[RTK_IPV6_ADDR_WORD_LENGTH];
+                if ((retVal = rtl8367c_setAsicRegBit(0x13e2, 0, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-    {
-        tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+                if ((retVal = rtl8367c_setAsicRegBit(0x13c5, 3, 1)) != RT_ERR_OK)
+                    return retVal;
 
-        aclRule[tempIdx].valid = 1;
-    }
+                if ((retVal = rtl8367c_setAsicRegBits(0x13f9, 0x1c0, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    switch (fieldPtr->fieldType)
-    {
-    /* use DMAC structure as representative for mac structure */
-    case FILTER_FIELD_DMAC:
-    case FILTER_FIELD_SMAC:
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c5, 0x7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicRegBits(0x13e2, 0x1c0, 4)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.mac.value.octet[5 - i * 2] | (fieldPtr->filter_pattern_union.mac.value.octet[5 - (i * 2 + 1)] << 8);
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.mac.mask.octet[5 - i * 2] | (fieldPtr->filter_pattern_union.mac.mask.octet[5 - (i * 2 + 1)] << 8);
+                if ((retVal = rtl8367c_setAsicRegBits(0x13e2, 0x38, 4)) != RT_ERR_OK)
+                    return retVal;
+            }
         }
-        break;
-    case FILTER_FIELD_ETHERTYPE:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        else if (mode == EXT_SGMII)
         {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
-
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.etherType.value;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.etherType.mask;
-        }
-        break;
-    case FILTER_FIELD_IPV4_SIP:
-    case FILTER_FIELD_IPV4_DIP:
+            if (id == 1)
+            {
+                /*sds 1     reg 1    page 0x21     write value  0xec91*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0xec91)) != RT_ERR_OK)
+                    return retVal;
 
-        ipValue = fieldPtr->filter_pattern_union.sip.value;
-        ipMask = fieldPtr->filter_pattern_union.sip.mask;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x21 << 5) | 1)) != RT_ERR_OK)
+                    return retVal;
 
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C1)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = (0xFFFF & (ipValue >> (i * 16)));
-            aclRule[tempIdx].care_bits.field[fieldIdx] = (0xFFFF & (ipMask >> (i * 16)));
-        }
-        break;
-    case FILTER_FIELD_IPV4_TOS:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                /*sds 1     reg 5    page 0x24     write value  0x5825*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x5825)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.ipTos.value & 0xFF;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.ipTos.mask & 0xFF;
-        }
-        break;
-    case FILTER_FIELD_IPV4_PROTOCOL:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x24 << 5) | 5)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.protocol.value & 0xFF;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.protocol.mask & 0xFF;
-        }
-        break;
-    case FILTER_FIELD_IPV6_SIPV6:
-    case FILTER_FIELD_IPV6_DIPV6:
-        for (i = 0; i < RTK_IPV6_ADDR_WORD_LENGTH; i++)
-        {
-            ip6addr[i] = fieldPtr->filter_pattern_union.sipv6.value.addr[i];
-            ip6mask[i] = fieldPtr->filter_pattern_union.sipv6.mask.addr[i];
-        }
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C1)) != RT_ERR_OK)
+                    return retVal;
 
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 2)) != RT_ERR_OK)
+                    return retVal;
 
-            if (i < 2)
-            {
-                aclRule[tempIdx].data_bits.field[fieldIdx] = ((ip6addr[0] & (0xFFFF << (i * 16))) >> (i * 16));
-                aclRule[tempIdx].care_bits.field[fieldIdx] = ((ip6mask[0] & (0xFFFF << (i * 16))) >> (i * 16));
+                /*?????????????????*/
             }
-            else
+            else if (id == 2)
             {
-                /*default acl template for ipv6 address supports MSB 32-bits and LSB 32-bits only*/
-                aclRule[tempIdx].data_bits.field[fieldIdx] = ((ip6addr[3] & (0xFFFF << ((i & 1) * 16))) >> ((i & 1) * 16));
-                aclRule[tempIdx].care_bits.field[fieldIdx] = ((ip6mask[3] & (0xFFFF << ((i & 1) * 16))) >> ((i & 1) * 16));
-            }
-        }
+                /*sds 0     reg 0    page 0x28     write value  0x942c*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x942c)) != RT_ERR_OK)
+                    return retVal;
 
-        break;
-    case FILTER_FIELD_CTAG:
-    case FILTER_FIELD_STAG:
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x28 << 5) | 0)) != RT_ERR_OK)
+                    return retVal;
 
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.l2tag.pri.value << 13) | (fieldPtr->filter_pattern_union.l2tag.cfi.value << 12) | fieldPtr->filter_pattern_union.l2tag.vid.value;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.l2tag.pri.mask << 13) | (fieldPtr->filter_pattern_union.l2tag.cfi.mask << 12) | fieldPtr->filter_pattern_union.l2tag.vid.mask;
-        }
-        break;
-    case FILTER_FIELD_IPV4_FLAG:
+                /*sds 0     reg 0    page 0x24     write value  0x942c*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x942c)) != RT_ERR_OK)
+                    return retVal;
 
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x24 << 5) | 0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] &= 0x1FFF;
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.xf.value << 15);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.df.value << 14);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.mf.value << 13);
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].care_bits.field[fieldIdx] &= 0x1FFF;
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.xf.mask << 15);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.df.mask << 14);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.mf.mask << 13);
-        }
+                /*sds 0     reg 5    page 0x21     write value  0x8dc3*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x8dc3)) != RT_ERR_OK)
+                    return retVal;
 
-        break;
-    case FILTER_FIELD_IPV4_OFFSET:
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x21 << 5) | 5)) != RT_ERR_OK)
+                    return retVal;
 
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] &= 0xE000;
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.inData.value;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 2)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].care_bits.field[fieldIdx] &= 0xE000;
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.inData.mask;
+                /*?????????????????*/
+            }
         }
-
-        break;
-
-    case FILTER_FIELD_IPV6_TRAFFIC_CLASS:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        else if (mode == EXT_HSGMII)
         {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
-
-            aclRule[tempIdx].data_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.inData.value << 4) & 0x0FF0;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.inData.mask << 4) & 0x0FF0;
-        }
-        break;
-    case FILTER_FIELD_IPV6_NEXT_HEADER:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
-
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.inData.value << 8;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.inData.mask << 8;
-        }
-        break;
-    case FILTER_FIELD_TCP_SPORT:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
-
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.tcpSrcPort.value;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.tcpSrcPort.mask;
-        }
-        break;
-    case FILTER_FIELD_TCP_DPORT:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
-
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.tcpDstPort.value;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.tcpDstPort.mask;
-        }
-        break;
-    case FILTER_FIELD_TCP_FLAG:
-
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
-
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.cwr.value << 7);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.ece.value << 6);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.urg.value << 5);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.ack.value << 4);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.psh.value << 3);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.rst.value << 2);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.syn.value << 1);
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.tcpFlag.fin.value;
+            if (id == 2)
+            {
+                /*sds 0     reg 0    page 0x28     write value  0x942c*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x942c)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.cwr.mask << 7);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.ece.mask << 6);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.urg.mask << 5);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.ack.mask << 4);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.psh.mask << 3);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.rst.mask << 2);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.syn.mask << 1);
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.tcpFlag.fin.mask;
-        }
-        break;
-    case FILTER_FIELD_UDP_SPORT:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x28 << 5) | 0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.udpSrcPort.value;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.udpSrcPort.mask;
-        }
-        break;
-    case FILTER_FIELD_UDP_DPORT:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.udpDstPort.value;
-            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.udpDstPort.mask;
-        }
-        break;
-    case FILTER_FIELD_ICMP_CODE:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                /*sds 0     reg 0    page 0x24     write value  0x942c*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x942c)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] &= 0xFF00;
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.icmpCode.value;
-            aclRule[tempIdx].care_bits.field[fieldIdx] &= 0xFF00;
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.icmpCode.mask;
-        }
-        break;
-    case FILTER_FIELD_ICMP_TYPE:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x24 << 5) | 0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] &= 0x00FF;
-            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.icmpType.value << 8);
-            aclRule[tempIdx].care_bits.field[fieldIdx] &= 0x00FF;
-            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.icmpType.mask << 8);
-        }
-        break;
-    case FILTER_FIELD_IGMP_TYPE:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.igmpType.value << 8);
-            aclRule[tempIdx].care_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.igmpType.mask << 8);
-        }
-        break;
-    case FILTER_FIELD_PATTERN_MATCH:
-        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
-        {
-            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
-            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+                /*sds 0     reg 5    page 0x21     write value  0x8dc3*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x8dc3)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[tempIdx].data_bits.field[fieldIdx] = ((fieldPtr->filter_pattern_union.pattern.value[i / 2] >> (16 * (i % 2))) & 0x0000FFFF);
-            aclRule[tempIdx].care_bits.field[fieldIdx] = ((fieldPtr->filter_pattern_union.pattern.mask[i / 2] >> (16 * (i % 2))) & 0x0000FFFF);
-        }
-        break;
-    case FILTER_FIELD_VID_RANGE:
-    case FILTER_FIELD_IP_RANGE:
-    case FILTER_FIELD_PORT_RANGE:
-    default:
-        tempIdx = (fieldPtr->fieldTemplateIdx[0] & 0xF0) >> 4;
-        fieldIdx = fieldPtr->fieldTemplateIdx[0] & 0x0F;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x21 << 5) | 5)) != RT_ERR_OK)
+                    return retVal;
 
-        aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.inData.value;
-        aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.inData.mask;
-        break;
-    }
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                    return retVal;
 
-    return RT_ERR_OK;
-}
+                /* optimizing HISGMII performance while RGMII used & */
+                /*sds 0     reg 9     page 0x21     write value 0x3931*/
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_DATA, 0x3931)) != RT_ERR_OK)
+                    return retVal;
 
-/* Function Name:
- *      rtk_svlan_checkAndCreateMbr
- * Description:
- *      Check and create Member configuration and return index
- * Input:
- *      vid  - VLAN id.
- * Output:
- *      pIndex  - Member configuration index
- * Return:
- *      RT_ERR_OK           - OK
- *      RT_ERR_FAILED       - Failed
- *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_VLAN_VID     - Invalid VLAN ID.
- *      RT_ERR_TBL_FULL     - Member Configuration table full
- * Note:
- *
- */
-int32_t rtl8367::rtk_svlan_checkAndCreateMbr(uint32_t vid, uint32_t *pIndex)
-{
-    int32_t retVal;
-    uint32_t svidx;
-    uint32_t empty_idx = 0xFFFF;
-    rtl8367c_svlan_memconf_t svlan_cfg;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_ADR, (0x21 << 5) | 9)) != RT_ERR_OK)
+                    return retVal;
 
-    /* vid must be 0~4095 */
-    if (vid > RTL8367C_VIDMAX)
-        return RT_ERR_VLAN_VID;
+                if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_SDS_INDACS_CMD, 0x00C0)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Null pointer check */
-    if (NULL == pIndex)
-        return RT_ERR_NULL_POINTER;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 0x12)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Search exist entry */
-    for (svidx = 0; svidx <= RTL8367C_SVIDXMAX; svidx++)
-    {
-        if (svlan_mbrCfgUsage[svidx] == 1)
-        {
-            if (svlan_mbrCfgVid[svidx] == vid)
-            {
-                /* Found! return index */
-                *pIndex = svidx;
-                return RT_ERR_OK;
+                /*?????????????????*/
             }
         }
-        else if (empty_idx == 0xFFFF)
+        else if (mode == EXT_1000X)
         {
-            empty_idx = svidx;
-        }
-    }
-
-    if (empty_idx == 0xFFFF)
-    {
-        /* No empty index */
-        return RT_ERR_TBL_FULL;
-    }
+            if (id == 1)
+            {
 
-    svlan_mbrCfgUsage[empty_idx] = 1;
-    svlan_mbrCfgVid[empty_idx] = vid;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 1, 0x21, 0xec91)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 5, 0x24, 0x5825)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 4)) != RT_ERR_OK)
+                    return retVal;
 
-    memset(&svlan_cfg, 0, sizeof(rtl8367c_svlan_memconf_t));
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
 
-    svlan_cfg.vs_svid = vid;
-    /*for create check*/
-    if (vid == 0)
-    {
-        svlan_cfg.vs_efid = 1;
-    }
+                /*patch speed change sds1 1000M*/
+                if ((retVal = rtl8367c_getAsicSdsReg(1, 4, 0, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFF0FFF;
+                regValue |= 0x9000;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 4, 0, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    if ((retVal = rtl8367c_setAsicSvlanMemberConfiguration(empty_idx, &svlan_cfg)) != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_getAsicSdsReg(1, 0, 2, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFFdFFF;
+                regValue |= 0x40;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 0, 2, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    *pIndex = empty_idx;
-    return RT_ERR_OK;
-}
+                if ((retVal = rtl8367c_getAsicSdsReg(1, 4, 0, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFFEFFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 4, 0, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-void rtl8367::_rtl8367c_aclRuleStSmi2User(rtl8367c_aclrule *pAclUser, rtl8367c_aclrulesmi *pAclSmi)
-{
-    uint8_t *care_ptr, *data_ptr;
-    uint8_t care_tmp, data_tmp;
-    uint32_t i;
-
-    pAclUser->data_bits.active_portmsk = (((pAclSmi->data_bits_ext.rule_info >> 1) & 0x0007) << 8) | ((pAclSmi->data_bits.rule_info >> 8) & 0x00FF);
-    pAclUser->data_bits.type = (pAclSmi->data_bits.rule_info & 0x0007);
-    pAclUser->data_bits.tag_exist = (pAclSmi->data_bits.rule_info & 0x00F8) >> 3;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 4)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x6000, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (id == 2)
+            {
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x28, 0x942c)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x24, 0x942c)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 5, 0x21, 0x8dc3)) != RT_ERR_OK)
+                    return retVal;
 
-    care_ptr = (uint8_t *)&pAclSmi->care_bits;
-    data_ptr = (uint8_t *)&pAclSmi->data_bits;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 4)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < sizeof(struct acl_rule_smi_st); i++)
-    {
-        care_tmp = *(care_ptr + i) ^ (*(data_ptr + i));
-        data_tmp = *(data_ptr + i);
+                /*patch speed change sds0 1000M*/
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 0x1f)) != RT_ERR_OK)
+                    return retVal;
 
-        *(care_ptr + i) = care_tmp;
-        *(data_ptr + i) = data_tmp;
-    }
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFF0FFF;
+                regValue |= 0x9000;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    care_ptr = (uint8_t *)&pAclSmi->care_bits_ext;
-    data_ptr = (uint8_t *)&pAclSmi->data_bits_ext;
-    care_tmp = (*care_ptr) ^ (*data_ptr);
-    data_tmp = (*data_ptr);
-    *care_ptr = care_tmp;
-    *data_ptr = data_tmp;
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFFDFFF;
+                regValue |= 0x40;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
-        pAclUser->data_bits.field[i] = pAclSmi->data_bits.field[i];
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFFEFFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    pAclUser->valid = pAclSmi->valid;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 4)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0xe0, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+        }
+        else if (mode == EXT_100FX)
+        {
+            if (id == 1)
+            {
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 1, 0x21, 0xec91)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 5, 0x24, 0x5825)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 5)) != RT_ERR_OK)
+                    return retVal;
 
-    pAclUser->care_bits.active_portmsk = (((pAclSmi->care_bits_ext.rule_info >> 1) & 0x0007) << 8) | ((pAclSmi->care_bits.rule_info >> 8) & 0x00FF);
-    pAclUser->care_bits.type = (pAclSmi->care_bits.rule_info & 0x0007);
-    pAclUser->care_bits.tag_exist = (pAclSmi->care_bits.rule_info & 0x00F8) >> 3;
+                /*patch speed change sds1 100M*/
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_getAsicSdsReg(1, 4, 0, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFF0FFF;
+                regValue |= 0xb000;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 4, 0, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
-        pAclUser->care_bits.field[i] = pAclSmi->care_bits.field[i];
-}
-/* Function Name:
- *      rtl8367c_getAsicAclRule
- * Description:
- *      Get acl rule content
- * Input:
- *      index   - ACL rule index (0-63) of 64 ACL rules
- *      pAclRule - ACL rule stucture for setting
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-63)
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicAclRule(uint32_t index, rtl8367c_aclrule *pAclRule)
-{
-    rtl8367c_aclrulesmi aclRuleSmi;
-    uint32_t regAddr, regData;
-    int32_t retVal;
-    uint16_t *tableAddr;
-    uint32_t i;
+                if ((retVal = rtl8367c_getAsicSdsReg(1, 0, 2, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFFFFBF;
+                regValue |= 0x2000;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 0, 2, regValue)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_getAsicSdsReg(1, 4, 0, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFFEFFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 4, 0, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    if (index > RTL8367C_ACLRULEMAX)
-        return RT_ERR_OUT_OF_RANGE;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 5)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x6000, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (id == 2)
+            {
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x28, 0x942c)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x24, 0x942c)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 5, 0x21, 0x8dc3)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 5)) != RT_ERR_OK)
+                    return retVal;
 
-    memset(&aclRuleSmi, 0x00, sizeof(rtl8367c_aclrulesmi));
+                /*patch speed change sds0 100M*/
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 0x1f)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write ACS_ADR register for data bits */
-    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
-    if (index >= 64)
-        regData = RTL8367C_ACLRULETBADDR2(DATABITS, index);
-    else
-        regData = RTL8367C_ACLRULETBADDR(DATABITS, index);
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFF0FFF;
+                regValue |= 0xb000;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    retVal = rtl8367c_setAsicReg(regAddr, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 0, 2, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFFFFBF;
+                regValue |= 0x2000;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 2, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write ACS_CMD register */
-    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
-    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_READ, TB_TARGET_ACLRULE);
-    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 4, 0, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue &= 0xFFFFEFFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 4, 0, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Read Data Bits */
-    regAddr = RTL8367C_TABLE_ACCESS_RDDATA_BASE;
-    tableAddr = (uint16_t *)&aclRuleSmi.data_bits;
-    for (i = 0; i < RTL8367C_ACLRULETBLEN; i++)
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 5)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0xe0, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+        }
+        else if (mode == EXT_1000X_100FX)
+        {
+            if (id == 1)
+            {
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 1, 0x21, 0xec91)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 5, 0x24, 0x5825)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 13, 0, 0x4616)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(1, 1, 0, 0xf20)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f00, 7)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (id == 2)
+            {
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x28, 0x942c)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 0, 0x24, 0x942c)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 5, 0x21, 0x8dc3)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 13, 0, 0x4616)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 1, 0, 0xf20)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d92, 0x1f, 7)) != RT_ERR_OK)
+                    return retVal;
+            }
+        }
+    }
+    else if (3 == type)
     {
-        retVal = rtl8367c_getAsicReg(regAddr, &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
 
-        *tableAddr = regData;
+        /*restore patch, by designer. patch Tx FIFO issue, when not HSGMII 2.5G mode
+         #sds0, page 1, reg 1, bit4=0*/
+        if ((retVal = rtl8367c_getAsicSdsReg(0, 1, 1, &regValue)) != RT_ERR_OK)
+            return retVal;
+        regValue &= 0xFFFFFFEF;
+        if ((retVal = rtl8367c_setAsicSdsReg(0, 1, 1, regValue)) != RT_ERR_OK)
+            return retVal;
 
-        regAddr++;
-        tableAddr++;
-    }
+        /*set for mac 6*/
+        if (1 == id)
+        {
 
-    /* Read Valid Bit */
-    retVal = rtl8367c_getAsicRegBit(RTL8367C_TABLE_ACCESS_RDDATA_REG(RTL8367C_ACLRULETBLEN), 0, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-    aclRuleSmi.valid = regData & 0x1;
-    /* Read active_portmsk_ext Bits */
-    retVal = rtl8367c_getAsicRegBits(RTL8367C_TABLE_ACCESS_RDDATA_REG(RTL8367C_ACLRULETBLEN), 0x7 << 1, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-    aclRuleSmi.data_bits_ext.rule_info = (regData % 0x0007) << 1;
+            if ((retVal = rtl8367c_setAsicReg(0x137c, 0x1000)) != RT_ERR_OK)
+                return retVal;
 
-    /* Write ACS_ADR register for carebits*/
-    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
-    if (index >= 64)
-        regData = RTL8367C_ACLRULETBADDR2(CAREBITS, index);
-    else
-        regData = RTL8367C_ACLRULETBADDR(CAREBITS, index);
+            if ((retVal = rtl8367c_getAsicRegBit(0x1d9d, 6, &reg_data)) != RT_ERR_OK)
+                return retVal;
+            while (reg_data == 0)
+            {
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d9d, 6, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+            }
 
-    retVal = rtl8367c_setAsicReg(regAddr, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+            if (mode == EXT_SGMII)
+            {
 
-    /* Write ACS_CMD register */
-    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
-    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_READ, TB_TARGET_ACLRULE);
-    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                if (reg_data == 0)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
+                        return retVal;
+                }
 
-    /* Read Care Bits */
-    regAddr = RTL8367C_TABLE_ACCESS_RDDATA_BASE;
-    tableAddr = (uint16_t *)&aclRuleSmi.care_bits;
-    for (i = 0; i < RTL8367C_ACLRULETBLEN; i++)
-    {
-        retVal = rtl8367c_getAsicReg(regAddr, &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-        *tableAddr = regData;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-        regAddr++;
-        tableAddr++;
-    }
-    /* Read active_portmsk_ext care Bits */
-    retVal = rtl8367c_getAsicRegBits(RTL8367C_TABLE_ACCESS_RDDATA_REG(RTL8367C_ACLRULETBLEN), 0x7 << 1, &regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-    aclRuleSmi.care_bits_ext.rule_info = (regData & 0x0007) << 1;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    _rtl8367c_aclRuleStSmi2User(pAclRule, &aclRuleSmi);
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 0, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    return RT_ERR_OK;
-}
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 9, 0)) != RT_ERR_OK)
+                    return retVal;
 
-void rtl8367::_rtl8367c_aclActStUser2Smi(rtl8367c_acl_act_t *pAclUser, uint16_t *pAclSmi)
-{
-    pAclSmi[0] |= (pAclUser->cvidx_cact & 0x003F);
-    pAclSmi[0] |= (pAclUser->cact & 0x0003) << 6;
-    pAclSmi[0] |= (pAclUser->svidx_sact & 0x003F) << 8;
-    pAclSmi[0] |= (pAclUser->sact & 0x0003) << 14;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    pAclSmi[1] |= (pAclUser->aclmeteridx & 0x003F);
-    pAclSmi[1] |= (pAclUser->fwdpmask & 0x00FF) << 6;
-    pAclSmi[1] |= (pAclUser->fwdact & 0x0003) << 14;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    pAclSmi[2] |= (pAclUser->pridx & 0x003F);
-    pAclSmi[2] |= (pAclUser->priact & 0x0003) << 6;
-    pAclSmi[2] |= (pAclUser->gpio_pin & 0x000F) << 8;
-    pAclSmi[2] |= (pAclUser->gpio_en & 0x0001) << 12;
-    pAclSmi[2] |= (pAclUser->aclint & 0x0001) << 13;
-    pAclSmi[2] |= (pAclUser->cact_ext & 0x0003) << 14;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
 
-    pAclSmi[3] |= (pAclUser->tag_fmt & 0x0003);
-    pAclSmi[3] |= (pAclUser->fwdact_ext & 0x0001) << 2;
-    pAclSmi[3] |= ((pAclUser->cvidx_cact & 0x0040) >> 6) << 3;
-    pAclSmi[3] |= ((pAclUser->svidx_sact & 0x0040) >> 6) << 4;
-    pAclSmi[3] |= ((pAclUser->aclmeteridx & 0x0040) >> 6) << 5;
-    pAclSmi[3] |= ((pAclUser->fwdpmask & 0x0700) >> 8) << 6;
-    pAclSmi[3] |= ((pAclUser->pridx & 0x0040) >> 6) << 9;
-}
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
+                    return retVal;
 
-/* Function Name:
- *      rtl8367c_setAsicAclAct
- * Description:
- *      Set ACL rule matched Action
- * Input:
- *      index   - ACL rule index (0-95) of 96 ACL rules
- *      pAclAct     - ACL action stucture for setting
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_setAsicAclAct(uint32_t index, rtl8367c_acl_act_t *pAclAct)
-{
-    uint16_t aclActSmi[RTL8367C_ACL_ACT_TABLE_LEN];
-    int32_t retVal;
-    uint32_t regAddr, regData;
-    uint16_t *tableAddr;
-    uint32_t i;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x2)) != RT_ERR_OK)
+                    return retVal;
 
-    if (index > RTL8367C_ACLRULEMAX)
-        return RT_ERR_OUT_OF_RANGE;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 2, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_HSGMII)
+            {
 
-    memset(aclActSmi, 0x00, sizeof(uint16_t) * RTL8367C_ACL_ACT_TABLE_LEN);
-    _rtl8367c_aclActStUser2Smi(pAclAct, aclActSmi);
+                /*restore patch, by designer. patch Tx FIFO issue, when  HSGMII 2.5G mode
+                 #sds0, page 1, reg 1, bit4=1*/
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 1, 1, &regValue)) != RT_ERR_OK)
+                    return retVal;
+                regValue |= 0x10;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 1, 1, regValue)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write ACS_ADR register for data bits */
-    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
-    regData = index;
-    retVal = rtl8367c_setAsicReg(regAddr, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                if (reg_data == 0)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
+                        return retVal;
+                }
 
-    /* Write Data Bits to ACS_DATA registers */
-    tableAddr = aclActSmi;
-    regAddr = RTL8367C_TABLE_ACCESS_WRDATA_BASE;
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLACTTBLEN; i++)
-    {
-        regData = *tableAddr;
-        retVal = rtl8367c_setAsicReg(regAddr, regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-        regAddr++;
-        tableAddr++;
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write ACS_CMD register for care bits*/
-    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
-    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_ACLACT);
-    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 0, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    return RT_ERR_OK;
-}
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 9, 0)) != RT_ERR_OK)
+                    return retVal;
 
-void rtl8367::_rtl8367c_aclRuleStUser2Smi(rtl8367c_aclrule *pAclUser, rtl8367c_aclrulesmi *pAclSmi)
-{
-    uint8_t *care_ptr, *data_ptr;
-    uint8_t care_tmp, data_tmp;
-    uint32_t i;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    pAclSmi->data_bits_ext.rule_info = ((pAclUser->data_bits.active_portmsk >> 8) & 0x7) << 1;
-    pAclSmi->data_bits.rule_info = ((pAclUser->data_bits.active_portmsk & 0xff) << 8) | ((pAclUser->data_bits.tag_exist & 0x1F) << 3) | (pAclUser->data_bits.type & 0x07);
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
-        pAclSmi->data_bits.field[i] = pAclUser->data_bits.field[i];
+                if ((retVal = rtl8367c_setAsicReg(0xd0, 7)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicReg(0x399, 7)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicReg(0x3fa, 7)) != RT_ERR_OK)
+                    return retVal;
 
-    pAclSmi->valid = pAclUser->valid;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    pAclSmi->care_bits_ext.rule_info = ((pAclUser->care_bits.active_portmsk >> 8) & 0x7) << 1;
-    pAclSmi->care_bits.rule_info = ((pAclUser->care_bits.active_portmsk & 0xff) << 8) | ((pAclUser->care_bits.tag_exist & 0x1F) << 3) | (pAclUser->care_bits.type & 0x07);
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x12)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
-        pAclSmi->care_bits.field[i] = pAclUser->care_bits.field[i];
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 2, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_1000X)
+            {
 
-    care_ptr = (uint8_t *)&pAclSmi->care_bits;
-    data_ptr = (uint8_t *)&pAclSmi->data_bits;
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                reg_data &= 0xFFFFFCFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < sizeof(struct acl_rule_smi_st); i++)
-    {
-        care_tmp = *(care_ptr + i) & ~(*(data_ptr + i));
-        data_tmp = *(care_ptr + i) & *(data_ptr + i);
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                if (reg_data == 0)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
+                        return retVal;
+                }
 
-        *(care_ptr + i) = care_tmp;
-        *(data_ptr + i) = data_tmp;
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    care_ptr = (uint8_t *)&pAclSmi->care_bits_ext;
-    data_ptr = (uint8_t *)&pAclSmi->data_bits_ext;
-    care_tmp = *care_ptr & ~(*data_ptr);
-    data_tmp = *care_ptr & *data_ptr;
+                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
+                    return retVal;
 
-    *care_ptr = care_tmp;
-    *data_ptr = data_tmp;
-}
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
+                    return retVal;
 
-/* Function Name:
- *      rtl8367c_setAsicAclRule
- * Description:
- *      Set acl rule content
- * Input:
- *      index   - ACL rule index (0-95) of 96 ACL rules
- *      pAclRule - ACL rule stucture for setting
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
- * Note:
- *      System supported 95 shared 289-bit ACL ingress rule. Index was available at range 0-95 only.
- *      If software want to modify ACL rule, the ACL function should be disable at first or unspecify
- *      acl action will be executed.
- *      One ACL rule structure has three parts setting:
- *      Bit 0-147       Data Bits of this Rule
- *      Bit 148     Valid Bit
- *      Bit 149-296 Care Bits of this Rule
- *      There are four kinds of field in Data Bits and Care Bits: Active Portmask, Type, Tag Exist, and 8 fields
- */
-int32_t rtl8367::rtl8367c_setAsicAclRule(uint32_t index, rtl8367c_aclrule *pAclRule)
-{
-    rtl8367c_aclrulesmi aclRuleSmi;
-    uint16_t *tableAddr;
-    uint32_t regAddr;
-    uint32_t regData;
-    uint32_t i;
-    int32_t retVal;
+                if ((retVal = rtl8367c_setAsicReg(0x13eb, 0x15bb)) != RT_ERR_OK)
+                    return retVal;
 
-    if (index > RTL8367C_ACLRULEMAX)
-        return RT_ERR_OUT_OF_RANGE;
+                if ((retVal = rtl8367c_setAsicReg(0x13e7, 0xc)) != RT_ERR_OK)
+                    return retVal;
 
-    memset(&aclRuleSmi, 0x00, sizeof(rtl8367c_aclrulesmi));
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 1)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    _rtl8367c_aclRuleStUser2Smi(pAclRule, &aclRuleSmi);
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write valid bit = 0 */
-    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
-    if (index >= 64)
-        regData = RTL8367C_ACLRULETBADDR2(DATABITS, index);
-    else
-        regData = RTL8367C_ACLRULETBADDR(DATABITS, index);
-    retVal = rtl8367c_setAsicReg(regAddr, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_TABLE_ACCESS_WRDATA_REG(RTL8367C_ACLRULETBLEN), 0x1, 0);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x4)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_100FX)
+            {
 
-    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
-    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_ACLRULE);
-    retVal = rtl8367c_setAsicReg(regAddr, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                reg_data &= 0xFFFFFCFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write ACS_ADR register */
-    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
-    if (index >= 64)
-        regData = RTL8367C_ACLRULETBADDR2(CAREBITS, index);
-    else
-        regData = RTL8367C_ACLRULETBADDR(CAREBITS, index);
-    retVal = rtl8367c_setAsicReg(regAddr, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                if (reg_data == 0)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
+                        return retVal;
+                }
 
-    /* Write Care Bits to ACS_DATA registers */
-    tableAddr = (uint16_t *)&aclRuleSmi.care_bits;
-    regAddr = RTL8367C_TABLE_ACCESS_WRDATA_BASE;
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLRULETBLEN; i++)
-    {
-        regData = *tableAddr;
-        retVal = rtl8367c_setAsicReg(regAddr, regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
+                    return retVal;
 
-        regAddr++;
-        tableAddr++;
-    }
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_TABLE_ACCESS_WRDATA_REG(RTL8367C_ACLRULETBLEN), (0x0007 << 1), (aclRuleSmi.care_bits_ext.rule_info >> 1) & 0x0007);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write ACS_CMD register */
-    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
-    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_ACLRULE);
-    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_setAsicReg(0x13eb, 0x15bb)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write ACS_ADR register for data bits */
-    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
-    if (index >= 64)
-        regData = RTL8367C_ACLRULETBADDR2(DATABITS, index);
-    else
-        regData = RTL8367C_ACLRULETBADDR(DATABITS, index);
+                if ((retVal = rtl8367c_setAsicReg(0x13e7, 0xc)) != RT_ERR_OK)
+                    return retVal;
 
-    retVal = rtl8367c_setAsicReg(regAddr, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 1)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    /* Write Data Bits to ACS_DATA registers */
-    tableAddr = (uint16_t *)&aclRuleSmi.data_bits;
-    regAddr = RTL8367C_TABLE_ACCESS_WRDATA_BASE;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLRULETBLEN; i++)
-    {
-        regData = *tableAddr;
-        retVal = rtl8367c_setAsicReg(regAddr, regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
+                    return retVal;
 
-        regAddr++;
-        tableAddr++;
-    }
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x5)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_1000X_100FX)
+            {
+                /* 0 2 0  bit 8~9  set 0, force n-way*/
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                reg_data &= 0xFFFFFCFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
+                    return retVal;
 
-    retVal = rtl8367c_setAsicRegBit(RTL8367C_TABLE_ACCESS_WRDATA_REG(RTL8367C_ACLRULETBLEN), 0, aclRuleSmi.valid);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_TABLE_ACCESS_WRDATA_REG(RTL8367C_ACLRULETBLEN), (0x0007 << 1), (aclRuleSmi.data_bits_ext.rule_info >> 1) & 0x0007);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d3d, 10, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                if (reg_data == 0)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 0)) != RT_ERR_OK)
+                        return retVal;
+                }
 
-    /* Write ACS_CMD register for care bits*/
-    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
-    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_ACLRULE);
-    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    return RT_ERR_OK;
-}
+                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
+                    return retVal;
 
-int32_t rtl8367::rtk_filter_igrAcl_cfg_add(rtk_filter_id_t filter_id, rtk_filter_cfg_t *pFilter_cfg, rtk_filter_action_t *pFilter_action, uint32_t *ruleNum)
-{
-    int32_t retVal;
-    uint32_t careTagData, careTagMask;
-    uint32_t i, vidx, svidx, actType, ruleId;
-    uint32_t aclActCtrl;
-    uint32_t cpuPort;
-    rtk_filter_field_t *fieldPtr;
-    rtl8367c_aclrule aclRule[RTL8367C_ACLTEMPLATENO];
-    rtl8367c_aclrule tempRule;
-    rtl8367c_acl_act_t aclAct;
-    uint32_t noRulesAdd;
-    uint32_t portmask;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    if (filter_id > RTL8367C_ACLRULEMAX)
-        return RT_ERR_ENTRY_INDEX;
+                if ((retVal = rtl8367c_setAsicReg(0x13eb, 0x15bb)) != RT_ERR_OK)
+                    return retVal;
 
-    if ((NULL == pFilter_cfg) || (NULL == pFilter_action) || (NULL == ruleNum))
-        return RT_ERR_NULL_POINTER;
+                if ((retVal = rtl8367c_setAsicReg(0x13e7, 0xc)) != RT_ERR_OK)
+                    return retVal;
 
-    fieldPtr = pFilter_cfg->fieldHead;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 1)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    /* init RULE */
-    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
-    {
-        memset(&aclRule[i], 0, sizeof(rtl8367c_aclrule));
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
+                    return retVal;
 
-        aclRule[i].data_bits.type = i;
-        aclRule[i].care_bits.type = 0x7;
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    while (NULL != fieldPtr)
-    {
-        _rtk_filter_igrAcl_writeDataField(aclRule, fieldPtr);
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x7)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode < EXT_SGMII)
+            {
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d3d, 10, 0)) != RT_ERR_OK)
+                    return retVal;
 
-        fieldPtr = fieldPtr->next;
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    /*set care tag mask in User Defined Field 15*/
-    /*Follow care tag should not be used while ACL template and User defined fields are fully control by system designer*/
-    /*those advanced packet type care tag is used in default template design structure only*/
-    careTagData = 0;
-    careTagMask = 0;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = CARE_TAG_TCP; i < CARE_TAG_END; i++)
-    {
-        if (pFilter_cfg->careTag.tagType[i].mask)
-            careTagMask = careTagMask | (1 << (i - CARE_TAG_TCP));
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-        if (pFilter_cfg->careTag.tagType[i].value)
-            careTagData = careTagData | (1 << (i - CARE_TAG_TCP));
-    }
+                if (mode < EXT_GMII)
+                {
+                    /* set mac6 mode*/
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, mode)) != RT_ERR_OK)
+                        return retVal;
+                }
+                else if (mode == EXT_RMII_MAC)
+                {
 
-    if (careTagData || careTagMask)
-    {
-        i = 0;
-        while (i < RTL8367C_ACLTEMPLATENO)
-        {
-            if (aclRule[i].valid == 1 && filter_advanceCaretagField[i][0] == 1)
-            {
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 7)) != RT_ERR_OK)
+                        return retVal;
+                }
+                else if (mode == EXT_RMII_PHY)
+                {
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, 8)) != RT_ERR_OK)
+                        return retVal;
+                }
 
-                aclRule[i].data_bits.field[filter_advanceCaretagField[i][1]] = careTagData & 0xFFFF;
-                aclRule[i].care_bits.field[filter_advanceCaretagField[i][1]] = careTagMask & 0xFFFF;
-                break;
+                if ((mode == EXT_TMII_MAC) || (mode == EXT_TMII_PHY))
+                {
+                    if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 1, 1)) != RT_ERR_OK)
+                        return retVal;
+                }
             }
-            i++;
         }
-        /*none of previous used template containing field 15*/
-        if (i == RTL8367C_ACLTEMPLATENO)
+        else if (2 == id)
         {
-            i = 0;
-            while (i < RTL8367C_ACLTEMPLATENO)
+
+            /*force port7 linkdown*/
+            if ((retVal = rtl8367c_setAsicReg(0x137d, 0x1000)) != RT_ERR_OK)
+                return retVal;
+
+            if ((retVal = rtl8367c_getAsicRegBit(0x1d9d, 7, &reg_data)) != RT_ERR_OK)
+                return retVal;
+            while (reg_data == 0)
             {
-                if (filter_advanceCaretagField[i][0] == 1)
-                {
-                    aclRule[i].data_bits.field[filter_advanceCaretagField[i][1]] = careTagData & 0xFFFF;
-                    aclRule[i].care_bits.field[filter_advanceCaretagField[i][1]] = careTagMask & 0xFFFF;
-                    aclRule[i].valid = 1;
-                    break;
-                }
-                i++;
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d9d, 7, &reg_data)) != RT_ERR_OK)
+                    return retVal;
             }
-        }
-    }
 
-    /*Check rule number*/
-    noRulesAdd = 0;
-    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
-    {
-        if (1 == aclRule[i].valid)
-        {
-            noRulesAdd++;
-        }
-    }
+            if (mode == EXT_SGMII)
+            {
 
-    *ruleNum = noRulesAdd;
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    if ((filter_id + noRulesAdd - 1) > RTL8367C_ACLRULEMAX)
-    {
-        return RT_ERR_ENTRY_INDEX;
-    }
+                if ((retVal = rtl8367c_setAsicReg(0x13c4, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    /*set care tag mask in TAG Indicator*/
-    careTagData = 0;
-    careTagMask = 0;
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i <= CARE_TAG_IPV6; i++)
-    {
-        if (0 == pFilter_cfg->careTag.tagType[i].mask)
-        {
-            careTagMask &= ~(1 << i);
-        }
-        else
-        {
-            careTagMask |= (1 << i);
-            if (0 == pFilter_cfg->careTag.tagType[i].value)
-                careTagData &= ~(1 << i);
-            else
-                careTagData |= (1 << i);
-        }
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
-    {
-        aclRule[i].data_bits.tag_exist = (careTagData)&ACL_RULE_CARETAG_MASK;
-        aclRule[i].care_bits.tag_exist = (careTagMask)&ACL_RULE_CARETAG_MASK;
-    }
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    RTK_CHK_PORTMASK_VALID(&pFilter_cfg->activeport.value);
-    RTK_CHK_PORTMASK_VALID(&pFilter_cfg->activeport.mask);
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 11, 0)) != RT_ERR_OK)
+                    return retVal;
 
-    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
-    {
-        if (1 == aclRule[i].valid)
-        {
-            if (rtk_switch_portmask_L2P_get(&pFilter_cfg->activeport.value, &portmask) != RT_ERR_OK)
-                return RT_ERR_PORT_MASK;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 0)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[i].data_bits.active_portmsk = portmask;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                    return retVal;
 
-            if (rtk_switch_portmask_L2P_get(&pFilter_cfg->activeport.mask, &portmask) != RT_ERR_OK)
-                return RT_ERR_PORT_MASK;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
 
-            aclRule[i].care_bits.active_portmsk = portmask;
-        }
-    }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 0, 1)) != RT_ERR_OK)
+                    return retVal;
 
-    if (pFilter_cfg->invert >= FILTER_INVERT_END)
-        return RT_ERR_INPUT;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x2)) != RT_ERR_OK)
+                    return retVal;
 
-    /*Last action gets high priority if actions are the same*/
-    memset(&aclAct, 0, sizeof(rtl8367c_acl_act_t));
-    aclActCtrl = 0;
-    for (actType = 0; actType < FILTER_ENACT_END; actType++)
-    {
-        if (pFilter_action->actEnable[actType])
-        {
-            switch (actType)
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 2, 0)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_1000X)
             {
-            case FILTER_ENACT_CVLAN_INGRESS:
-                if (pFilter_action->filterCvlanVid > RTL8367C_EVIDMAX)
-                    return RT_ERR_INPUT;
 
-                if ((retVal = rtk_vlan_checkAndCreateMbr(pFilter_action->filterCvlanVid, &vidx)) != RT_ERR_OK)
-                {
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
                     return retVal;
-                }
-                aclAct.cact = FILTER_ENACT_CVLAN_TYPE(actType);
-                aclAct.cvidx_cact = vidx;
 
-                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
-                {
-                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_TAGONLY)
-                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
-                }
-                else
-                {
-                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_VLANONLY;
-                }
+                if ((retVal = rtl8367c_setAsicReg(0x13c4, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
-                break;
-            case FILTER_ENACT_CVLAN_EGRESS:
-                if (pFilter_action->filterCvlanVid > RTL8367C_EVIDMAX)
-                    return RT_ERR_INPUT;
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                reg_data &= 0xFFFFFCFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
+                    return retVal;
 
-                if ((retVal = rtk_vlan_checkAndCreateMbr(pFilter_action->filterCvlanVid, &vidx)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
                     return retVal;
 
-                aclAct.cact = FILTER_ENACT_CVLAN_TYPE(actType);
-                aclAct.cvidx_cact = vidx;
+                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
+                    return retVal;
 
-                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
-                {
-                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_TAGONLY)
-                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
-                }
-                else
-                {
-                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_VLANONLY;
-                }
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
-                break;
-            case FILTER_ENACT_CVLAN_SVID:
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.cact = FILTER_ENACT_CVLAN_TYPE(actType);
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
-                {
-                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_TAGONLY)
-                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
-                }
-                else
-                {
-                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_VLANONLY;
-                }
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 3)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
-                break;
-            case FILTER_ENACT_POLICING_1:
-                if (pFilter_action->filterPolicingIdx[1] >= ((halCtrl.max_meter_id + 1) + RTL8367C_MAX_LOG_CNT_NUM))
-                    return RT_ERR_INPUT;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x4)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_100FX)
+            {
 
-                aclAct.cact = FILTER_ENACT_CVLAN_TYPE(actType);
-                aclAct.cvidx_cact = pFilter_action->filterPolicingIdx[1];
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
-                {
-                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_TAGONLY)
-                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
-                }
-                else
-                {
-                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_VLANONLY;
-                }
+                if ((retVal = rtl8367c_setAsicReg(0x13c4, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
-                break;
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                reg_data &= 0xFFFFFCFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
+                    return retVal;
 
-            case FILTER_ENACT_SVLAN_INGRESS:
-            case FILTER_ENACT_SVLAN_EGRESS:
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                if ((retVal = rtk_svlan_checkAndCreateMbr(pFilter_action->filterSvlanVid, &svidx)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
                     return retVal;
 
-                aclAct.sact = FILTER_ENACT_SVLAN_TYPE(actType);
-                aclAct.svidx_sact = svidx;
-                aclActCtrl |= FILTER_ENACT_SVLAN_MASK;
-                break;
-            case FILTER_ENACT_SVLAN_CVID:
-
-                aclAct.sact = FILTER_ENACT_SVLAN_TYPE(actType);
-                aclActCtrl |= FILTER_ENACT_SVLAN_MASK;
-                break;
-            case FILTER_ENACT_POLICING_2:
-                if (pFilter_action->filterPolicingIdx[2] >= ((halCtrl.max_meter_id + 1) + RTL8367C_MAX_LOG_CNT_NUM))
-                    return RT_ERR_INPUT;
-
-                aclAct.sact = FILTER_ENACT_SVLAN_TYPE(actType);
-                aclAct.svidx_sact = pFilter_action->filterPolicingIdx[2];
-                aclActCtrl |= FILTER_ENACT_SVLAN_MASK;
-                break;
-            case FILTER_ENACT_POLICING_0:
-                if (pFilter_action->filterPolicingIdx[0] >= ((halCtrl.max_meter_id + 1) + RTL8367C_MAX_LOG_CNT_NUM))
-                    return RT_ERR_INPUT;
-
-                aclAct.aclmeteridx = pFilter_action->filterPolicingIdx[0];
-                aclActCtrl |= FILTER_ENACT_POLICING_MASK;
-                break;
-            case FILTER_ENACT_PRIORITY:
-            case FILTER_ENACT_1P_REMARK:
-                if (pFilter_action->filterPriority > RTL8367C_PRIMAX)
-                    return RT_ERR_INPUT;
-
-                aclAct.priact = FILTER_ENACT_PRI_TYPE(actType);
-                aclAct.pridx = pFilter_action->filterPriority;
-                aclActCtrl |= FILTER_ENACT_PRIORITY_MASK;
-                break;
-            case FILTER_ENACT_DSCP_REMARK:
-                if (pFilter_action->filterPriority > RTL8367C_DSCPMAX)
-                    return RT_ERR_INPUT;
-
-                aclAct.priact = FILTER_ENACT_PRI_TYPE(actType);
-                aclAct.pridx = pFilter_action->filterPriority;
-                aclActCtrl |= FILTER_ENACT_PRIORITY_MASK;
-                break;
-            case FILTER_ENACT_POLICING_3:
-                if (pFilter_action->filterPriority >= ((halCtrl.max_meter_id + 1) + RTL8367C_MAX_LOG_CNT_NUM))
-                    return RT_ERR_INPUT;
-
-                aclAct.priact = FILTER_ENACT_PRI_TYPE(actType);
-                aclAct.pridx = pFilter_action->filterPolicingIdx[3];
-                aclActCtrl |= FILTER_ENACT_PRIORITY_MASK;
-                break;
-            case FILTER_ENACT_DROP:
-
-                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(FILTER_ENACT_REDIRECT);
-                aclAct.fwdact_ext = 0;
-
-                aclAct.fwdpmask = 0;
-                aclActCtrl |= FILTER_ENACT_FWD_MASK;
-                break;
-            case FILTER_ENACT_REDIRECT:
-                RTK_CHK_PORTMASK_VALID(&pFilter_action->filterPortmask);
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(actType);
-                aclAct.fwdact_ext = 0;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
 
-                if (rtk_switch_portmask_L2P_get(&pFilter_action->filterPortmask, &portmask) != RT_ERR_OK)
-                    return RT_ERR_PORT_MASK;
-                aclAct.fwdpmask = portmask;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_FWD_MASK;
-                break;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 3)) != RT_ERR_OK)
+                    return retVal;
 
-            case FILTER_ENACT_ADD_DSTPORT:
-                RTK_CHK_PORTMASK_VALID(&pFilter_action->filterPortmask);
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x5)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode == EXT_1000X_100FX)
+            {
+                /*  disable mac7 MII/TMM/RMII/GMII/RGMII mode, mode_ext2 = disable  */
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(actType);
-                aclAct.fwdact_ext = 0;
+                if ((retVal = rtl8367c_setAsicReg(0x13c4, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                if (rtk_switch_portmask_L2P_get(&pFilter_action->filterPortmask, &portmask) != RT_ERR_OK)
-                    return RT_ERR_PORT_MASK;
-                aclAct.fwdpmask = portmask;
+                if ((retVal = rtl8367c_getAsicSdsReg(0, 2, 0, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                reg_data &= 0xFFFFFCFF;
+                if ((retVal = rtl8367c_setAsicSdsReg(0, 2, 0, reg_data)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_FWD_MASK;
-                break;
-            case FILTER_ENACT_MIRROR:
-                RTK_CHK_PORTMASK_VALID(&pFilter_action->filterPortmask);
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(actType);
-                aclAct.cact_ext = 0;
+                if ((retVal = rtl8367c_setAsicReg(0x1d11, 0x1500)) != RT_ERR_OK)
+                    return retVal;
 
-                if (rtk_switch_portmask_L2P_get(&pFilter_action->filterPortmask, &portmask) != RT_ERR_OK)
-                    return RT_ERR_PORT_MASK;
-                aclAct.fwdpmask = portmask;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d95, 13, 1)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_FWD_MASK;
-                break;
-            case FILTER_ENACT_TRAP_CPU:
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x1f)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(actType);
-                aclAct.fwdact_ext = 0;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 5, 0)) != RT_ERR_OK)
+                    return retVal;
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d41, 7, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_FWD_MASK;
-                break;
-            case FILTER_ENACT_COPY_CPU:
-                if ((retVal = rtl8367c_getAsicCputagTrapPort(&cpuPort)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 3)) != RT_ERR_OK)
                     return retVal;
 
-                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(FILTER_ENACT_MIRROR);
-                aclAct.fwdact_ext = 0;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 0x1f00, 0x7)) != RT_ERR_OK)
+                    return retVal;
+            }
+            else if (mode < EXT_SGMII)
+            {
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d3d, 10, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.fwdpmask = 1 << cpuPort;
-                aclActCtrl |= FILTER_ENACT_FWD_MASK;
-                break;
-            case FILTER_ENACT_ISOLATION:
-                RTK_CHK_PORTMASK_VALID(&pFilter_action->filterPortmask);
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.fwdact_ext = 1;
+                if ((retVal = rtl8367c_setAsicReg(0x1d95, 0x1f00)) != RT_ERR_OK)
+                    return retVal;
 
-                if (rtk_switch_portmask_L2P_get(&pFilter_action->filterPortmask, &portmask) != RT_ERR_OK)
-                    return RT_ERR_PORT_MASK;
-                aclAct.fwdpmask = portmask;
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclActCtrl |= FILTER_ENACT_FWD_MASK;
-                break;
+                if ((retVal = rtl8367c_setAsicRegBits(0x13c3, 0xf, mode)) != RT_ERR_OK)
+                    return retVal;
 
-            case FILTER_ENACT_INTERRUPT:
+                if ((mode == EXT_TMII_MAC) || (mode == EXT_TMII_PHY))
+                {
+                    if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 1)) != RT_ERR_OK)
+                        return retVal;
+                }
+            }
+            else if ((mode < EXT_END) && (mode > EXT_100FX))
+            {
+                if ((retVal = rtl8367c_setAsicRegBits(0x13C3, 0xf, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.aclint = 1;
-                aclActCtrl |= FILTER_ENACT_INTGPIO_MASK;
-                break;
-            case FILTER_ENACT_GPO:
+                if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                aclAct.gpio_en = 1;
-                aclAct.gpio_pin = pFilter_action->filterPin;
-                aclActCtrl |= FILTER_ENACT_INTGPIO_MASK;
-                break;
-            case FILTER_ENACT_EGRESSCTAG_TAG:
+                if ((retVal = rtl8367c_setAsicRegBits(0x1d95, 3, 0)) != RT_ERR_OK)
+                    return retVal;
 
-                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
-                {
-                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_VLANONLY)
-                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
-                }
-                else
-                {
-                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_TAGONLY;
-                }
-                aclAct.tag_fmt = FILTER_CTAGFMT_TAG;
-                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
-                break;
-            case FILTER_ENACT_EGRESSCTAG_UNTAG:
+                if ((retVal = rtl8367c_setAsicRegBit(0x1d3d, 10, 1)) != RT_ERR_OK)
+                    return retVal;
 
-                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
-                {
-                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_VLANONLY)
-                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
-                }
-                else
+                if ((retVal = rtl8367c_getAsicRegBit(0x1d11, 11, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+                if (reg_data == 0)
                 {
-                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_TAGONLY;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x1d11, 6, 1)) != RT_ERR_OK)
+                        return retVal;
                 }
-                aclAct.tag_fmt = FILTER_CTAGFMT_UNTAG;
-                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
-                break;
-            case FILTER_ENACT_EGRESSCTAG_KEEP:
 
-                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                if (mode < EXT_RMII_MAC_2)
                 {
-                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_VLANONLY)
-                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, (mode - 13))) != RT_ERR_OK)
+                        return retVal;
                 }
                 else
                 {
-                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_TAGONLY;
+                    if ((retVal = rtl8367c_setAsicRegBits(0x1305, 0xf0, (mode - 12))) != RT_ERR_OK)
+                        return retVal;
                 }
-                aclAct.tag_fmt = FILTER_CTAGFMT_KEEP;
-                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
-                break;
-            case FILTER_ENACT_EGRESSCTAG_KEEPAND1PRMK:
 
-                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
-                {
-                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_VLANONLY)
-                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
-                }
-                else
+                if ((mode == EXT_TMII_MAC_2) || (mode == EXT_TMII_PHY_2))
                 {
-                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_TAGONLY;
+                    if ((retVal = rtl8367c_setAsicRegBit(0x3f7, 2, 1)) != RT_ERR_OK)
+                        return retVal;
                 }
-                aclAct.tag_fmt = FILTER_CTAGFMT_KEEP1PRMK;
-                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
-                break;
-            default:
-                return RT_ERR_FILTER_INACL_ACT_NOT_SUPPORT;
             }
         }
     }
+    return RT_ERR_OK;
+}
 
-    /*check if free ACL rules are enough*/
-    for (i = filter_id; i < (filter_id + noRulesAdd); i++)
-    {
-        if ((retVal = rtl8367c_getAsicAclRule(i, &tempRule)) != RT_ERR_OK)
-            return retVal;
-
-        if (tempRule.valid == 1)
-        {
-            return RT_ERR_TBL_FULL;
-        }
-    }
-
-    ruleId = 0;
-    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
-    {
-        if (aclRule[i].valid == 1)
-        {
-            /* write ACL action control */
-            if ((retVal = rtl8367c_setAsicAclActCtrl(filter_id + ruleId, aclActCtrl)) != RT_ERR_OK)
-                return retVal;
-            /* write ACL action */
-            if ((retVal = rtl8367c_setAsicAclAct(filter_id + ruleId, &aclAct)) != RT_ERR_OK)
-                return retVal;
-
-            /* write ACL not */
-            if ((retVal = rtl8367c_setAsicAclNot(filter_id + ruleId, pFilter_cfg->invert)) != RT_ERR_OK)
-                return retVal;
-            /* write ACL rule */
-            if ((retVal = rtl8367c_setAsicAclRule(filter_id + ruleId, &aclRule[i])) != RT_ERR_OK)
-                return retVal;
-
-            /* only the first rule will be written with input action control, aclActCtrl of other rules will be zero */
-            aclActCtrl = 0;
-            memset(&aclAct, 0, sizeof(rtl8367c_acl_act_t));
-
-            ruleId++;
-        }
-    }
-
-    return RT_ERR_OK;
-}
-
-int32_t rtl8367::rtk_filter_igrAcl_cfg_del(rtk_filter_id_t filter_id)
-{
-    rtl8367c_aclrule initRule;
-    rtl8367c_acl_act_t initAct;
-    int32_t ret;
-
-    if (filter_id > RTL8367C_ACLRULEMAX)
-        return RT_ERR_FILTER_ENTRYIDX;
-
-    memset(&initRule, 0, sizeof(rtl8367c_aclrule));
-    memset(&initAct, 0, sizeof(rtl8367c_acl_act_t));
-
-    if ((ret = rtl8367c_setAsicAclRule(filter_id, &initRule)) != RT_ERR_OK)
-        return ret;
-    if ((ret = rtl8367c_setAsicAclActCtrl(filter_id, FILTER_ENACT_INIT_MASK)) != RT_ERR_OK)
-        return ret;
-    if ((ret = rtl8367c_setAsicAclAct(filter_id, &initAct)) != RT_ERR_OK)
-        return ret;
-    if ((ret = rtl8367c_setAsicAclNot(filter_id, DISABLED)) != RT_ERR_OK)
-        return ret;
-
-    return RT_ERR_OK;
-}
-
-int32_t rtl8367::rtk_filter_igrAcl_cfg_delAll()
-{
-    uint32_t i;
-    int32_t ret;
-
-    for (i = 0; i < RTL8367C_ACLRULENO; i++)
-    {
-        if ((ret = rtl8367c_setAsicAclActCtrl(i, FILTER_ENACT_INIT_MASK)) != RT_ERR_OK)
-            return ret;
-        if ((ret = rtl8367c_setAsicAclNot(i, DISABLED)) != RT_ERR_OK)
-            return ret;
-    }
-
-    return rtl8367c_setAsicRegBit(RTL8367C_REG_ACL_RESET_CFG, RTL8367C_ACL_RESET_CFG_OFFSET, 1);
-}
-
-/* Function Name:
- *      rtl8367c_getAsicAcl
- * Description:
- *      Get rule comparison result inversion / no inversion
- * Input:
- *      index   - ACL rule index (0-95) of 95 ACL rules
- *      pNot    - 1: inverse, 0: don't inverse
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicAclNot(uint32_t index, uint32_t *pNot)
-{
-    if (index > RTL8367C_ACLRULEMAX)
-        return RT_ERR_OUT_OF_RANGE;
-
-    if (index < 64)
-        return rtl8367c_getAsicRegBit(RTL8367C_ACL_ACTION_CTRL_REG(index), RTL8367C_ACL_OP_NOT_OFFSET(index), pNot);
-    else
-        return rtl8367c_getAsicRegBit(RTL8367C_ACL_ACTION_CTRL2_REG(index), RTL8367C_ACL_OP_NOT_OFFSET(index), pNot);
-}
-
-void rtl8367::_rtl8367c_aclActStSmi2User(rtl8367c_acl_act_t *pAclUser, uint16_t *pAclSmi)
-{
-    pAclUser->cact = (pAclSmi[0] & 0x00C0) >> 6;
-    pAclUser->cvidx_cact = (pAclSmi[0] & 0x003F) | (((pAclSmi[3] & 0x0008) >> 3) << 6);
-
-    pAclUser->sact = (pAclSmi[0] & 0xC000) >> 14;
-    pAclUser->svidx_sact = ((pAclSmi[0] & 0x3F00) >> 8) | (((pAclSmi[3] & 0x0010) >> 4) << 6);
-
-    pAclUser->aclmeteridx = (pAclSmi[1] & 0x003F) | (((pAclSmi[3] & 0x0020) >> 5) << 6);
-
-    pAclUser->fwdact = (pAclSmi[1] & 0xC000) >> 14;
-    pAclUser->fwdpmask = ((pAclSmi[1] & 0x3FC0) >> 6) | (((pAclSmi[3] & 0x01C0) >> 6) << 8);
-
-    pAclUser->priact = (pAclSmi[2] & 0x00C0) >> 6;
-    pAclUser->pridx = (pAclSmi[2] & 0x003F) | (((pAclSmi[3] & 0x0200) >> 9) << 6);
-
-    pAclUser->aclint = (pAclSmi[2] & 0x2000) >> 13;
-    pAclUser->gpio_en = (pAclSmi[2] & 0x1000) >> 12;
-    pAclUser->gpio_pin = (pAclSmi[2] & 0x0F00) >> 8;
-
-    pAclUser->cact_ext = (pAclSmi[2] & 0xC000) >> 14;
-    pAclUser->tag_fmt = (pAclSmi[3] & 0x0003);
-    pAclUser->fwdact_ext = (pAclSmi[3] & 0x0004) >> 2;
-}
 /* Function Name:
- *      rtl8367c_getAsicAclAct
+ *      rtl8367c_getAsicPortExtMode
  * Description:
- *      Get ACL rule matched Action
+ *      Get external interface mode configuration
  * Input:
- *      index   - ACL rule index (0-95) of 96 ACL rules
- *      pAclAct     - ACL action stucture for setting
+ *      id      - external interface id (0~1)
+ *      pMode   - external interface mode
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicAclAct(uint32_t index, rtl8367c_acl_act_t *pAclAct)
+int32_t rtl8367::rtl8367c_getAsicPortExtMode(uint32_t id, uint32_t *pMode)
 {
-    uint16_t aclActSmi[RTL8367C_ACL_ACT_TABLE_LEN];
     int32_t retVal;
-    uint32_t regAddr, regData;
-    uint16_t *tableAddr;
-    uint32_t i;
+    uint32_t regData, regValue, type;
 
-    if (index > RTL8367C_ACLRULEMAX)
+    if (id >= RTL8367C_EXTNO)
         return RT_ERR_OUT_OF_RANGE;
 
-    memset(aclActSmi, 0x00, sizeof(uint16_t) * RTL8367C_ACL_ACT_TABLE_LEN);
-
-    /* Write ACS_ADR register for data bits */
-    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
-    regData = index;
-    retVal = rtl8367c_setAsicReg(regAddr, regData);
-    if (retVal != RT_ERR_OK)
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
         return retVal;
 
-    /* Write ACS_CMD register */
-    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
-    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_READ, TB_TARGET_ACLACT);
-    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
-    if (retVal != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicReg(0x1300, &regValue)) != RT_ERR_OK)
         return retVal;
 
-    /* Read Data Bits */
-    regAddr = RTL8367C_TABLE_ACCESS_RDDATA_BASE;
-    tableAddr = aclActSmi;
-    for (i = 0; i < RTL8367C_ACLACTTBLEN; i++)
-    {
-        retVal = rtl8367c_getAsicReg(regAddr, &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
+        return retVal;
 
-        *tableAddr = regData;
+    type = 0;
 
-        regAddr++;
-        tableAddr++;
+    switch (regValue)
+    {
+    case 0x0276:
+    case 0x0597:
+    case 0x6367:
+        type = 1;
+        break;
+    case 0x0652:
+    case 0x6368:
+        type = 2;
+        break;
+    case 0x0801:
+    case 0x6511:
+        type = 3;
+        break;
+    default:
+        return RT_ERR_FAILED;
     }
 
-    _rtl8367c_aclActStSmi2User(pAclAct, aclActSmi);
-
-    return RT_ERR_OK;
-}
+    if (1 == type)
+    {
 
-/* Function Name:
- *      rtl8367c_getAsicAclActCtrl
- * Description:
- *      Get ACL rule matched Action Control Bits
- * Input:
- *      index       - ACL rule index (0-95) of 96 ACL rules
- *      pAclActCtrl     - 6 ACL Control Bits
- * Output:
- *      None
- * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
- * Note:
- *      None
- */
-int32_t rtl8367::rtl8367c_getAsicAclActCtrl(uint32_t index, uint32_t *pAclActCtrl)
-{
-    int32_t retVal;
-    uint32_t regData;
+        if (1 == id)
+        {
+            if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, &regData)) != RT_ERR_OK)
+                return retVal;
 
-    if (index > RTL8367C_ACLRULEMAX)
-        return RT_ERR_OUT_OF_RANGE;
+            if (1 == regData)
+            {
+                *pMode = EXT_SGMII;
+                return RT_ERR_OK;
+            }
 
-    if (index >= 64)
-        retVal = rtl8367c_getAsicRegBits(RTL8367C_ACL_ACTION_CTRL2_REG(index), RTL8367C_ACL_OP_ACTION_MASK(index), &regData);
-    else
-        retVal = rtl8367c_getAsicRegBits(RTL8367C_ACL_ACTION_CTRL_REG(index), RTL8367C_ACL_OP_ACTION_MASK(index), &regData);
+            if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, &regData)) != RT_ERR_OK)
+                return retVal;
 
-    if (retVal != RT_ERR_OK)
-        return retVal;
+            if (1 == regData)
+            {
+                *pMode = EXT_HSGMII;
+                return RT_ERR_OK;
+            }
+        }
 
-    *pAclActCtrl = regData;
+        if (0 == id || 1 == id)
+            return rtl8367c_getAsicRegBits(RTL8367C_REG_DIGITAL_INTERFACE_SELECT, RTL8367C_SELECT_GMII_0_MASK << (id * RTL8367C_SELECT_GMII_1_OFFSET), pMode);
+        else
+            return rtl8367c_getAsicRegBits(RTL8367C_REG_DIGITAL_INTERFACE_SELECT_1, RTL8367C_SELECT_GMII_2_MASK, pMode);
+    }
+    else if (2 == type)
+    {
+        if (1 == id)
+        {
+            if ((retVal = rtl8367c_getAsicReg(0x1d92, &regData)) != RT_ERR_OK)
+                return retVal;
 
-    return RT_ERR_OK;
-}
+            if (regData & 0x4000)
+            {
+                *pMode = EXT_SGMII;
+                return RT_ERR_OK;
+            }
 
-int32_t rtl8367::rtk_filter_igrAcl_cfg_get(rtk_filter_id_t filter_id, rtk_filter_cfg_raw_t *pFilter_cfg, rtk_filter_action_t *pAction)
-{
-    int32_t retVal;
-    uint32_t i, tmp;
-    rtl8367c_aclrule aclRule;
-    rtl8367c_acl_act_t aclAct;
-    uint32_t cpuPort;
-    rtl8367c_acltemplate_t type;
-    rtl8367c_svlan_memconf_t svlan_cfg;
-    rtl8367c_vlanconfiguser vlanMC;
-    uint32_t phyPmask;
-
-    if (NULL == pFilter_cfg || NULL == pAction)
-        return RT_ERR_NULL_POINTER;
-
-    if (filter_id > RTL8367C_ACLRULEMAX)
-        return RT_ERR_ENTRY_INDEX;
-
-    if ((retVal = rtl8367c_getAsicAclRule(filter_id, &aclRule)) != RT_ERR_OK)
-        return retVal;
-
-    /* Check valid */
-    if (aclRule.valid == 0)
-    {
-        pFilter_cfg->valid = DISABLED_RTK;
-        return RT_ERR_OK;
-    }
-
-    phyPmask = aclRule.data_bits.active_portmsk;
-    if (rtk_switch_portmask_P2L_get(phyPmask, &(pFilter_cfg->activeport.value)) != RT_ERR_OK)
-        return RT_ERR_FAILED;
-
-    phyPmask = aclRule.care_bits.active_portmsk;
-    if (rtk_switch_portmask_P2L_get(phyPmask, &(pFilter_cfg->activeport.mask)) != RT_ERR_OK)
-        return RT_ERR_FAILED;
-
-    for (i = 0; i <= CARE_TAG_IPV6; i++)
-    {
-        if (aclRule.data_bits.tag_exist & (1 << i))
-            pFilter_cfg->careTag.tagType[i].value = 1;
-        else
-            pFilter_cfg->careTag.tagType[i].value = 0;
-
-        if (aclRule.care_bits.tag_exist & (1 << i))
-            pFilter_cfg->careTag.tagType[i].mask = 1;
-        else
-            pFilter_cfg->careTag.tagType[i].mask = 0;
-    }
+            else if (((regData >> 8) & 0x1f) == 4)
+            {
+                *pMode = EXT_1000X;
+                return RT_ERR_OK;
+            }
+            else if (((regData >> 8) & 0x1f) == 5)
+            {
+                *pMode = EXT_100FX;
+                return RT_ERR_OK;
+            }
+            else if (((regData >> 8) & 0x1f) == 7)
+            {
+                *pMode = EXT_1000X_100FX;
+                return RT_ERR_OK;
+            }
 
-    if (filter_advanceCaretagField[aclRule.data_bits.type][0] == 1)
-    {
-        /* Advanced Care tag setting */
-        for (i = CARE_TAG_TCP; i < CARE_TAG_END; i++)
+            return rtl8367c_getAsicRegBits(0x1305, 0xf0, pMode);
+        }
+        else if (2 == id)
         {
-            if (aclRule.data_bits.field[filter_advanceCaretagField[aclRule.data_bits.type][1]] & (0x0001 << (i - CARE_TAG_TCP)))
-                pFilter_cfg->careTag.tagType[i].value = 1;
-            else
-                pFilter_cfg->careTag.tagType[i].value = 0;
+            if ((retVal = rtl8367c_getAsicReg(0x1d92, &regData)) != RT_ERR_OK)
+                return retVal;
 
-            if (aclRule.care_bits.field[filter_advanceCaretagField[aclRule.care_bits.type][1]] & (0x0001 << (i - CARE_TAG_TCP)))
-                pFilter_cfg->careTag.tagType[i].mask = 1;
-            else
-                pFilter_cfg->careTag.tagType[i].mask = 0;
+            if (regData & 0x40)
+            {
+                *pMode = EXT_SGMII;
+                return RT_ERR_OK;
+            }
+            else if (regData & 0x80)
+            {
+                *pMode = EXT_HSGMII;
+                return RT_ERR_OK;
+            }
+            else if ((regData & 0x1f) == 4)
+            {
+                *pMode = EXT_1000X;
+                return RT_ERR_OK;
+            }
+            else if ((regData & 0x1f) == 5)
+            {
+                *pMode = EXT_100FX;
+                return RT_ERR_OK;
+            }
+            else if ((regData & 0x1f) == 7)
+            {
+                *pMode = EXT_1000X_100FX;
+                return RT_ERR_OK;
+            }
+
+            return rtl8367c_getAsicRegBits(0x1305, 0xf, pMode);
         }
     }
-
-    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
+    else if (3 == type)
     {
-        pFilter_cfg->careFieldRaw[i] = aclRule.care_bits.field[i];
-        pFilter_cfg->dataFieldRaw[i] = aclRule.data_bits.field[i];
-    }
-
-    if ((retVal = rtl8367c_getAsicAclNot(filter_id, &tmp)) != RT_ERR_OK)
-        return retVal;
-
-    pFilter_cfg->invert = (rtk_filter_invert_t)tmp;
-
-    pFilter_cfg->valid = (rtk_enable_t)aclRule.valid;
-
-    memset(pAction, 0, sizeof(rtk_filter_action_t));
+        if (1 == id)
+        {
+            /* SDS_CFG_NEW */
+            if ((retVal = rtl8367c_getAsicReg(0x1d95, &regData)) != RT_ERR_OK)
+                return retVal;
 
-    if ((retVal = rtl8367c_getAsicAclActCtrl(filter_id, &tmp)) != RT_ERR_OK)
-        return retVal;
+            if ((retVal = rtl8367c_getAsicReg(0x1d41, &regValue)) != RT_ERR_OK)
+                return retVal;
 
-    if ((retVal = rtl8367c_getAsicAclAct(filter_id, &aclAct)) != RT_ERR_OK)
-        return retVal;
+            if ((regValue & 0xa0) == 0xa0)
+            {
 
-    if (tmp & FILTER_ENACT_FWD_MASK)
-    {
-        if (1 == aclAct.fwdact_ext)
-        {
-            pAction->actEnable[FILTER_ENACT_ISOLATION] = (rtk_filter_act_enable_t)1;
+                regData = regData >> 8;
+                if ((regData & 0x1f) == 4)
+                {
+                    *pMode = EXT_1000X;
+                    return RT_ERR_OK;
+                }
+                else if ((regData & 0x1f) == 5)
+                {
+                    *pMode = EXT_100FX;
+                    return RT_ERR_OK;
+                }
+                else if ((regData & 0x1f) == 7)
+                {
+                    *pMode = EXT_1000X_100FX;
+                    return RT_ERR_OK;
+                }
+            }
 
-            phyPmask = aclAct.fwdpmask;
-            if (rtk_switch_portmask_P2L_get(phyPmask, &(pAction->filterPortmask)) != RT_ERR_OK)
-                return RT_ERR_FAILED;
-        }
-        else if (aclAct.fwdact == RTL8367C_ACL_FWD_TRAP)
-        {
-            pAction->actEnable[FILTER_ENACT_TRAP_CPU] = (rtk_filter_act_enable_t)1;
-        }
-        else if (aclAct.fwdact == RTL8367C_ACL_FWD_MIRRORFUNTION)
-        {
-            pAction->actEnable[FILTER_ENACT_MIRROR] = (rtk_filter_act_enable_t)1;
+            if ((retVal = rtl8367c_getAsicReg(0x1d11, &regData)) != RT_ERR_OK)
+                return retVal;
 
-            phyPmask = aclAct.fwdpmask;
-            if (rtk_switch_portmask_P2L_get(phyPmask, &(pAction->filterPortmask)) != RT_ERR_OK)
-                return RT_ERR_FAILED;
-        }
-        else if (aclAct.fwdact == RTL8367C_ACL_FWD_REDIRECT)
-        {
-            if (aclAct.fwdpmask == 0)
-                pAction->actEnable[FILTER_ENACT_DROP] = (rtk_filter_act_enable_t)1;
+            /* check cfg_mac6_sel_sgmii */
+            if ((regData >> 6) & 1)
+            {
+                *pMode = EXT_SGMII;
+                return RT_ERR_OK;
+            }
+            else if ((regData >> 11) & 1)
+            {
+                *pMode = EXT_HSGMII;
+                return RT_ERR_OK;
+            }
             else
             {
-                pAction->actEnable[FILTER_ENACT_REDIRECT] = (rtk_filter_act_enable_t)1;
+                /* check port6 MAC mode */
+                if ((retVal = rtl8367c_getAsicRegBits(0x1305, 0xf0, &regData)) != RT_ERR_OK)
+                    return retVal;
 
-                phyPmask = aclAct.fwdpmask;
-                if (rtk_switch_portmask_P2L_get(phyPmask, &(pAction->filterPortmask)) != RT_ERR_OK)
-                    return RT_ERR_FAILED;
+                *pMode = regData;
+                return RT_ERR_OK;
             }
         }
-        else if (aclAct.fwdact == RTL8367C_ACL_FWD_MIRROR)
+        else if (2 == id)
         {
-            if ((retVal = rtl8367c_getAsicCputagTrapPort(&cpuPort)) != RT_ERR_OK)
+            if ((retVal = rtl8367c_getAsicReg(0x1d95, &regData)) != RT_ERR_OK)
                 return retVal;
-            if (aclAct.fwdpmask == (1 << cpuPort))
+
+            if (((regData & 0x3) == 3) && (((regData >> 8) & 0x1f) == 0x4))
             {
-                pAction->actEnable[FILTER_ENACT_COPY_CPU] = (rtk_filter_act_enable_t)1;
+                *pMode = EXT_1000X;
+                return RT_ERR_OK;
+            }
+            else if (((regData & 0x3) == 3) && (((regData >> 8) & 0x1f) == 0x5))
+            {
+                *pMode = EXT_100FX;
+                return RT_ERR_OK;
+            }
+            else if (((regData & 0x3) == 3) && (((regData >> 8) & 0x1f) == 0x7))
+            {
+                *pMode = EXT_1000X_100FX;
+                return RT_ERR_OK;
+            }
+            else if (regData & 1)
+            {
+                *pMode = EXT_SGMII;
+                return RT_ERR_OK;
             }
             else
             {
-                pAction->actEnable[FILTER_ENACT_ADD_DSTPORT] = (rtk_filter_act_enable_t)1;
 
-                phyPmask = aclAct.fwdpmask;
-                if (rtk_switch_portmask_P2L_get(phyPmask, &(pAction->filterPortmask)) != RT_ERR_OK)
-                    return RT_ERR_FAILED;
+                if ((retVal = rtl8367c_getAsicRegBits(0x13c3, 0xf, &regData)) != RT_ERR_OK)
+                    return retVal;
+
+                *pMode = regData;
+
+                return RT_ERR_OK;
             }
         }
-        else
-        {
-            return RT_ERR_FAILED;
-        }
-    }
-
-    if (tmp & FILTER_ENACT_POLICING_MASK)
-    {
-        pAction->actEnable[FILTER_ENACT_POLICING_0] = (rtk_filter_act_enable_t)1;
-        pAction->filterPolicingIdx[0] = aclAct.aclmeteridx;
     }
 
-    if (tmp & FILTER_ENACT_PRIORITY_MASK)
-    {
-        if (aclAct.priact == FILTER_ENACT_PRI_TYPE(FILTER_ENACT_PRIORITY))
-        {
-            pAction->actEnable[FILTER_ENACT_PRIORITY] = (rtk_filter_act_enable_t)1;
-            pAction->filterPriority = aclAct.pridx;
-        }
-        else if (aclAct.priact == FILTER_ENACT_PRI_TYPE(FILTER_ENACT_1P_REMARK))
-        {
-            pAction->actEnable[FILTER_ENACT_1P_REMARK] = (rtk_filter_act_enable_t)1;
-            pAction->filterPriority = aclAct.pridx;
-        }
-        else if (aclAct.priact == FILTER_ENACT_PRI_TYPE(FILTER_ENACT_DSCP_REMARK))
-        {
-            pAction->actEnable[FILTER_ENACT_DSCP_REMARK] = (rtk_filter_act_enable_t)1;
-            pAction->filterPriority = aclAct.pridx;
-        }
-        else if (aclAct.priact == FILTER_ENACT_PRI_TYPE(FILTER_ENACT_POLICING_3))
-        {
-            pAction->actEnable[FILTER_ENACT_POLICING_3] = (rtk_filter_act_enable_t)1;
-            pAction->filterPolicingIdx[3] = aclAct.pridx;
-        }
+    return RT_ERR_OK;
+}
+/* Function Name:
+ *      rtl8367c_getAsicPortForceLinkExt
+ * Description:
+ *      Get external interface force linking configuration
+ * Input:
+ *      id          - external interface id (0~1)
+ *      pPortAbility - port ability configuration
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicPortForceLinkExt(uint32_t id, rtl8367c_port_ability_t *pPortAbility)
+{
+    uint32_t reg_data, regValue, type;
+    uint32_t sgmiiSel;
+    uint32_t hsgmiiSel;
+    uint32_t Mode;
+    int32_t retVal;
+
+    if (id >= RTL8367C_EXTNO)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0249)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_getAsicReg(0x1300, &regValue)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicReg(0x13C2, 0x0000)) != RT_ERR_OK)
+        return retVal;
+
+    type = 0;
+
+    switch (regValue)
+    {
+    case 0x0276:
+    case 0x0597:
+    case 0x6367:
+        type = 1;
+        break;
+    case 0x0652:
+    case 0x6368:
+        type = 2;
+        break;
+    case 0x0801:
+    case 0x6511:
+        type = 3;
+        break;
+    default:
+        return RT_ERR_FAILED;
     }
 
-    if (tmp & FILTER_ENACT_SVLAN_MASK)
+    if (1 == type)
     {
-        if (aclAct.sact == FILTER_ENACT_SVLAN_TYPE(FILTER_ENACT_SVLAN_INGRESS))
+        if (1 == id)
         {
-            if ((retVal = rtl8367c_getAsicSvlanMemberConfiguration(aclAct.svidx_sact, &svlan_cfg)) != RT_ERR_OK)
+            if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_SGMII_OFFSET, &sgmiiSel)) != RT_ERR_OK)
                 return retVal;
 
-            pAction->actEnable[FILTER_ENACT_SVLAN_INGRESS] = (rtk_filter_act_enable_t)1;
-            pAction->filterSvlanIdx = aclAct.svidx_sact;
-            pAction->filterSvlanVid = svlan_cfg.vs_svid;
+            if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_MAC8_SEL_HSGMII_OFFSET, &hsgmiiSel)) != RT_ERR_OK)
+                return retVal;
+
+            if ((sgmiiSel == 1) || (hsgmiiSel == 1))
+            {
+                memset(pPortAbility, 0x00, sizeof(rtl8367c_port_ability_t));
+                pPortAbility->forcemode = 1;
+
+                if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_FDUP_OFFSET, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                pPortAbility->duplex = reg_data;
+
+                if ((retVal = rtl8367c_getAsicRegBits(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_SPD_MASK, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                pPortAbility->speed = reg_data;
+
+                if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_LINK_OFFSET, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                pPortAbility->link = reg_data;
+
+                if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_TXFC_OFFSET, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                pPortAbility->txpause = reg_data;
+
+                if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SDS_MISC, RTL8367C_CFG_SGMII_RXFC_OFFSET, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                pPortAbility->rxpause = reg_data;
+
+                return RT_ERR_OK;
+            }
         }
-        else if (aclAct.sact == FILTER_ENACT_SVLAN_TYPE(FILTER_ENACT_SVLAN_EGRESS))
+
+        if (0 == id || 1 == id)
+            retVal = rtl8367c_getAsicReg(RTL8367C_REG_DIGITAL_INTERFACE0_FORCE + id, &reg_data);
+        else
+            retVal = rtl8367c_getAsicReg(RTL8367C_REG_DIGITAL_INTERFACE2_FORCE, &reg_data);
+
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        pPortAbility->forcemode = (reg_data >> 12) & 0x0001;
+        pPortAbility->mstfault = (reg_data >> 9) & 0x0001;
+        pPortAbility->mstmode = (reg_data >> 8) & 0x0001;
+        pPortAbility->nway = (reg_data >> 7) & 0x0001;
+        pPortAbility->txpause = (reg_data >> 6) & 0x0001;
+        pPortAbility->rxpause = (reg_data >> 5) & 0x0001;
+        pPortAbility->link = (reg_data >> 4) & 0x0001;
+        pPortAbility->duplex = (reg_data >> 2) & 0x0001;
+        pPortAbility->speed = reg_data & 0x0003;
+    }
+    else if (2 == type)
+    {
+        if (id == 1)
         {
-            if ((retVal = rtl8367c_getAsicSvlanMemberConfiguration(aclAct.svidx_sact, &svlan_cfg)) != RT_ERR_OK)
+            if ((retVal = rtl8367c_getAsicReg(0x1311, &reg_data)) != RT_ERR_OK)
                 return retVal;
 
-            pAction->actEnable[FILTER_ENACT_SVLAN_EGRESS] = (rtk_filter_act_enable_t)1;
-            pAction->filterSvlanIdx = aclAct.svidx_sact;
-            pAction->filterSvlanVid = svlan_cfg.vs_svid;
+            pPortAbility->forcemode = (reg_data >> 12) & 1;
+            pPortAbility->duplex = (reg_data >> 2) & 1;
+            pPortAbility->link = (reg_data >> 4) & 1;
+            pPortAbility->speed = reg_data & 3;
+            pPortAbility->rxpause = (reg_data >> 5) & 1;
+            pPortAbility->txpause = (reg_data >> 6) & 1;
         }
-        else if (aclAct.sact == FILTER_ENACT_SVLAN_TYPE(FILTER_ENACT_SVLAN_CVID))
-            pAction->actEnable[FILTER_ENACT_SVLAN_CVID] = (rtk_filter_act_enable_t)1;
-        else if (aclAct.sact == FILTER_ENACT_SVLAN_TYPE(FILTER_ENACT_POLICING_2))
+        else if (2 == id)
         {
-            pAction->actEnable[FILTER_ENACT_POLICING_2] = (rtk_filter_act_enable_t)1;
-            pAction->filterPolicingIdx[2] = aclAct.svidx_sact;
+            if ((retVal = rtl8367c_getAsicReg(0x13c4, &reg_data)) != RT_ERR_OK)
+                return retVal;
+
+            pPortAbility->forcemode = (reg_data >> 12) & 1;
+            pPortAbility->duplex = (reg_data >> 2) & 1;
+            pPortAbility->link = (reg_data >> 4) & 1;
+            pPortAbility->speed = reg_data & 3;
+            pPortAbility->rxpause = (reg_data >> 5) & 1;
+            pPortAbility->txpause = (reg_data >> 6) & 1;
         }
     }
-
-    if (tmp & FILTER_ENACT_CVLAN_MASK)
+    else if (3 == type)
     {
-        if (FILTER_ENACT_CACTEXT_TAGONLY == aclAct.cact_ext ||
-            FILTER_ENACT_CACTEXT_BOTHVLANTAG == aclAct.cact_ext)
+        if (id == 1)
         {
-            if (FILTER_CTAGFMT_UNTAG == aclAct.tag_fmt)
-            {
-                pAction->actEnable[FILTER_ENACT_EGRESSCTAG_UNTAG] = (rtk_filter_act_enable_t)1;
-            }
-            else if (FILTER_CTAGFMT_TAG == aclAct.tag_fmt)
+
+            if ((retVal = rtl8367c_getAsicPortExtMode(id, &Mode)) != RT_ERR_OK)
+                return retVal;
+            if (Mode < EXT_SGMII)
             {
-                pAction->actEnable[FILTER_ENACT_EGRESSCTAG_TAG] = (rtk_filter_act_enable_t)1;
+
+                if ((retVal = rtl8367c_getAsicReg(0x1311, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                pPortAbility->forcemode = (reg_data >> 12) & 1;
+                pPortAbility->duplex = (reg_data >> 2) & 1;
+                pPortAbility->link = (reg_data >> 4) & 1;
+                pPortAbility->speed = reg_data & 3;
+                pPortAbility->rxpause = (reg_data >> 5) & 1;
+                pPortAbility->txpause = (reg_data >> 6) & 1;
             }
-            else if (FILTER_CTAGFMT_KEEP == aclAct.tag_fmt)
+            else if (Mode < EXT_1000X_100FX)
             {
-                pAction->actEnable[FILTER_ENACT_EGRESSCTAG_KEEP] = (rtk_filter_act_enable_t)1;
+                if ((retVal = rtl8367c_getAsicReg(0x1d11, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                // pPortAbility->forcemode = (reg_data >> 12) & 1;
+                pPortAbility->duplex = (reg_data >> 10) & 1;
+                pPortAbility->link = (reg_data >> 9) & 1;
+                pPortAbility->speed = (reg_data >> 7) & 3;
+                pPortAbility->rxpause = (reg_data >> 14) & 1;
+                pPortAbility->txpause = (reg_data >> 13) & 1;
             }
-            else if (FILTER_CTAGFMT_KEEP1PRMK == aclAct.tag_fmt)
+            else if (Mode < EXT_RGMII_2)
             {
-                pAction->actEnable[FILTER_ENACT_EGRESSCTAG_KEEPAND1PRMK] = (rtk_filter_act_enable_t)1;
+                if ((retVal = rtl8367c_getAsicReg(0x1358, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                // pPortAbility->forcemode = (reg_data >> 12) & 1;
+                pPortAbility->duplex = (reg_data >> 2) & 1;
+                pPortAbility->link = (reg_data >> 4) & 1;
+                pPortAbility->speed = reg_data & 3;
+                pPortAbility->rxpause = (reg_data >> 5) & 1;
+                pPortAbility->txpause = (reg_data >> 6) & 1;
             }
         }
-
-        if (FILTER_ENACT_CACTEXT_VLANONLY == aclAct.cact_ext ||
-            FILTER_ENACT_CACTEXT_BOTHVLANTAG == aclAct.cact_ext)
+        else if (2 == id)
         {
-            if (aclAct.cact == FILTER_ENACT_CVLAN_TYPE(FILTER_ENACT_CVLAN_INGRESS))
+            if ((retVal = rtl8367c_getAsicPortExtMode(id, &Mode)) != RT_ERR_OK)
+                return retVal;
+            if (Mode < EXT_SGMII)
             {
-                if ((retVal = rtl8367c_getAsicVlanMemberConfig(aclAct.cvidx_cact, &vlanMC)) != RT_ERR_OK)
+
+                if ((retVal = rtl8367c_getAsicReg(0x13c4, &reg_data)) != RT_ERR_OK)
                     return retVal;
 
-                pAction->actEnable[FILTER_ENACT_CVLAN_INGRESS] = (rtk_filter_act_enable_t)1;
-                pAction->filterCvlanIdx = aclAct.cvidx_cact;
-                pAction->filterCvlanVid = vlanMC.evid;
+                pPortAbility->forcemode = (reg_data >> 12) & 1;
+                pPortAbility->duplex = (reg_data >> 2) & 1;
+                pPortAbility->link = (reg_data >> 4) & 1;
+                pPortAbility->speed = reg_data & 3;
+                pPortAbility->rxpause = (reg_data >> 5) & 1;
+                pPortAbility->txpause = (reg_data >> 6) & 1;
             }
-            else if (aclAct.cact == FILTER_ENACT_CVLAN_TYPE(FILTER_ENACT_CVLAN_EGRESS))
+            else if (Mode < EXT_1000X_100FX)
             {
-                if ((retVal = rtl8367c_getAsicVlanMemberConfig(aclAct.cvidx_cact, &vlanMC)) != RT_ERR_OK)
+                if ((retVal = rtl8367c_getAsicReg(0x1d11, &reg_data)) != RT_ERR_OK)
                     return retVal;
 
-                pAction->actEnable[FILTER_ENACT_CVLAN_EGRESS] = (rtk_filter_act_enable_t)1;
-                pAction->filterCvlanIdx = aclAct.cvidx_cact;
-                pAction->filterCvlanVid = vlanMC.evid;
+                // pPortAbility->forcemode = (reg_data >> 12) & 1;
+                pPortAbility->duplex = (reg_data >> 10) & 1;
+                pPortAbility->link = (reg_data >> 9) & 1;
+                pPortAbility->speed = (reg_data >> 7) & 3;
+                pPortAbility->rxpause = (reg_data >> 14) & 1;
+                pPortAbility->txpause = (reg_data >> 13) & 1;
             }
-            else if (aclAct.cact == FILTER_ENACT_CVLAN_TYPE(FILTER_ENACT_CVLAN_SVID))
+            else if (Mode < EXT_RGMII_2)
             {
-                pAction->actEnable[FILTER_ENACT_CVLAN_SVID] = (rtk_filter_act_enable_t)1;
+                if ((retVal = rtl8367c_getAsicReg(0x1359, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                // pPortAbility->forcemode = (reg_data >> 12) & 1;
+                pPortAbility->duplex = (reg_data >> 2) & 1;
+                pPortAbility->link = (reg_data >> 4) & 1;
+                pPortAbility->speed = reg_data & 3;
+                pPortAbility->rxpause = (reg_data >> 5) & 1;
+                pPortAbility->txpause = (reg_data >> 6) & 1;
             }
-            else if (aclAct.cact == FILTER_ENACT_CVLAN_TYPE(FILTER_ENACT_POLICING_1))
+            else if (Mode < EXT_END)
             {
-                pAction->actEnable[FILTER_ENACT_POLICING_1] = (rtk_filter_act_enable_t)1;
-                pAction->filterPolicingIdx[1] = aclAct.cvidx_cact;
+
+                if ((retVal = rtl8367c_getAsicReg(0x1311, &reg_data)) != RT_ERR_OK)
+                    return retVal;
+
+                pPortAbility->forcemode = (reg_data >> 12) & 1;
+                pPortAbility->duplex = (reg_data >> 2) & 1;
+                pPortAbility->link = (reg_data >> 4) & 1;
+                pPortAbility->speed = reg_data & 3;
+                pPortAbility->rxpause = (reg_data >> 5) & 1;
+                pPortAbility->txpause = (reg_data >> 6) & 1;
             }
         }
     }
+    return RT_ERR_OK;
+}
 
-    if (tmp & FILTER_ENACT_INTGPIO_MASK)
+int32_t rtl8367::rtk_port_macForceLinkExt_set(rtk_port_t port, rtk_mode_ext_t mode, rtk_port_mac_ability_t *pPortability)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    rtl8367c_port_ability_t ability;
+    uint32_t ext_id;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_EXT(port);
+
+    if (NULL == pPortability)
+        return RT_ERR_NULL_POINTER;
+
+    if (mode >= MODE_EXT_END)
+        return RT_ERR_INPUT;
+
+    if (mode == MODE_EXT_HSGMII)
     {
-        if (1 == aclAct.aclint)
-        {
-            pAction->actEnable[FILTER_ENACT_INTERRUPT] = (rtk_filter_act_enable_t)1;
-        }
+        if (pPortability->forcemode > 1 || pPortability->speed != PORT_SPEED_2500M || pPortability->duplex != PORT_FULL_DUPLEX ||
+            pPortability->link >= PORT_LINKSTATUS_END || pPortability->nway > 1 || pPortability->txpause > 1 || pPortability->rxpause > 1)
+            return RT_ERR_INPUT;
 
-        if (1 == aclAct.gpio_en)
-        {
-            pAction->actEnable[FILTER_ENACT_GPO] = (rtk_filter_act_enable_t)1;
-            pAction->filterPin = aclAct.gpio_pin;
-        }
+        if (rtk_switch_isHsgPort(port) != RT_ERR_OK)
+            return RT_ERR_PORT_ID;
+    }
+    else
+    {
+        if (pPortability->forcemode > 1 || pPortability->speed > PORT_SPEED_1000M || pPortability->duplex >= PORT_DUPLEX_END ||
+            pPortability->link >= PORT_LINKSTATUS_END || pPortability->nway > 1 || pPortability->txpause > 1 || pPortability->rxpause > 1)
+            return RT_ERR_INPUT;
     }
 
-    /* Get field type of RAW data */
-    if ((retVal = rtl8367c_getAsicAclTemplate(aclRule.data_bits.type, &type)) != RT_ERR_OK)
-        return retVal;
+    ext_id = port - 15;
 
-    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
+    if (mode == MODE_EXT_DISABLE)
     {
-        pFilter_cfg->fieldRawType[i] = (rtk_filter_field_type_raw_t)type.field[i];
-    } /* end of for(i...) */
+        memset(&ability, 0x00, sizeof(rtl8367c_port_ability_t));
+        if ((retVal = rtl8367c_setAsicPortForceLinkExt(ext_id, &ability)) != RT_ERR_OK)
+            return retVal;
+
+        if ((retVal = rtl8367c_setAsicPortExtMode(ext_id, mode)) != RT_ERR_OK)
+            return retVal;
+    }
+    else
+    {
+        if ((retVal = rtl8367c_setAsicPortExtMode(ext_id, mode)) != RT_ERR_OK)
+            return retVal;
+
+        if ((retVal = rtl8367c_getAsicPortForceLinkExt(ext_id, &ability)) != RT_ERR_OK)
+            return retVal;
+
+        ability.forcemode = pPortability->forcemode;
+        ability.speed = (mode == MODE_EXT_HSGMII) ? PORT_SPEED_1000M : pPortability->speed;
+        ability.duplex = pPortability->duplex;
+        ability.link = pPortability->link;
+        ability.nway = pPortability->nway;
+        ability.txpause = pPortability->txpause;
+        ability.rxpause = pPortability->rxpause;
+
+        if ((retVal = rtl8367c_setAsicPortForceLinkExt(ext_id, &ability)) != RT_ERR_OK)
+            return retVal;
+    }
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_port_macForceLinkExt_get(rtk_port_t port, rtk_mode_ext_t *pMode, rtk_port_mac_ability_t *pPortability)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    rtl8367c_port_ability_t ability;
+    uint32_t ext_id;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_EXT(port);
+
+    if (NULL == pMode)
+        return RT_ERR_NULL_POINTER;
+
+    if (NULL == pPortability)
+        return RT_ERR_NULL_POINTER;
+
+    ext_id = port - 15;
+
+    if ((retVal = rtl8367c_getAsicPortExtMode(ext_id, (uint32_t *)pMode)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_getAsicPortForceLinkExt(ext_id, &ability)) != RT_ERR_OK)
+        return retVal;
+
+    pPortability->forcemode = ability.forcemode;
+    pPortability->speed = (*pMode == MODE_EXT_HSGMII) ? PORT_SPEED_2500M : ability.speed;
+    pPortability->duplex = ability.duplex;
+    pPortability->link = ability.link;
+    pPortability->nway = ability.nway;
+    pPortability->txpause = ability.txpause;
+    pPortability->rxpause = ability.rxpause;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_port_rgmiiDelayExt_set(rtk_port_t port, uint32_t txDelay, uint32_t rxDelay)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t regAddr, regData;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_EXT(port);
+
+    if ((txDelay > 1) || (rxDelay > 7))
+        return RT_ERR_INPUT;
+
+    if (port == EXT_PORT0)
+        regAddr = RTL8367C_REG_EXT1_RGMXF;
+    else if (port == EXT_PORT1)
+        regAddr = RTL8367C_REG_EXT2_RGMXF;
+    else
+        return RT_ERR_INPUT;
+
+    if ((retVal = rtl8367c_getAsicReg(regAddr, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    regData = (regData & 0xFFF0) | ((txDelay << 3) & 0x0008) | (rxDelay & 0x0007);
+
+    if ((retVal = rtl8367c_setAsicReg(regAddr, regData)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_port_rgmiiDelayExt_get(rtk_port_t port, uint32_t *pTxDelay, uint32_t *pRxDelay)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t regAddr, regData;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_IS_EXT(port);
+
+    if ((NULL == pTxDelay) || (NULL == pRxDelay))
+        return RT_ERR_NULL_POINTER;
+
+    if (port == EXT_PORT0)
+        regAddr = RTL8367C_REG_EXT1_RGMXF;
+    else if (port == EXT_PORT1)
+        regAddr = RTL8367C_REG_EXT2_RGMXF;
+    else
+        return RT_ERR_INPUT;
+
+    if ((retVal = rtl8367c_getAsicReg(regAddr, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    *pTxDelay = (regData & 0x0008) >> 3;
+    *pRxDelay = regData & 0x0007;
+
+    return RT_ERR_OK;
+}
+
+// --------------------------------- PORT ISOLATION ---------------------------------
+
+/* Function Name:
+ *      rtl8367c_setAsicPortIsolationPermittedPortmask
+ * Description:
+ *      Set permitted port isolation portmask
+ * Input:
+ *      port            - Physical port number (0~10)
+ *      permitPortmask  - port mask
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_PORT_MASK    - Invalid portmask
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicPortIsolationPermittedPortmask(uint32_t port, uint32_t permitPortmask)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
+
+    if (permitPortmask > RTL8367C_PORTMASK)
+        return RT_ERR_PORT_MASK;
+
+    return rtl8367c_setAsicReg(RTL8367C_PORT_ISOLATION_PORT_MASK_REG(port), permitPortmask);
+}
+/* Function Name:
+ *      rtl8367c_getAsicPortIsolationPermittedPortmask
+ * Description:
+ *      Get permitted port isolation portmask
+ * Input:
+ *      port                - Physical port number (0~10)
+ *      pPermitPortmask     - port mask
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicPortIsolationPermittedPortmask(uint32_t port, uint32_t *pPermitPortmask)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_getAsicReg(RTL8367C_PORT_ISOLATION_PORT_MASK_REG(port), pPermitPortmask);
+}
+int32_t rtl8367::rtk_port_isolation_set(rtk_port_t port, rtk_portmask_t *pPortmask)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmask;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (NULL == pPortmask)
+        return RT_ERR_NULL_POINTER;
+
+    /* check port mask */
+    RTK_CHK_PORTMASK_VALID(pPortmask);
+
+    if ((retVal = rtk_switch_portmask_L2P_get(pPortmask, &pmask)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicPortIsolationPermittedPortmask(rtk_switch_port_L2P_get(port), pmask)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_port_isolation_get(rtk_port_t port, rtk_portmask_t *pPortmask)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmask;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (NULL == pPortmask)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicPortIsolationPermittedPortmask(rtk_switch_port_L2P_get(port), &pmask)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtk_switch_portmask_P2L_get(pmask, pPortmask)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+// ------------------------------------ TRUNKING ------------------------------------
+
+/* Function Name:
+ *      rtl8367c_setAsicTrunkingGroup
+ * Description:
+ *      Set trunking group available port mask
+ * Input:
+ *      group       - Trunking group index (0~1)
+ *      portmask    - Member ports of the group, bit 0 is the first port of the group
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ *      RT_ERR_PORT_MASK        - Invalid portmask
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicTrunkingGroup(uint32_t group, uint32_t portmask)
+{
+    if (group > TRUNK_GROUP1)
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (portmask > 0xF)
+        return RT_ERR_PORT_MASK;
+
+    return rtl8367c_setAsicRegBits(RTL8367C_PORT_TRUNK_GROUP_MASK_REG, RTL8367C_PORT_TRUNK_GROUP_MASK_MASK(group), portmask);
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicTrunkingGroup
+ * Description:
+ *      Get trunking group available port mask
+ * Input:
+ *      group       - Trunking group index (0~1)
+ * Output:
+ *      pPortmask   - Member ports of the group, bit 0 is the first port of the group
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicTrunkingGroup(uint32_t group, uint32_t *pPortmask)
+{
+    if (group > TRUNK_GROUP1)
+        return RT_ERR_LA_TRUNK_ID;
+
+    return rtl8367c_getAsicRegBits(RTL8367C_PORT_TRUNK_GROUP_MASK_REG, RTL8367C_PORT_TRUNK_GROUP_MASK_MASK(group), pPortmask);
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicTrunkingHashTable
+ * Description:
+ *      Set the member of every hash value of a trunking group
+ * Input:
+ *      group       - Trunking group index (0~1)
+ *      pMember     - Member (0~3, port offset in the group) of hash values 0~15
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ * Note:
+ *      Two register writes for the whole table.
+ */
+int32_t rtl8367::rtl8367c_setAsicTrunkingHashTable(uint32_t group, uint8_t *pMember)
+{
+    int32_t retVal;
+    uint32_t hash, i, regData;
+
+    if (group > TRUNK_GROUP1)
+        return RT_ERR_LA_TRUNK_ID;
+
+    for (hash = 0; hash < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; hash += 8)
+    {
+        regData = 0;
+        for (i = 0; i < 8; i++)
+            regData |= (pMember[hash + i] & RTL8367C_PORT_TRUNK_HASH_MAPPING_CTRL0_HASH0_MASK) << RTL8367C_PORT_TRUNK_HASH_MAPPING_OFFSET(i);
+
+        if ((retVal = rtl8367c_setAsicReg(RTL8367C_PORT_TRUNK_HASH_MAPPING_REG(group, hash), regData)) != RT_ERR_OK)
+            return retVal;
+    }
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicTrunkingHashTable
+ * Description:
+ *      Get the member of every hash value of a trunking group
+ * Input:
+ *      group       - Trunking group index (0~1)
+ * Output:
+ *      pMember     - Member (0~3, port offset in the group) of hash values 0~15
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicTrunkingHashTable(uint32_t group, uint8_t *pMember)
+{
+    int32_t retVal;
+    uint32_t hash, i, regData;
+
+    if (group > TRUNK_GROUP1)
+        return RT_ERR_LA_TRUNK_ID;
+
+    for (hash = 0; hash < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; hash += 8)
+    {
+        if ((retVal = rtl8367c_getAsicReg(RTL8367C_PORT_TRUNK_HASH_MAPPING_REG(group, hash), &regData)) != RT_ERR_OK)
+            return retVal;
+
+        for (i = 0; i < 8; i++)
+            pMember[hash + i] = (regData >> RTL8367C_PORT_TRUNK_HASH_MAPPING_OFFSET(i)) & RTL8367C_PORT_TRUNK_HASH_MAPPING_CTRL0_HASH0_MASK;
+    }
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_trunk_port_set
+ * Description:
+ *      Set trunking group available port mask
+ * Input:
+ *      trk_gid                 - trunk group id
+ *      pTrunk_member_portmask  - Logic trunking member port mask
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - invalid trunk ID
+ *      RT_ERR_PORT_MASK        - Invalid portmask.
+ *      RT_ERR_LA_PORTMASK      - port mask has ports outside of the group
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      The API can set port trunking group port mask. Each port trunking group has max 4 ports.
+ *      Group 0 takes ports of physical port 0~3 (UTP0~UTP3), group 1 of
+ *      physical port 4~7 (UTP4, EXT0, EXT1). An empty mask removes the group.
+ */
+int32_t rtl8367::rtk_trunk_port_set(rtk_trunk_group_t trk_gid, rtk_portmask_t *pTrunk_member_portmask)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmsk;
+
+    /* Check Trunk Group ID */
+    if ((trk_gid >= TRUNK_GROUP_END) || ((halCtrl.trunk_group_mask & (1 << trk_gid)) == 0))
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (NULL == pTrunk_member_portmask)
+        return RT_ERR_NULL_POINTER;
+
+    RTK_CHK_PORTMASK_VALID(pTrunk_member_portmask);
+
+    if ((retVal = rtk_switch_portmask_L2P_get(pTrunk_member_portmask, &pmsk)) != RT_ERR_OK)
+        return retVal;
+
+    if ((pmsk & RTL8367C_PORT_TRUNK_GROUP_MASK_MASK(trk_gid)) != pmsk)
+        return RT_ERR_LA_PORTMASK;
+
+    return rtl8367c_setAsicTrunkingGroup(trk_gid, pmsk >> RTL8367C_PORT_TRUNK_GROUP_MASK_OFFSET(trk_gid));
+}
+
+/* Function Name:
+ *      rtk_trunk_port_get
+ * Description:
+ *      Get trunking group available port mask
+ * Input:
+ *      trk_gid - trunk group id
+ * Output:
+ *      pTrunk_member_portmask - Logic trunking member port mask
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - invalid trunk ID
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      The API can get 2 port trunking group.
+ */
+int32_t rtl8367::rtk_trunk_port_get(rtk_trunk_group_t trk_gid, rtk_portmask_t *pTrunk_member_portmask)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmsk;
+
+    /* Check Trunk Group ID */
+    if ((trk_gid >= TRUNK_GROUP_END) || ((halCtrl.trunk_group_mask & (1 << trk_gid)) == 0))
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (NULL == pTrunk_member_portmask)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicTrunkingGroup(trk_gid, &pmsk)) != RT_ERR_OK)
+        return retVal;
+
+    return rtk_switch_portmask_P2L_get(pmsk << RTL8367C_PORT_TRUNK_GROUP_MASK_OFFSET(trk_gid), pTrunk_member_portmask);
+}
+
+/* Function Name:
+ *      rtk_trunk_distributionAlgorithm_set
+ * Description:
+ *      Set port trunking hash select sources
+ * Input:
+ *      trk_gid         - trunk group id, RTK_WHOLE_SYSTEM
+ *      algo_bitmask    - Bitmask of the distribution algorithm
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ *      RT_ERR_LA_HASHMASK      - Hash algorithm selection error.
+ * Note:
+ *      The API can set port trunking hash algorithm sources, for all groups.
+ *      7 bits mask for link aggregation group0 hash parameter selection {DIP, SIP, DMAC, SMAC, SPA}
+ *      - 0b0000001: SPA
+ *      - 0b0000010: SMAC
+ *      - 0b0000100: DMAC
+ *      - 0b0001000: SIP
+ *      - 0b0010000: DIP
+ *      - 0b0100000: TCP/UDP Source Port
+ *      - 0b1000000: TCP/UDP Destination Port
+ *      Example:
+ *      - 0b0000011: SMAC & SPA
+ *      - Note that it could be an arbitrary combination or independent set
+ */
+int32_t rtl8367::rtk_trunk_distributionAlgorithm_set(uint32_t trk_gid, uint32_t algo_bitmask)
+{
+    RTK_SMI_STATS_SCOPE();
+
+    if (trk_gid != RTK_WHOLE_SYSTEM)
+        return RT_ERR_LA_TRUNK_ID;
+
+    if ((algo_bitmask == 0) || (algo_bitmask > TRUNK_DISTRIBUTION_ALGO_MASKALL))
+        return RT_ERR_LA_HASHMASK;
+
+    return rtl8367c_setAsicRegBits(RTL8367C_PORT_TRUNK_CTRL_REG, RTL8367C_PORT_TRUNK_HASH_MASK, algo_bitmask);
+}
+
+/* Function Name:
+ *      rtk_trunk_distributionAlgorithm_get
+ * Description:
+ *      Get port trunking hash select sources
+ * Input:
+ *      trk_gid - trunk group id, RTK_WHOLE_SYSTEM
+ * Output:
+ *      pAlgo_bitmask - Bitmask of the distribution algorithm
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      The API can get port trunking hash algorithm sources.
+ */
+int32_t rtl8367::rtk_trunk_distributionAlgorithm_get(uint32_t trk_gid, uint32_t *pAlgo_bitmask)
+{
+    RTK_SMI_STATS_SCOPE();
+
+    if (trk_gid != RTK_WHOLE_SYSTEM)
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (NULL == pAlgo_bitmask)
+        return RT_ERR_NULL_POINTER;
+
+    return rtl8367c_getAsicRegBits(RTL8367C_PORT_TRUNK_CTRL_REG, RTL8367C_PORT_TRUNK_HASH_MASK, pAlgo_bitmask);
+}
+
+/* Function Name:
+ *      rtk_trunk_hashMappingTable_set
+ * Description:
+ *      Set port trunking hash value mapping table
+ * Input:
+ *      trk_gid             - trunk group id
+ *      pHash2Port_array    - logical member port of each hash value
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ *      RT_ERR_LA_NOT_MEMBER_PORT - a port is not a member port of the trunk
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      The hash value picks the member that forwards a flow; ports must be
+ *      members of the group (rtk_trunk_port_set) at the time of the call.
+ */
+int32_t rtl8367::rtk_trunk_hashMappingTable_set(rtk_trunk_group_t trk_gid, rtk_trunk_hashVal2Port_t *pHash2Port_array)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t hash, pmsk, phyPort;
+    uint8_t member[RTK_MAX_NUM_OF_TRUNK_HASH_VAL];
+
+    /* Check Trunk Group ID */
+    if ((trk_gid >= TRUNK_GROUP_END) || ((halCtrl.trunk_group_mask & (1 << trk_gid)) == 0))
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (NULL == pHash2Port_array)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicTrunkingGroup(trk_gid, &pmsk)) != RT_ERR_OK)
+        return retVal;
+
+    for (hash = 0; hash < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; hash++)
+    {
+        if (rtk_switch_logicalPortCheck(pHash2Port_array->value[hash]) != RT_ERR_OK)
+            return RT_ERR_LA_NOT_MEMBER_PORT;
+
+        phyPort = rtk_switch_port_L2P_get(pHash2Port_array->value[hash]) - RTL8367C_PORT_TRUNK_GROUP_MASK_OFFSET(trk_gid);
+        if ((phyPort >= RTL8367C_TRUNKING_PORTNO) || ((pmsk & (1 << phyPort)) == 0))
+            return RT_ERR_LA_NOT_MEMBER_PORT;
+
+        member[hash] = phyPort;
+    }
+
+    return rtl8367c_setAsicTrunkingHashTable(trk_gid, member);
+}
+
+/* Function Name:
+ *      rtk_trunk_hashMappingTable_get
+ * Description:
+ *      Get port trunking hash value mapping table
+ * Input:
+ *      trk_gid - trunk group id
+ * Output:
+ *      pHash2Port_array - logical member port of each hash value
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_trunk_hashMappingTable_get(rtk_trunk_group_t trk_gid, rtk_trunk_hashVal2Port_t *pHash2Port_array)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t hash;
+    uint8_t member[RTK_MAX_NUM_OF_TRUNK_HASH_VAL];
+
+    /* Check Trunk Group ID */
+    if ((trk_gid >= TRUNK_GROUP_END) || ((halCtrl.trunk_group_mask & (1 << trk_gid)) == 0))
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (NULL == pHash2Port_array)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicTrunkingHashTable(trk_gid, member)) != RT_ERR_OK)
+        return retVal;
+
+    for (hash = 0; hash < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; hash++)
+        pHash2Port_array->value[hash] = rtk_switch_port_P2L_get(member[hash] + RTL8367C_PORT_TRUNK_GROUP_MASK_OFFSET(trk_gid));
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_trunk_trafficPause_set
+ * Description:
+ *      Set the traffic pause setting of a trunk group.
+ * Input:
+ *      trk_gid - trunk group id
+ *      enable  - traffic pause state
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ *      RT_ERR_ENABLE           - Invalid enable input.
+ * Note:
+ *      ENABLED makes a PAUSE received on any member pause the whole group.
+ */
+int32_t rtl8367::rtk_trunk_trafficPause_set(rtk_trunk_group_t trk_gid, rtk_enable_t enable)
+{
+    RTK_SMI_STATS_SCOPE();
+
+    /* Check Trunk Group ID */
+    if ((trk_gid >= TRUNK_GROUP_END) || ((halCtrl.trunk_group_mask & (1 << trk_gid)) == 0))
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_PORT_TRUNK_FLOWCTRL_REG, RTL8367C_EN_FLOWCTRL_TG0_OFFSET + trk_gid, (enable == ENABLED) ? 1 : 0);
+}
+
+/* Function Name:
+ *      rtk_trunk_trafficPause_get
+ * Description:
+ *      Get the traffic pause setting of a trunk group.
+ * Input:
+ *      trk_gid - trunk group id
+ * Output:
+ *      pEnable - traffic pause state
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_trunk_trafficPause_get(rtk_trunk_group_t trk_gid, rtk_enable_t *pEnable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t regData;
+
+    /* Check Trunk Group ID */
+    if ((trk_gid >= TRUNK_GROUP_END) || ((halCtrl.trunk_group_mask & (1 << trk_gid)) == 0))
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (NULL == pEnable)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_PORT_TRUNK_FLOWCTRL_REG, RTL8367C_EN_FLOWCTRL_TG0_OFFSET + trk_gid, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    *pEnable = regData ? ENABLED : (rtk_enable_t)DISABLED;
+
+    return RT_ERR_OK;
+}
+
+#ifdef RTL8367_TRUNK_BALANCE
+/* Function Name:
+ *      rtk_trunk_rebalance
+ * Description:
+ *      Move a hash value from the busiest to the idlest member of a trunk group
+ * Input:
+ *      trk_gid - trunk group id
+ * Output:
+ *      pMoved  - hash values remapped by this call
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_LA_TRUNK_ID      - Invalid trunking group
+ *      RT_ERR_LA_TRUNK_NOT_EXIST - the trunk has no member
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      Call periodically (e.g. every few seconds). Hash values mapped to a
+ *      port that is no longer a member are first spread over the members.
+ *      Then the ifOutOctets increase of every member since the previous
+ *      call is compared; each hash value of a member is assumed to carry an
+ *      equal share of its bytes. When the busiest member sends over 1/8 more
+ *      than the idlest and one share is less than the gap, its highest hash
+ *      value moves to the idlest member. One move per call keeps flows from
+ *      bouncing; the flows of the moved hash value may see a few frames
+ *      reordered. The first call of a group only takes the byte snapshot.
+ */
+int32_t rtl8367::rtk_trunk_rebalance(rtk_trunk_group_t trk_gid, uint32_t *pMoved)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmsk, hash, i, base, busy, idle, next;
+    uint8_t member[RTK_MAX_NUM_OF_TRUNK_HASH_VAL];
+    uint32_t hashNum[RTL8367C_TRUNKING_PORTNO] = {0};
+    uint64_t octets, load[RTL8367C_TRUNKING_PORTNO];
+
+    /* Check Trunk Group ID */
+    if ((trk_gid >= TRUNK_GROUP_END) || ((halCtrl.trunk_group_mask & (1 << trk_gid)) == 0))
+        return RT_ERR_LA_TRUNK_ID;
+
+    if (NULL == pMoved)
+        return RT_ERR_NULL_POINTER;
+
+    *pMoved = 0;
+
+    if ((retVal = rtl8367c_getAsicTrunkingGroup(trk_gid, &pmsk)) != RT_ERR_OK)
+        return retVal;
+
+    if (pmsk == 0)
+        return RT_ERR_LA_TRUNK_NOT_EXIST;
+
+    if ((retVal = rtl8367c_getAsicTrunkingHashTable(trk_gid, member)) != RT_ERR_OK)
+        return retVal;
+
+    /* stray hash values round robin over the members */
+    next = 0;
+    for (hash = 0; hash < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; hash++)
+    {
+        if (pmsk & (1 << member[hash]))
+            continue;
+
+        while ((pmsk & (1 << next)) == 0)
+            next = (next + 1) % RTL8367C_TRUNKING_PORTNO;
+        member[hash] = next;
+        next = (next + 1) % RTL8367C_TRUNKING_PORTNO;
+        (*pMoved)++;
+    }
+
+    if (*pMoved)
+        return rtl8367c_setAsicTrunkingHashTable(trk_gid, member);
+
+    base = RTL8367C_PORT_TRUNK_GROUP_MASK_OFFSET(trk_gid);
+    for (i = 0; i < RTL8367C_TRUNKING_PORTNO; i++)
+    {
+        if ((pmsk & (1 << i)) == 0)
+            continue;
+
+        if ((retVal = rtl8367c_getAsicMIBsCounter(base + i, ifOutOctets, &octets)) != RT_ERR_OK)
+            return retVal;
+
+        /* a counter reset restarts from 0 */
+        load[i] = (octets >= trunkTxPrev[base + i]) ? (octets - trunkTxPrev[base + i]) : octets;
+        trunkTxPrev[base + i] = octets;
+    }
+
+    if ((trunkTxValid & (1 << trk_gid)) == 0)
+    {
+        trunkTxValid |= (1 << trk_gid);
+        return RT_ERR_OK;
+    }
+
+    for (hash = 0; hash < RTK_MAX_NUM_OF_TRUNK_HASH_VAL; hash++)
+        hashNum[member[hash]]++;
+
+    busy = idle = RTL8367C_TRUNKING_PORTNO;
+    for (i = 0; i < RTL8367C_TRUNKING_PORTNO; i++)
+    {
+        if ((pmsk & (1 << i)) == 0)
+            continue;
+
+        if ((busy == RTL8367C_TRUNKING_PORTNO) || (load[i] > load[busy]))
+            busy = i;
+        if ((idle == RTL8367C_TRUNKING_PORTNO) || (load[i] < load[idle]))
+            idle = i;
+    }
+
+    if ((busy == idle) || (hashNum[busy] < 2))
+        return RT_ERR_OK;
+
+    if ((load[busy] - load[idle]) <= (load[busy] >> 3))
+        return RT_ERR_OK;
+
+    if ((load[busy] / hashNum[busy]) >= (load[busy] - load[idle]))
+        return RT_ERR_OK;
+
+    for (hash = RTK_MAX_NUM_OF_TRUNK_HASH_VAL; hash > 0; hash--)
+    {
+        if (member[hash - 1] == busy)
+            break;
+    }
+
+    *pMoved = 1;
+
+    /* only the register holding the hash value changes */
+    hash--;
+    return rtl8367c_setAsicRegBits(RTL8367C_PORT_TRUNK_HASH_MAPPING_REG(trk_gid, hash), RTL8367C_PORT_TRUNK_HASH_MAPPING_MASK(hash), idle);
+}
+#endif
+
+// -------------------------------- MAX PACKET LENGTH --------------------------------
+
+/* bytes of each rtk_switch_len_t */
+static const uint16_t maxPktLenBytes[MAXPKTLEN_END] = {1522, 1536, 1552, 16000, 9216};
+
+/* Function Name:
+ *      rtl8367c_setAsicMaxLengthCfg
+ * Description:
+ *      Set a max packet length configuration
+ * Input:
+ *      id      - Configuration id (0~1)
+ *      length  - Max accepted length in bytes (0~16383)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_INPUT        - Invalid input parameter
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicMaxLengthCfg(uint32_t id, uint32_t length)
+{
+    if (id > MAXPKTLENCFG_ID_MAX)
+        return RT_ERR_INPUT;
+
+    if (length > RTK_SWITCH_MAX_PKTLEN)
+        return RT_ERR_INPUT;
+
+    return rtl8367c_setAsicRegBits(RTL8367C_REG_MAX_LEN_RX_TX_CFG0 + id, RTL8367C_MAX_LEN_RX_TX_CFG0_MASK, length);
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicMaxLengthCfg
+ * Description:
+ *      Get a max packet length configuration
+ * Input:
+ *      id      - Configuration id (0~1)
+ * Output:
+ *      pLength - Max accepted length in bytes
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_INPUT        - Invalid input parameter
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicMaxLengthCfg(uint32_t id, uint32_t *pLength)
+{
+    if (id > MAXPKTLENCFG_ID_MAX)
+        return RT_ERR_INPUT;
+
+    return rtl8367c_getAsicRegBits(RTL8367C_REG_MAX_LEN_RX_TX_CFG0 + id, RTL8367C_MAX_LEN_RX_TX_CFG0_MASK, pLength);
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicMaxLength
+ * Description:
+ *      Set the max packet length configuration used by a port at a link speed
+ * Input:
+ *      port    - Physical port number (0~10)
+ *      type    - 0: 10M/100M, 1: 1000M
+ *      cfgId   - Configuration id (0~1)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_INPUT        - Invalid input parameter
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicMaxLength(uint32_t port, uint32_t type, uint32_t cfgId)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    if ((type >= MAXPKTLEN_LINK_SPEED_END) || (cfgId > MAXPKTLENCFG_ID_MAX))
+        return RT_ERR_INPUT;
+
+    if (port < 8)
+        return rtl8367c_setAsicRegBit(RTL8367C_REG_MAX_LENGTH_CFG, (type * 8) + port, cfgId);
+    else
+        return rtl8367c_setAsicRegBit(RTL8367C_REG_MAX_LENGTH_CFG_EXT, (type * 3) + port - 8, cfgId);
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicMaxLength
+ * Description:
+ *      Get the max packet length configuration used by a port at a link speed
+ * Input:
+ *      port    - Physical port number (0~10)
+ *      type    - 0: 10M/100M, 1: 1000M
+ * Output:
+ *      pCfgId  - Configuration id (0~1)
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_INPUT        - Invalid input parameter
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicMaxLength(uint32_t port, uint32_t type, uint32_t *pCfgId)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    if (type >= MAXPKTLEN_LINK_SPEED_END)
+        return RT_ERR_INPUT;
+
+    if (port < 8)
+        return rtl8367c_getAsicRegBit(RTL8367C_REG_MAX_LENGTH_CFG, (type * 8) + port, pCfgId);
+    else
+        return rtl8367c_getAsicRegBit(RTL8367C_REG_MAX_LENGTH_CFG_EXT, (type * 3) + port - 8, pCfgId);
+}
+
+/* Function Name:
+ *      rtk_switch_maxPktLen_set
+ * Description:
+ *      Set the max packet length of all ports at a link speed
+ * Input:
+ *      speed   - Speed
+ *      len     - Max packet length
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ * Note:
+ *      Configuration 0 holds the 10M/100M length and configuration 1 the
+ *      1000M length; every port is pointed at the configuration of the
+ *      speed. Two read-modify-writes cover all ports.
+ */
+int32_t rtl8367::rtk_switch_maxPktLen_set(rtk_switch_maxPktLen_linkSpeed_t speed, rtk_switch_len_t len)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmsk, regData;
+
+    if (speed >= MAXPKTLEN_LINK_SPEED_END)
+        return RT_ERR_INPUT;
+
+    if (len >= MAXPKTLEN_END)
+        return RT_ERR_INPUT;
+
+    if ((retVal = rtl8367c_setAsicMaxLengthCfg(speed, maxPktLenBytes[len])) != RT_ERR_OK)
+        return retVal;
+
+    pmsk = halCtrl.phy_portmask;
+
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_MAX_LENGTH_CFG, &regData)) != RT_ERR_OK)
+        return retVal;
+    regData &= ~((pmsk & 0xFF) << (speed * 8));
+    regData |= (speed == MAXPKTLEN_LINK_SPEED_GE) ? ((pmsk & 0xFF) << 8) : 0;
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_REG_MAX_LENGTH_CFG, regData)) != RT_ERR_OK)
+        return retVal;
+
+    if ((pmsk >> 8) == 0)
+        return RT_ERR_OK;
+
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_MAX_LENGTH_CFG_EXT, &regData)) != RT_ERR_OK)
+        return retVal;
+    regData &= ~(((pmsk >> 8) & 0x7) << (speed * 3));
+    regData |= (speed == MAXPKTLEN_LINK_SPEED_GE) ? (((pmsk >> 8) & 0x7) << 3) : 0;
+
+    return rtl8367c_setAsicReg(RTL8367C_REG_MAX_LENGTH_CFG_EXT, regData);
+}
+
+/* Function Name:
+ *      rtk_switch_maxPktLen_get
+ * Description:
+ *      Get the max packet length at a link speed
+ * Input:
+ *      speed   - Speed
+ * Output:
+ *      pLen    - Max packet length
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ *      RT_ERR_FAILED           - The configuration holds a custom length.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      Reads the configuration of the speed as set by rtk_switch_maxPktLen_set;
+ *      use rtk_switch_maxPktLenCfg_get for custom lengths.
+ */
+int32_t rtl8367::rtk_switch_maxPktLen_get(rtk_switch_maxPktLen_linkSpeed_t speed, rtk_switch_len_t *pLen)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t length, len;
+
+    if (speed >= MAXPKTLEN_LINK_SPEED_END)
+        return RT_ERR_INPUT;
+
+    if (NULL == pLen)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicMaxLengthCfg(speed, &length)) != RT_ERR_OK)
+        return retVal;
+
+    for (len = 0; len < MAXPKTLEN_END; len++)
+    {
+        if (maxPktLenBytes[len] == length)
+        {
+            *pLen = (rtk_switch_len_t)len;
+            return RT_ERR_OK;
+        }
+    }
+
+    return RT_ERR_FAILED;
+}
+
+/* Function Name:
+ *      rtk_switch_portMaxPktLen_set
+ * Description:
+ *      Set the max packet length configuration of a port at a link speed
+ * Input:
+ *      port    - Port ID
+ *      speed   - Speed
+ *      cfgId   - Configuration ID
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ * Note:
+ *      E.g. a jumbo storage port: rtk_switch_maxPktLenCfg_set(1, 9216) and
+ *      cfgId 1 for that port only.
+ */
+int32_t rtl8367::rtk_switch_portMaxPktLen_set(rtk_port_t port, rtk_switch_maxPktLen_linkSpeed_t speed, uint32_t cfgId)
+{
+    RTK_SMI_STATS_SCOPE();
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (speed >= MAXPKTLEN_LINK_SPEED_END)
+        return RT_ERR_INPUT;
+
+    if (cfgId > MAXPKTLENCFG_ID_MAX)
+        return RT_ERR_INPUT;
+
+    return rtl8367c_setAsicMaxLength(rtk_switch_port_L2P_get(port), speed, cfgId);
+}
+
+/* Function Name:
+ *      rtk_switch_portMaxPktLen_get
+ * Description:
+ *      Get the max packet length configuration of a port at a link speed
+ * Input:
+ *      port    - Port ID
+ *      speed   - Speed
+ * Output:
+ *      pCfgId  - Configuration ID
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      The active length is rtk_switch_maxPktLenCfg_get of the returned id.
+ */
+int32_t rtl8367::rtk_switch_portMaxPktLen_get(rtk_port_t port, rtk_switch_maxPktLen_linkSpeed_t speed, uint32_t *pCfgId)
+{
+    RTK_SMI_STATS_SCOPE();
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (speed >= MAXPKTLEN_LINK_SPEED_END)
+        return RT_ERR_INPUT;
+
+    if (NULL == pCfgId)
+        return RT_ERR_NULL_POINTER;
+
+    return rtl8367c_getAsicMaxLength(rtk_switch_port_L2P_get(port), speed, pCfgId);
+}
+
+/* Function Name:
+ *      rtk_switch_maxPktLenCfg_set
+ * Description:
+ *      Set a max packet length configuration
+ * Input:
+ *      cfgId   - Configuration ID
+ *      pktLen  - Max packet length in bytes
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ * Note:
+ *      Any length up to RTK_SWITCH_MAX_PKTLEN.
+ */
+int32_t rtl8367::rtk_switch_maxPktLenCfg_set(uint32_t cfgId, uint32_t pktLen)
+{
+    RTK_SMI_STATS_SCOPE();
+
+    if (cfgId > MAXPKTLENCFG_ID_MAX)
+        return RT_ERR_INPUT;
+
+    if (pktLen > RTK_SWITCH_MAX_PKTLEN)
+        return RT_ERR_INPUT;
+
+    return rtl8367c_setAsicMaxLengthCfg(cfgId, pktLen);
+}
+
+/* Function Name:
+ *      rtk_switch_maxPktLenCfg_get
+ * Description:
+ *      Get a max packet length configuration
+ * Input:
+ *      cfgId   - Configuration ID
+ * Output:
+ *      pPktLen - Max packet length in bytes
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_INPUT            - Invalid input parameter.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_switch_maxPktLenCfg_get(uint32_t cfgId, uint32_t *pPktLen)
+{
+    RTK_SMI_STATS_SCOPE();
+
+    if (cfgId > MAXPKTLENCFG_ID_MAX)
+        return RT_ERR_INPUT;
+
+    if (NULL == pPktLen)
+        return RT_ERR_NULL_POINTER;
+
+    return rtl8367c_getAsicMaxLengthCfg(cfgId, pPktLen);
+}
+
+// ------------------------------- MAC LEARNING LIMIT -------------------------------
+
+/* Function Name:
+ *      rtl8367c_setAsicLutLearnLimitNo
+ * Description:
+ *      Set per-Port auto learning limit number
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      number  - ASIC auto learning entries limit number
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK                   - Success
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_PORT_ID              - Invalid port number
+ *      RT_ERR_LIMITED_L2ENTRY_NUM  - Invalid auto learning limit number
+ * Note:
+ *      None
+ */
+/*�޸�: RTL8367C_PORTIDMAX, RTL8367C_LUT_LEARNLIMITMAX, RTL8367C_LUT_PORT_LEARN_LIMITNO_REG*/
+int32_t rtl8367::rtl8367c_setAsicLutLearnLimitNo(uint32_t port, uint32_t number)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    if (number > RTL8367C_LUT_LEARNLIMITMAX)
+        return RT_ERR_LIMITED_L2ENTRY_NUM;
+
+    if (port < 8)
+        return rtl8367c_setAsicReg(RTL8367C_LUT_PORT_LEARN_LIMITNO_REG(port), number);
+    else
+        return rtl8367c_setAsicReg(RTL8367C_REG_LUT_PORT8_LEARN_LIMITNO + port - 8, number);
+}
+/* Function Name:
+ *      rtl8367c_getAsicLutLearnLimitNo
+ * Description:
+ *      Get per-Port auto learning limit number
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pNumber     - ASIC auto learning entries limit number
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+/*�޸�: RTL8367C_PORTIDMAX, RTL8367C_LUT_PORT_LEARN_LIMITNO_REG*/
+int32_t rtl8367::rtl8367c_getAsicLutLearnLimitNo(uint32_t port, uint32_t *pNumber)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    if (port < 8)
+        return rtl8367c_getAsicReg(RTL8367C_LUT_PORT_LEARN_LIMITNO_REG(port), pNumber);
+    else
+        return rtl8367c_getAsicReg(RTL8367C_REG_LUT_PORT8_LEARN_LIMITNO + port - 8, pNumber);
+}
+
+int32_t rtl8367::rtk_l2_limitLearningCnt_set(rtk_port_t port, uint32_t mac_cnt)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    /* check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (mac_cnt > halCtrl.max_lut_addr_num)
+        return RT_ERR_LIMITED_L2ENTRY_NUM;
+
+    if ((retVal = rtl8367c_setAsicLutLearnLimitNo(rtk_switch_port_L2P_get(port), mac_cnt)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_l2_limitLearningCnt_get(rtk_port_t port, uint32_t *pMac_cnt)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    /* check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (NULL == pMac_cnt)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicLutLearnLimitNo(rtk_switch_port_L2P_get(port), pMac_cnt)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicLutLearnNo
+ * Description:
+ *      Get per-Port auto learning number
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      pNumber     - ASIC auto learning entries number
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+/*�޸�RTL8367C_PORTIDMAX, RTL8367C_REG_L2_LRN_CNT_REG, port10 reg is not contnious, wait for updating of base.h*/
+int32_t rtl8367::rtl8367c_getAsicLutLearnNo(uint32_t port, uint32_t *pNumber)
+{
+    int32_t retVal;
+
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    if (port < 10)
+    {
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_L2_LRN_CNT_REG(port), pNumber);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+    else
+    {
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_L2_LRN_CNT_CTRL10, pNumber);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+
+    return RT_ERR_OK;
+}
+int32_t rtl8367::rtk_l2_learningCnt_get(rtk_port_t port, uint32_t *pMac_cnt)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    /* check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (NULL == pMac_cnt)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicLutLearnNo(rtk_switch_port_L2P_get(port), pMac_cnt)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicLutLearnOverAct
+ * Description:
+ *      Set per-port auto learning over limit action
+ * Input:
+ *      action  - Learn over action 0:normal, 1:drop, 2:trap
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NOT_ALLOWED  - Invalid learn over action
+ * Note:
+ *      The action is shared by all ports.
+ */
+int32_t rtl8367::rtl8367c_setAsicLutLearnOverAct(uint32_t action)
+{
+    if (action >= LRNOVERACT_END)
+        return RT_ERR_NOT_ALLOWED;
+
+    return rtl8367c_setAsicField<RTL8367C_FIELD(PORT_SECURITY_CTRL, LUT_LEARN_OVER_ACT)>(action);
+}
+/* Function Name:
+ *      rtl8367c_getAsicLutLearnOverAct
+ * Description:
+ *      Get per-port auto learning over limit action
+ * Input:
+ *      None
+ * Output:
+ *      pAction - Learn over action 0:normal, 1:drop, 2:trap
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicLutLearnOverAct(uint32_t *pAction)
+{
+    return rtl8367c_getAsicField<RTL8367C_FIELD(PORT_SECURITY_CTRL, LUT_LEARN_OVER_ACT)>(pAction);
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicSystemLutLearnLimitNo
+ * Description:
+ *      Set system auto learning limit number
+ * Input:
+ *      number  - ASIC auto learning entries limit number
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK                   - Success
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_LIMITED_L2ENTRY_NUM  - Invalid auto learning limit number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicSystemLutLearnLimitNo(uint32_t number)
+{
+    if (number > RTL8367C_LUT_LEARNLIMITMAX)
+        return RT_ERR_LIMITED_L2ENTRY_NUM;
+
+    return rtl8367c_setAsicReg(RTL8367C_REG_LUT_SYS_LEARN_LIMITNO, number);
+}
+/* Function Name:
+ *      rtl8367c_getAsicSystemLutLearnLimitNo
+ * Description:
+ *      Get system auto learning limit number
+ * Input:
+ *      None
+ * Output:
+ *      pNumber - ASIC auto learning entries limit number
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicSystemLutLearnLimitNo(uint32_t *pNumber)
+{
+    return rtl8367c_getAsicField<RTL8367C_FIELD(LUT_SYS_LEARN_LIMITNO, LUT_SYS_LEARN_LIMITNO)>(pNumber);
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicSystemLutLearnOverAct
+ * Description:
+ *      Set system auto learning over limit action
+ * Input:
+ *      action  - Learn over action 0:normal, 1:drop, 2:trap
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NOT_ALLOWED  - Invalid learn over action
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicSystemLutLearnOverAct(uint32_t action)
+{
+    if (action >= LRNOVERACT_END)
+        return RT_ERR_NOT_ALLOWED;
+
+    return rtl8367c_setAsicField<RTL8367C_FIELD(LUT_LRN_SYS_LMT_CTRL, LUT_SYSTEM_LEARN_OVER_ACT)>(action);
+}
+/* Function Name:
+ *      rtl8367c_getAsicSystemLutLearnOverAct
+ * Description:
+ *      Get system auto learning over limit action
+ * Input:
+ *      None
+ * Output:
+ *      pAction - Learn over action 0:normal, 1:drop, 2:trap
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicSystemLutLearnOverAct(uint32_t *pAction)
+{
+    return rtl8367c_getAsicField<RTL8367C_FIELD(LUT_LRN_SYS_LMT_CTRL, LUT_SYSTEM_LEARN_OVER_ACT)>(pAction);
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicSystemLutLearnPortMask
+ * Description:
+ *      Set ports counted by the system auto learning limit
+ * Input:
+ *      portmask    - physical port mask (0~10)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_MASK    - Invalid port mask
+ * Note:
+ *      Ports 0~7 and 8~10 live in two fields of one register, written with
+ *      a single read-modify-write.
+ */
+int32_t rtl8367::rtl8367c_setAsicSystemLutLearnPortMask(uint32_t portmask)
+{
+    if (portmask > RTL8367C_PORTMASK)
+        return RT_ERR_PORT_MASK;
+
+    return rtl8367c_setAsicRegMasked(RTL8367C_REG_LUT_LRN_SYS_LMT_CTRL,
+                                     RTL8367C_LUT_SYSTEM_LEARN_PMASK_MASK | RTL8367C_LUT_SYSTEM_LEARN_PMASK1_MASK,
+                                     (portmask & 0xFF) | ((portmask >> 8) << RTL8367C_LUT_SYSTEM_LEARN_PMASK1_OFFSET));
+}
+/* Function Name:
+ *      rtl8367c_getAsicSystemLutLearnPortMask
+ * Description:
+ *      Get ports counted by the system auto learning limit
+ * Input:
+ *      None
+ * Output:
+ *      pPortmask   - physical port mask (0~10)
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicSystemLutLearnPortMask(uint32_t *pPortmask)
+{
+    int32_t retVal;
+    uint32_t regData;
+
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_REG_LUT_LRN_SYS_LMT_CTRL, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    *pPortmask = (regData & RTL8367C_LUT_SYSTEM_LEARN_PMASK_MASK) |
+                 (((regData & RTL8367C_LUT_SYSTEM_LEARN_PMASK1_MASK) >> RTL8367C_LUT_SYSTEM_LEARN_PMASK1_OFFSET) << 8);
+
+    return RT_ERR_OK;
+}
+
+/* learn over action of the API and its ASIC value */
+static const uint32_t _rtk_l2_lrnOverAct[LIMIT_LEARN_CNT_ACTION_END] = {LRNOVERACT_DROP, LRNOVERACT_FORWARD, LRNOVERACT_TRAP};
+
+static rtk_l2_limitLearnCntAction_t _rtk_l2_lrnOverAct_get(uint32_t act)
+{
+    uint32_t i;
+
+    for (i = 0; i < LIMIT_LEARN_CNT_ACTION_END; i++)
+    {
+        if (_rtk_l2_lrnOverAct[i] == act)
+            return (rtk_l2_limitLearnCntAction_t)i;
+    }
+
+    return LIMIT_LEARN_CNT_ACTION_END;
+}
+
+/* Function Name:
+ *      rtk_l2_limitLearningCntAction_set
+ * Description:
+ *      Configure auto learn over limit number action.
+ * Input:
+ *      port    - Port id, must be RTK_WHOLE_SYSTEM
+ *      action  - Auto learning entries limit number
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number.
+ *      RT_ERR_NOT_ALLOWED  - Invalid learn over action
+ * Note:
+ *      The action of frames whose source MAC would exceed the limit of
+ *      their port (rtk_l2_limitLearningCnt_set). The chip has one action for
+ *      all ports.
+ */
+int32_t rtl8367::rtk_l2_limitLearningCntAction_set(uint32_t port, rtk_l2_limitLearnCntAction_t action)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if (port != RTK_WHOLE_SYSTEM)
+        return RT_ERR_PORT_ID;
+
+    if (action >= LIMIT_LEARN_CNT_ACTION_END)
+        return RT_ERR_NOT_ALLOWED;
+
+    if ((retVal = rtl8367c_setAsicLutLearnOverAct(_rtk_l2_lrnOverAct[action])) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_limitLearningCntAction_get
+ * Description:
+ *      Get auto learn over limit number action.
+ * Input:
+ *      port    - Port id, must be RTK_WHOLE_SYSTEM
+ * Output:
+ *      pAction - Learn over action
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number.
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_l2_limitLearningCntAction_get(uint32_t port, rtk_l2_limitLearnCntAction_t *pAction)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t act;
+
+    if (port != RTK_WHOLE_SYSTEM)
+        return RT_ERR_PORT_ID;
+
+    if (NULL == pAction)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicLutLearnOverAct(&act)) != RT_ERR_OK)
+        return retVal;
+
+    if ((*pAction = _rtk_l2_lrnOverAct_get(act)) == LIMIT_LEARN_CNT_ACTION_END)
+        return RT_ERR_FAILED;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_limitSystemLearningCnt_set
+ * Description:
+ *      Set system auto learn limit number
+ * Input:
+ *      mac_cnt - Auto learning entries limit number
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK                  - OK
+ *      RT_ERR_SMI                 - SMI access error
+ *      RT_ERR_LIMITED_L2ENTRY_NUM - Invalid auto learning limit number
+ * Note:
+ *      Caps the entries learned by all the ports of
+ *      rtk_l2_limitSystemLearningCntPortMask_set together, on top of their
+ *      own limits. Static entries do not count.
+ */
+int32_t rtl8367::rtk_l2_limitSystemLearningCnt_set(uint32_t mac_cnt)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if (mac_cnt > halCtrl.max_lut_addr_num)
+        return RT_ERR_LIMITED_L2ENTRY_NUM;
+
+    if ((retVal = rtl8367c_setAsicSystemLutLearnLimitNo(mac_cnt)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_limitSystemLearningCnt_get
+ * Description:
+ *      Get system auto learn limit number
+ * Input:
+ *      None
+ * Output:
+ *      pMac_cnt - Auto learning entries limit number
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_l2_limitSystemLearningCnt_get(uint32_t *pMac_cnt)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if (NULL == pMac_cnt)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicSystemLutLearnLimitNo(pMac_cnt)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_limitSystemLearningCntAction_set
+ * Description:
+ *      Configure system auto learn over limit number action.
+ * Input:
+ *      action  - Learn over action
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NOT_ALLOWED  - Invalid learn over action
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_l2_limitSystemLearningCntAction_set(rtk_l2_limitLearnCntAction_t action)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if (action >= LIMIT_LEARN_CNT_ACTION_END)
+        return RT_ERR_NOT_ALLOWED;
+
+    if ((retVal = rtl8367c_setAsicSystemLutLearnOverAct(_rtk_l2_lrnOverAct[action])) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_limitSystemLearningCntAction_get
+ * Description:
+ *      Get system auto learn over limit number action.
+ * Input:
+ *      None
+ * Output:
+ *      pAction - Learn over action
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_l2_limitSystemLearningCntAction_get(rtk_l2_limitLearnCntAction_t *pAction)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t act;
+
+    if (NULL == pAction)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicSystemLutLearnOverAct(&act)) != RT_ERR_OK)
+        return retVal;
+
+    if ((*pAction = _rtk_l2_lrnOverAct_get(act)) == LIMIT_LEARN_CNT_ACTION_END)
+        return RT_ERR_FAILED;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_limitSystemLearningCntPortMask_set
+ * Description:
+ *      Configure system auto learn portmask
+ * Input:
+ *      pPortmask   - Port Mask
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_MASK    - Invalid port mask.
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_l2_limitSystemLearningCntPortMask_set(rtk_portmask_t *pPortmask)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmask;
+
+    if (NULL == pPortmask)
+        return RT_ERR_NULL_POINTER;
+
+    /* Check port mask */
+    RTK_CHK_PORTMASK_VALID(pPortmask);
+
+    if ((retVal = rtk_switch_portmask_L2P_get(pPortmask, &pmask)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicSystemLutLearnPortMask(pmask)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_limitSystemLearningCntPortMask_get
+ * Description:
+ *      get system auto learn portmask
+ * Input:
+ *      None
+ * Output:
+ *      pPortmask   - Port Mask
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_l2_limitSystemLearningCntPortMask_get(rtk_portmask_t *pPortmask)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t pmask;
+
+    if (NULL == pPortmask)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicSystemLutLearnPortMask(&pmask)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtk_switch_portmask_P2L_get(pmask, pPortmask)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+// ------------------------------- MAC AGING -------------------------------
+
+/* Function Name:
+ *      rtl8367c_setAsicLutAgeTimerSpeed
+ * Description:
+ *      Set LUT agging out speed
+ * Input:
+ *      timer   - Agging out timer 0:Has been aged out
+ *      speed   - Agging out speed 0-fastest 3-slowest
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK                   - Success
+ *      RT_ERR_SMI                  - SMI access error
+ *      RT_ERR_OUT_OF_RANGE         - input parameter out of range
+ * Note:
+ *      Timer and speed share LUT_CFG and are written with one
+ *      read-modify-write.
+ */
+int32_t rtl8367::rtl8367c_setAsicLutAgeTimerSpeed(uint32_t timer, uint32_t speed)
+{
+    if (timer > RTL8367C_LUT_AGETIMERMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (speed > RTL8367C_LUT_AGESPEEDMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    return rtl8367c_setAsicRegMasked(RTL8367C_LUT_CFG_REG, RTL8367C_AGE_TIMER_MASK | RTL8367C_AGE_SPEED_MASK,
+                                     (timer << RTL8367C_AGE_TIMER_OFFSET) | (speed << RTL8367C_AGE_SPEED_OFFSET));
+}
+/* Function Name:
+ *      rtl8367c_getAsicLutAgeTimerSpeed
+ * Description:
+ *      Get LUT agging out time and speed
+ * Input:
+ *      None
+ * Output:
+ *      pTimer  - Agging out timer 0:Has been aged out
+ *      pSpeed  - Agging out speed 0-fastest 3-slowest
+ * Return:
+ *      RT_ERR_OK   - Success
+ *      RT_ERR_SMI  - SMI access error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicLutAgeTimerSpeed(uint32_t *pTimer, uint32_t *pSpeed)
+{
+    int32_t retVal;
+    uint32_t regData;
+
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_LUT_CFG_REG, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    *pTimer = (regData & RTL8367C_AGE_TIMER_MASK) >> RTL8367C_AGE_TIMER_OFFSET;
+    *pSpeed = (regData & RTL8367C_AGE_SPEED_MASK) >> RTL8367C_AGE_SPEED_OFFSET;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicLutDisableAging
+ * Description:
+ *      Set L2 LUT aging per port setting
+ * Input:
+ *      port    - Physical port number (0~10)
+ *      disabled    - 0: enable aging; 1: disabling aging
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicLutDisableAging(uint32_t port, uint32_t disabled)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_LUT_AGEOUT_CTRL_REG, port, disabled);
+}
+/* Function Name:
+ *      rtl8367c_getAsicLutDisableAging
+ * Description:
+ *      Get L2 LUT aging per port setting
+ * Input:
+ *      port    - Physical port number (0~10)
+ * Output:
+ *      pDisabled   - 0: enable aging; 1: disabling aging
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicLutDisableAging(uint32_t port, uint32_t *pDisabled)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_getAsicRegBit(RTL8367C_LUT_AGEOUT_CTRL_REG, port, pDisabled);
+}
+
+/* aging times the chip supports: seconds, speed, timer */
+static const uint16_t _rtk_l2_agingTime[][3] = {
+    {45, 0, 1}, {88, 0, 2}, {133, 0, 3}, {177, 0, 4}, {221, 0, 5}, {266, 0, 6}, {310, 0, 7}, {458, 1, 2}, {916, 1, 4}, {RTK_L2_AGING_TIME_MAX, 1, 6}};
+
+/* Function Name:
+ *      rtk_l2_aging_set
+ * Description:
+ *      Set LUT aging out time
+ * Input:
+ *      aging_time  - Aging out time in seconds.
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input out of range.
+ * Note:
+ *      The chip has 10 aging times between 45 and 1374 seconds, the
+ *      shortest one that is at least aging_time is used. A short time
+ *      returns the entries of a MAC flood to the free pool sooner.
+ */
+int32_t rtl8367::rtk_l2_aging_set(uint32_t aging_time)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t i;
+
+    if (aging_time > RTK_L2_AGING_TIME_MAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    for (i = 0; i < sizeof(_rtk_l2_agingTime) / sizeof(_rtk_l2_agingTime[0]); i++)
+    {
+        if (aging_time <= _rtk_l2_agingTime[i][0])
+            break;
+    }
+
+    if ((retVal = rtl8367c_setAsicLutAgeTimerSpeed(_rtk_l2_agingTime[i][2], _rtk_l2_agingTime[i][1])) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_aging_get
+ * Description:
+ *      Get LUT aging out time
+ * Input:
+ *      None
+ * Output:
+ *      pAging_time - Aging out time in seconds.
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      RT_ERR_FAILED when the chip holds a timer and speed pair that
+ *      rtk_l2_aging_set does not write.
+ */
+int32_t rtl8367::rtk_l2_aging_get(uint32_t *pAging_time)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t i, timer, speed;
+
+    if (NULL == pAging_time)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicLutAgeTimerSpeed(&timer, &speed)) != RT_ERR_OK)
+        return retVal;
+
+    for (i = 0; i < sizeof(_rtk_l2_agingTime) / sizeof(_rtk_l2_agingTime[0]); i++)
+    {
+        if ((_rtk_l2_agingTime[i][1] == speed) && (_rtk_l2_agingTime[i][2] == timer))
+        {
+            *pAging_time = _rtk_l2_agingTime[i][0];
+            return RT_ERR_OK;
+        }
+    }
+
+    return RT_ERR_FAILED;
+}
+
+/* Function Name:
+ *      rtk_l2_agingEnable_set
+ * Description:
+ *      Set L2 LUT aging status per port setting.
+ * Input:
+ *      port    - Port id.
+ *      enable  - Aging status
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - OK
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number.
+ *      RT_ERR_ENABLE   - Invalid enable input.
+ * Note:
+ *      Entries learned on a port with aging disabled stay until they are
+ *      flushed or the port learns them elsewhere.
+ */
+int32_t rtl8367::rtk_l2_agingEnable_set(rtk_port_t port, rtk_enable_t enable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    /* check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
+
+    if ((retVal = rtl8367c_setAsicLutDisableAging(rtk_switch_port_L2P_get(port), (enable == ENABLED) ? 0 : 1)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_agingEnable_get
+ * Description:
+ *      Get L2 LUT aging status per port setting.
+ * Input:
+ *      port    - Port id.
+ * Output:
+ *      pEnable - Aging status
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number.
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_l2_agingEnable_get(rtk_port_t port, rtk_enable_t *pEnable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t disabled;
+
+    /* check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (NULL == pEnable)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicLutDisableAging(rtk_switch_port_L2P_get(port), &disabled)) != RT_ERR_OK)
+        return retVal;
+
+    *pEnable = disabled ? (rtk_enable_t)DISABLED : ENABLED;
+
+    return RT_ERR_OK;
+}
+
+#ifdef RTL8367_L2_LEARN_RATE
+/* Function Name:
+ *      rtk_l2_learnRate_sample
+ * Description:
+ *      Sample the learned entry counters of ports and flag MAC floods
+ * Input:
+ *      pPortmask   - ports to sample
+ *      threshold   - new entries per second that count as a flood, 0 for none
+ * Output:
+ *      pFlood      - ports learning at threshold or faster
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_MASK        - Invalid portmask.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      One read per port. The first sample of a port only takes the
+ *      reference. The rate is the net growth of the counter, entries aged
+ *      out or flushed in between hide as many new ones, and a port stuck at
+ *      its learn limit grows no more: pair the monitor with
+ *      rtk_l2_limitLearningCnt_set. A port sampled twice within the same
+ *      millisecond keeps its previous result.
+ */
+int32_t rtl8367::rtk_l2_learnRate_sample(rtk_portmask_t *pPortmask, uint32_t threshold, rtk_portmask_t *pFlood)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t port, phyPort, count, now, ms;
+    rtk_l2_learn_rate_t *pRate;
+
+    if ((NULL == pPortmask) || (NULL == pFlood))
+        return RT_ERR_NULL_POINTER;
+
+    RTK_CHK_PORTMASK_VALID(pPortmask);
+
+    RTK_PORTMASK_CLEAR(*pFlood);
+    RTK_PORTMASK_SCAN((*pPortmask), port)
+    {
+        phyPort = rtk_switch_port_L2P_get(port);
+        if ((retVal = rtl8367c_getAsicLutLearnNo(phyPort, &count)) != RT_ERR_OK)
+            return retVal;
+
+        now = millis();
+        pRate = &learnRate[phyPort];
+        ms = 1;
+        if (learnRateValid & (1 << phyPort))
+        {
+            ms = now - learnRateMs[phyPort];
+            if (ms != 0)
+            {
+                pRate->ms = ms;
+                pRate->perSec = (count > pRate->count) ? (count - pRate->count) * 1000 / ms : 0;
+                if (pRate->perSec > pRate->perSecMax)
+                    pRate->perSecMax = pRate->perSec;
+            }
+        }
+
+        /* within the same millisecond keep the reference and the previous rate */
+        if (ms != 0)
+        {
+            pRate->count = count;
+            learnRateMs[phyPort] = now;
+            learnRateValid |= (1 << phyPort);
+        }
+
+        if (threshold && (pRate->perSec >= threshold))
+            RTK_PORTMASK_PORT_SET(*pFlood, port);
+    }
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_learnRate_get
+ * Description:
+ *      Get the learning rate of a port at its last sample
+ * Input:
+ *      port    - port id.
+ * Output:
+ *      pRate   - result of the last rtk_l2_learnRate_sample of the port
+ * Return:
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_PORT_ID          - Invalid port number.
+ *      RT_ERR_NULL_POINTER     - Input parameter may be null pointer
+ * Note:
+ *      No SMI access.
+ */
+int32_t rtl8367::rtk_l2_learnRate_get(rtk_port_t port, rtk_l2_learn_rate_t *pRate)
+{
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (NULL == pRate)
+        return RT_ERR_NULL_POINTER;
+
+    *pRate = learnRate[rtk_switch_port_L2P_get(port)];
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_l2_learnRate_clear
+ * Description:
+ *      Forget the learning rate samples of all ports
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      None
+ * Note:
+ *      The next rtk_l2_learnRate_sample of every port takes a new
+ *      reference. reset() calls it, the reset empties the LUT.
+ */
+void rtl8367::rtk_l2_learnRate_clear()
+{
+    memset(learnRate, 0, sizeof(learnRate));
+    learnRateValid = 0;
+}
+#endif
+
+// -------------------------------- ACL ---------------------------------------
+
+/* Function Name:
+ *      rtl8367c_setAsicAclActCtrl
+ * Description:
+ *      Set ACL rule matched Action Control Bits
+ * Input:
+ *      index       - ACL rule index (0-95) of 96 ACL rules
+ *      aclActCtrl  - 6 ACL Control Bits
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
+ * Note:
+ *      ACL Action Control Bits Indicate which actions will be take when a rule matches
+ */
+int32_t rtl8367::rtl8367c_setAsicAclActCtrl(uint32_t index, uint32_t aclActCtrl)
+{
+    int32_t retVal;
+
+    if (index > RTL8367C_ACLRULEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (index >= 64)
+        retVal = rtl8367c_setAsicRegBits(RTL8367C_ACL_ACTION_CTRL2_REG(index), RTL8367C_ACL_OP_ACTION_MASK(index), aclActCtrl);
+    else
+        retVal = rtl8367c_setAsicRegBits(RTL8367C_ACL_ACTION_CTRL_REG(index), RTL8367C_ACL_OP_ACTION_MASK(index), aclActCtrl);
+
+    return retVal;
+}
+/* Function Name:
+ *      rtl8367c_setAsicAclNot
+ * Description:
+ *      Set rule comparison result inversion / no inversion
+ * Input:
+ *      index   - ACL rule index (0-95) of 96 ACL rules
+ *      not     - 1: inverse, 0: don't inverse
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicAclNot(uint32_t index, uint32_t nott)
+{
+    if (index > RTL8367C_ACLRULEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (index < 64)
+        return rtl8367c_setAsicRegBit(RTL8367C_ACL_ACTION_CTRL_REG(index), RTL8367C_ACL_OP_NOT_OFFSET(index), nott);
+    else
+        return rtl8367c_setAsicRegBit(RTL8367C_ACL_ACTION_CTRL2_REG(index), RTL8367C_ACL_OP_NOT_OFFSET(index), nott);
+}
+int32_t rtl8367::_rtk_filter_igrAcl_cfg_delAll()
+{
+    uint32_t i;
+    int32_t ret;
+
+    for (i = 0; i < RTL8367C_ACLRULENO; i++)
+    {
+        if ((ret = rtl8367c_setAsicAclActCtrl(i, FILTER_ENACT_INIT_MASK)) != RT_ERR_OK)
+            return ret;
+        if ((ret = rtl8367c_setAsicAclNot(i, DISABLED)) != RT_ERR_OK)
+            return ret;
+    }
+
+    return rtl8367c_setAsicRegBit(RTL8367C_REG_ACL_RESET_CFG, RTL8367C_ACL_RESET_CFG_OFFSET, 1);
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicAclTemplate
+ * Description:
+ *      Set fields of a ACL Template
+ * Input:
+ *      index   - ACL template index(0~4)
+ *      pAclType - ACL type stucture for setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL template index(0~4)
+ * Note:
+ *      The API can set type field of the 5 ACL rule templates.
+ *      Each type has 8 fields. One field means what data in one field of a ACL rule means
+ *      8 fields of ACL rule 0~95 is descripted by one type in ACL group
+ */
+int32_t rtl8367::rtl8367c_setAsicAclTemplate(uint32_t index, rtl8367c_acltemplate_t *pAclType)
+{
+    int32_t retVal;
+    uint32_t i;
+    uint32_t regAddr, regData;
+
+    if (index >= RTL8367C_ACLTEMPLATENO)
+        return RT_ERR_OUT_OF_RANGE;
+
+    regAddr = RTL8367C_ACL_RULE_TEMPLATE_CTRL_REG(index);
+
+    for (i = 0; i < (RTL8367C_ACLRULEFIELDNO / 2); i++)
+    {
+        regData = pAclType->field[i * 2 + 1];
+        regData = regData << 8 | pAclType->field[i * 2];
+
+        retVal = rtl8367c_setAsicReg(regAddr + i, regData);
+
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+
+    return retVal;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicFieldSelector
+ * Description:
+ *      Set user defined field selectors in HSB
+ * Input:
+ *      index       - index of field selector 0-15
+ *      format      - Format of field selector
+ *      offset      - Retrieving data offset
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ * Note:
+ *      System support 16 user defined field selctors.
+ *      Each selector can be enabled or disable. User can defined retrieving 16-bits in many predefiend
+ *      standard l2/l3/l4 payload.
+ */
+int32_t rtl8367::rtl8367c_setAsicFieldSelector(uint32_t index, uint32_t format, uint32_t offset)
+{
+    uint32_t regData;
+
+    if (index > RTL8367C_FIELDSEL_FORMAT_NUMBER)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (format >= FIELDSEL_FORMAT_END)
+        return RT_ERR_OUT_OF_RANGE;
+
+    regData = (((format << RTL8367C_FIELD_SELECTOR_FORMAT_OFFSET) & RTL8367C_FIELD_SELECTOR_FORMAT_MASK) |
+               ((offset << RTL8367C_FIELD_SELECTOR_OFFSET_OFFSET) & RTL8367C_FIELD_SELECTOR_OFFSET_MASK));
+
+    return rtl8367c_setAsicReg(RTL8367C_FIELD_SELECTOR_REG(index), regData);
+}
+/* Function Name:
+ *      rtl8367c_setAsicAcl
+ * Description:
+ *      Set port acl function enable/disable
+ * Input:
+ *      port    - Physical port number (0~10)
+ *      enabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicAcl(uint32_t port, uint32_t enabled)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_ACL_ENABLE_REG, port, enabled);
+}
+/* Function Name:
+ *      rtl8367c_setAsicAclUnmatchedPermit
+ * Description:
+ *      Set port acl function unmatched permit action
+ * Input:
+ *      port    - Physical port number (0~10)
+ *      enabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicAclUnmatchedPermit(uint32_t port, uint32_t enabled)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_ACL_UNMATCH_PERMIT_REG, port, enabled);
+}
+int32_t rtl8367::rtk_filter_igrAcl_init()
+{
+    RTK_SMI_STATS_SCOPE();
+    rtl8367c_acltemplate_t aclTemp;
+    uint32_t i, j;
+    int32_t ret;
+
+    if ((ret = _rtk_filter_igrAcl_cfg_delAll()) != RT_ERR_OK)
+        return ret;
+
+    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
+    {
+        for (j = 0; j < RTL8367C_ACLRULEFIELDNO; j++)
+            aclTemp.field[j] = filter_templateField[i][j];
+
+        if ((ret = rtl8367c_setAsicAclTemplate(i, &aclTemp)) != RT_ERR_OK)
+            return ret;
+    }
+
+    for (i = 0; i < RTL8367C_FIELDSEL_FORMAT_NUMBER; i++)
+    {
+        if ((ret = rtl8367c_setAsicFieldSelector(i, field_selector[i][0], field_selector[i][1])) != RT_ERR_OK)
+            return ret;
+    }
+
+    RTK_SCAN_ALL_PHY_PORTMASK(i)
+    {
+        if ((ret = rtl8367c_setAsicAcl(i, 1)) != RT_ERR_OK)
+            return ret;
+
+        if ((ret = rtl8367c_setAsicAclUnmatchedPermit(i, 1)) != RT_ERR_OK)
+            return ret;
+    }
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicAclTemplate
+ * Description:
+ *      Get fields of a ACL Template
+ * Input:
+ *      index   - ACL template index(0~4)
+ *      pAclType - ACL type stucture for setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL template index(0~4)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicAclTemplate(uint32_t index, rtl8367c_acltemplate_t *pAclType)
+{
+    int32_t retVal;
+    uint32_t i;
+    uint32_t regData, regAddr;
+
+    if (index >= RTL8367C_ACLTEMPLATENO)
+        return RT_ERR_OUT_OF_RANGE;
+
+    regAddr = RTL8367C_ACL_RULE_TEMPLATE_CTRL_REG(index);
+
+    for (i = 0; i < (RTL8367C_ACLRULEFIELDNO / 2); i++)
+    {
+        retVal = rtl8367c_getAsicReg(regAddr + i, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        pAclType->field[i * 2] = regData & 0xFF;
+        pAclType->field[i * 2 + 1] = (regData >> 8) & 0xFF;
+    }
+
+    return RT_ERR_OK;
+}
+int32_t rtl8367::rtk_filter_igrAcl_template_set(rtk_filter_template_t *aclTemplate)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t idxField;
+    rtl8367c_acltemplate_t aclType;
+
+    if (aclTemplate->index >= RTK_MAX_NUM_OF_FILTER_TYPE)
+        return RT_ERR_INPUT;
+
+    for (idxField = 0; idxField < RTK_MAX_NUM_OF_FILTER_FIELD; idxField++)
+    {
+        if (aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_DMAC_15_0 ||
+            (aclTemplate->fieldType[idxField] > FILTER_FIELD_RAW_CTAG && aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_IPV4_SIP_15_0) ||
+            (aclTemplate->fieldType[idxField] > FILTER_FIELD_RAW_IPV4_DIP_31_16 && aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_IPV6_SIP_15_0) ||
+            (aclTemplate->fieldType[idxField] > FILTER_FIELD_RAW_IPV6_DIP_31_16 && aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_VIDRANGE) ||
+            (aclTemplate->fieldType[idxField] > FILTER_FIELD_RAW_FIELD_VALID && aclTemplate->fieldType[idxField] < FILTER_FIELD_RAW_FIELD_SELECT00) ||
+            aclTemplate->fieldType[idxField] >= FILTER_FIELD_RAW_END)
+        {
+            return RT_ERR_INPUT;
+        }
+    }
+
+    for (idxField = 0; idxField < RTK_MAX_NUM_OF_FILTER_FIELD; idxField++)
+    {
+        aclType.field[idxField] = aclTemplate->fieldType[idxField];
+    }
+
+    if ((retVal = rtl8367c_setAsicAclTemplate(aclTemplate->index, &aclType)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_igrAcl_template_get(rtk_filter_template_t *aclTemplate)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t ret;
+    uint32_t idxField;
+    rtl8367c_acltemplate_t aclType;
+
+    if (NULL == aclTemplate)
+        return RT_ERR_NULL_POINTER;
+
+    if (aclTemplate->index >= RTK_MAX_NUM_OF_FILTER_TYPE)
+        return RT_ERR_INPUT;
+
+    if ((ret = rtl8367c_getAsicAclTemplate(aclTemplate->index, &aclType)) != RT_ERR_OK)
+        return ret;
+
+    for (idxField = 0; idxField < RTK_MAX_NUM_OF_FILTER_FIELD; idxField++)
+    {
+        aclTemplate->fieldType[idxField] = (rtk_filter_field_type_raw_t)aclType.field[idxField];
+    }
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_igrAcl_field_add(rtk_filter_cfg_t *pFilter_cfg, rtk_filter_field_t *pFilter_field)
+{
+    RTK_SMI_STATS_SCOPE();
+    uint32_t i;
+    rtk_filter_field_t *tailPtr;
+
+    if (NULL == pFilter_cfg || NULL == pFilter_field)
+        return RT_ERR_NULL_POINTER;
+
+    if (pFilter_field->fieldType >= FILTER_FIELD_END)
+        return RT_ERR_ENTRY_INDEX;
+
+    if (0 == pFilter_field->fieldTemplateNo)
+    {
+        pFilter_field->fieldTemplateNo = filter_fieldSize[pFilter_field->fieldType];
+
+        for (i = 0; i < pFilter_field->fieldTemplateNo; i++)
+        {
+            pFilter_field->fieldTemplateIdx[i] = filter_fieldTemplateIndex[pFilter_field->fieldType][i];
+        }
+    }
+
+    if (NULL == pFilter_cfg->fieldHead)
+    {
+        pFilter_cfg->fieldHead = pFilter_field;
+    }
+    else
+    {
+        if (pFilter_cfg->fieldHead->next == NULL)
+        {
+            pFilter_cfg->fieldHead->next = pFilter_field;
+        }
+        else
+        {
+            tailPtr = pFilter_cfg->fieldHead->next;
+            while (tailPtr->next != NULL)
+            {
+                tailPtr = tailPtr->next;
+            }
+            tailPtr->next = pFilter_field;
+        }
+    }
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::_rtk_filter_igrAcl_writeDataField(rtl8367c_aclrule *aclRule, rtk_filter_field_t *fieldPtr)
+{
+    uint32_t i, tempIdx, fieldIdx, ipValue, ipMask;
+    uint32_t ip6addr[RTK_IPV6_ADDR_WORD_LENGTH];
+    uint32_t ip6mask[RTK_IPV6_ADDR_WORD_LENGTH];
+
+    for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+    {
+        tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+
+        aclRule[tempIdx].valid = 1;
+    }
+
+    switch (fieldPtr->fieldType)
+    {
+    /* use DMAC structure as representative for mac structure */
+    case FILTER_FIELD_DMAC:
+    case FILTER_FIELD_SMAC:
+
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.mac.value.octet[5 - i * 2] | (fieldPtr->filter_pattern_union.mac.value.octet[5 - (i * 2 + 1)] << 8);
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.mac.mask.octet[5 - i * 2] | (fieldPtr->filter_pattern_union.mac.mask.octet[5 - (i * 2 + 1)] << 8);
+        }
+        break;
+    case FILTER_FIELD_ETHERTYPE:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.etherType.value;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.etherType.mask;
+        }
+        break;
+    case FILTER_FIELD_IPV4_SIP:
+    case FILTER_FIELD_IPV4_DIP:
+
+        ipValue = fieldPtr->filter_pattern_union.sip.value;
+        ipMask = fieldPtr->filter_pattern_union.sip.mask;
+
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = (0xFFFF & (ipValue >> (i * 16)));
+            aclRule[tempIdx].care_bits.field[fieldIdx] = (0xFFFF & (ipMask >> (i * 16)));
+        }
+        break;
+    case FILTER_FIELD_IPV4_TOS:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.ipTos.value & 0xFF;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.ipTos.mask & 0xFF;
+        }
+        break;
+    case FILTER_FIELD_IPV4_PROTOCOL:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.protocol.value & 0xFF;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.protocol.mask & 0xFF;
+        }
+        break;
+    case FILTER_FIELD_IPV6_SIPV6:
+    case FILTER_FIELD_IPV6_DIPV6:
+        for (i = 0; i < RTK_IPV6_ADDR_WORD_LENGTH; i++)
+        {
+            ip6addr[i] = fieldPtr->filter_pattern_union.sipv6.value.addr[i];
+            ip6mask[i] = fieldPtr->filter_pattern_union.sipv6.mask.addr[i];
+        }
+
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            if (i < 2)
+            {
+                aclRule[tempIdx].data_bits.field[fieldIdx] = ((ip6addr[0] & (0xFFFF << (i * 16))) >> (i * 16));
+                aclRule[tempIdx].care_bits.field[fieldIdx] = ((ip6mask[0] & (0xFFFF << (i * 16))) >> (i * 16));
+            }
+            else
+            {
+                /*default acl template for ipv6 address supports MSB 32-bits and LSB 32-bits only*/
+                aclRule[tempIdx].data_bits.field[fieldIdx] = ((ip6addr[3] & (0xFFFF << ((i & 1) * 16))) >> ((i & 1) * 16));
+                aclRule[tempIdx].care_bits.field[fieldIdx] = ((ip6mask[3] & (0xFFFF << ((i & 1) * 16))) >> ((i & 1) * 16));
+            }
+        }
+
+        break;
+    case FILTER_FIELD_CTAG:
+    case FILTER_FIELD_STAG:
+
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.l2tag.pri.value << 13) | (fieldPtr->filter_pattern_union.l2tag.cfi.value << 12) | fieldPtr->filter_pattern_union.l2tag.vid.value;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.l2tag.pri.mask << 13) | (fieldPtr->filter_pattern_union.l2tag.cfi.mask << 12) | fieldPtr->filter_pattern_union.l2tag.vid.mask;
+        }
+        break;
+    case FILTER_FIELD_IPV4_FLAG:
+
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] &= 0x1FFF;
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.xf.value << 15);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.df.value << 14);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.mf.value << 13);
+
+            aclRule[tempIdx].care_bits.field[fieldIdx] &= 0x1FFF;
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.xf.mask << 15);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.df.mask << 14);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.ipFlag.mf.mask << 13);
+        }
+
+        break;
+    case FILTER_FIELD_IPV4_OFFSET:
+
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] &= 0xE000;
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.inData.value;
+
+            aclRule[tempIdx].care_bits.field[fieldIdx] &= 0xE000;
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.inData.mask;
+        }
+
+        break;
+
+    case FILTER_FIELD_IPV6_TRAFFIC_CLASS:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.inData.value << 4) & 0x0FF0;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.inData.mask << 4) & 0x0FF0;
+        }
+        break;
+    case FILTER_FIELD_IPV6_NEXT_HEADER:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.inData.value << 8;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.inData.mask << 8;
+        }
+        break;
+    case FILTER_FIELD_TCP_SPORT:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.tcpSrcPort.value;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.tcpSrcPort.mask;
+        }
+        break;
+    case FILTER_FIELD_TCP_DPORT:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.tcpDstPort.value;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.tcpDstPort.mask;
+        }
+        break;
+    case FILTER_FIELD_TCP_FLAG:
+
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.cwr.value << 7);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.ece.value << 6);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.urg.value << 5);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.ack.value << 4);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.psh.value << 3);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.rst.value << 2);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.syn.value << 1);
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.tcpFlag.fin.value;
+
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.cwr.mask << 7);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.ece.mask << 6);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.urg.mask << 5);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.ack.mask << 4);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.psh.mask << 3);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.rst.mask << 2);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.tcpFlag.syn.mask << 1);
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.tcpFlag.fin.mask;
+        }
+        break;
+    case FILTER_FIELD_UDP_SPORT:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.udpSrcPort.value;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.udpSrcPort.mask;
+        }
+        break;
+    case FILTER_FIELD_UDP_DPORT:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.udpDstPort.value;
+            aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.udpDstPort.mask;
+        }
+        break;
+    case FILTER_FIELD_ICMP_CODE:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] &= 0xFF00;
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.icmpCode.value;
+            aclRule[tempIdx].care_bits.field[fieldIdx] &= 0xFF00;
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= fieldPtr->filter_pattern_union.icmpCode.mask;
+        }
+        break;
+    case FILTER_FIELD_ICMP_TYPE:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] &= 0x00FF;
+            aclRule[tempIdx].data_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.icmpType.value << 8);
+            aclRule[tempIdx].care_bits.field[fieldIdx] &= 0x00FF;
+            aclRule[tempIdx].care_bits.field[fieldIdx] |= (fieldPtr->filter_pattern_union.icmpType.mask << 8);
+        }
+        break;
+    case FILTER_FIELD_IGMP_TYPE:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.igmpType.value << 8);
+            aclRule[tempIdx].care_bits.field[fieldIdx] = (fieldPtr->filter_pattern_union.igmpType.mask << 8);
+        }
+        break;
+    case FILTER_FIELD_PATTERN_MATCH:
+        for (i = 0; i < fieldPtr->fieldTemplateNo; i++)
+        {
+            tempIdx = (fieldPtr->fieldTemplateIdx[i] & 0xF0) >> 4;
+            fieldIdx = fieldPtr->fieldTemplateIdx[i] & 0x0F;
+
+            aclRule[tempIdx].data_bits.field[fieldIdx] = ((fieldPtr->filter_pattern_union.pattern.value[i / 2] >> (16 * (i % 2))) & 0x0000FFFF);
+            aclRule[tempIdx].care_bits.field[fieldIdx] = ((fieldPtr->filter_pattern_union.pattern.mask[i / 2] >> (16 * (i % 2))) & 0x0000FFFF);
+        }
+        break;
+    case FILTER_FIELD_VID_RANGE:
+    case FILTER_FIELD_IP_RANGE:
+    case FILTER_FIELD_PORT_RANGE:
+    default:
+        tempIdx = (fieldPtr->fieldTemplateIdx[0] & 0xF0) >> 4;
+        fieldIdx = fieldPtr->fieldTemplateIdx[0] & 0x0F;
+
+        aclRule[tempIdx].data_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.inData.value;
+        aclRule[tempIdx].care_bits.field[fieldIdx] = fieldPtr->filter_pattern_union.inData.mask;
+        break;
+    }
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtk_svlan_checkAndCreateMbr
+ * Description:
+ *      Check and create Member configuration and return index
+ * Input:
+ *      vid  - VLAN id.
+ * Output:
+ *      pIndex  - Member configuration index
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_VLAN_VID     - Invalid VLAN ID.
+ *      RT_ERR_TBL_FULL     - Member Configuration table full
+ * Note:
+ *
+ */
+int32_t rtl8367::rtk_svlan_checkAndCreateMbr(uint32_t vid, uint32_t *pIndex)
+{
+    int32_t retVal;
+    uint32_t svidx;
+    uint32_t empty_idx = 0xFFFF;
+    rtl8367c_svlan_memconf_t svlan_cfg;
+
+    /* vid must be 0~4095 */
+    if (vid > RTL8367C_VIDMAX)
+        return RT_ERR_VLAN_VID;
+
+    /* Null pointer check */
+    if (NULL == pIndex)
+        return RT_ERR_NULL_POINTER;
+
+    /* Search exist entry */
+    for (svidx = 0; svidx <= RTL8367C_SVIDXMAX; svidx++)
+    {
+        if (svlan_mbrCfgUsage[svidx] == 1)
+        {
+            if (svlan_mbrCfgVid[svidx] == vid)
+            {
+                /* Found! return index */
+                *pIndex = svidx;
+                return RT_ERR_OK;
+            }
+        }
+        else if (empty_idx == 0xFFFF)
+        {
+            empty_idx = svidx;
+        }
+    }
+
+    if (empty_idx == 0xFFFF)
+    {
+        /* No empty index */
+        return RT_ERR_TBL_FULL;
+    }
+
+    svlan_mbrCfgUsage[empty_idx] = 1;
+    svlan_mbrCfgVid[empty_idx] = vid;
+
+    memset(&svlan_cfg, 0, sizeof(rtl8367c_svlan_memconf_t));
+
+    svlan_cfg.vs_svid = vid;
+    /*for create check*/
+    if (vid == 0)
+    {
+        svlan_cfg.vs_efid = 1;
+    }
+
+    if ((retVal = rtl8367c_setAsicSvlanMemberConfiguration(empty_idx, &svlan_cfg)) != RT_ERR_OK)
+        return retVal;
+
+    *pIndex = empty_idx;
+    return RT_ERR_OK;
+}
+
+void rtl8367::_rtl8367c_aclRuleStSmi2User(rtl8367c_aclrule *pAclUser, rtl8367c_aclrulesmi *pAclSmi)
+{
+    uint8_t *care_ptr, *data_ptr;
+    uint8_t care_tmp, data_tmp;
+    uint32_t i;
+
+    pAclUser->data_bits.active_portmsk = (((pAclSmi->data_bits_ext.rule_info >> 1) & 0x0007) << 8) | ((pAclSmi->data_bits.rule_info >> 8) & 0x00FF);
+    pAclUser->data_bits.type = (pAclSmi->data_bits.rule_info & 0x0007);
+    pAclUser->data_bits.tag_exist = (pAclSmi->data_bits.rule_info & 0x00F8) >> 3;
+
+    care_ptr = (uint8_t *)&pAclSmi->care_bits;
+    data_ptr = (uint8_t *)&pAclSmi->data_bits;
+
+    for (i = 0; i < sizeof(struct acl_rule_smi_st); i++)
+    {
+        care_tmp = *(care_ptr + i) ^ (*(data_ptr + i));
+        data_tmp = *(data_ptr + i);
+
+        *(care_ptr + i) = care_tmp;
+        *(data_ptr + i) = data_tmp;
+    }
+
+    care_ptr = (uint8_t *)&pAclSmi->care_bits_ext;
+    data_ptr = (uint8_t *)&pAclSmi->data_bits_ext;
+    care_tmp = (*care_ptr) ^ (*data_ptr);
+    data_tmp = (*data_ptr);
+    *care_ptr = care_tmp;
+    *data_ptr = data_tmp;
+
+    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
+        pAclUser->data_bits.field[i] = pAclSmi->data_bits.field[i];
+
+    pAclUser->valid = pAclSmi->valid;
+
+    pAclUser->care_bits.active_portmsk = (((pAclSmi->care_bits_ext.rule_info >> 1) & 0x0007) << 8) | ((pAclSmi->care_bits.rule_info >> 8) & 0x00FF);
+    pAclUser->care_bits.type = (pAclSmi->care_bits.rule_info & 0x0007);
+    pAclUser->care_bits.tag_exist = (pAclSmi->care_bits.rule_info & 0x00F8) >> 3;
+
+    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
+        pAclUser->care_bits.field[i] = pAclSmi->care_bits.field[i];
+}
+/* Function Name:
+ *      rtl8367c_getAsicAclRule
+ * Description:
+ *      Get acl rule content
+ * Input:
+ *      index   - ACL rule index (0-63) of 64 ACL rules
+ *      pAclRule - ACL rule stucture for setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-63)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicAclRule(uint32_t index, rtl8367c_aclrule *pAclRule)
+{
+    rtl8367c_aclrulesmi aclRuleSmi;
+    uint32_t regAddr, regData;
+    int32_t retVal;
+    uint16_t *tableAddr;
+    uint32_t i;
+
+    if (index > RTL8367C_ACLRULEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    memset(&aclRuleSmi, 0x00, sizeof(rtl8367c_aclrulesmi));
+
+    /* Write ACS_ADR register for data bits */
+    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
+    if (index >= 64)
+        regData = RTL8367C_ACLRULETBADDR2(DATABITS, index);
+    else
+        regData = RTL8367C_ACLRULETBADDR(DATABITS, index);
+
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write ACS_CMD register */
+    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
+    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_READ, TB_TARGET_ACLRULE);
+    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Read Data Bits */
+    regAddr = RTL8367C_TABLE_ACCESS_RDDATA_BASE;
+    tableAddr = (uint16_t *)&aclRuleSmi.data_bits;
+    for (i = 0; i < RTL8367C_ACLRULETBLEN; i++)
+    {
+        retVal = rtl8367c_getAsicReg(regAddr, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        *tableAddr = regData;
+
+        regAddr++;
+        tableAddr++;
+    }
+
+    /* Read Valid Bit */
+    retVal = rtl8367c_getAsicRegBit(RTL8367C_TABLE_ACCESS_RDDATA_REG(RTL8367C_ACLRULETBLEN), 0, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+    aclRuleSmi.valid = regData & 0x1;
+    /* Read active_portmsk_ext Bits */
+    retVal = rtl8367c_getAsicRegBits(RTL8367C_TABLE_ACCESS_RDDATA_REG(RTL8367C_ACLRULETBLEN), 0x7 << 1, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+    aclRuleSmi.data_bits_ext.rule_info = (regData % 0x0007) << 1;
+
+    /* Write ACS_ADR register for carebits*/
+    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
+    if (index >= 64)
+        regData = RTL8367C_ACLRULETBADDR2(CAREBITS, index);
+    else
+        regData = RTL8367C_ACLRULETBADDR(CAREBITS, index);
+
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write ACS_CMD register */
+    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
+    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_READ, TB_TARGET_ACLRULE);
+    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Read Care Bits */
+    regAddr = RTL8367C_TABLE_ACCESS_RDDATA_BASE;
+    tableAddr = (uint16_t *)&aclRuleSmi.care_bits;
+    for (i = 0; i < RTL8367C_ACLRULETBLEN; i++)
+    {
+        retVal = rtl8367c_getAsicReg(regAddr, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        *tableAddr = regData;
+
+        regAddr++;
+        tableAddr++;
+    }
+    /* Read active_portmsk_ext care Bits */
+    retVal = rtl8367c_getAsicRegBits(RTL8367C_TABLE_ACCESS_RDDATA_REG(RTL8367C_ACLRULETBLEN), 0x7 << 1, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+    aclRuleSmi.care_bits_ext.rule_info = (regData & 0x0007) << 1;
+
+    _rtl8367c_aclRuleStSmi2User(pAclRule, &aclRuleSmi);
+
+    return RT_ERR_OK;
+}
+
+void rtl8367::_rtl8367c_aclActStUser2Smi(rtl8367c_acl_act_t *pAclUser, uint16_t *pAclSmi)
+{
+    pAclSmi[0] |= (pAclUser->cvidx_cact & 0x003F);
+    pAclSmi[0] |= (pAclUser->cact & 0x0003) << 6;
+    pAclSmi[0] |= (pAclUser->svidx_sact & 0x003F) << 8;
+    pAclSmi[0] |= (pAclUser->sact & 0x0003) << 14;
+
+    pAclSmi[1] |= (pAclUser->aclmeteridx & 0x003F);
+    pAclSmi[1] |= (pAclUser->fwdpmask & 0x00FF) << 6;
+    pAclSmi[1] |= (pAclUser->fwdact & 0x0003) << 14;
+
+    pAclSmi[2] |= (pAclUser->pridx & 0x003F);
+    pAclSmi[2] |= (pAclUser->priact & 0x0003) << 6;
+    pAclSmi[2] |= (pAclUser->gpio_pin & 0x000F) << 8;
+    pAclSmi[2] |= (pAclUser->gpio_en & 0x0001) << 12;
+    pAclSmi[2] |= (pAclUser->aclint & 0x0001) << 13;
+    pAclSmi[2] |= (pAclUser->cact_ext & 0x0003) << 14;
+
+    pAclSmi[3] |= (pAclUser->tag_fmt & 0x0003);
+    pAclSmi[3] |= (pAclUser->fwdact_ext & 0x0001) << 2;
+    pAclSmi[3] |= ((pAclUser->cvidx_cact & 0x0040) >> 6) << 3;
+    pAclSmi[3] |= ((pAclUser->svidx_sact & 0x0040) >> 6) << 4;
+    pAclSmi[3] |= ((pAclUser->aclmeteridx & 0x0040) >> 6) << 5;
+    pAclSmi[3] |= ((pAclUser->fwdpmask & 0x0700) >> 8) << 6;
+    pAclSmi[3] |= ((pAclUser->pridx & 0x0040) >> 6) << 9;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicAclAct
+ * Description:
+ *      Set ACL rule matched Action
+ * Input:
+ *      index   - ACL rule index (0-95) of 96 ACL rules
+ *      pAclAct     - ACL action stucture for setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicAclAct(uint32_t index, rtl8367c_acl_act_t *pAclAct)
+{
+    uint16_t aclActSmi[RTL8367C_ACL_ACT_TABLE_LEN];
+    int32_t retVal;
+    uint32_t regAddr, regData;
+    uint16_t *tableAddr;
+    uint32_t i;
+
+    if (index > RTL8367C_ACLRULEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    memset(aclActSmi, 0x00, sizeof(uint16_t) * RTL8367C_ACL_ACT_TABLE_LEN);
+    _rtl8367c_aclActStUser2Smi(pAclAct, aclActSmi);
+
+    /* Write ACS_ADR register for data bits */
+    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
+    regData = index;
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write Data Bits to ACS_DATA registers */
+    tableAddr = aclActSmi;
+    regAddr = RTL8367C_TABLE_ACCESS_WRDATA_BASE;
+
+    for (i = 0; i < RTL8367C_ACLACTTBLEN; i++)
+    {
+        regData = *tableAddr;
+        retVal = rtl8367c_setAsicReg(regAddr, regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        regAddr++;
+        tableAddr++;
+    }
+
+    /* Write ACS_CMD register for care bits*/
+    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
+    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_ACLACT);
+    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+void rtl8367::_rtl8367c_aclRuleStUser2Smi(rtl8367c_aclrule *pAclUser, rtl8367c_aclrulesmi *pAclSmi)
+{
+    uint8_t *care_ptr, *data_ptr;
+    uint8_t care_tmp, data_tmp;
+    uint32_t i;
+
+    pAclSmi->data_bits_ext.rule_info = ((pAclUser->data_bits.active_portmsk >> 8) & 0x7) << 1;
+    pAclSmi->data_bits.rule_info = ((pAclUser->data_bits.active_portmsk & 0xff) << 8) | ((pAclUser->data_bits.tag_exist & 0x1F) << 3) | (pAclUser->data_bits.type & 0x07);
+
+    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
+        pAclSmi->data_bits.field[i] = pAclUser->data_bits.field[i];
+
+    pAclSmi->valid = pAclUser->valid;
+
+    pAclSmi->care_bits_ext.rule_info = ((pAclUser->care_bits.active_portmsk >> 8) & 0x7) << 1;
+    pAclSmi->care_bits.rule_info = ((pAclUser->care_bits.active_portmsk & 0xff) << 8) | ((pAclUser->care_bits.tag_exist & 0x1F) << 3) | (pAclUser->care_bits.type & 0x07);
+
+    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
+        pAclSmi->care_bits.field[i] = pAclUser->care_bits.field[i];
+
+    care_ptr = (uint8_t *)&pAclSmi->care_bits;
+    data_ptr = (uint8_t *)&pAclSmi->data_bits;
+
+    for (i = 0; i < sizeof(struct acl_rule_smi_st); i++)
+    {
+        care_tmp = *(care_ptr + i) & ~(*(data_ptr + i));
+        data_tmp = *(care_ptr + i) & *(data_ptr + i);
+
+        *(care_ptr + i) = care_tmp;
+        *(data_ptr + i) = data_tmp;
+    }
+
+    care_ptr = (uint8_t *)&pAclSmi->care_bits_ext;
+    data_ptr = (uint8_t *)&pAclSmi->data_bits_ext;
+    care_tmp = *care_ptr & ~(*data_ptr);
+    data_tmp = *care_ptr & *data_ptr;
+
+    *care_ptr = care_tmp;
+    *data_ptr = data_tmp;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicAclRule
+ * Description:
+ *      Set acl rule content
+ * Input:
+ *      index   - ACL rule index (0-95) of 96 ACL rules
+ *      pAclRule - ACL rule stucture for setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
+ * Note:
+ *      System supported 95 shared 289-bit ACL ingress rule. Index was available at range 0-95 only.
+ *      If software want to modify ACL rule, the ACL function should be disable at first or unspecify
+ *      acl action will be executed.
+ *      One ACL rule structure has three parts setting:
+ *      Bit 0-147       Data Bits of this Rule
+ *      Bit 148     Valid Bit
+ *      Bit 149-296 Care Bits of this Rule
+ *      There are four kinds of field in Data Bits and Care Bits: Active Portmask, Type, Tag Exist, and 8 fields
+ */
+int32_t rtl8367::rtl8367c_setAsicAclRule(uint32_t index, rtl8367c_aclrule *pAclRule)
+{
+    rtl8367c_aclrulesmi aclRuleSmi;
+    uint16_t *tableAddr;
+    uint32_t regAddr;
+    uint32_t regData;
+    uint32_t i;
+    int32_t retVal;
+
+    if (index > RTL8367C_ACLRULEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    memset(&aclRuleSmi, 0x00, sizeof(rtl8367c_aclrulesmi));
+
+    _rtl8367c_aclRuleStUser2Smi(pAclRule, &aclRuleSmi);
+
+    /* Write valid bit = 0 */
+    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
+    if (index >= 64)
+        regData = RTL8367C_ACLRULETBADDR2(DATABITS, index);
+    else
+        regData = RTL8367C_ACLRULETBADDR(DATABITS, index);
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_TABLE_ACCESS_WRDATA_REG(RTL8367C_ACLRULETBLEN), 0x1, 0);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
+    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_ACLRULE);
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write ACS_ADR register */
+    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
+    if (index >= 64)
+        regData = RTL8367C_ACLRULETBADDR2(CAREBITS, index);
+    else
+        regData = RTL8367C_ACLRULETBADDR(CAREBITS, index);
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write Care Bits to ACS_DATA registers */
+    tableAddr = (uint16_t *)&aclRuleSmi.care_bits;
+    regAddr = RTL8367C_TABLE_ACCESS_WRDATA_BASE;
+
+    for (i = 0; i < RTL8367C_ACLRULETBLEN; i++)
+    {
+        regData = *tableAddr;
+        retVal = rtl8367c_setAsicReg(regAddr, regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        regAddr++;
+        tableAddr++;
+    }
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_TABLE_ACCESS_WRDATA_REG(RTL8367C_ACLRULETBLEN), (0x0007 << 1), (aclRuleSmi.care_bits_ext.rule_info >> 1) & 0x0007);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write ACS_CMD register */
+    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
+    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_ACLRULE);
+    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write ACS_ADR register for data bits */
+    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
+    if (index >= 64)
+        regData = RTL8367C_ACLRULETBADDR2(DATABITS, index);
+    else
+        regData = RTL8367C_ACLRULETBADDR(DATABITS, index);
+
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write Data Bits to ACS_DATA registers */
+    tableAddr = (uint16_t *)&aclRuleSmi.data_bits;
+    regAddr = RTL8367C_TABLE_ACCESS_WRDATA_BASE;
+
+    for (i = 0; i < RTL8367C_ACLRULETBLEN; i++)
+    {
+        regData = *tableAddr;
+        retVal = rtl8367c_setAsicReg(regAddr, regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        regAddr++;
+        tableAddr++;
+    }
+
+    retVal = rtl8367c_setAsicRegBit(RTL8367C_TABLE_ACCESS_WRDATA_REG(RTL8367C_ACLRULETBLEN), 0, aclRuleSmi.valid);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_TABLE_ACCESS_WRDATA_REG(RTL8367C_ACLRULETBLEN), (0x0007 << 1), (aclRuleSmi.data_bits_ext.rule_info >> 1) & 0x0007);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write ACS_CMD register for care bits*/
+    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
+    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_WRITE, TB_TARGET_ACLRULE);
+    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_igrAcl_cfg_add(rtk_filter_id_t filter_id, rtk_filter_cfg_t *pFilter_cfg, rtk_filter_action_t *pFilter_action, uint32_t *ruleNum)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t careTagData, careTagMask;
+    uint32_t i, vidx, svidx, actType, ruleId;
+    uint32_t aclActCtrl;
+    uint32_t cpuPort;
+    rtk_filter_field_t *fieldPtr;
+    rtl8367c_aclrule aclRule[RTL8367C_ACLTEMPLATENO];
+    rtl8367c_aclrule tempRule;
+    rtl8367c_acl_act_t aclAct;
+    uint32_t noRulesAdd;
+    uint32_t portmask;
+
+    if (filter_id > RTL8367C_ACLRULEMAX)
+        return RT_ERR_ENTRY_INDEX;
+
+    if ((NULL == pFilter_cfg) || (NULL == pFilter_action) || (NULL == ruleNum))
+        return RT_ERR_NULL_POINTER;
+
+    fieldPtr = pFilter_cfg->fieldHead;
+
+    /* init RULE */
+    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
+    {
+        memset(&aclRule[i], 0, sizeof(rtl8367c_aclrule));
+
+        aclRule[i].data_bits.type = i;
+        aclRule[i].care_bits.type = 0x7;
+    }
+
+    while (NULL != fieldPtr)
+    {
+        _rtk_filter_igrAcl_writeDataField(aclRule, fieldPtr);
+
+        fieldPtr = fieldPtr->next;
+    }
+
+    /*set care tag mask in User Defined Field 15*/
+    /*Follow care tag should not be used while ACL template and User defined fields are fully control by system designer*/
+    /*those advanced packet type care tag is used in default template design structure only*/
+    careTagData = 0;
+    careTagMask = 0;
+
+    for (i = CARE_TAG_TCP; i < CARE_TAG_END; i++)
+    {
+        if (pFilter_cfg->careTag.tagType[i].mask)
+            careTagMask = careTagMask | (1 << (i - CARE_TAG_TCP));
+
+        if (pFilter_cfg->careTag.tagType[i].value)
+            careTagData = careTagData | (1 << (i - CARE_TAG_TCP));
+    }
+
+    if (careTagData || careTagMask)
+    {
+        i = 0;
+        while (i < RTL8367C_ACLTEMPLATENO)
+        {
+            if (aclRule[i].valid == 1 && filter_advanceCaretagField[i][0] == 1)
+            {
+
+                aclRule[i].data_bits.field[filter_advanceCaretagField[i][1]] = careTagData & 0xFFFF;
+                aclRule[i].care_bits.field[filter_advanceCaretagField[i][1]] = careTagMask & 0xFFFF;
+                break;
+            }
+            i++;
+        }
+        /*none of previous used template containing field 15*/
+        if (i == RTL8367C_ACLTEMPLATENO)
+        {
+            i = 0;
+            while (i < RTL8367C_ACLTEMPLATENO)
+            {
+                if (filter_advanceCaretagField[i][0] == 1)
+                {
+                    aclRule[i].data_bits.field[filter_advanceCaretagField[i][1]] = careTagData & 0xFFFF;
+                    aclRule[i].care_bits.field[filter_advanceCaretagField[i][1]] = careTagMask & 0xFFFF;
+                    aclRule[i].valid = 1;
+                    break;
+                }
+                i++;
+            }
+        }
+    }
+
+    /*Check rule number*/
+    noRulesAdd = 0;
+    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
+    {
+        if (1 == aclRule[i].valid)
+        {
+            noRulesAdd++;
+        }
+    }
+
+    *ruleNum = noRulesAdd;
+
+    if ((filter_id + noRulesAdd - 1) > RTL8367C_ACLRULEMAX)
+    {
+        return RT_ERR_ENTRY_INDEX;
+    }
+
+    /*set care tag mask in TAG Indicator*/
+    careTagData = 0;
+    careTagMask = 0;
+
+    for (i = 0; i <= CARE_TAG_IPV6; i++)
+    {
+        if (0 == pFilter_cfg->careTag.tagType[i].mask)
+        {
+            careTagMask &= ~(1 << i);
+        }
+        else
+        {
+            careTagMask |= (1 << i);
+            if (0 == pFilter_cfg->careTag.tagType[i].value)
+                careTagData &= ~(1 << i);
+            else
+                careTagData |= (1 << i);
+        }
+    }
+
+    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
+    {
+        aclRule[i].data_bits.tag_exist = (careTagData)&ACL_RULE_CARETAG_MASK;
+        aclRule[i].care_bits.tag_exist = (careTagMask)&ACL_RULE_CARETAG_MASK;
+    }
+
+    RTK_CHK_PORTMASK_VALID(&pFilter_cfg->activeport.value);
+    RTK_CHK_PORTMASK_VALID(&pFilter_cfg->activeport.mask);
+
+    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
+    {
+        if (1 == aclRule[i].valid)
+        {
+            if (rtk_switch_portmask_L2P_get(&pFilter_cfg->activeport.value, &portmask) != RT_ERR_OK)
+                return RT_ERR_PORT_MASK;
+
+            aclRule[i].data_bits.active_portmsk = portmask;
+
+            if (rtk_switch_portmask_L2P_get(&pFilter_cfg->activeport.mask, &portmask) != RT_ERR_OK)
+                return RT_ERR_PORT_MASK;
+
+            aclRule[i].care_bits.active_portmsk = portmask;
+        }
+    }
+
+    if (pFilter_cfg->invert >= FILTER_INVERT_END)
+        return RT_ERR_INPUT;
+
+    /*Last action gets high priority if actions are the same*/
+    memset(&aclAct, 0, sizeof(rtl8367c_acl_act_t));
+    aclActCtrl = 0;
+    for (actType = 0; actType < FILTER_ENACT_END; actType++)
+    {
+        if (pFilter_action->actEnable[actType])
+        {
+            switch (actType)
+            {
+            case FILTER_ENACT_CVLAN_INGRESS:
+                if (pFilter_action->filterCvlanVid > RTL8367C_EVIDMAX)
+                    return RT_ERR_INPUT;
+
+                if ((retVal = rtk_vlan_checkAndCreateMbr(pFilter_action->filterCvlanVid, &vidx)) != RT_ERR_OK)
+                {
+                    return retVal;
+                }
+                aclAct.cact = FILTER_ENACT_CVLAN_TYPE(actType);
+                aclAct.cvidx_cact = vidx;
+
+                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                {
+                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_TAGONLY)
+                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                }
+                else
+                {
+                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_VLANONLY;
+                }
+
+                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
+                break;
+            case FILTER_ENACT_CVLAN_EGRESS:
+                if (pFilter_action->filterCvlanVid > RTL8367C_EVIDMAX)
+                    return RT_ERR_INPUT;
+
+                if ((retVal = rtk_vlan_checkAndCreateMbr(pFilter_action->filterCvlanVid, &vidx)) != RT_ERR_OK)
+                    return retVal;
+
+                aclAct.cact = FILTER_ENACT_CVLAN_TYPE(actType);
+                aclAct.cvidx_cact = vidx;
+
+                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                {
+                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_TAGONLY)
+                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                }
+                else
+                {
+                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_VLANONLY;
+                }
+
+                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
+                break;
+            case FILTER_ENACT_CVLAN_SVID:
+
+                aclAct.cact = FILTER_ENACT_CVLAN_TYPE(actType);
+
+                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                {
+                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_TAGONLY)
+                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                }
+                else
+                {
+                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_VLANONLY;
+                }
+
+                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
+                break;
+            case FILTER_ENACT_POLICING_1:
+                if (pFilter_action->filterPolicingIdx[1] >= ((halCtrl.max_meter_id + 1) + RTL8367C_MAX_LOG_CNT_NUM))
+                    return RT_ERR_INPUT;
+
+                aclAct.cact = FILTER_ENACT_CVLAN_TYPE(actType);
+                aclAct.cvidx_cact = pFilter_action->filterPolicingIdx[1];
+
+                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                {
+                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_TAGONLY)
+                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                }
+                else
+                {
+                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_VLANONLY;
+                }
+
+                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
+                break;
+
+            case FILTER_ENACT_SVLAN_INGRESS:
+            case FILTER_ENACT_SVLAN_EGRESS:
+
+                if ((retVal = rtk_svlan_checkAndCreateMbr(pFilter_action->filterSvlanVid, &svidx)) != RT_ERR_OK)
+                    return retVal;
+
+                aclAct.sact = FILTER_ENACT_SVLAN_TYPE(actType);
+                aclAct.svidx_sact = svidx;
+                aclActCtrl |= FILTER_ENACT_SVLAN_MASK;
+                break;
+            case FILTER_ENACT_SVLAN_CVID:
+
+                aclAct.sact = FILTER_ENACT_SVLAN_TYPE(actType);
+                aclActCtrl |= FILTER_ENACT_SVLAN_MASK;
+                break;
+            case FILTER_ENACT_POLICING_2:
+                if (pFilter_action->filterPolicingIdx[2] >= ((halCtrl.max_meter_id + 1) + RTL8367C_MAX_LOG_CNT_NUM))
+                    return RT_ERR_INPUT;
+
+                aclAct.sact = FILTER_ENACT_SVLAN_TYPE(actType);
+                aclAct.svidx_sact = pFilter_action->filterPolicingIdx[2];
+                aclActCtrl |= FILTER_ENACT_SVLAN_MASK;
+                break;
+            case FILTER_ENACT_POLICING_0:
+                if (pFilter_action->filterPolicingIdx[0] >= ((halCtrl.max_meter_id + 1) + RTL8367C_MAX_LOG_CNT_NUM))
+                    return RT_ERR_INPUT;
+
+                aclAct.aclmeteridx = pFilter_action->filterPolicingIdx[0];
+                aclActCtrl |= FILTER_ENACT_POLICING_MASK;
+                break;
+            case FILTER_ENACT_PRIORITY:
+            case FILTER_ENACT_1P_REMARK:
+                if (pFilter_action->filterPriority > RTL8367C_PRIMAX)
+                    return RT_ERR_INPUT;
+
+                aclAct.priact = FILTER_ENACT_PRI_TYPE(actType);
+                aclAct.pridx = pFilter_action->filterPriority;
+                aclActCtrl |= FILTER_ENACT_PRIORITY_MASK;
+                break;
+            case FILTER_ENACT_DSCP_REMARK:
+                if (pFilter_action->filterPriority > RTL8367C_DSCPMAX)
+                    return RT_ERR_INPUT;
+
+                aclAct.priact = FILTER_ENACT_PRI_TYPE(actType);
+                aclAct.pridx = pFilter_action->filterPriority;
+                aclActCtrl |= FILTER_ENACT_PRIORITY_MASK;
+                break;
+            case FILTER_ENACT_POLICING_3:
+                if (pFilter_action->filterPriority >= ((halCtrl.max_meter_id + 1) + RTL8367C_MAX_LOG_CNT_NUM))
+                    return RT_ERR_INPUT;
+
+                aclAct.priact = FILTER_ENACT_PRI_TYPE(actType);
+                aclAct.pridx = pFilter_action->filterPolicingIdx[3];
+                aclActCtrl |= FILTER_ENACT_PRIORITY_MASK;
+                break;
+            case FILTER_ENACT_DROP:
+
+                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(FILTER_ENACT_REDIRECT);
+                aclAct.fwdact_ext = 0;
+
+                aclAct.fwdpmask = 0;
+                aclActCtrl |= FILTER_ENACT_FWD_MASK;
+                break;
+            case FILTER_ENACT_REDIRECT:
+                RTK_CHK_PORTMASK_VALID(&pFilter_action->filterPortmask);
+
+                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(actType);
+                aclAct.fwdact_ext = 0;
+
+                if (rtk_switch_portmask_L2P_get(&pFilter_action->filterPortmask, &portmask) != RT_ERR_OK)
+                    return RT_ERR_PORT_MASK;
+                aclAct.fwdpmask = portmask;
+
+                aclActCtrl |= FILTER_ENACT_FWD_MASK;
+                break;
+
+            case FILTER_ENACT_ADD_DSTPORT:
+                RTK_CHK_PORTMASK_VALID(&pFilter_action->filterPortmask);
+
+                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(actType);
+                aclAct.fwdact_ext = 0;
+
+                if (rtk_switch_portmask_L2P_get(&pFilter_action->filterPortmask, &portmask) != RT_ERR_OK)
+                    return RT_ERR_PORT_MASK;
+                aclAct.fwdpmask = portmask;
+
+                aclActCtrl |= FILTER_ENACT_FWD_MASK;
+                break;
+            case FILTER_ENACT_MIRROR:
+                RTK_CHK_PORTMASK_VALID(&pFilter_action->filterPortmask);
+
+                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(actType);
+                aclAct.cact_ext = 0;
+
+                if (rtk_switch_portmask_L2P_get(&pFilter_action->filterPortmask, &portmask) != RT_ERR_OK)
+                    return RT_ERR_PORT_MASK;
+                aclAct.fwdpmask = portmask;
+
+                aclActCtrl |= FILTER_ENACT_FWD_MASK;
+                break;
+            case FILTER_ENACT_TRAP_CPU:
+
+                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(actType);
+                aclAct.fwdact_ext = 0;
+
+                aclActCtrl |= FILTER_ENACT_FWD_MASK;
+                break;
+            case FILTER_ENACT_COPY_CPU:
+                if ((retVal = rtl8367c_getAsicCputagTrapPort(&cpuPort)) != RT_ERR_OK)
+                    return retVal;
+
+                aclAct.fwdact = FILTER_ENACT_FWD_TYPE(FILTER_ENACT_MIRROR);
+                aclAct.fwdact_ext = 0;
+
+                aclAct.fwdpmask = 1 << cpuPort;
+                aclActCtrl |= FILTER_ENACT_FWD_MASK;
+                break;
+            case FILTER_ENACT_ISOLATION:
+                RTK_CHK_PORTMASK_VALID(&pFilter_action->filterPortmask);
+
+                aclAct.fwdact_ext = 1;
+
+                if (rtk_switch_portmask_L2P_get(&pFilter_action->filterPortmask, &portmask) != RT_ERR_OK)
+                    return RT_ERR_PORT_MASK;
+                aclAct.fwdpmask = portmask;
+
+                aclActCtrl |= FILTER_ENACT_FWD_MASK;
+                break;
+
+            case FILTER_ENACT_INTERRUPT:
+
+                aclAct.aclint = 1;
+                aclActCtrl |= FILTER_ENACT_INTGPIO_MASK;
+                break;
+            case FILTER_ENACT_GPO:
+
+                aclAct.gpio_en = 1;
+                aclAct.gpio_pin = pFilter_action->filterPin;
+                aclActCtrl |= FILTER_ENACT_INTGPIO_MASK;
+                break;
+            case FILTER_ENACT_EGRESSCTAG_TAG:
+
+                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                {
+                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_VLANONLY)
+                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                }
+                else
+                {
+                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_TAGONLY;
+                }
+                aclAct.tag_fmt = FILTER_CTAGFMT_TAG;
+                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
+                break;
+            case FILTER_ENACT_EGRESSCTAG_UNTAG:
+
+                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                {
+                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_VLANONLY)
+                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                }
+                else
+                {
+                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_TAGONLY;
+                }
+                aclAct.tag_fmt = FILTER_CTAGFMT_UNTAG;
+                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
+                break;
+            case FILTER_ENACT_EGRESSCTAG_KEEP:
+
+                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                {
+                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_VLANONLY)
+                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                }
+                else
+                {
+                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_TAGONLY;
+                }
+                aclAct.tag_fmt = FILTER_CTAGFMT_KEEP;
+                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
+                break;
+            case FILTER_ENACT_EGRESSCTAG_KEEPAND1PRMK:
+
+                if (aclActCtrl & (FILTER_ENACT_CVLAN_MASK))
+                {
+                    if (aclAct.cact_ext == FILTER_ENACT_CACTEXT_VLANONLY)
+                        aclAct.cact_ext = FILTER_ENACT_CACTEXT_BOTHVLANTAG;
+                }
+                else
+                {
+                    aclAct.cact_ext = FILTER_ENACT_CACTEXT_TAGONLY;
+                }
+                aclAct.tag_fmt = FILTER_CTAGFMT_KEEP1PRMK;
+                aclActCtrl |= FILTER_ENACT_CVLAN_MASK;
+                break;
+            default:
+                return RT_ERR_FILTER_INACL_ACT_NOT_SUPPORT;
+            }
+        }
+    }
+
+    /*check if free ACL rules are enough*/
+    for (i = filter_id; i < (filter_id + noRulesAdd); i++)
+    {
+        if ((retVal = rtl8367c_getAsicAclRule(i, &tempRule)) != RT_ERR_OK)
+            return retVal;
+
+        if (tempRule.valid == 1)
+        {
+            return RT_ERR_TBL_FULL;
+        }
+    }
+
+    ruleId = 0;
+    for (i = 0; i < RTL8367C_ACLTEMPLATENO; i++)
+    {
+        if (aclRule[i].valid == 1)
+        {
+            /* write ACL action control */
+            if ((retVal = rtl8367c_setAsicAclActCtrl(filter_id + ruleId, aclActCtrl)) != RT_ERR_OK)
+                return retVal;
+            /* write ACL action */
+            if ((retVal = rtl8367c_setAsicAclAct(filter_id + ruleId, &aclAct)) != RT_ERR_OK)
+                return retVal;
+
+            /* write ACL not */
+            if ((retVal = rtl8367c_setAsicAclNot(filter_id + ruleId, pFilter_cfg->invert)) != RT_ERR_OK)
+                return retVal;
+            /* write ACL rule */
+            if ((retVal = rtl8367c_setAsicAclRule(filter_id + ruleId, &aclRule[i])) != RT_ERR_OK)
+                return retVal;
+
+            /* only the first rule will be written with input action control, aclActCtrl of other rules will be zero */
+            aclActCtrl = 0;
+            memset(&aclAct, 0, sizeof(rtl8367c_acl_act_t));
+
+            ruleId++;
+        }
+    }
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_igrAcl_cfg_del(rtk_filter_id_t filter_id)
+{
+    RTK_SMI_STATS_SCOPE();
+    rtl8367c_aclrule initRule;
+    rtl8367c_acl_act_t initAct;
+    int32_t ret;
+
+    if (filter_id > RTL8367C_ACLRULEMAX)
+        return RT_ERR_FILTER_ENTRYIDX;
+
+    memset(&initRule, 0, sizeof(rtl8367c_aclrule));
+    memset(&initAct, 0, sizeof(rtl8367c_acl_act_t));
+
+    if ((ret = rtl8367c_setAsicAclRule(filter_id, &initRule)) != RT_ERR_OK)
+        return ret;
+    if ((ret = rtl8367c_setAsicAclActCtrl(filter_id, FILTER_ENACT_INIT_MASK)) != RT_ERR_OK)
+        return ret;
+    if ((ret = rtl8367c_setAsicAclAct(filter_id, &initAct)) != RT_ERR_OK)
+        return ret;
+    if ((ret = rtl8367c_setAsicAclNot(filter_id, DISABLED)) != RT_ERR_OK)
+        return ret;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_igrAcl_cfg_delAll()
+{
+    RTK_SMI_STATS_SCOPE();
+    uint32_t i;
+    int32_t ret;
+
+    for (i = 0; i < RTL8367C_ACLRULENO; i++)
+    {
+        if ((ret = rtl8367c_setAsicAclActCtrl(i, FILTER_ENACT_INIT_MASK)) != RT_ERR_OK)
+            return ret;
+        if ((ret = rtl8367c_setAsicAclNot(i, DISABLED)) != RT_ERR_OK)
+            return ret;
+    }
+
+    return rtl8367c_setAsicRegBit(RTL8367C_REG_ACL_RESET_CFG, RTL8367C_ACL_RESET_CFG_OFFSET, 1);
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicAcl
+ * Description:
+ *      Get rule comparison result inversion / no inversion
+ * Input:
+ *      index   - ACL rule index (0-95) of 95 ACL rules
+ *      pNot    - 1: inverse, 0: don't inverse
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicAclNot(uint32_t index, uint32_t *pNot)
+{
+    if (index > RTL8367C_ACLRULEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (index < 64)
+        return rtl8367c_getAsicRegBit(RTL8367C_ACL_ACTION_CTRL_REG(index), RTL8367C_ACL_OP_NOT_OFFSET(index), pNot);
+    else
+        return rtl8367c_getAsicRegBit(RTL8367C_ACL_ACTION_CTRL2_REG(index), RTL8367C_ACL_OP_NOT_OFFSET(index), pNot);
+}
+
+void rtl8367::_rtl8367c_aclActStSmi2User(rtl8367c_acl_act_t *pAclUser, uint16_t *pAclSmi)
+{
+    pAclUser->cact = (pAclSmi[0] & 0x00C0) >> 6;
+    pAclUser->cvidx_cact = (pAclSmi[0] & 0x003F) | (((pAclSmi[3] & 0x0008) >> 3) << 6);
+
+    pAclUser->sact = (pAclSmi[0] & 0xC000) >> 14;
+    pAclUser->svidx_sact = ((pAclSmi[0] & 0x3F00) >> 8) | (((pAclSmi[3] & 0x0010) >> 4) << 6);
+
+    pAclUser->aclmeteridx = (pAclSmi[1] & 0x003F) | (((pAclSmi[3] & 0x0020) >> 5) << 6);
+
+    pAclUser->fwdact = (pAclSmi[1] & 0xC000) >> 14;
+    pAclUser->fwdpmask = ((pAclSmi[1] & 0x3FC0) >> 6) | (((pAclSmi[3] & 0x01C0) >> 6) << 8);
+
+    pAclUser->priact = (pAclSmi[2] & 0x00C0) >> 6;
+    pAclUser->pridx = (pAclSmi[2] & 0x003F) | (((pAclSmi[3] & 0x0200) >> 9) << 6);
+
+    pAclUser->aclint = (pAclSmi[2] & 0x2000) >> 13;
+    pAclUser->gpio_en = (pAclSmi[2] & 0x1000) >> 12;
+    pAclUser->gpio_pin = (pAclSmi[2] & 0x0F00) >> 8;
+
+    pAclUser->cact_ext = (pAclSmi[2] & 0xC000) >> 14;
+    pAclUser->tag_fmt = (pAclSmi[3] & 0x0003);
+    pAclUser->fwdact_ext = (pAclSmi[3] & 0x0004) >> 2;
+}
+/* Function Name:
+ *      rtl8367c_getAsicAclAct
+ * Description:
+ *      Get ACL rule matched Action
+ * Input:
+ *      index   - ACL rule index (0-95) of 96 ACL rules
+ *      pAclAct     - ACL action stucture for setting
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicAclAct(uint32_t index, rtl8367c_acl_act_t *pAclAct)
+{
+    uint16_t aclActSmi[RTL8367C_ACL_ACT_TABLE_LEN];
+    int32_t retVal;
+    uint32_t regAddr, regData;
+    uint16_t *tableAddr;
+    uint32_t i;
+
+    if (index > RTL8367C_ACLRULEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    memset(aclActSmi, 0x00, sizeof(uint16_t) * RTL8367C_ACL_ACT_TABLE_LEN);
+
+    /* Write ACS_ADR register for data bits */
+    regAddr = RTL8367C_TABLE_ACCESS_ADDR_REG;
+    regData = index;
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Write ACS_CMD register */
+    regAddr = RTL8367C_TABLE_ACCESS_CTRL_REG;
+    regData = RTL8367C_TABLE_ACCESS_REG_DATA(TB_OP_READ, TB_TARGET_ACLACT);
+    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_TABLE_TYPE_MASK | RTL8367C_COMMAND_TYPE_MASK, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    /* Read Data Bits */
+    regAddr = RTL8367C_TABLE_ACCESS_RDDATA_BASE;
+    tableAddr = aclActSmi;
+    for (i = 0; i < RTL8367C_ACLACTTBLEN; i++)
+    {
+        retVal = rtl8367c_getAsicReg(regAddr, &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        *tableAddr = regData;
+
+        regAddr++;
+        tableAddr++;
+    }
+
+    _rtl8367c_aclActStSmi2User(pAclAct, aclActSmi);
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_getAsicAclActCtrl
+ * Description:
+ *      Get ACL rule matched Action Control Bits
+ * Input:
+ *      index       - ACL rule index (0-95) of 96 ACL rules
+ *      pAclActCtrl     - 6 ACL Control Bits
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL rule index (0-95)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicAclActCtrl(uint32_t index, uint32_t *pAclActCtrl)
+{
+    int32_t retVal;
+    uint32_t regData;
+
+    if (index > RTL8367C_ACLRULEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (index >= 64)
+        retVal = rtl8367c_getAsicRegBits(RTL8367C_ACL_ACTION_CTRL2_REG(index), RTL8367C_ACL_OP_ACTION_MASK(index), &regData);
+    else
+        retVal = rtl8367c_getAsicRegBits(RTL8367C_ACL_ACTION_CTRL_REG(index), RTL8367C_ACL_OP_ACTION_MASK(index), &regData);
+
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    *pAclActCtrl = regData;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_igrAcl_cfg_get(rtk_filter_id_t filter_id, rtk_filter_cfg_raw_t *pFilter_cfg, rtk_filter_action_t *pAction)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t i, tmp;
+    rtl8367c_aclrule aclRule;
+    rtl8367c_acl_act_t aclAct;
+    uint32_t cpuPort;
+    rtl8367c_acltemplate_t type;
+    rtl8367c_svlan_memconf_t svlan_cfg;
+    rtl8367c_vlanconfiguser vlanMC;
+    uint32_t phyPmask;
+
+    if (NULL == pFilter_cfg || NULL == pAction)
+        return RT_ERR_NULL_POINTER;
+
+    if (filter_id > RTL8367C_ACLRULEMAX)
+        return RT_ERR_ENTRY_INDEX;
+
+    if ((retVal = rtl8367c_getAsicAclRule(filter_id, &aclRule)) != RT_ERR_OK)
+        return retVal;
+
+    /* Check valid */
+    if (aclRule.valid == 0)
+    {
+        pFilter_cfg->valid = DISABLED_RTK;
+        return RT_ERR_OK;
+    }
+
+    phyPmask = aclRule.data_bits.active_portmsk;
+    if (rtk_switch_portmask_P2L_get(phyPmask, &(pFilter_cfg->activeport.value)) != RT_ERR_OK)
+        return RT_ERR_FAILED;
+
+    phyPmask = aclRule.care_bits.active_portmsk;
+    if (rtk_switch_portmask_P2L_get(phyPmask, &(pFilter_cfg->activeport.mask)) != RT_ERR_OK)
+        return RT_ERR_FAILED;
+
+    for (i = 0; i <= CARE_TAG_IPV6; i++)
+    {
+        if (aclRule.data_bits.tag_exist & (1 << i))
+            pFilter_cfg->careTag.tagType[i].value = 1;
+        else
+            pFilter_cfg->careTag.tagType[i].value = 0;
+
+        if (aclRule.care_bits.tag_exist & (1 << i))
+            pFilter_cfg->careTag.tagType[i].mask = 1;
+        else
+            pFilter_cfg->careTag.tagType[i].mask = 0;
+    }
+
+    if (filter_advanceCaretagField[aclRule.data_bits.type][0] == 1)
+    {
+        /* Advanced Care tag setting */
+        for (i = CARE_TAG_TCP; i < CARE_TAG_END; i++)
+        {
+            if (aclRule.data_bits.field[filter_advanceCaretagField[aclRule.data_bits.type][1]] & (0x0001 << (i - CARE_TAG_TCP)))
+                pFilter_cfg->careTag.tagType[i].value = 1;
+            else
+                pFilter_cfg->careTag.tagType[i].value = 0;
+
+            if (aclRule.care_bits.field[filter_advanceCaretagField[aclRule.care_bits.type][1]] & (0x0001 << (i - CARE_TAG_TCP)))
+                pFilter_cfg->careTag.tagType[i].mask = 1;
+            else
+                pFilter_cfg->careTag.tagType[i].mask = 0;
+        }
+    }
+
+    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
+    {
+        pFilter_cfg->careFieldRaw[i] = aclRule.care_bits.field[i];
+        pFilter_cfg->dataFieldRaw[i] = aclRule.data_bits.field[i];
+    }
+
+    if ((retVal = rtl8367c_getAsicAclNot(filter_id, &tmp)) != RT_ERR_OK)
+        return retVal;
+
+    pFilter_cfg->invert = (rtk_filter_invert_t)tmp;
+
+    pFilter_cfg->valid = (rtk_enable_t)aclRule.valid;
+
+    memset(pAction, 0, sizeof(rtk_filter_action_t));
+
+    if ((retVal = rtl8367c_getAsicAclActCtrl(filter_id, &tmp)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_getAsicAclAct(filter_id, &aclAct)) != RT_ERR_OK)
+        return retVal;
+
+    if (tmp & FILTER_ENACT_FWD_MASK)
+    {
+        if (1 == aclAct.fwdact_ext)
+        {
+            pAction->actEnable[FILTER_ENACT_ISOLATION] = (rtk_filter_act_enable_t)1;
+
+            phyPmask = aclAct.fwdpmask;
+            if (rtk_switch_portmask_P2L_get(phyPmask, &(pAction->filterPortmask)) != RT_ERR_OK)
+                return RT_ERR_FAILED;
+        }
+        else if (aclAct.fwdact == RTL8367C_ACL_FWD_TRAP)
+        {
+            pAction->actEnable[FILTER_ENACT_TRAP_CPU] = (rtk_filter_act_enable_t)1;
+        }
+        else if (aclAct.fwdact == RTL8367C_ACL_FWD_MIRRORFUNTION)
+        {
+            pAction->actEnable[FILTER_ENACT_MIRROR] = (rtk_filter_act_enable_t)1;
+
+            phyPmask = aclAct.fwdpmask;
+            if (rtk_switch_portmask_P2L_get(phyPmask, &(pAction->filterPortmask)) != RT_ERR_OK)
+                return RT_ERR_FAILED;
+        }
+        else if (aclAct.fwdact == RTL8367C_ACL_FWD_REDIRECT)
+        {
+            if (aclAct.fwdpmask == 0)
+                pAction->actEnable[FILTER_ENACT_DROP] = (rtk_filter_act_enable_t)1;
+            else
+            {
+                pAction->actEnable[FILTER_ENACT_REDIRECT] = (rtk_filter_act_enable_t)1;
+
+                phyPmask = aclAct.fwdpmask;
+                if (rtk_switch_portmask_P2L_get(phyPmask, &(pAction->filterPortmask)) != RT_ERR_OK)
+                    return RT_ERR_FAILED;
+            }
+        }
+        else if (aclAct.fwdact == RTL8367C_ACL_FWD_MIRROR)
+        {
+            if ((retVal = rtl8367c_getAsicCputagTrapPort(&cpuPort)) != RT_ERR_OK)
+                return retVal;
+            if (aclAct.fwdpmask == (1 << cpuPort))
+            {
+                pAction->actEnable[FILTER_ENACT_COPY_CPU] = (rtk_filter_act_enable_t)1;
+            }
+            else
+            {
+                pAction->actEnable[FILTER_ENACT_ADD_DSTPORT] = (rtk_filter_act_enable_t)1;
+
+                phyPmask = aclAct.fwdpmask;
+                if (rtk_switch_portmask_P2L_get(phyPmask, &(pAction->filterPortmask)) != RT_ERR_OK)
+                    return RT_ERR_FAILED;
+            }
+        }
+        else
+        {
+            return RT_ERR_FAILED;
+        }
+    }
+
+    if (tmp & FILTER_ENACT_POLICING_MASK)
+    {
+        pAction->actEnable[FILTER_ENACT_POLICING_0] = (rtk_filter_act_enable_t)1;
+        pAction->filterPolicingIdx[0] = aclAct.aclmeteridx;
+    }
+
+    if (tmp & FILTER_ENACT_PRIORITY_MASK)
+    {
+        if (aclAct.priact == FILTER_ENACT_PRI_TYPE(FILTER_ENACT_PRIORITY))
+        {
+            pAction->actEnable[FILTER_ENACT_PRIORITY] = (rtk_filter_act_enable_t)1;
+            pAction->filterPriority = aclAct.pridx;
+        }
+        else if (aclAct.priact == FILTER_ENACT_PRI_TYPE(FILTER_ENACT_1P_REMARK))
+        {
+            pAction->actEnable[FILTER_ENACT_1P_REMARK] = (rtk_filter_act_enable_t)1;
+            pAction->filterPriority = aclAct.pridx;
+        }
+        else if (aclAct.priact == FILTER_ENACT_PRI_TYPE(FILTER_ENACT_DSCP_REMARK))
+        {
+            pAction->actEnable[FILTER_ENACT_DSCP_REMARK] = (rtk_filter_act_enable_t)1;
+            pAction->filterPriority = aclAct.pridx;
+        }
+        else if (aclAct.priact == FILTER_ENACT_PRI_TYPE(FILTER_ENACT_POLICING_3))
+        {
+            pAction->actEnable[FILTER_ENACT_POLICING_3] = (rtk_filter_act_enable_t)1;
+            pAction->filterPolicingIdx[3] = aclAct.pridx;
+        }
+    }
+
+    if (tmp & FILTER_ENACT_SVLAN_MASK)
+    {
+        if (aclAct.sact == FILTER_ENACT_SVLAN_TYPE(FILTER_ENACT_SVLAN_INGRESS))
+        {
+            if ((retVal = rtl8367c_getAsicSvlanMemberConfiguration(aclAct.svidx_sact, &svlan_cfg)) != RT_ERR_OK)
+                return retVal;
+
+            pAction->actEnable[FILTER_ENACT_SVLAN_INGRESS] = (rtk_filter_act_enable_t)1;
+            pAction->filterSvlanIdx = aclAct.svidx_sact;
+            pAction->filterSvlanVid = svlan_cfg.vs_svid;
+        }
+        else if (aclAct.sact == FILTER_ENACT_SVLAN_TYPE(FILTER_ENACT_SVLAN_EGRESS))
+        {
+            if ((retVal = rtl8367c_getAsicSvlanMemberConfiguration(aclAct.svidx_sact, &svlan_cfg)) != RT_ERR_OK)
+                return retVal;
+
+            pAction->actEnable[FILTER_ENACT_SVLAN_EGRESS] = (rtk_filter_act_enable_t)1;
+            pAction->filterSvlanIdx = aclAct.svidx_sact;
+            pAction->filterSvlanVid = svlan_cfg.vs_svid;
+        }
+        else if (aclAct.sact == FILTER_ENACT_SVLAN_TYPE(FILTER_ENACT_SVLAN_CVID))
+            pAction->actEnable[FILTER_ENACT_SVLAN_CVID] = (rtk_filter_act_enable_t)1;
+        else if (aclAct.sact == FILTER_ENACT_SVLAN_TYPE(FILTER_ENACT_POLICING_2))
+        {
+            pAction->actEnable[FILTER_ENACT_POLICING_2] = (rtk_filter_act_enable_t)1;
+            pAction->filterPolicingIdx[2] = aclAct.svidx_sact;
+        }
+    }
+
+    if (tmp & FILTER_ENACT_CVLAN_MASK)
+    {
+        if (FILTER_ENACT_CACTEXT_TAGONLY == aclAct.cact_ext ||
+            FILTER_ENACT_CACTEXT_BOTHVLANTAG == aclAct.cact_ext)
+        {
+            if (FILTER_CTAGFMT_UNTAG == aclAct.tag_fmt)
+            {
+                pAction->actEnable[FILTER_ENACT_EGRESSCTAG_UNTAG] = (rtk_filter_act_enable_t)1;
+            }
+            else if (FILTER_CTAGFMT_TAG == aclAct.tag_fmt)
+            {
+                pAction->actEnable[FILTER_ENACT_EGRESSCTAG_TAG] = (rtk_filter_act_enable_t)1;
+            }
+            else if (FILTER_CTAGFMT_KEEP == aclAct.tag_fmt)
+            {
+                pAction->actEnable[FILTER_ENACT_EGRESSCTAG_KEEP] = (rtk_filter_act_enable_t)1;
+            }
+            else if (FILTER_CTAGFMT_KEEP1PRMK == aclAct.tag_fmt)
+            {
+                pAction->actEnable[FILTER_ENACT_EGRESSCTAG_KEEPAND1PRMK] = (rtk_filter_act_enable_t)1;
+            }
+        }
+
+        if (FILTER_ENACT_CACTEXT_VLANONLY == aclAct.cact_ext ||
+            FILTER_ENACT_CACTEXT_BOTHVLANTAG == aclAct.cact_ext)
+        {
+            if (aclAct.cact == FILTER_ENACT_CVLAN_TYPE(FILTER_ENACT_CVLAN_INGRESS))
+            {
+                if ((retVal = rtl8367c_getAsicVlanMemberConfig(aclAct.cvidx_cact, &vlanMC)) != RT_ERR_OK)
+                    return retVal;
+
+                pAction->actEnable[FILTER_ENACT_CVLAN_INGRESS] = (rtk_filter_act_enable_t)1;
+                pAction->filterCvlanIdx = aclAct.cvidx_cact;
+                pAction->filterCvlanVid = vlanMC.evid;
+            }
+            else if (aclAct.cact == FILTER_ENACT_CVLAN_TYPE(FILTER_ENACT_CVLAN_EGRESS))
+            {
+                if ((retVal = rtl8367c_getAsicVlanMemberConfig(aclAct.cvidx_cact, &vlanMC)) != RT_ERR_OK)
+                    return retVal;
+
+                pAction->actEnable[FILTER_ENACT_CVLAN_EGRESS] = (rtk_filter_act_enable_t)1;
+                pAction->filterCvlanIdx = aclAct.cvidx_cact;
+                pAction->filterCvlanVid = vlanMC.evid;
+            }
+            else if (aclAct.cact == FILTER_ENACT_CVLAN_TYPE(FILTER_ENACT_CVLAN_SVID))
+            {
+                pAction->actEnable[FILTER_ENACT_CVLAN_SVID] = (rtk_filter_act_enable_t)1;
+            }
+            else if (aclAct.cact == FILTER_ENACT_CVLAN_TYPE(FILTER_ENACT_POLICING_1))
+            {
+                pAction->actEnable[FILTER_ENACT_POLICING_1] = (rtk_filter_act_enable_t)1;
+                pAction->filterPolicingIdx[1] = aclAct.cvidx_cact;
+            }
+        }
+    }
+
+    if (tmp & FILTER_ENACT_INTGPIO_MASK)
+    {
+        if (1 == aclAct.aclint)
+        {
+            pAction->actEnable[FILTER_ENACT_INTERRUPT] = (rtk_filter_act_enable_t)1;
+        }
+
+        if (1 == aclAct.gpio_en)
+        {
+            pAction->actEnable[FILTER_ENACT_GPO] = (rtk_filter_act_enable_t)1;
+            pAction->filterPin = aclAct.gpio_pin;
+        }
+    }
+
+    /* Get field type of RAW data */
+    if ((retVal = rtl8367c_getAsicAclTemplate(aclRule.data_bits.type, &type)) != RT_ERR_OK)
+        return retVal;
+
+    for (i = 0; i < RTL8367C_ACLRULEFIELDNO; i++)
+    {
+        pFilter_cfg->fieldRawType[i] = (rtk_filter_field_type_raw_t)type.field[i];
+    } /* end of for(i...) */
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_igrAcl_state_set(rtk_port_t port, rtk_filter_state_t state)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t ret;
+
+    /* Check port valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (state >= RTK_ENABLE_END)
+        return RT_ERR_INPUT;
+
+    if ((ret = rtl8367c_setAsicAcl(rtk_switch_port_L2P_get(port), state)) != RT_ERR_OK)
+        return ret;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_igrAcl_field_sel_set(uint32_t index, rtk_field_sel_t format, uint32_t offset)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t ret;
+
+    if (index >= RTL8367C_FIELDSEL_FORMAT_NUMBER)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (format >= FORMAT_END)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (offset > RTL8367C_FIELDSEL_MAX_OFFSET)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if ((ret = rtl8367c_setAsicFieldSelector(index, (uint32_t)format, offset)) != RT_ERR_OK)
+        return ret;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicAclIpRange
+ * Description:
+ *      Set ACL IP range check
+ * Input:
+ *      index       - ACL IP range check index(0~15)
+ *      type        - Range check type
+ *      upperIp     - IP range upper bound
+ *      lowerIp     - IP range lower bound
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL IP range check index(0~15)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicAclIpRange(uint32_t index, uint32_t type, uint32_t upperIp, uint32_t lowerIp)
+{
+    int32_t retVal;
+    uint32_t regData;
+    uint32_t ipData;
+
+    if (index > RTL8367C_ACLRANGEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL4 + index * 5, RTL8367C_ACL_IP_RANGE_ENTRY0_CTRL4_MASK, type);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    ipData = upperIp;
+
+    regData = ipData & 0xFFFF;
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL2 + index * 5, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    regData = (ipData >> 16) & 0xFFFF;
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL3 + index * 5, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    ipData = lowerIp;
+
+    regData = ipData & 0xFFFF;
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL0 + index * 5, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    regData = (ipData >> 16) & 0xFFFF;
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL1 + index * 5, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+int32_t rtl8367::rtk_filter_iprange_set(uint32_t index, rtk_filter_iprange_t type, uint32_t upperIp, uint32_t lowerIp)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t ret;
+
+    if (index > RTL8367C_ACLRANGEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (type >= IPRANGE_END)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (lowerIp > upperIp)
+        return RT_ERR_INPUT;
+
+    if ((ret = rtl8367c_setAsicAclIpRange(index, type, upperIp, lowerIp)) != RT_ERR_OK)
+        return ret;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicAclVidRange
+ * Description:
+ *      Set ACL VID range check
+ * Input:
+ *      index       - ACL VID range check index(0~15)
+ *      type        - Range check type
+ *      upperVid    - VID range upper bound
+ *      lowerVid    - VID range lower bound
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid ACL  VID range check index(0~15)
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicAclVidRange(uint32_t index, uint32_t type, uint32_t upperVid, uint32_t lowerVid)
+{
+    int32_t retVal;
+    uint32_t regData;
+
+    if (index > RTL8367C_ACLRANGEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    regData = ((type << RTL8367C_ACL_VID_RANGE_ENTRY0_CTRL1_CHECK0_TYPE_OFFSET) & RTL8367C_ACL_VID_RANGE_ENTRY0_CTRL1_CHECK0_TYPE_MASK) |
+              (upperVid & RTL8367C_ACL_VID_RANGE_ENTRY0_CTRL1_CHECK0_HIGH_MASK);
+
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_VID_RANGE_ENTRY0_CTRL1 + index * 2, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_VID_RANGE_ENTRY0_CTRL0 + index * 2, lowerVid);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_vidrange_set(uint32_t index, rtk_filter_vidrange_t type, uint32_t upperVid, uint32_t lowerVid)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t ret;
+
+    if (index > RTL8367C_ACLRANGEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (type >= VIDRANGE_END)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (lowerVid > upperVid)
+        return RT_ERR_INPUT;
+
+    if ((upperVid > RTL8367C_VIDMAX) || (lowerVid > RTL8367C_VIDMAX))
+        return RT_ERR_OUT_OF_RANGE;
+
+    if ((ret = rtl8367c_setAsicAclVidRange(index, type, upperVid, lowerVid)) != RT_ERR_OK)
+        return ret;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsicAclPortRange
+ * Description:
+ *      Set ACL TCP/UDP range check
+ * Input:
+ *      index       - TCP/UDP port range check table index
+ *      type        - Range check type
+ *      upperPort   - TCP/UDP port range upper bound
+ *      lowerPort   - TCP/UDP port range lower bound
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_OUT_OF_RANGE     - Invalid TCP/UDP port range check table index
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicAclPortRange(uint32_t index, uint32_t type, uint32_t upperPort, uint32_t lowerPort)
+{
+    int32_t retVal;
+
+    if (index > RTL8367C_ACLRANGEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_ACL_SDPORT_RANGE_ENTRY0_CTRL2 + index * 3, RTL8367C_ACL_SDPORT_RANGE_ENTRY0_CTRL2_MASK, type);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_SDPORT_RANGE_ENTRY0_CTRL1 + index * 3, upperPort);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_SDPORT_RANGE_ENTRY0_CTRL0 + index * 3, lowerPort);
+    if (retVal != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_filter_portrange_set(uint32_t index, rtk_filter_portrange_t type, uint32_t upperPort, uint32_t lowerPort)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t ret;
+
+    if (index > RTL8367C_ACLRANGEMAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (type >= PORTRANGE_END)
+        return RT_ERR_OUT_OF_RANGE;
+
+    if (lowerPort > upperPort)
+        return RT_ERR_INPUT;
+
+    if (upperPort > RTL8367C_ACL_PORTRANGEMAX)
+        return RT_ERR_INPUT;
+
+    if (lowerPort > RTL8367C_ACL_PORTRANGEMAX)
+        return RT_ERR_INPUT;
+
+    if ((ret = rtl8367c_setAsicAclPortRange(index, type, upperPort, lowerPort)) != RT_ERR_OK)
+        return ret;
+
+    return RT_ERR_OK;
+}
+
+// ------------------------- EEE ---------------------------------
+
+int32_t rtl8367::rtk_eee_init()
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    if ((retVal = rtl8367c_setAsicRegBit(0x0018, 10, 1)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicRegBit(0x0018, 11, 1)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/*
+@func int32_t | rtl8367c_setAsicEee100M | Set eee force mode function enable/disable.
+@parm uint32_t | port | The port number.
+@parm uint32_t | enabled | 1: enabled, 0: disabled.
+@rvalue RT_ERR_OK | Success.
+@rvalue RT_ERR_SMI | SMI access error.
+@rvalue RT_ERR_INPUT | Invalid input parameter.
+@comm
+    This API set the 100M EEE enable function.
+
+*/
+int32_t rtl8367::rtl8367c_setAsicEee100M(uint32_t port, uint32_t enable)
+{
+    int32_t retVal;
+    uint32_t regData;
+
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
+
+    if (enable > 1)
+        return RT_ERR_INPUT;
+
+    if ((retVal = rtl8367c_getAsicPHYOCPReg(port, EEE_OCP_PHY_ADDR, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    if (enable)
+        regData |= (0x0001 << 1);
+    else
+        regData &= ~(0x0001 << 1);
+
+    if ((retVal = rtl8367c_setAsicPHYOCPReg(port, EEE_OCP_PHY_ADDR, regData)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_PORT_EEE_CFG_REG(port), &regData)) != RT_ERR_OK)
+        return retVal;
+
+    if (enable)
+        regData |= (0x0001 << 11);
+    else
+        regData &= ~(0x0001 << 11);
+
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_PORT_EEE_CFG_REG(port), regData)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/*
+@func int32_t | rtl8367c_setAsicEeeGiga | Set eee force mode function enable/disable.
+@parm uint32_t | port | The port number.
+@parm uint32_t | enabled | 1: enabled, 0: disabled.
+@rvalue RT_ERR_OK | Success.
+@rvalue RT_ERR_SMI | SMI access error.
+@rvalue RT_ERR_INPUT | Invalid input parameter.
+@comm
+    This API set the 100M EEE enable function.
+
+*/
+int32_t rtl8367::rtl8367c_setAsicEeeGiga(uint32_t port, uint32_t enable)
+{
+    int32_t retVal;
+    uint32_t regData;
+
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
+
+    if (enable > 1)
+        return RT_ERR_INPUT;
+
+    if ((retVal = rtl8367c_getAsicPHYOCPReg(port, EEE_OCP_PHY_ADDR, &regData)) != RT_ERR_OK)
+        return retVal;
+
+    if (enable)
+        regData |= (0x0001 << 2);
+    else
+        regData &= ~(0x0001 << 2);
+
+    if ((retVal = rtl8367c_setAsicPHYOCPReg(port, EEE_OCP_PHY_ADDR, regData)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_getAsicReg(RTL8367C_PORT_EEE_CFG_REG(port), &regData)) != RT_ERR_OK)
+        return retVal;
+
+    if (enable)
+        regData |= (0x0001 << 10);
+    else
+        regData &= ~(0x0001 << 10);
+
+    if ((retVal = rtl8367c_setAsicReg(RTL8367C_PORT_EEE_CFG_REG(port), regData)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+int32_t rtl8367::rtk_eee_portEnable_set(rtk_port_t port, rtk_enable_t enable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t regData;
+    uint32_t phy_port;
+
+    /* Check port is UTP port */
+    RTK_CHK_PORT_IS_UTP(port);
+
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_INPUT;
+
+    phy_port = rtk_switch_port_L2P_get(port);
+
+    if ((retVal = rtl8367c_setAsicEee100M(phy_port, enable)) != RT_ERR_OK)
+        return retVal;
+    if ((retVal = rtl8367c_setAsicEeeGiga(phy_port, enable)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicPHYReg(phy_port, RTL8367C_PHY_PAGE_ADDRESS, 0)) != RT_ERR_OK)
+        return retVal;
+    if ((retVal = rtl8367c_getAsicPHYReg(phy_port, 0, &regData)) != RT_ERR_OK)
+        return retVal;
+    regData |= 0x0200;
+    if ((retVal = rtl8367c_setAsicPHYReg(phy_port, 0, regData)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+// ------------------------ 802.1X --------------------------------
+
+int32_t rtl8367::rtk_dot1x_eapolFrame2CpuEnable_set(rtk_enable_t enable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    rtl8367c_rma_t rmacfg;
+
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
+
+    if ((retVal = rtl8367c_getAsicRma(3, &rmacfg)) != RT_ERR_OK)
+        return retVal;
+
+    if (ENABLED == enable)
+        rmacfg.operation = RMAOP_TRAP_TO_CPU;
+    else if (DISABLED == enable)
+        rmacfg.operation = RMAOP_FORWARD;
+
+    if ((retVal = rtl8367c_setAsicRma(3, &rmacfg)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsic1xPBEnConfig
+ * Description:
+ *      Set 802.1x port-based port enable configuration
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      enabled - 1: enabled, 0: disabled
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsic1xPBEnConfig(uint32_t port, uint32_t enabled)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_DOT1X_PORT_ENABLE_REG, port, enabled);
+}
+int32_t rtl8367::rtk_dot1x_portBasedEnable_set(rtk_port_t port, rtk_enable_t enable)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    /* Check port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
+
+    if ((retVal = rtl8367c_setAsic1xPBEnConfig(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsic1xPBAuthConfig
+ * Description:
+ *      Set 802.1x port-based authorised port configuration
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      auth    - 1: authorised, 0: non-authorised
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsic1xPBAuthConfig(uint32_t port, uint32_t auth)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_DOT1X_PORT_AUTH_REG, port, auth);
+}
+int32_t rtl8367::rtk_dot1x_portBasedAuthStatus_set(rtk_port_t port, rtk_dot1x_auth_status_t port_auth)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    /* Check port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (port_auth >= AUTH_STATUS_END)
+        return RT_ERR_DOT1X_PORTBASEDAUTH;
+
+    if ((retVal = rtl8367c_setAsic1xPBAuthConfig(rtk_switch_port_L2P_get(port), port_auth)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsic1xPBOpdirConfig
+ * Description:
+ *      Set 802.1x port-based operational direction
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      opdir   - Operation direction 1: IN, 0:BOTH
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsic1xPBOpdirConfig(uint32_t port, uint32_t opdir)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
+
+    return rtl8367c_setAsicRegBit(RTL8367C_DOT1X_PORT_OPDIR_REG, port, opdir);
+}
+int32_t rtl8367::rtk_dot1x_portBasedDirection_set(rtk_port_t port, rtk_dot1x_direction_t port_direction)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+
+    /* Check port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (port_direction >= DIRECTION_END)
+        return RT_ERR_DOT1X_PORTBASEDOPDIR;
+
+    if ((retVal = rtl8367c_setAsic1xPBOpdirConfig(rtk_switch_port_L2P_get(port), port_direction)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      rtl8367c_setAsic1xProcConfig
+ * Description:
+ *      Set 802.1x unauth. behavior configuration
+ * Input:
+ *      port    - Physical port number (0~7)
+ *      proc    - 802.1x unauth. behavior configuration 0:drop 1:trap to CPU 2:Guest VLAN
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_DOT1X_PROC   - Unauthorized behavior error
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsic1xProcConfig(uint32_t port, uint32_t proc)
+{
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
+
+    if (proc >= DOT1X_UNAUTH_END)
+        return RT_ERR_DOT1X_PROC;
 
-    return RT_ERR_OK;
+    if (port < 8)
+    {
+        return rtl8367c_setAsicRegBits(RTL8367C_DOT1X_UNAUTH_ACT_BASE, RTL8367C_DOT1X_UNAUTH_ACT_MASK(port), proc);
+    }
+    else
+    {
+        return rtl8367c_setAsicRegBits(RTL8367C_REG_DOT1X_UNAUTH_ACT_W1, RTL8367C_DOT1X_UNAUTH_ACT_MASK(port), proc);
+    }
 }
-
-int32_t rtl8367::rtk_filter_igrAcl_state_set(rtk_port_t port, rtk_filter_state_t state)
+int32_t rtl8367::rtk_dot1x_unauthPacketOper_set(rtk_port_t port, rtk_dot1x_unauth_action_t unauth_action)
 {
-    int32_t ret;
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-    /* Check port valid */
+    /* Check port Valid */
     RTK_CHK_PORT_VALID(port);
 
-    if (state >= RTK_ENABLE_END)
-        return RT_ERR_INPUT;
+    if (unauth_action >= DOT1X_ACTION_END)
+        return RT_ERR_DOT1X_PROC;
 
-    if ((ret = rtl8367c_setAsicAcl(rtk_switch_port_L2P_get(port), state)) != RT_ERR_OK)
-        return ret;
+    if ((retVal = rtl8367c_setAsic1xProcConfig(rtk_switch_port_L2P_get(port), unauth_action)) != RT_ERR_OK)
+        return retVal;
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_filter_igrAcl_field_sel_set(uint32_t index, rtk_field_sel_t format, uint32_t offset)
+// ------------------------- SHARE METER ---------------------------------
+
+/* Function Name:
+ *      rtl8367c_setAsicShareMeter
+ * Description:
+ *      Set meter configuration
+ * Input:
+ *      index   - hared meter index (0-31)
+ *      rate    - 17-bits rate of share meter, unit is 8Kpbs
+ *      ifg     - Including IFG in rate calculation, 1:include 0:exclude
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicShareMeter(uint32_t index, uint32_t rate, uint32_t ifg)
 {
-    int32_t ret;
+    int32_t retVal;
 
-    if (index >= RTL8367C_FIELDSEL_FORMAT_NUMBER)
-        return RT_ERR_OUT_OF_RANGE;
+    if (index > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-    if (format >= FORMAT_END)
-        return RT_ERR_OUT_OF_RANGE;
+    if (index < 32)
+    {
+        /*19-bits Rate*/
+        retVal = rtl8367c_setAsicReg(RTL8367C_METER_RATE_REG(index), rate & 0xFFFF);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    if (offset > RTL8367C_FIELDSEL_MAX_OFFSET)
-        return RT_ERR_OUT_OF_RANGE;
+        retVal = rtl8367c_setAsicReg(RTL8367C_METER_RATE_REG(index) + 1, (rate & 0x70000) >> 16);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    if ((ret = rtl8367c_setAsicFieldSelector(index, (uint32_t)format, offset)) != RT_ERR_OK)
-        return ret;
+        retVal = rtl8367c_setAsicRegBit(RTL8367C_METER_IFG_CTRL_REG(index), RTL8367C_METER_IFG_OFFSET(index), ifg);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+    else
+    {
+        /*19-bits Rate*/
+        retVal = rtl8367c_setAsicReg(RTL8367C_REG_METER32_RATE_CTRL0 + ((index - 32) << 1), rate & 0xFFFF);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        retVal = rtl8367c_setAsicReg(RTL8367C_REG_METER32_RATE_CTRL0 + ((index - 32) << 1) + 1, (rate & 0x70000) >> 16);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+
+        retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_METER_IFG_CTRL2 + ((index - 32) >> 4), RTL8367C_METER_IFG_OFFSET(index), ifg);
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicAclIpRange
+ *      rtl8367c_setAsicShareMeterType
  * Description:
- *      Set ACL IP range check
+ *      Set meter Type
  * Input:
- *      index       - ACL IP range check index(0~15)
- *      type        - Range check type
- *      upperIp     - IP range upper bound
- *      lowerIp     - IP range lower bound
+ *      index       - shared meter index (0-31)
+ *      Type        - 0: kbps, 1: pps
  * Output:
  *      None
  * Return:
  *      RT_ERR_OK               - Success
  *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL IP range check index(0~15)
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicAclIpRange(uint32_t index, uint32_t type, uint32_t upperIp, uint32_t lowerIp)
+int32_t rtl8367::rtl8367c_setAsicShareMeterType(uint32_t index, uint32_t type)
 {
-    int32_t retVal;
-    uint32_t regData;
-    uint32_t ipData;
-
-    if (index > RTL8367C_ACLRANGEMAX)
-        return RT_ERR_OUT_OF_RANGE;
-
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL4 + index * 5, RTL8367C_ACL_IP_RANGE_ENTRY0_CTRL4_MASK, type);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    uint32_t reg;
 
-    ipData = upperIp;
+    if (index > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-    regData = ipData & 0xFFFF;
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL2 + index * 5, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (index < 32)
+        reg = RTL8367C_REG_METER_MODE_SETTING0 + (index / 16);
+    else
+        reg = RTL8367C_REG_METER_MODE_SETTING2 + ((index - 32) / 16);
+    return rtl8367c_setAsicRegBit(reg, index % 16, type);
+}
+int32_t rtl8367::rtk_rate_shareMeter_set(uint32_t index, rtk_meter_type_t type, uint32_t rate, rtk_enable_t ifg_include)
+{
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-    regData = (ipData >> 16) & 0xFFFF;
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL3 + index * 5, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (index > halCtrl.max_meter_id)
+        return RT_ERR_FILTER_METER_ID;
 
-    ipData = lowerIp;
+    if (type >= METER_TYPE_END)
+        return RT_ERR_INPUT;
 
-    regData = ipData & 0xFFFF;
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL0 + index * 5, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (ifg_include >= RTK_ENABLE_END)
+        return RT_ERR_INPUT;
 
-    regData = (ipData >> 16) & 0xFFFF;
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_IP_RANGE_ENTRY0_CTRL1 + index * 5, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    switch (type)
+    {
+    case METER_TYPE_KBPS:
+        if (rate > RTL8367C_QOS_RATE_INPUT_MAX_HSG || rate < RTL8367C_QOS_RATE_INPUT_MIN)
+            return RT_ERR_RATE;
 
-    return RT_ERR_OK;
-}
-int32_t rtl8367::rtk_filter_iprange_set(uint32_t index, rtk_filter_iprange_t type, uint32_t upperIp, uint32_t lowerIp)
-{
-    int32_t ret;
+        if ((retVal = rtl8367c_setAsicShareMeter(index, rate >> 3, ifg_include)) != RT_ERR_OK)
+            return retVal;
 
-    if (index > RTL8367C_ACLRANGEMAX)
-        return RT_ERR_OUT_OF_RANGE;
+        break;
+    case METER_TYPE_PPS:
+        if (rate > RTL8367C_QOS_PPS_INPUT_MAX || rate < RTL8367C_QOS_PPS_INPUT_MIN)
+            return RT_ERR_RATE;
 
-    if (type >= IPRANGE_END)
-        return RT_ERR_OUT_OF_RANGE;
+        if ((retVal = rtl8367c_setAsicShareMeter(index, rate, ifg_include)) != RT_ERR_OK)
+            return retVal;
 
-    if (lowerIp > upperIp)
+        break;
+    default:
         return RT_ERR_INPUT;
+    }
 
-    if ((ret = rtl8367c_setAsicAclIpRange(index, type, upperIp, lowerIp)) != RT_ERR_OK)
-        return ret;
+    /* Set Type */
+    if ((retVal = rtl8367c_setAsicShareMeterType(index, (uint32_t)type)) != RT_ERR_OK)
+        return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicAclVidRange
+ *      rtl8367c_getAsicShareMeter
  * Description:
- *      Set ACL VID range check
+ *      Get meter configuration
  * Input:
- *      index       - ACL VID range check index(0~15)
- *      type        - Range check type
- *      upperVid    - VID range upper bound
- *      lowerVid    - VID range lower bound
+ *      index   - hared meter index (0-31)
+ *      pRate   - 17-bits rate of share meter, unit is 8Kpbs
+ *      pIfg    - Including IFG in rate calculation, 1:include 0:exclude
  * Output:
  *      None
  * Return:
  *      RT_ERR_OK               - Success
  *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid ACL  VID range check index(0~15)
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicAclVidRange(uint32_t index, uint32_t type, uint32_t upperVid, uint32_t lowerVid)
+int32_t rtl8367::rtl8367c_getAsicShareMeter(uint32_t index, uint32_t *pRate, uint32_t *pIfg)
 {
-    int32_t retVal;
     uint32_t regData;
+    uint32_t regData2;
+    int32_t retVal;
 
-    if (index > RTL8367C_ACLRANGEMAX)
-        return RT_ERR_OUT_OF_RANGE;
-
-    regData = ((type << RTL8367C_ACL_VID_RANGE_ENTRY0_CTRL1_CHECK0_TYPE_OFFSET) & RTL8367C_ACL_VID_RANGE_ENTRY0_CTRL1_CHECK0_TYPE_MASK) |
-              (upperVid & RTL8367C_ACL_VID_RANGE_ENTRY0_CTRL1_CHECK0_HIGH_MASK);
-
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_VID_RANGE_ENTRY0_CTRL1 + index * 2, regData);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_VID_RANGE_ENTRY0_CTRL0 + index * 2, lowerVid);
-    if (retVal != RT_ERR_OK)
-        return retVal;
-
-    return RT_ERR_OK;
-}
-
-int32_t rtl8367::rtk_filter_vidrange_set(uint32_t index, rtk_filter_vidrange_t type, uint32_t upperVid, uint32_t lowerVid)
-{
-    int32_t ret;
+    if (index > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-    if (index > RTL8367C_ACLRANGEMAX)
-        return RT_ERR_OUT_OF_RANGE;
+    if (index < 32)
+    {
+        /*17-bits Rate*/
+        retVal = rtl8367c_getAsicReg(RTL8367C_METER_RATE_REG(index), &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    if (type >= VIDRANGE_END)
-        return RT_ERR_OUT_OF_RANGE;
+        retVal = rtl8367c_getAsicReg(RTL8367C_METER_RATE_REG(index) + 1, &regData2);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    if (lowerVid > upperVid)
-        return RT_ERR_INPUT;
+        *pRate = ((regData2 << 16) & 0x70000) | regData;
+        /*IFG*/
+        retVal = rtl8367c_getAsicRegBit(RTL8367C_METER_IFG_CTRL_REG(index), RTL8367C_METER_IFG_OFFSET(index), pIfg);
 
-    if ((upperVid > RTL8367C_VIDMAX) || (lowerVid > RTL8367C_VIDMAX))
-        return RT_ERR_OUT_OF_RANGE;
+        return retVal;
+    }
+    else
+    {
+        /*17-bits Rate*/
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_METER32_RATE_CTRL0 + ((index - 32) << 1), &regData);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    if ((ret = rtl8367c_setAsicAclVidRange(index, type, upperVid, lowerVid)) != RT_ERR_OK)
-        return ret;
+        retVal = rtl8367c_getAsicReg(RTL8367C_REG_METER32_RATE_CTRL0 + ((index - 32) << 1) + 1, &regData2);
+        if (retVal != RT_ERR_OK)
+            return retVal;
 
-    return RT_ERR_OK;
-}
+        *pRate = ((regData2 << 16) & 0x70000) | regData;
+        /*IFG*/
+        retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_METER_IFG_CTRL2 + ((index - 32) >> 4), RTL8367C_METER_IFG_OFFSET(index), pIfg);
 
+        return retVal;
+    }
+}
 /* Function Name:
- *      rtl8367c_setAsicAclPortRange
+ *      rtl8367c_getAsicShareMeterType
  * Description:
- *      Set ACL TCP/UDP range check
+ *      Get meter Type
  * Input:
- *      index       - TCP/UDP port range check table index
- *      type        - Range check type
- *      upperPort   - TCP/UDP port range upper bound
- *      lowerPort   - TCP/UDP port range lower bound
+ *      index       - shared meter index (0-31)
  * Output:
- *      None
+ *      pType       - 0: kbps, 1: pps
  * Return:
  *      RT_ERR_OK               - Success
  *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_OUT_OF_RANGE     - Invalid TCP/UDP port range check table index
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicAclPortRange(uint32_t index, uint32_t type, uint32_t upperPort, uint32_t lowerPort)
+int32_t rtl8367::rtl8367c_getAsicShareMeterType(uint32_t index, uint32_t *pType)
 {
-    int32_t retVal;
-
-    if (index > RTL8367C_ACLRANGEMAX)
-        return RT_ERR_OUT_OF_RANGE;
-
-    retVal = rtl8367c_setAsicRegBits(RTL8367C_REG_ACL_SDPORT_RANGE_ENTRY0_CTRL2 + index * 3, RTL8367C_ACL_SDPORT_RANGE_ENTRY0_CTRL2_MASK, type);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    uint32_t reg;
 
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_SDPORT_RANGE_ENTRY0_CTRL1 + index * 3, upperPort);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (index > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-    retVal = rtl8367c_setAsicReg(RTL8367C_REG_ACL_SDPORT_RANGE_ENTRY0_CTRL0 + index * 3, lowerPort);
-    if (retVal != RT_ERR_OK)
-        return retVal;
+    if (NULL == pType)
+        return RT_ERR_NULL_POINTER;
 
-    return RT_ERR_OK;
+    if (index < 32)
+        reg = RTL8367C_REG_METER_MODE_SETTING0 + (index / 16);
+    else
+        reg = RTL8367C_REG_METER_MODE_SETTING2 + ((index - 32) / 16);
+    return rtl8367c_getAsicRegBit(reg, index % 16, pType);
 }
-
-int32_t rtl8367::rtk_filter_portrange_set(uint32_t index, rtk_filter_portrange_t type, uint32_t upperPort, uint32_t lowerPort)
+int32_t rtl8367::rtk_rate_shareMeter_get(uint32_t index, rtk_meter_type_t *pType, uint32_t *pRate, rtk_enable_t *pIfg_include)
 {
-    int32_t ret;
-
-    if (index > RTL8367C_ACLRANGEMAX)
-        return RT_ERR_OUT_OF_RANGE;
-
-    if (type >= PORTRANGE_END)
-        return RT_ERR_OUT_OF_RANGE;
-
-    if (lowerPort > upperPort)
-        return RT_ERR_INPUT;
-
-    if (upperPort > RTL8367C_ACL_PORTRANGEMAX)
-        return RT_ERR_INPUT;
-
-    if (lowerPort > RTL8367C_ACL_PORTRANGEMAX)
-        return RT_ERR_INPUT;
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
+    uint32_t regData;
 
-    if ((ret = rtl8367c_setAsicAclPortRange(index, type, upperPort, lowerPort)) != RT_ERR_OK)
-        return ret;
+    if (index > halCtrl.max_meter_id)
+        return RT_ERR_FILTER_METER_ID;
 
-    return RT_ERR_OK;
-}
+    if (NULL == pType)
+        return RT_ERR_NULL_POINTER;
 
-// ------------------------- EEE ---------------------------------
+    if (NULL == pRate)
+        return RT_ERR_NULL_POINTER;
 
-int32_t rtl8367::rtk_eee_init()
-{
-    int32_t retVal;
+    if (NULL == pIfg_include)
+        return RT_ERR_NULL_POINTER;
 
-    if ((retVal = rtl8367c_setAsicRegBit(0x0018, 10, 1)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicShareMeter(index, &regData, (uint32_t *)pIfg_include)) != RT_ERR_OK)
         return retVal;
 
-    if ((retVal = rtl8367c_setAsicRegBit(0x0018, 11, 1)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicShareMeterType(index, (uint32_t *)pType)) != RT_ERR_OK)
         return retVal;
 
+    if (*pType == METER_TYPE_KBPS)
+        *pRate = regData << 3;
+    else
+        *pRate = regData;
+
     return RT_ERR_OK;
 }
 
-/*
-@func int32_t | rtl8367c_setAsicEee100M | Set eee force mode function enable/disable.
-@parm uint32_t | port | The port number.
-@parm uint32_t | enabled | 1: enabled, 0: disabled.
-@rvalue RT_ERR_OK | Success.
-@rvalue RT_ERR_SMI | SMI access error.
-@rvalue RT_ERR_INPUT | Invalid input parameter.
-@comm
-    This API set the 100M EEE enable function.
-
-*/
-int32_t rtl8367::rtl8367c_setAsicEee100M(uint32_t port, uint32_t enable)
+/* Function Name:
+ *      rtl8367c_setAsicShareMeterBucketSize
+ * Description:
+ *      Set meter related leaky bucket threshold
+ * Input:
+ *      index       - hared meter index (0-31)
+ *      lbthreshold - Leaky bucket threshold of meter
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_setAsicShareMeterBucketSize(uint32_t index, uint32_t lbthreshold)
 {
-    int32_t retVal;
-    uint32_t regData;
 
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    if (enable > 1)
-        return RT_ERR_INPUT;
-
-    if ((retVal = rtl8367c_getAsicPHYOCPReg(port, EEE_OCP_PHY_ADDR, &regData)) != RT_ERR_OK)
-        return retVal;
+    if (index > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-    if (enable)
-        regData |= (0x0001 << 1);
+    if (index < 32)
+        return rtl8367c_setAsicReg(RTL8367C_METER_BUCKET_SIZE_REG(index), lbthreshold);
     else
-        regData &= ~(0x0001 << 1);
-
-    if ((retVal = rtl8367c_setAsicPHYOCPReg(port, EEE_OCP_PHY_ADDR, regData)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_getAsicReg(RTL8367C_PORT_EEE_CFG_REG(port), &regData)) != RT_ERR_OK)
-        return retVal;
+        return rtl8367c_setAsicReg(RTL8367C_REG_METER32_BUCKET_SIZE + index - 32, lbthreshold);
+}
+/* Function Name:
+ *      rtl8367c_getAsicShareMeterBucketSize
+ * Description:
+ *      Get meter related leaky bucket threshold
+ * Input:
+ *      index       - hared meter index (0-31)
+ *      pLbthreshold - Leaky bucket threshold of meter
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicShareMeterBucketSize(uint32_t index, uint32_t *pLbthreshold)
+{
+    if (index > RTL8367C_METERMAX)
+        return RT_ERR_FILTER_METER_ID;
 
-    if (enable)
-        regData |= (0x0001 << 11);
+    if (index < 32)
+        return rtl8367c_getAsicReg(RTL8367C_METER_BUCKET_SIZE_REG(index), pLbthreshold);
     else
-        regData &= ~(0x0001 << 11);
-
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_PORT_EEE_CFG_REG(port), regData)) != RT_ERR_OK)
-        return retVal;
-
-    return RT_ERR_OK;
+        return rtl8367c_getAsicReg(RTL8367C_REG_METER32_BUCKET_SIZE + index - 32, pLbthreshold);
 }
-
-/*
-@func int32_t | rtl8367c_setAsicEeeGiga | Set eee force mode function enable/disable.
-@parm uint32_t | port | The port number.
-@parm uint32_t | enabled | 1: enabled, 0: disabled.
-@rvalue RT_ERR_OK | Success.
-@rvalue RT_ERR_SMI | SMI access error.
-@rvalue RT_ERR_INPUT | Invalid input parameter.
-@comm
-    This API set the 100M EEE enable function.
-
-*/
-int32_t rtl8367::rtl8367c_setAsicEeeGiga(uint32_t port, uint32_t enable)
+int32_t rtl8367::rtk_rate_shareMeterBucket_set(uint32_t index, uint32_t bucket_size)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t regData;
 
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    if (index > halCtrl.max_meter_id)
+        return RT_ERR_FILTER_METER_ID;
 
-    if (enable > 1)
+    if (bucket_size > RTL8367C_METERBUCKETSIZEMAX)
         return RT_ERR_INPUT;
 
-    if ((retVal = rtl8367c_getAsicPHYOCPReg(port, EEE_OCP_PHY_ADDR, &regData)) != RT_ERR_OK)
-        return retVal;
-
-    if (enable)
-        regData |= (0x0001 << 2);
-    else
-        regData &= ~(0x0001 << 2);
-
-    if ((retVal = rtl8367c_setAsicPHYOCPReg(port, EEE_OCP_PHY_ADDR, regData)) != RT_ERR_OK)
-        return retVal;
-
-    if ((retVal = rtl8367c_getAsicReg(RTL8367C_PORT_EEE_CFG_REG(port), &regData)) != RT_ERR_OK)
-        return retVal;
-
-    if (enable)
-        regData |= (0x0001 << 10);
-    else
-        regData &= ~(0x0001 << 10);
-
-    if ((retVal = rtl8367c_setAsicReg(RTL8367C_PORT_EEE_CFG_REG(port), regData)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_setAsicShareMeterBucketSize(index, bucket_size)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_eee_portEnable_set(rtk_port_t port, rtk_enable_t enable)
+int32_t rtl8367::rtk_rate_shareMeterBucket_get(uint32_t index, uint32_t *pBucket_size)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t regData;
-    uint32_t phy_port;
-
-    /* Check port is UTP port */
-    RTK_CHK_PORT_IS_UTP(port);
-
-    if (enable >= RTK_ENABLE_END)
-        return RT_ERR_INPUT;
 
-    phy_port = rtk_switch_port_L2P_get(port);
+    if (index > halCtrl.max_meter_id)
+        return RT_ERR_FILTER_METER_ID;
 
-    if ((retVal = rtl8367c_setAsicEee100M(phy_port, enable)) != RT_ERR_OK)
-        return retVal;
-    if ((retVal = rtl8367c_setAsicEeeGiga(phy_port, enable)) != RT_ERR_OK)
-        return retVal;
+    if (NULL == pBucket_size)
+        return RT_ERR_NULL_POINTER;
 
-    if ((retVal = rtl8367c_setAsicPHYReg(phy_port, RTL8367C_PHY_PAGE_ADDRESS, 0)) != RT_ERR_OK)
-        return retVal;
-    if ((retVal = rtl8367c_getAsicPHYReg(phy_port, 0, &regData)) != RT_ERR_OK)
-        return retVal;
-    regData |= 0x0200;
-    if ((retVal = rtl8367c_setAsicPHYReg(phy_port, 0, regData)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_getAsicShareMeterBucketSize(index, pBucket_size)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
-// ------------------------ 802.1X --------------------------------
+// ------------------------- BANDWIDTH CONTROL ---------------------------------
 
-int32_t rtl8367::rtk_dot1x_eapolFrame2CpuEnable_set(rtk_enable_t enable)
+/* Function Name:
+ *      rtl8367c_setAsicPortIngressBandwidth
+ * Description:
+ *      Set per-port total ingress bandwidth
+ * Input:
+ *      port        - Physical port number (0~10)
+ *      bandwidth   - The total ingress bandwidth (unit: 8Kbps), 0x7FFFF:disable
+ *      preifg      - Include preamble and IFG, 0:Exclude, 1:Include
+ *      enableFC    - Action when input rate exceeds. 0: Drop   1: Flow Control
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_OUT_OF_RANGE - input parameter out of range
+ * Note:
+ *      The three rate MSB bits share their register with a dummy field and
+ *      the IFG/flow control bits live in PORT_MISC_CFG, both are updated with
+ *      a read-modify-write.
+ */
+int32_t rtl8367::rtl8367c_setAsicPortIngressBandwidth(uint32_t port, uint32_t bandwidth, uint32_t preifg, uint32_t enableFC)
 {
     int32_t retVal;
-    rtl8367c_rma_t rmacfg;
+    uint32_t regData;
+    uint32_t regAddr;
 
-    if (enable >= RTK_ENABLE_END)
-        return RT_ERR_ENABLE;
+    if (port >= RTL8367C_PORTNO)
+        return RT_ERR_PORT_ID;
 
-    if ((retVal = rtl8367c_getAsicRma(3, &rmacfg)) != RT_ERR_OK)
+    if (bandwidth > RTL8367C_QOS_GRANULARTY_MAX)
+        return RT_ERR_OUT_OF_RANGE;
+
+    regAddr = RTL8367C_INGRESSBW_PORT_RATE_LSB_REG(port);
+    regData = bandwidth & RTL8367C_QOS_GRANULARTY_LSB_MASK;
+    retVal = rtl8367c_setAsicReg(regAddr, regData);
+    if (retVal != RT_ERR_OK)
         return retVal;
 
-    if (ENABLED == enable)
-        rmacfg.operation = RMAOP_TRAP_TO_CPU;
-    else if (DISABLED == enable)
-        rmacfg.operation = RMAOP_FORWARD;
+    regAddr += 1;
+    regData = (bandwidth & RTL8367C_QOS_GRANULARTY_MSB_MASK) >> RTL8367C_QOS_GRANULARTY_MSB_OFFSET;
+    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_INGRESSBW_PORT0_RATE_CTRL1_INGRESSBW_RATE16_MASK, regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-    if ((retVal = rtl8367c_setAsicRma(3, &rmacfg)) != RT_ERR_OK)
+    /* IFG (bit 10) and flow control (bit 11) are adjacent, update both in one pass */
+    regAddr = RTL8367C_PORT_MISC_CFG_REG(port);
+    regData = (preifg ? 1 : 0) | (enableFC ? 2 : 0);
+    retVal = rtl8367c_setAsicRegBits(regAddr, RTL8367C_PORT0_MISC_CFG_INGRESSBW_IFG_MASK | RTL8367C_PORT0_MISC_CFG_INGRESSBW_FLOWCTRL_MASK, regData);
+    if (retVal != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsic1xPBEnConfig
+ *      rtl8367c_getAsicPortIngressBandwidth
  * Description:
- *      Set 802.1x port-based port enable configuration
+ *      Get per-port total ingress bandwidth
  * Input:
- *      port    - Physical port number (0~7)
- *      enabled - 1: enabled, 0: disabled
+ *      port        - Physical port number (0~10)
  * Output:
- *      None
+ *      pBandwidth  - The total ingress bandwidth (unit: 8Kbps), 0x7FFFF:disable
+ *      pPreifg     - Include preamble and IFG, 0:Exclude, 1:Include
+ *      pEnableFC   - Action when input rate exceeds. 0: Drop   1: Flow Control
  * Return:
  *      RT_ERR_OK       - Success
  *      RT_ERR_SMI      - SMI access error
@@ -13982,77 +19837,83 @@ int32_t rtl8367::rtk_dot1x_eapolFrame2CpuEnable_set(rtk_enable_t enable)
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsic1xPBEnConfig(uint32_t port, uint32_t enabled)
+int32_t rtl8367::rtl8367c_getAsicPortIngressBandwidth(uint32_t port, uint32_t *pBandwidth, uint32_t *pPreifg, uint32_t *pEnableFC)
 {
+    int32_t retVal;
+    uint32_t regData;
+    uint32_t regAddr;
+
     if (port >= RTL8367C_PORTNO)
         return RT_ERR_PORT_ID;
 
-    return rtl8367c_setAsicRegBit(RTL8367C_DOT1X_PORT_ENABLE_REG, port, enabled);
-}
-int32_t rtl8367::rtk_dot1x_portBasedEnable_set(rtk_port_t port, rtk_enable_t enable)
-{
-    int32_t retVal;
+    regAddr = RTL8367C_INGRESSBW_PORT_RATE_LSB_REG(port);
+    retVal = rtl8367c_getAsicReg(regAddr, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-    /* Check port Valid */
-    RTK_CHK_PORT_VALID(port);
+    *pBandwidth = regData;
 
-    if (enable >= RTK_ENABLE_END)
-        return RT_ERR_ENABLE;
+    regAddr += 1;
+    retVal = rtl8367c_getAsicRegBits(regAddr, RTL8367C_INGRESSBW_PORT0_RATE_CTRL1_INGRESSBW_RATE16_MASK, &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-    if ((retVal = rtl8367c_setAsic1xPBEnConfig(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
+    *pBandwidth |= (regData << RTL8367C_QOS_GRANULARTY_MSB_OFFSET);
+
+    /* IFG and flow control sit in one register, read it once */
+    retVal = rtl8367c_getAsicReg(RTL8367C_PORT_MISC_CFG_REG(port), &regData);
+    if (retVal != RT_ERR_OK)
         return retVal;
 
+    *pPreifg = (regData & RTL8367C_PORT0_MISC_CFG_INGRESSBW_IFG_MASK) >> RTL8367C_PORT0_MISC_CFG_INGRESSBW_IFG_OFFSET;
+    *pEnableFC = (regData & RTL8367C_PORT0_MISC_CFG_INGRESSBW_FLOWCTRL_MASK) >> RTL8367C_PORT0_MISC_CFG_INGRESSBW_FLOWCTRL_OFFSET;
+
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsic1xPBAuthConfig
+ *      rtl8367c_setAsicPortEgressRate
  * Description:
- *      Set 802.1x port-based authorised port configuration
+ *      Set per-port egress rate
  * Input:
- *      port    - Physical port number (0~7)
- *      auth    - 1: authorised, 0: non-authorised
+ *      port    - Physical port number (0~10)
+ *      rate    - Egress rate (unit: 8Kbps)
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK       - Success
- *      RT_ERR_SMI      - SMI access error
- *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_OK           - Success
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_QOS_EBW_RATE - Invalid bandwidth/rate
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsic1xPBAuthConfig(uint32_t port, uint32_t auth)
-{
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    return rtl8367c_setAsicRegBit(RTL8367C_DOT1X_PORT_AUTH_REG, port, auth);
-}
-int32_t rtl8367::rtk_dot1x_portBasedAuthStatus_set(rtk_port_t port, rtk_dot1x_auth_status_t port_auth)
+int32_t rtl8367::rtl8367c_setAsicPortEgressRate(uint32_t port, uint32_t rate)
 {
     int32_t retVal;
 
-    /* Check port Valid */
-    RTK_CHK_PORT_VALID(port);
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    if (port_auth >= AUTH_STATUS_END)
-        return RT_ERR_DOT1X_PORTBASEDAUTH;
+    if (rate > RTL8367C_QOS_GRANULARTY_MAX)
+        return RT_ERR_QOS_EBW_RATE;
 
-    if ((retVal = rtl8367c_setAsic1xPBAuthConfig(rtk_switch_port_L2P_get(port), port_auth)) != RT_ERR_OK)
+    retVal = rtl8367c_setAsicReg(RTL8367C_PORT_EGRESSBW_LSB_REG(port), rate & RTL8367C_QOS_GRANULARTY_LSB_MASK);
+    if (retVal != RT_ERR_OK)
         return retVal;
 
-    return RT_ERR_OK;
+    return rtl8367c_setAsicRegBits(RTL8367C_PORT_EGRESSBW_MSB_REG(port), RTL8367C_PORT6_EGRESSBW_CTRL1_MASK,
+                                   (rate & RTL8367C_QOS_GRANULARTY_MSB_MASK) >> RTL8367C_QOS_GRANULARTY_MSB_OFFSET);
 }
 
 /* Function Name:
- *      rtl8367c_setAsic1xPBOpdirConfig
+ *      rtl8367c_getAsicPortEgressRate
  * Description:
- *      Set 802.1x port-based operational direction
+ *      Get per-port egress rate
  * Input:
- *      port    - Physical port number (0~7)
- *      opdir   - Operation direction 1: IN, 0:BOTH
+ *      port    - Physical port number (0~10)
  * Output:
- *      None
+ *      pRate   - Egress rate (unit: 8Kbps)
  * Return:
  *      RT_ERR_OK       - Success
  *      RT_ERR_SMI      - SMI access error
@@ -14060,415 +19921,515 @@ int32_t rtl8367::rtk_dot1x_portBasedAuthStatus_set(rtk_port_t port, rtk_dot1x_au
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsic1xPBOpdirConfig(uint32_t port, uint32_t opdir)
-{
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
-
-    return rtl8367c_setAsicRegBit(RTL8367C_DOT1X_PORT_OPDIR_REG, port, opdir);
-}
-int32_t rtl8367::rtk_dot1x_portBasedDirection_set(rtk_port_t port, rtk_dot1x_direction_t port_direction)
+int32_t rtl8367::rtl8367c_getAsicPortEgressRate(uint32_t port, uint32_t *pRate)
 {
     int32_t retVal;
+    uint32_t regData;
+    uint32_t regData2;
 
-    /* Check port Valid */
-    RTK_CHK_PORT_VALID(port);
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    if (port_direction >= DIRECTION_END)
-        return RT_ERR_DOT1X_PORTBASEDOPDIR;
+    retVal = rtl8367c_getAsicReg(RTL8367C_PORT_EGRESSBW_LSB_REG(port), &regData);
+    if (retVal != RT_ERR_OK)
+        return retVal;
 
-    if ((retVal = rtl8367c_setAsic1xPBOpdirConfig(rtk_switch_port_L2P_get(port), port_direction)) != RT_ERR_OK)
+    retVal = rtl8367c_getAsicRegBits(RTL8367C_PORT_EGRESSBW_MSB_REG(port), RTL8367C_PORT6_EGRESSBW_CTRL1_MASK, &regData2);
+    if (retVal != RT_ERR_OK)
         return retVal;
 
+    *pRate = regData | (regData2 << RTL8367C_QOS_GRANULARTY_MSB_OFFSET);
+
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsic1xProcConfig
+ *      rtk_rate_igrBandwidthCtrlRate_set
  * Description:
- *      Set 802.1x unauth. behavior configuration
+ *      Set port ingress bandwidth control
  * Input:
- *      port    - Physical port number (0~7)
- *      proc    - 802.1x unauth. behavior configuration 0:drop 1:trap to CPU 2:Guest VLAN
+ *      port        - Port id
+ *      rate        - Rate of share meter (unit: Kbps)
+ *      ifg_include - Include IFG or not, ENABLE:include DISABLE:exclude
+ *      fc_enable   - Enable flow control or not, ENABLE:use flow control DISABLE:drop
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK           - Success
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
  *      RT_ERR_SMI          - SMI access error
- *      RT_ERR_PORT_ID      - Invalid port number
- *      RT_ERR_DOT1X_PROC   - Unauthorized behavior error
+ *      RT_ERR_PORT_ID      - Invalid port number.
+ *      RT_ERR_ENABLE       - Invalid IFG parameter.
+ *      RT_ERR_INBW_RATE    - Invalid ingress rate parameter.
  * Note:
- *      None
+ *      The rate unit is 1 kbps and the range is from 8k to 1048568k (8k to
+ *      4194296k on the HSG port), rounded down to the 8 kbps granularity.
+ *      A rate of RTL8367C_QOS_RATE_INPUT_MAX (RTL8367C_QOS_RATE_INPUT_MAX_HSG
+ *      on the HSG port) disables the limit.
+ *      With fc_enable the port sends PAUSE frames instead of dropping once
+ *      the rate is exceeded.
  */
-int32_t rtl8367::rtl8367c_setAsic1xProcConfig(uint32_t port, uint32_t proc)
+int32_t rtl8367::rtk_rate_igrBandwidthCtrlRate_set(rtk_port_t port, uint32_t rate, rtk_enable_t ifg_include, rtk_enable_t fc_enable)
 {
-    if (port >= RTL8367C_PORTNO)
-        return RT_ERR_PORT_ID;
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-    if (proc >= DOT1X_UNAUTH_END)
-        return RT_ERR_DOT1X_PROC;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if (port < 8)
+    if (ifg_include >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
+
+    if (fc_enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
+
+    if (rtk_switch_isHsgPort(port) == RT_ERR_OK)
     {
-        return rtl8367c_setAsicRegBits(RTL8367C_DOT1X_UNAUTH_ACT_BASE, RTL8367C_DOT1X_UNAUTH_ACT_MASK(port), proc);
+        if ((rate > RTL8367C_QOS_RATE_INPUT_MAX_HSG) || (rate < RTL8367C_QOS_RATE_INPUT_MIN))
+            return RT_ERR_INBW_RATE;
     }
     else
     {
-        return rtl8367c_setAsicRegBits(RTL8367C_REG_DOT1X_UNAUTH_ACT_W1, RTL8367C_DOT1X_UNAUTH_ACT_MASK(port), proc);
+        if ((rate > RTL8367C_QOS_RATE_INPUT_MAX) || (rate < RTL8367C_QOS_RATE_INPUT_MIN))
+            return RT_ERR_INBW_RATE;
     }
+
+    if ((retVal = rtl8367c_setAsicPortIngressBandwidth(rtk_switch_port_L2P_get(port), rate >> 3, ifg_include, fc_enable)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
 }
-int32_t rtl8367::rtk_dot1x_unauthPacketOper_set(rtk_port_t port, rtk_dot1x_unauth_action_t unauth_action)
+
+/* Function Name:
+ *      rtk_rate_igrBandwidthCtrlRate_get
+ * Description:
+ *      Get port ingress bandwidth control
+ * Input:
+ *      port - Port id
+ * Output:
+ *      pRate           - Rate of share meter (unit: Kbps)
+ *      pIfg_include    - Rate's calculation including IFG, ENABLE:include DISABLE:exclude
+ *      pFc_enable      - Enable flow control or not, ENABLE:use flow control DISABLE:drop
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number.
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_rate_igrBandwidthCtrlRate_get(rtk_port_t port, uint32_t *pRate, rtk_enable_t *pIfg_include, rtk_enable_t *pFc_enable)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t regData;
 
-    /* Check port Valid */
+    /* Check Port Valid */
     RTK_CHK_PORT_VALID(port);
 
-    if (unauth_action >= DOT1X_ACTION_END)
-        return RT_ERR_DOT1X_PROC;
+    if (NULL == pRate)
+        return RT_ERR_NULL_POINTER;
 
-    if ((retVal = rtl8367c_setAsic1xProcConfig(rtk_switch_port_L2P_get(port), unauth_action)) != RT_ERR_OK)
+    if (NULL == pIfg_include)
+        return RT_ERR_NULL_POINTER;
+
+    if (NULL == pFc_enable)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicPortIngressBandwidth(rtk_switch_port_L2P_get(port), &regData, (uint32_t *)pIfg_include, (uint32_t *)pFc_enable)) != RT_ERR_OK)
         return retVal;
 
+    *pRate = regData << 3;
+
     return RT_ERR_OK;
 }
 
-// ------------------------- SHARE METER ---------------------------------
-
 /* Function Name:
- *      rtl8367c_setAsicShareMeter
+ *      rtk_rate_egrBandwidthCtrlRate_set
  * Description:
- *      Set meter configuration
+ *      Set port egress bandwidth control
  * Input:
- *      index   - hared meter index (0-31)
- *      rate    - 17-bits rate of share meter, unit is 8Kpbs
- *      ifg     - Including IFG in rate calculation, 1:include 0:exclude
+ *      port        - Port id
+ *      rate        - Rate of egress bandwidth (unit: Kbps)
+ *      ifg_include - Include IFG or not, ENABLE:include DISABLE:exclude
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number.
+ *      RT_ERR_ENABLE       - Invalid IFG parameter.
+ *      RT_ERR_QOS_EBW_RATE - Invalid egress rate parameter.
  * Note:
- *      None
+ *      The rate unit is 1 kbps and the range is from 8k to 1048568k (8k to
+ *      4194296k on the HSG port), rounded down to the 8 kbps granularity.
+ *      The egress scheduler has a single IFG setting, so ifg_include applies
+ *      to the egress limit of every port.
  */
-int32_t rtl8367::rtl8367c_setAsicShareMeter(uint32_t index, uint32_t rate, uint32_t ifg)
+int32_t rtl8367::rtk_rate_egrBandwidthCtrlRate_set(rtk_port_t port, uint32_t rate, rtk_enable_t ifg_include)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
-    if (index > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if (index < 32)
+    if (rtk_switch_isHsgPort(port) == RT_ERR_OK)
     {
-        /*19-bits Rate*/
-        retVal = rtl8367c_setAsicReg(RTL8367C_METER_RATE_REG(index), rate & 0xFFFF);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-
-        retVal = rtl8367c_setAsicReg(RTL8367C_METER_RATE_REG(index) + 1, (rate & 0x70000) >> 16);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-
-        retVal = rtl8367c_setAsicRegBit(RTL8367C_METER_IFG_CTRL_REG(index), RTL8367C_METER_IFG_OFFSET(index), ifg);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+        if ((rate > RTL8367C_QOS_RATE_INPUT_MAX_HSG) || (rate < RTL8367C_QOS_RATE_INPUT_MIN))
+            return RT_ERR_QOS_EBW_RATE;
     }
     else
     {
-        /*19-bits Rate*/
-        retVal = rtl8367c_setAsicReg(RTL8367C_REG_METER32_RATE_CTRL0 + ((index - 32) << 1), rate & 0xFFFF);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+        if ((rate > RTL8367C_QOS_RATE_INPUT_MAX) || (rate < RTL8367C_QOS_RATE_INPUT_MIN))
+            return RT_ERR_QOS_EBW_RATE;
+    }
 
-        retVal = rtl8367c_setAsicReg(RTL8367C_REG_METER32_RATE_CTRL0 + ((index - 32) << 1) + 1, (rate & 0x70000) >> 16);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+    if (ifg_include >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
 
-        retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_METER_IFG_CTRL2 + ((index - 32) >> 4), RTL8367C_METER_IFG_OFFSET(index), ifg);
-        if (retVal != RT_ERR_OK)
-            return retVal;
-    }
+    if ((retVal = rtl8367c_setAsicPortEgressRate(rtk_switch_port_L2P_get(port), rate >> 3)) != RT_ERR_OK)
+        return retVal;
+
+    if ((retVal = rtl8367c_setAsicRegBit(RTL8367C_REG_SCHEDULE_WFQ_CTRL, RTL8367C_SCHEDULE_WFQ_CTRL_OFFSET, ifg_include)) != RT_ERR_OK)
+        return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicShareMeterType
+ *      rtk_rate_egrBandwidthCtrlRate_get
  * Description:
- *      Set meter Type
+ *      Get port egress bandwidth control
  * Input:
- *      index       - shared meter index (0-31)
- *      Type        - 0: kbps, 1: pps
+ *      port - Port id
  * Output:
- *      None
+ *      pRate           - Rate of egress bandwidth (unit: Kbps)
+ *      pIfg_include    - Rate's calculation including IFG, ENABLE:include DISABLE:exclude
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number.
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicShareMeterType(uint32_t index, uint32_t type)
-{
-    uint32_t reg;
-
-    if (index > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
-
-    if (index < 32)
-        reg = RTL8367C_REG_METER_MODE_SETTING0 + (index / 16);
-    else
-        reg = RTL8367C_REG_METER_MODE_SETTING2 + ((index - 32) / 16);
-    return rtl8367c_setAsicRegBit(reg, index % 16, type);
-}
-int32_t rtl8367::rtk_rate_shareMeter_set(uint32_t index, rtk_meter_type_t type, uint32_t rate, rtk_enable_t ifg_include)
+int32_t rtl8367::rtk_rate_egrBandwidthCtrlRate_get(rtk_port_t port, uint32_t *pRate, rtk_enable_t *pIfg_include)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t regData;
 
-    if (index > halCtrl.max_meter_id)
-        return RT_ERR_FILTER_METER_ID;
-
-    if (type >= METER_TYPE_END)
-        return RT_ERR_INPUT;
-
-    if (ifg_include >= RTK_ENABLE_END)
-        return RT_ERR_INPUT;
-
-    switch (type)
-    {
-    case METER_TYPE_KBPS:
-        if (rate > RTL8367C_QOS_RATE_INPUT_MAX_HSG || rate < RTL8367C_QOS_RATE_INPUT_MIN)
-            return RT_ERR_RATE;
-
-        if ((retVal = rtl8367c_setAsicShareMeter(index, rate >> 3, ifg_include)) != RT_ERR_OK)
-            return retVal;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-        break;
-    case METER_TYPE_PPS:
-        if (rate > RTL8367C_QOS_PPS_INPUT_MAX || rate < RTL8367C_QOS_PPS_INPUT_MIN)
-            return RT_ERR_RATE;
+    if (NULL == pRate)
+        return RT_ERR_NULL_POINTER;
 
-        if ((retVal = rtl8367c_setAsicShareMeter(index, rate, ifg_include)) != RT_ERR_OK)
-            return retVal;
+    if (NULL == pIfg_include)
+        return RT_ERR_NULL_POINTER;
 
-        break;
-    default:
-        return RT_ERR_INPUT;
-    }
+    if ((retVal = rtl8367c_getAsicPortEgressRate(rtk_switch_port_L2P_get(port), &regData)) != RT_ERR_OK)
+        return retVal;
 
-    /* Set Type */
-    if ((retVal = rtl8367c_setAsicShareMeterType(index, (uint32_t)type)) != RT_ERR_OK)
+    *pRate = regData << 3;
+
+    if ((retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_SCHEDULE_WFQ_CTRL, RTL8367C_SCHEDULE_WFQ_CTRL_OFFSET, (uint32_t *)pIfg_include)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_getAsicShareMeter
+ *      rtl8367c_setAsicAprEnable
  * Description:
- *      Get meter configuration
+ *      Set per-port APR enable
  * Input:
- *      index   - hared meter index (0-31)
- *      pRate   - 17-bits rate of share meter, unit is 8Kpbs
- *      pIfg    - Including IFG in rate calculation, 1:include 0:exclude
+ *      port        - Physical port number (0~10)
+ *      aprEnable   - APR enable seting 1:enable 0:disable
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicShareMeter(uint32_t index, uint32_t *pRate, uint32_t *pIfg)
+int32_t rtl8367::rtl8367c_setAsicAprEnable(uint32_t port, uint32_t aprEnable)
 {
-    uint32_t regData;
-    uint32_t regData2;
-    int32_t retVal;
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    if (index > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
+    return rtl8367c_setAsicRegBit(RTL8367C_SCHEDULE_APR_CTRL_REG, RTL8367C_SCHEDULE_APR_CTRL_OFFSET(port), aprEnable);
+}
 
-    if (index < 32)
-    {
-        /*17-bits Rate*/
-        retVal = rtl8367c_getAsicReg(RTL8367C_METER_RATE_REG(index), &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+/* Function Name:
+ *      rtl8367c_getAsicAprEnable
+ * Description:
+ *      Get per-port APR enable
+ * Input:
+ *      port        - Physical port number (0~10)
+ * Output:
+ *      pAprEnable  - APR enable seting 1:enable 0:disable
+ * Return:
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtl8367c_getAsicAprEnable(uint32_t port, uint32_t *pAprEnable)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-        retVal = rtl8367c_getAsicReg(RTL8367C_METER_RATE_REG(index) + 1, &regData2);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+    return rtl8367c_getAsicRegBit(RTL8367C_SCHEDULE_APR_CTRL_REG, RTL8367C_SCHEDULE_APR_CTRL_OFFSET(port), pAprEnable);
+}
 
-        *pRate = ((regData2 << 16) & 0x70000) | regData;
-        /*IFG*/
-        retVal = rtl8367c_getAsicRegBit(RTL8367C_METER_IFG_CTRL_REG(index), RTL8367C_METER_IFG_OFFSET(index), pIfg);
+/* Function Name:
+ *      rtl8367c_setAsicAprMeter
+ * Description:
+ *      Set per-port and per-queue APR shared meter index
+ * Input:
+ *      port    - Physical port number (0~10)
+ *      qid     - Queue id
+ *      apridx  - dedicated shared meter index for APR (0~7)
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK               - Success
+ *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_QUEUE_ID         - Invalid queue id
+ *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ * Note:
+ *      Queues 0~4 of a port share one register and queues 5~7 the next one.
+ */
+int32_t rtl8367::rtl8367c_setAsicAprMeter(uint32_t port, uint32_t qid, uint32_t apridx)
+{
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-        return retVal;
-    }
-    else
-    {
-        /*17-bits Rate*/
-        retVal = rtl8367c_getAsicReg(RTL8367C_REG_METER32_RATE_CTRL0 + ((index - 32) << 1), &regData);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+    if (qid > RTL8367C_QIDMAX)
+        return RT_ERR_QUEUE_ID;
 
-        retVal = rtl8367c_getAsicReg(RTL8367C_REG_METER32_RATE_CTRL0 + ((index - 32) << 1) + 1, &regData2);
-        if (retVal != RT_ERR_OK)
-            return retVal;
+    if (apridx > RTL8367C_PORT_QUEUE_METER_INDEX_MAX)
+        return RT_ERR_FILTER_METER_ID;
 
-        *pRate = ((regData2 << 16) & 0x70000) | regData;
-        /*IFG*/
-        retVal = rtl8367c_getAsicRegBit(RTL8367C_REG_METER_IFG_CTRL2 + ((index - 32) >> 4), RTL8367C_METER_IFG_OFFSET(index), pIfg);
+    if (port < 8)
+        return rtl8367c_setAsicRegBits(RTL8367C_SCHEDULE_PORT_APR_METER_REG(port, qid), RTL8367C_SCHEDULE_PORT_APR_METER_MASK(qid), apridx);
 
-        return retVal;
-    }
+    /* ports 8~10 have their own block, not the continuation of ports 0~7 */
+    return rtl8367c_setAsicRegBits(RTL8367C_REG_SCHEDULE_PORT8_APR_METER_CTRL0 + ((port - 8) << 2) + (qid / 5), RTL8367C_SCHEDULE_PORT_APR_METER_MASK(qid), apridx);
 }
+
 /* Function Name:
- *      rtl8367c_getAsicShareMeterType
+ *      rtl8367c_getAsicAprMeter
  * Description:
- *      Get meter Type
+ *      Get per-port and per-queue APR shared meter index
  * Input:
- *      index       - shared meter index (0-31)
+ *      port    - Physical port number (0~10)
+ *      qid     - Queue id
  * Output:
- *      pType       - 0: kbps, 1: pps
+ *      pApridx - dedicated shared meter index for APR (0~7)
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ *      RT_ERR_OK       - Success
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_QUEUE_ID - Invalid queue id
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicShareMeterType(uint32_t index, uint32_t *pType)
+int32_t rtl8367::rtl8367c_getAsicAprMeter(uint32_t port, uint32_t qid, uint32_t *pApridx)
 {
-    uint32_t reg;
+    if (port > RTL8367C_PORTIDMAX)
+        return RT_ERR_PORT_ID;
 
-    if (index > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
+    if (qid > RTL8367C_QIDMAX)
+        return RT_ERR_QUEUE_ID;
 
-    if (NULL == pType)
-        return RT_ERR_NULL_POINTER;
+    if (port < 8)
+        return rtl8367c_getAsicRegBits(RTL8367C_SCHEDULE_PORT_APR_METER_REG(port, qid), RTL8367C_SCHEDULE_PORT_APR_METER_MASK(qid), pApridx);
 
-    if (index < 32)
-        reg = RTL8367C_REG_METER_MODE_SETTING0 + (index / 16);
-    else
-        reg = RTL8367C_REG_METER_MODE_SETTING2 + ((index - 32) / 16);
-    return rtl8367c_getAsicRegBit(reg, index % 16, pType);
+    /* ports 8~10 have their own block, not the continuation of ports 0~7 */
+    return rtl8367c_getAsicRegBits(RTL8367C_REG_SCHEDULE_PORT8_APR_METER_CTRL0 + ((port - 8) << 2) + (qid / 5), RTL8367C_SCHEDULE_PORT_APR_METER_MASK(qid), pApridx);
 }
-int32_t rtl8367::rtk_rate_shareMeter_get(uint32_t index, rtk_meter_type_t *pType, uint32_t *pRate, rtk_enable_t *pIfg_include)
+
+/* Function Name:
+ *      rtk_rate_egrQueueBwCtrlEnable_set
+ * Description:
+ *      Set enable status of egress bandwidth control on specified queue.
+ * Input:
+ *      port    - Port id
+ *      queue   - Queue id, must be RTK_WHOLE_SYSTEM
+ *      enable  - Enable status of egress queue bandwidth control
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - OK
+ *      RT_ERR_FAILED   - Failed
+ *      RT_ERR_SMI      - SMI access error
+ *      RT_ERR_PORT_ID  - Invalid port number
+ *      RT_ERR_QUEUE_ID - Invalid queue id
+ *      RT_ERR_ENABLE   - Invalid enable parameter
+ * Note:
+ *      APR (average packet rate) is enabled for all queues of a port at once,
+ *      each queue is then limited by the shared meter bound to it with
+ *      rtk_rate_egrQueueBwCtrlRate_set.
+ */
+int32_t rtl8367::rtk_rate_egrQueueBwCtrlEnable_set(rtk_port_t port, uint32_t queue, rtk_enable_t enable)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
-    uint32_t regData;
-
-    if (index > halCtrl.max_meter_id)
-        return RT_ERR_FILTER_METER_ID;
-
-    if (NULL == pType)
-        return RT_ERR_NULL_POINTER;
 
-    if (NULL == pRate)
-        return RT_ERR_NULL_POINTER;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if (NULL == pIfg_include)
-        return RT_ERR_NULL_POINTER;
+    /* The API only allows the whole port to be set */
+    if (queue != RTK_WHOLE_SYSTEM)
+        return RT_ERR_QUEUE_ID;
 
-    if ((retVal = rtl8367c_getAsicShareMeter(index, &regData, (uint32_t *)pIfg_include)) != RT_ERR_OK)
-        return retVal;
+    if (enable >= RTK_ENABLE_END)
+        return RT_ERR_ENABLE;
 
-    if ((retVal = rtl8367c_getAsicShareMeterType(index, (uint32_t *)pType)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_setAsicAprEnable(rtk_switch_port_L2P_get(port), enable)) != RT_ERR_OK)
         return retVal;
 
-    if (*pType == METER_TYPE_KBPS)
-        *pRate = regData << 3;
-    else
-        *pRate = regData;
-
     return RT_ERR_OK;
 }
 
 /* Function Name:
- *      rtl8367c_setAsicShareMeterBucketSize
+ *      rtk_rate_egrQueueBwCtrlEnable_get
  * Description:
- *      Set meter related leaky bucket threshold
+ *      Get enable status of egress bandwidth control on specified queue.
  * Input:
- *      index       - hared meter index (0-31)
- *      lbthreshold - Leaky bucket threshold of meter
+ *      port    - Port id
+ *      queue   - Queue id, must be RTK_WHOLE_SYSTEM
  * Output:
- *      None
+ *      pEnable - Enable status of egress queue bandwidth control
  * Return:
- *      RT_ERR_OK               - Success
- *      RT_ERR_SMI              - SMI access error
- *      RT_ERR_FILTER_METER_ID  - Invalid meter
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_QUEUE_ID     - Invalid queue id
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_setAsicShareMeterBucketSize(uint32_t index, uint32_t lbthreshold)
+int32_t rtl8367::rtk_rate_egrQueueBwCtrlEnable_get(rtk_port_t port, uint32_t queue, rtk_enable_t *pEnable)
 {
+    RTK_SMI_STATS_SCOPE();
+    int32_t retVal;
 
-    if (index > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if (index < 32)
-        return rtl8367c_setAsicReg(RTL8367C_METER_BUCKET_SIZE_REG(index), lbthreshold);
-    else
-        return rtl8367c_setAsicReg(RTL8367C_REG_METER32_BUCKET_SIZE + index - 32, lbthreshold);
+    /* The API only allows the whole port to be read */
+    if (queue != RTK_WHOLE_SYSTEM)
+        return RT_ERR_QUEUE_ID;
+
+    if (NULL == pEnable)
+        return RT_ERR_NULL_POINTER;
+
+    if ((retVal = rtl8367c_getAsicAprEnable(rtk_switch_port_L2P_get(port), (uint32_t *)pEnable)) != RT_ERR_OK)
+        return retVal;
+
+    return RT_ERR_OK;
 }
+
 /* Function Name:
- *      rtl8367c_getAsicShareMeterBucketSize
+ *      rtk_rate_egrQueueBwCtrlRate_set
  * Description:
- *      Get meter related leaky bucket threshold
+ *      Set rate of egress bandwidth control on specified queue.
  * Input:
- *      index       - hared meter index (0-31)
- *      pLbthreshold - Leaky bucket threshold of meter
+ *      port    - Port id
+ *      queue   - Queue id
+ *      index   - Shared meter index
  * Output:
  *      None
  * Return:
- *      RT_ERR_OK               - Success
+ *      RT_ERR_OK               - OK
+ *      RT_ERR_FAILED           - Failed
  *      RT_ERR_SMI              - SMI access error
+ *      RT_ERR_PORT_ID          - Invalid port number
+ *      RT_ERR_QUEUE_ID         - Invalid queue id
  *      RT_ERR_FILTER_METER_ID  - Invalid meter
  * Note:
- *      None
+ *      A queue can only be bound to one of the eight shared meters of its
+ *      port's block, meters (physical port % 4) * 8 to (physical port % 4) * 8 + 7.
+ *      The meter itself is programmed with rtk_rate_shareMeter_set.
  */
-int32_t rtl8367::rtl8367c_getAsicShareMeterBucketSize(uint32_t index, uint32_t *pLbthreshold)
-{
-    if (index > RTL8367C_METERMAX)
-        return RT_ERR_FILTER_METER_ID;
-
-    if (index < 32)
-        return rtl8367c_getAsicReg(RTL8367C_METER_BUCKET_SIZE_REG(index), pLbthreshold);
-    else
-        return rtl8367c_getAsicReg(RTL8367C_REG_METER32_BUCKET_SIZE + index - 32, pLbthreshold);
-}
-int32_t rtl8367::rtk_rate_shareMeterBucket_set(uint32_t index, uint32_t bucket_size)
+int32_t rtl8367::rtk_rate_egrQueueBwCtrlRate_set(rtk_port_t port, uint32_t queue, uint32_t index)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t phyPort;
+
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
+
+    if (queue > RTL8367C_QIDMAX)
+        return RT_ERR_QUEUE_ID;
 
     if (index > halCtrl.max_meter_id)
         return RT_ERR_FILTER_METER_ID;
 
-    if (bucket_size > RTL8367C_METERBUCKETSIZEMAX)
-        return RT_ERR_INPUT;
+    phyPort = rtk_switch_port_L2P_get(port);
+    if ((index / RTL8367C_PORT_QUEUE_METER_NO) != (phyPort % 4))
+        return RT_ERR_FILTER_METER_ID;
 
-    if ((retVal = rtl8367c_setAsicShareMeterBucketSize(index, bucket_size)) != RT_ERR_OK)
+    if ((retVal = rtl8367c_setAsicAprMeter(phyPort, queue, index % RTL8367C_PORT_QUEUE_METER_NO)) != RT_ERR_OK)
         return retVal;
 
     return RT_ERR_OK;
 }
 
-int32_t rtl8367::rtk_rate_shareMeterBucket_get(uint32_t index, uint32_t *pBucket_size)
+/* Function Name:
+ *      rtk_rate_egrQueueBwCtrlRate_get
+ * Description:
+ *      Get rate of egress bandwidth control on specified queue.
+ * Input:
+ *      port    - Port id
+ *      queue   - Queue id
+ * Output:
+ *      pIndex  - Shared meter index
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_FAILED       - Failed
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_PORT_ID      - Invalid port number
+ *      RT_ERR_QUEUE_ID     - Invalid queue id
+ *      RT_ERR_NULL_POINTER - Input parameter may be null pointer
+ * Note:
+ *      None
+ */
+int32_t rtl8367::rtk_rate_egrQueueBwCtrlRate_get(rtk_port_t port, uint32_t queue, uint32_t *pIndex)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
+    uint32_t phyPort;
+    uint32_t offsetIdx;
 
-    if (index > halCtrl.max_meter_id)
-        return RT_ERR_FILTER_METER_ID;
+    /* Check Port Valid */
+    RTK_CHK_PORT_VALID(port);
 
-    if (NULL == pBucket_size)
+    if (queue > RTL8367C_QIDMAX)
+        return RT_ERR_QUEUE_ID;
+
+    if (NULL == pIndex)
         return RT_ERR_NULL_POINTER;
 
-    if ((retVal = rtl8367c_getAsicShareMeterBucketSize(index, pBucket_size)) != RT_ERR_OK)
+    phyPort = rtk_switch_port_L2P_get(port);
+    if ((retVal = rtl8367c_getAsicAprMeter(phyPort, queue, &offsetIdx)) != RT_ERR_OK)
         return retVal;
 
+    *pIndex = offsetIdx + ((phyPort % 4) * RTL8367C_PORT_QUEUE_METER_NO);
+
     return RT_ERR_OK;
 }
 
@@ -14846,6 +20807,7 @@ int32_t rtl8367::rtl8367c_getAsicIgmp(uint32_t *ptr_enabled)
 }
 int32_t rtl8367::rtk_igmp_init()
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t port;
 
@@ -14890,6 +20852,7 @@ int32_t rtl8367::rtk_igmp_init()
 
 int32_t rtl8367::rtk_igmp_state_set(rtk_enable_t enabled)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     if (enabled >= RTK_ENABLE_END)
@@ -14903,6 +20866,7 @@ int32_t rtl8367::rtk_igmp_state_set(rtk_enable_t enabled)
 
 int32_t rtl8367::rtk_igmp_state_get(rtk_enable_t *pEnabled)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     if (pEnabled == NULL)
@@ -14939,6 +20903,7 @@ int32_t rtl8367::rtl8367c_setAsicIGMPStaticRouterPort(uint32_t pmsk)
 
 int32_t rtl8367::rtk_igmp_static_router_port_set(rtk_portmask_t *pPortmask)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t pmask;
 
@@ -14978,6 +20943,7 @@ int32_t rtl8367::rtl8367c_getAsicIGMPStaticRouterPort(uint32_t *pmsk)
 
 int32_t rtl8367::rtk_igmp_static_router_port_get(rtk_portmask_t *pPortmask)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
     uint32_t pmask;
 
@@ -14995,6 +20961,7 @@ int32_t rtl8367::rtk_igmp_static_router_port_get(rtk_portmask_t *pPortmask)
 
 int32_t rtl8367::rtk_igmp_protocol_set(rtk_port_t port, rtk_igmp_protocol_t protocol, rtk_igmp_action_t action)
 {
+    RTK_SMI_STATS_SCOPE();
     uint32_t operation;
     int32_t retVal;
 
@@ -15270,6 +21237,7 @@ int32_t rtl8367::rtl8367c_getAsicMLDv2Opeartion(uint32_t port, uint32_t *mldv2_o
 }
 int32_t rtl8367::rtk_igmp_protocol_get(rtk_port_t port, rtk_igmp_protocol_t protocol, rtk_igmp_action_t *pAction)
 {
+    RTK_SMI_STATS_SCOPE();
     uint32_t operation;
     int32_t retVal;
 
@@ -15336,6 +21304,7 @@ int32_t rtl8367::rtk_igmp_protocol_get(rtk_port_t port, rtk_igmp_protocol_t prot
 
 int32_t rtl8367::rtk_igmp_fastLeave_set(rtk_enable_t state)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     if (state >= RTK_ENABLE_END)
@@ -15377,6 +21346,7 @@ int32_t rtl8367::rtl8367c_getAsicIGMPFastLeaveEn(uint32_t *penabled)
 }
 int32_t rtl8367::rtk_igmp_fastLeave_get(rtk_enable_t *pState)
 {
+    RTK_SMI_STATS_SCOPE();
     uint32_t fast_leave;
     int32_t retVal;
 
@@ -15434,6 +21404,7 @@ int32_t rtl8367::rtl8367c_setAsicIGMPPortMAXGroup(uint32_t port, uint32_t max_gr
 }
 int32_t rtl8367::rtk_igmp_maxGroup_set(rtk_port_t port, uint32_t group)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     /* Check port valid */
@@ -15490,6 +21461,7 @@ int32_t rtl8367::rtl8367c_getAsicIGMPPortMAXGroup(uint32_t port, uint32_t *max_g
 }
 int32_t rtl8367::rtk_igmp_maxGroup_get(rtk_port_t port, uint32_t *pGroup)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     /* Check port valid */
@@ -15546,6 +21518,7 @@ int32_t rtl8367::rtl8367c_getAsicIGMPPortCurrentGroup(uint32_t port, uint32_t *c
 }
 int32_t rtl8367::rtk_igmp_currentGroup_get(rtk_port_t port, uint32_t *pGroup)
 {
+    RTK_SMI_STATS_SCOPE();
     int32_t retVal;
 
     /* Check port valid */
@@ -15562,6 +21535,7 @@ int32_t rtl8367::rtk_igmp_currentGroup_get(rtk_port_t port, uint32_t *pGroup)
 
 int32_t rtl8367::clearVlan(uint16_t vlanId)
 {
+    RTK_SMI_STATS_SCOPE();
     rtk_vlan_cfg_t vlan1;
     memset(&vlan1, 0x00, sizeof(rtk_vlan_cfg_t));
     RTK_PORTMASK_CLEAR(vlan1.mbr);
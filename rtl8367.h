@@ -5,20 +5,57 @@
 #include "rtl8367c_reg.h"
 #include "rtl8367c_base.h"
 #include "rtl8367c_def_types.h"
+#include "rtl8367c_smi.h"
+#include "rtl8367c_field.h"
+
+/* boot time allowed by resetWithDelay()/waitReady() and their polling period, ms */
+#ifndef RTL8367_READY_TIMEOUT_MS
+#define RTL8367_READY_TIMEOUT_MS 2000
+#endif
+#ifndef RTL8367_READY_POLL_MS
+#define RTL8367_READY_POLL_MS 10
+#endif
+
+/* placement of the INT pin handler, it must stay in IRAM on the ESP cores */
+#ifndef RTL8367_ISR_ATTR
+#if defined(ESP32) || defined(ESP8266)
+#define RTL8367_ISR_ATTR IRAM_ATTR
+#else
+#define RTL8367_ISR_ATTR
+#endif
+#endif
 
 class rtl8367
 {
 public:
     rtl8367(uint16_t);
     int32_t reset();
-    int32_t resetWithDelay();
+    int32_t resetWithDelay(uint32_t msTimeout = RTL8367_READY_TIMEOUT_MS);
+    int32_t waitReady(uint32_t msTimeout = RTL8367_READY_TIMEOUT_MS);
     void setCommunicationPins(uint8_t, uint8_t);
     void setCommunicationDelay(uint16_t);
+    void setTransport(rtl8367_smi_transport *);
+#ifdef RTL8367_SMI_STATS
+    const rtl8367_smi_stats_t *getSmiStats(uint32_t *);
+    void clearSmiStats();
+    void dumpSmiStats();
+#endif
+#ifdef RTL8367_REG_CACHE
+    int32_t setRegCacheMode(rtl8367_reg_cache_mode_t);
+    void invalidateRegCache();
+    int32_t verifyRegCache(uint32_t *);
+    void getRegCacheStats(rtl8367_reg_cache_stats_t *);
+#endif
+#ifdef RTL8367_REG_BATCH
+    void beginRegBatch();
+    int32_t commitRegBatch();
+#endif
     int32_t clearVlan(uint16_t);
 
     int32_t rtk_switch_probe(uint8_t &);
     int32_t rtk_port_phyStatus_get(uint8_t, uint8_t &, uint8_t &, uint8_t &);
-    int32_t rtk_vlan_init();
+    int32_t rtk_port_phyStatus_getAll(rtk_port_status_all_t *);
+    int32_t rtk_vlan_init(rtk_vlan_initMode_t mode = VLAN_INIT_MODE_FULL);
     int32_t rtk_vlan_portPvid_set(rtk_port_t, uint32_t, uint32_t);
     int32_t rtk_vlan_portPvid_get(rtk_port_t, uint32_t *, uint32_t *);
     int32_t rtk_vlan_portIgrFilterEnable_set(rtk_port_t, rtk_enable_t);
@@ -38,6 +75,15 @@ public:
     int32_t rtk_l2_addr_del(rtk_mac_t *, rtk_l2_ucastAddr_t *);
     int32_t rtk_l2_addr_get(rtk_mac_t *, rtk_l2_ucastAddr_t *);
     int32_t rtk_l2_addr_next_get(rtk_l2_read_method_t, rtk_port_t, uint32_t *, rtk_l2_ucastAddr_t *);
+    int32_t rtk_l2_table_dump(uint32_t *, rtk_l2_entry_t *, uint32_t, uint32_t *);
+#ifdef RTL8367_L2_INDEX
+    int32_t rtk_l2_index_get(rtk_mac_t *, uint32_t, uint32_t, rtk_l2_entry_t *);
+    int32_t rtk_l2_index_rebuild(uint32_t *);
+#endif
+    int32_t rtk_l2_table_clear();
+    int32_t rtk_l2_ucastAddr_flush(rtk_l2_flushCfg_t *);
+    int32_t rtk_l2_flushLinkDownPortAddrEnable_set(uint32_t, rtk_enable_t);
+    int32_t rtk_l2_flushLinkDownPortAddrEnable_get(uint32_t, rtk_enable_t *);
     int32_t rtk_l2_mcastAddr_add(rtk_l2_mcastAddr_t *);
     int32_t rtk_l2_mcastAddr_del(rtk_l2_mcastAddr_t *);
     int32_t rtk_l2_mcastAddr_get(rtk_l2_mcastAddr_t *);
@@ -58,6 +104,8 @@ public:
     int32_t rtk_qos_portPriSelIndex_set(rtk_port_t, rtk_qos_priDecTbl_t);
     int32_t rtk_qos_priMap_set(uint32_t, rtk_qos_pri2queue_t *);
     int32_t rtk_qos_schedulingQueue_set(rtk_port_t, rtk_qos_queue_weights_t *);
+    int32_t rtk_qos_wfqBurstSize_set(uint32_t);
+    int32_t rtk_qos_wfqBurstSize_get(uint32_t *);
     int32_t rtk_cpu_enable_set(rtk_enable_t);
     int32_t rtk_cpu_tagPort_set(rtk_port_t, rtk_cpu_insert_t);
     int32_t rtk_cpu_tagPort_get(rtk_port_t *, rtk_cpu_insert_t *);
@@ -68,13 +116,67 @@ public:
     int32_t rtk_int_status_get(rtk_int_status_t *);
     int32_t rtk_int_status_set(rtk_int_status_t *);
     int32_t rtk_int_advanceInfo_get(rtk_int_advType_t, rtk_int_info_t *);
+#ifdef RTL8367_INT_EVENT
+    int32_t rtk_int_event_attach(uint8_t, rtk_int_polarity_t);
+    void rtk_int_event_detach();
+    int32_t rtk_int_callback_set(rtk_int_type_t, rtk_int_callback_t, void *);
+    int32_t rtk_int_event_service(uint32_t *);
+#endif
     int32_t rtk_stat_port_get(rtk_port_t, rtk_stat_port_type_t, uint64_t *);
     int32_t rtk_stat_port_reset(rtk_port_t);
+    int32_t rtk_stat_port_getAll(rtk_port_t, rtk_stat_port_cntr_t *);
+    int32_t rtk_stat_all_ports_get(rtk_portmask_t *, rtk_stat_port_cntr_t *);
+#ifdef RTL8367_STAT_RATE
+    int32_t rtk_stat_port_rate_get(rtk_port_t, rtk_stat_port_rate_t *);
+#endif
+    int32_t rtk_buf_portPage_get(rtk_port_t, rtk_buf_port_page_t *);
+    int32_t rtk_buf_systemPage_get(rtk_buf_system_page_t *);
+    int32_t rtk_buf_pageMax_clear();
+    int32_t rtk_buf_queuePageMax_clear(rtk_port_t);
+#ifdef RTL8367_BUF_HIST
+    int32_t rtk_buf_sample(rtk_portmask_t *);
+    int32_t rtk_buf_hist_get(rtk_port_t, rtk_buf_hist_t *);
+    void rtk_buf_hist_clear();
+#endif
+    int32_t rtk_pktgen_port_set(rtk_port_t, rtk_pktgen_cfg_t *);
+    int32_t rtk_pktgen_port_get(rtk_port_t, rtk_pktgen_cfg_t *);
+    int32_t rtk_pktgen_start(rtk_portmask_t *);
+    int32_t rtk_pktgen_stop();
+    int32_t rtk_pktgen_status_get(rtk_portmask_t *);
+    int32_t rtk_pktgen_flowCtrlBypass_set(rtk_enable_t);
+    int32_t rtk_pktgen_flowCtrlBypass_get(rtk_enable_t *);
+    int32_t rtk_pktgen_test(rtk_port_t, rtk_pktgen_cfg_t *, uint32_t, rtk_pktgen_result_t *);
+    int32_t rtk_trunk_port_set(rtk_trunk_group_t, rtk_portmask_t *);
+    int32_t rtk_trunk_port_get(rtk_trunk_group_t, rtk_portmask_t *);
+    int32_t rtk_trunk_distributionAlgorithm_set(uint32_t, uint32_t);
+    int32_t rtk_trunk_distributionAlgorithm_get(uint32_t, uint32_t *);
+    int32_t rtk_trunk_hashMappingTable_set(rtk_trunk_group_t, rtk_trunk_hashVal2Port_t *);
+    int32_t rtk_trunk_hashMappingTable_get(rtk_trunk_group_t, rtk_trunk_hashVal2Port_t *);
+    int32_t rtk_trunk_trafficPause_set(rtk_trunk_group_t, rtk_enable_t);
+    int32_t rtk_trunk_trafficPause_get(rtk_trunk_group_t, rtk_enable_t *);
+#ifdef RTL8367_TRUNK_BALANCE
+    int32_t rtk_trunk_rebalance(rtk_trunk_group_t, uint32_t *);
+#endif
+    int32_t rtk_switch_maxPktLen_set(rtk_switch_maxPktLen_linkSpeed_t, rtk_switch_len_t);
+    int32_t rtk_switch_maxPktLen_get(rtk_switch_maxPktLen_linkSpeed_t, rtk_switch_len_t *);
+    int32_t rtk_switch_portMaxPktLen_set(rtk_port_t, rtk_switch_maxPktLen_linkSpeed_t, uint32_t);
+    int32_t rtk_switch_portMaxPktLen_get(rtk_port_t, rtk_switch_maxPktLen_linkSpeed_t, uint32_t *);
+    int32_t rtk_switch_maxPktLenCfg_set(uint32_t, uint32_t);
+    int32_t rtk_switch_maxPktLenCfg_get(uint32_t, uint32_t *);
     int32_t rtk_port_phyEnableAll_set(rtk_enable_t);
     int32_t rtk_port_phyAutoNegoAbility_set(rtk_port_t, rtk_port_phy_ability_t *);
     int32_t rtk_port_phyAutoNegoAbility_get(rtk_port_t, rtk_port_phy_ability_t *);
+    int32_t rtk_port_phyRegs_get(rtk_port_t, const uint32_t *, uint32_t, uint32_t *);
+    int32_t rtk_port_phyRegs_set(rtk_port_t, const uint32_t *, const uint32_t *, uint32_t);
     int32_t rtk_vlan_set(uint32_t, rtk_vlan_cfg_t *);
     int32_t rtk_vlan_get(uint32_t, rtk_vlan_cfg_t *);
+    int32_t rtk_vlan_bulk_set(rtk_vlan_entry_t *, uint32_t, uint32_t *);
+    int32_t rtk_vlan_range_set(uint32_t, uint32_t, rtk_vlan_cfg_t *, uint32_t *);
+#ifdef RTL8367_VLAN_SHADOW
+    int32_t rtk_vlan_shadow_rebuild(uint32_t *);
+    int32_t rtk_vlan_shadow_next_get(uint32_t *);
+    void rtk_vlan_shadow_invalidate();
+#endif
     int32_t rtk_led_enable_set(rtk_led_group_t, rtk_portmask_t *);
     int32_t rtk_led_operation_set(rtk_led_operation_t mode);
     int32_t rtk_led_blinkRate_set(rtk_led_blink_rate_t blinkRate);
@@ -95,6 +197,23 @@ public:
     int32_t rtk_l2_limitLearningCnt_set(rtk_port_t port, uint32_t mac_cnt);
     int32_t rtk_l2_limitLearningCnt_get(rtk_port_t port, uint32_t *pMac_cnt);
     int32_t rtk_l2_learningCnt_get(rtk_port_t port, uint32_t *pMac_cnt);
+    int32_t rtk_l2_limitLearningCntAction_set(uint32_t port, rtk_l2_limitLearnCntAction_t action);
+    int32_t rtk_l2_limitLearningCntAction_get(uint32_t port, rtk_l2_limitLearnCntAction_t *pAction);
+    int32_t rtk_l2_limitSystemLearningCnt_set(uint32_t mac_cnt);
+    int32_t rtk_l2_limitSystemLearningCnt_get(uint32_t *pMac_cnt);
+    int32_t rtk_l2_limitSystemLearningCntAction_set(rtk_l2_limitLearnCntAction_t action);
+    int32_t rtk_l2_limitSystemLearningCntAction_get(rtk_l2_limitLearnCntAction_t *pAction);
+    int32_t rtk_l2_limitSystemLearningCntPortMask_set(rtk_portmask_t *pPortmask);
+    int32_t rtk_l2_limitSystemLearningCntPortMask_get(rtk_portmask_t *pPortmask);
+    int32_t rtk_l2_aging_set(uint32_t aging_time);
+    int32_t rtk_l2_aging_get(uint32_t *pAging_time);
+    int32_t rtk_l2_agingEnable_set(rtk_port_t port, rtk_enable_t enable);
+    int32_t rtk_l2_agingEnable_get(rtk_port_t port, rtk_enable_t *pEnable);
+#ifdef RTL8367_L2_LEARN_RATE
+    int32_t rtk_l2_learnRate_sample(rtk_portmask_t *pPortmask, uint32_t threshold, rtk_portmask_t *pFlood);
+    int32_t rtk_l2_learnRate_get(rtk_port_t port, rtk_l2_learn_rate_t *pRate);
+    void rtk_l2_learnRate_clear();
+#endif
     int32_t rtk_filter_igrAcl_init();
     int32_t rtk_filter_igrAcl_template_set(rtk_filter_template_t *aclTemplate);
     int32_t rtk_filter_igrAcl_template_get(rtk_filter_template_t *aclTemplate);
@@ -119,6 +238,14 @@ public:
     int32_t rtk_rate_shareMeter_get(uint32_t index, rtk_meter_type_t *pType, uint32_t *pRate, rtk_enable_t *pIfg_include);
     int32_t rtk_rate_shareMeterBucket_set(uint32_t index, uint32_t bucket_size);
     int32_t rtk_rate_shareMeterBucket_get(uint32_t index, uint32_t *pBucket_size);
+    int32_t rtk_rate_igrBandwidthCtrlRate_set(rtk_port_t port, uint32_t rate, rtk_enable_t ifg_include, rtk_enable_t fc_enable);
+    int32_t rtk_rate_igrBandwidthCtrlRate_get(rtk_port_t port, uint32_t *pRate, rtk_enable_t *pIfg_include, rtk_enable_t *pFc_enable);
+    int32_t rtk_rate_egrBandwidthCtrlRate_set(rtk_port_t port, uint32_t rate, rtk_enable_t ifg_include);
+    int32_t rtk_rate_egrBandwidthCtrlRate_get(rtk_port_t port, uint32_t *pRate, rtk_enable_t *pIfg_include);
+    int32_t rtk_rate_egrQueueBwCtrlEnable_set(rtk_port_t port, uint32_t queue, rtk_enable_t enable);
+    int32_t rtk_rate_egrQueueBwCtrlEnable_get(rtk_port_t port, uint32_t queue, rtk_enable_t *pEnable);
+    int32_t rtk_rate_egrQueueBwCtrlRate_set(rtk_port_t port, uint32_t queue, uint32_t index);
+    int32_t rtk_rate_egrQueueBwCtrlRate_get(rtk_port_t port, uint32_t queue, uint32_t *pIndex);
     int32_t rtk_igmp_init();
     int32_t rtk_igmp_state_set(rtk_enable_t enabled);
     int32_t rtk_igmp_state_get(rtk_enable_t *pEnabled);
@@ -142,6 +269,162 @@ private:
         sdaPin = 0,
         sckPin = 0;
 
+    rtl8367_smi_arduino smiDefaultTransport;
+    rtl8367_smi_transport *smiTransport = &smiDefaultTransport;
+
+    /* CFG_CPU_OCPADR_MSB as last written by the PHY OCP access,
+       RTL8367C_PHY_OCP_PREFIX_NONE when unknown */
+    uint16_t phyOcpPrefix;
+
+#ifdef RTL8367_SMI_STATS
+    rtl8367_smi_stats_t smiStats[RTL8367_SMI_STATS_SLOTS];
+    rtl8367_smi_stats_t *smiStatsCur = NULL;
+
+    rtl8367_smi_stats_t *smiStatsEnter(const char *);
+    void smiStatsLeave(rtl8367_smi_stats_t *, uint32_t);
+    void smiStatsCount(uint32_t, uint32_t, int32_t);
+
+    /* tags the SMI traffic of the enclosing public API call */
+    class smiStatsScope
+    {
+    public:
+        smiStatsScope(rtl8367 *pSwitch, const char *api) : pSwitch(pSwitch), start(micros())
+        {
+            prev = pSwitch->smiStatsEnter(api);
+        }
+        ~smiStatsScope()
+        {
+            pSwitch->smiStatsLeave(prev, micros() - start);
+        }
+
+    private:
+        rtl8367 *pSwitch;
+        rtl8367_smi_stats_t *prev;
+        unsigned long start;
+    };
+#define RTK_SMI_STATS_SCOPE() smiStatsScope _smiStatsScope(this, __func__)
+#else
+#define RTK_SMI_STATS_SCOPE()
+#endif
+
+#if defined(RTL8367_REG_CACHE) || defined(RTL8367_REG_BATCH)
+    uint32_t regVolatile(uint32_t);
+#endif
+
+#ifdef RTL8367_REG_CACHE
+    /* open addressing on the register address, a slot stays owned by its
+       register until invalidateRegCache(), regCacheValid tells if the value
+       is current */
+    uint16_t regCacheReg[RTL8367_REG_CACHE_SIZE];
+    uint16_t regCacheValue[RTL8367_REG_CACHE_SIZE];
+    uint8_t regCacheUsed[RTL8367_REG_CACHE_SIZE / 8];
+    uint8_t regCacheValid[RTL8367_REG_CACHE_SIZE / 8];
+    rtl8367_reg_cache_mode_t regCacheMode = REG_CACHE_ENABLE;
+    rtl8367_reg_cache_stats_t regCacheStats;
+
+    uint32_t regCacheFind(uint32_t);
+    int32_t regCacheGet(uint32_t, uint32_t *);
+    void regCacheFill(uint32_t, uint32_t, uint32_t);
+    void regCacheDrop(uint32_t);
+#endif
+
+#ifdef RTL8367_REG_BATCH
+    /* pending updates in issue order, regBatchMask tells which bits of
+       regBatchValue are set */
+    uint16_t regBatchReg[RTL8367_REG_BATCH_SIZE];
+    uint16_t regBatchMask[RTL8367_REG_BATCH_SIZE];
+    uint16_t regBatchValue[RTL8367_REG_BATCH_SIZE];
+    uint8_t regBatchNum = 0;
+    uint8_t regBatchDepth = 0;
+
+    uint32_t regBatchFind(uint32_t);
+    int32_t regBatchPut(uint32_t, uint32_t, uint32_t);
+    int32_t regBatchFlush();
+#endif
+
+#ifdef RTL8367_L2_INDEX
+    /* linear probing on MAC and VID/FID, l2IndexUsed marks the taken slots;
+       deletion shifts the following run back so no tombstones are needed */
+    rtk_l2_entry_t l2Index[RTL8367_L2_INDEX_SIZE];
+    uint8_t l2IndexUsed[RTL8367_L2_INDEX_SIZE / 8];
+    uint32_t l2IndexNum;
+    uint32_t l2IndexOverflows;
+    /* set once the index covers the whole LUT (reset, table clear or
+       rebuild), before that a miss has to be looked up on the chip */
+    uint8_t l2IndexValid;
+
+    uint32_t l2IndexHash(const rtk_l2_entry_t *);
+    uint32_t l2IndexFind(const rtk_l2_entry_t *);
+    void l2IndexPut(const rtk_l2_entry_t *);
+    void l2IndexDrop(const rtk_l2_entry_t *);
+    void l2IndexClear();
+    void l2IndexFlush(const rtk_l2_flushCfg_t *, uint32_t);
+#endif
+
+#ifdef RTL8367_STAT_RATE
+    /* previous MIB block and sample time of physical ports 0~7,
+       statRateValid has a bit per port holding a sample */
+    uint16_t statRatePrev[8][RTL8367C_MIB_PORT_OFFSET];
+    uint32_t statRateMs[8];
+    uint32_t statRateValid;
+
+    void statRateZero(uint32_t);
+#endif
+
+#ifdef RTL8367_VLAN_SHADOW
+    /* SMI words of the 4K VLAN entries, word 0 and 1 in vlanShadowLo and
+       the 7 bits of word 2 in vlanShadowHi (20 KB); vlanShadowKnown has a
+       bit per VID whose entry is shadowed, vlanShadowPresent per VID with
+       member ports */
+    uint32_t vlanShadowLo[RTL8367C_VIDMAX + 1];
+    uint8_t vlanShadowHi[RTL8367C_VIDMAX + 1];
+    uint32_t vlanShadowKnown[(RTL8367C_VIDMAX + 1) / 32];
+    uint32_t vlanShadowPresent[(RTL8367C_VIDMAX + 1) / 32];
+
+    uint32_t vlanShadowGet(uint32_t, uint16_t *);
+    void vlanShadowPut(uint32_t, const uint16_t *);
+    void vlanShadowDrop(uint32_t);
+    void vlanShadowReset(uint32_t);
+#endif
+
+#ifdef RTL8367_L2_LEARN_RATE
+    /* last learning rate sample and its time of physical ports 0~10,
+       learnRateValid has a bit per port holding a sample */
+    rtk_l2_learn_rate_t learnRate[RTL8367C_PORTNO];
+    uint32_t learnRateMs[RTL8367C_PORTNO];
+    uint32_t learnRateValid;
+#endif
+
+#ifdef RTL8367_BUF_HIST
+    /* occupancy histograms of physical ports 0~7 */
+    rtk_buf_hist_t bufHist[8];
+#endif
+
+#ifdef RTL8367_TRUNK_BALANCE
+    /* ifOutOctets of physical ports 0~7 at the last rtk_trunk_rebalance,
+       trunkTxValid has a bit per trunk group holding a snapshot */
+    uint64_t trunkTxPrev[8];
+    uint8_t trunkTxValid;
+#endif
+
+#ifdef RTL8367_INT_EVENT
+    /* single producer (the INT pin handler) single consumer ring of edge
+       stamps, the handler only moves intQueueHead, the service only
+       intQueueTail; intEventOwner is the instance the handler feeds */
+    static rtl8367 *volatile intEventOwner;
+    volatile uint32_t intQueue[RTL8367_INT_QUEUE_SIZE];
+    volatile uint8_t intQueueHead;
+    volatile uint8_t intQueueTail;
+    uint8_t intPin;
+    uint8_t intActiveLevel;
+    uint32_t intCallbackMask;
+    rtk_int_callback_t intCallback[INT_TYPE_END];
+    void *intCallbackArg[INT_TYPE_END];
+
+    static void intEventIsr();
+    void intEventClear();
+#endif
+
     rtk_svlan_lookupType_t svlan_lookupType;
     uint8_t svlan_mbrCfgUsage[RTL8367C_SVIDXNO];
     uint16_t svlan_mbrCfgVid[RTL8367C_SVIDXNO];
@@ -273,12 +556,54 @@ private:
     int32_t smi_write(uint32_t, uint32_t);
     int32_t rtl8367c_setAsicReg(uint32_t, uint32_t);
     int32_t rtl8367c_getAsicReg(uint32_t, uint32_t *);
+    int32_t rtl8367c_getAsicReady(uint32_t *);
     int32_t rtk_switch_isUtpPort(uint8_t);
     uint32_t rtk_switch_port_L2P_get(uint8_t);
     int32_t rtl8367c_getAsicPHYReg(uint32_t, uint32_t, uint32_t *);
     int32_t rtl8367c_getAsicPHYOCPReg(uint32_t, uint32_t, uint32_t *);
+    int32_t _rtl8367c_getAsicPHYOCPReg(uint32_t, uint32_t, uint32_t *);
+    int32_t _rtl8367c_setAsicPHYOCPPrefix(uint32_t);
+    int32_t rtl8367c_getAsicPHYRegs(uint32_t, const uint32_t *, uint32_t, uint32_t *);
     int32_t rtl8367c_setAsicRegBits(uint32_t, uint32_t, uint32_t);
     int32_t rtl8367c_getAsicRegBits(uint32_t, uint32_t, uint32_t *);
+    int32_t rtl8367c_setAsicRegMasked(uint32_t, uint32_t, uint32_t);
+
+    /* typed access to a register field, Field is a rtl8367c_field / RTL8367C_FIELD;
+       like rtl8367c_setAsicRegBits, bits above the field are masked off and
+       only a value shifted past the register is refused */
+    template <class Field>
+    int32_t rtl8367c_setAsicField(uint32_t value)
+    {
+        uint32_t valueShifted = value << Field::shift;
+
+        if (valueShifted > RTL8367C_REGDATAMAX)
+            return RT_ERR_INPUT;
+
+        return rtl8367c_setAsicRegMasked(Field::reg, Field::mask, valueShifted);
+    }
+
+    /* constant value, rejected at compile time if it does not fit */
+    template <class Field, uint32_t Value>
+    int32_t rtl8367c_setAsicField()
+    {
+        static_assert(Value <= Field::max, "value does not fit the register field");
+
+        return rtl8367c_setAsicRegMasked(Field::reg, Field::mask, Value << Field::shift);
+    }
+
+    template <class Field>
+    int32_t rtl8367c_getAsicField(uint32_t *pValue)
+    {
+        int32_t retVal;
+        uint32_t regData;
+
+        if ((retVal = rtl8367c_getAsicReg(Field::reg, &regData)) != RT_ERR_OK)
+            return retVal;
+
+        *pValue = (regData & Field::mask) >> Field::shift;
+
+        return RT_ERR_OK;
+    }
     int32_t rtl8367c_setAsicRegBit(uint32_t, uint32_t, uint32_t);
     int32_t rtl8367c_getAsicRegBit(uint32_t, uint32_t, uint32_t *);
     int32_t rtk_vlan_checkAndCreateMbr(uint32_t, uint32_t *);
@@ -311,9 +636,18 @@ private:
     int32_t rtl8367c_setAsicSvlanUnmatchVlan(uint32_t);
     int32_t rtl8367c_setAsicSvlanDmacCvidSel(uint32_t, uint32_t);
     int32_t rtl8367c_getAsicL2LookupTb(uint32_t, rtl8367c_luttb *);
+    int32_t rtl8367c_getAsicL2LookupTbNext(uint32_t, uint32_t *, uint16_t *);
     void _rtl8367c_fdbStUser2Smi(rtl8367c_luttb *, uint16_t *);
     void _rtl8367c_fdbStSmi2User(rtl8367c_luttb *, uint16_t *);
+    void _rtl8367c_fdbStUser2Entry(rtl8367c_luttb *, rtk_l2_entry_t *);
     int32_t rtl8367c_setAsicL2LookupTb(rtl8367c_luttb *);
+    int32_t rtl8367c_setAsicLutFlushFilter(uint32_t, uint32_t, uint32_t);
+    int32_t rtl8367c_setAsicLutForceFlush(uint32_t);
+    int32_t rtl8367c_getAsicLutForceFlushStatus(uint32_t, uint32_t *);
+    int32_t rtl8367c_setAsicLutFlushAll();
+    int32_t rtl8367c_getAsicLutFlushAllStatus(uint32_t *);
+    int32_t rtl8367c_setAsicLutLinkDownForceAging(uint32_t);
+    int32_t rtl8367c_getAsicLutLinkDownForceAging(uint32_t *);
     int32_t rtl8367c_setAsicOutputQueueMappingIndex(uint32_t, uint32_t);
     int32_t rtl8367c_setAsicPriorityToQIDMappingTable(uint32_t, uint32_t, uint32_t);
     int32_t rtl8367c_setAsicPriorityPortBased(uint32_t, uint32_t);
@@ -327,6 +661,8 @@ private:
     int32_t rtl8367c_setAsicPortPriorityDecisionIndex(uint32_t, uint32_t);
     int32_t rtl8367c_setAsicQueueType(uint32_t, uint32_t, uint32_t);
     int32_t rtl8367c_setAsicWFQWeight(uint32_t, uint32_t, uint32_t);
+    int32_t rtl8367c_setAsicWFQBurstSize(uint32_t);
+    int32_t rtl8367c_getAsicWFQBurstSize(uint32_t *);
     int32_t rtl8367c_setAsicCputagEnable(uint32_t);
     int32_t rtl8367c_setAsicCputagPortmask(uint32_t);
     int32_t rtl8367c_setAsicCputagTrapPort(uint32_t);
@@ -344,13 +680,34 @@ private:
     int32_t rtl8367c_getAsicInterruptRelatedStatus(uint32_t, uint32_t *);
     int32_t rtl8367c_setAsicInterruptRelatedStatus(uint32_t, uint32_t);
     int32_t _get_asic_mib_idx(rtk_stat_port_type_t, RTL8367C_MIBCOUNTER *);
+    void _get_asic_mib_layout(RTL8367C_MIBCOUNTER, uint32_t *, uint32_t *);
     int32_t rtl8367c_getAsicMIBsCounter(uint32_t, RTL8367C_MIBCOUNTER, uint64_t *);
+    int32_t rtl8367c_setAsicMIBsAddr(uint32_t);
+    int32_t rtl8367c_getAsicMIBsPort(uint32_t, uint32_t *, uint16_t *);
+    int32_t rtl8367c_getAsicPortPage(uint32_t, uint32_t *, uint32_t *);
+    int32_t rtl8367c_getAsicQueuePage(uint32_t, uint16_t *, uint16_t *);
+    int32_t rtl8367c_setAsicPageMaxClear();
+    int32_t rtl8367c_setAsicPktGen(uint32_t, rtk_pktgen_cfg_t *);
+    int32_t rtl8367c_getAsicPktGen(uint32_t, rtk_pktgen_cfg_t *);
+    int32_t rtl8367c_setAsicPktGenCommand(uint32_t);
+    int32_t _rtk_pktgen_mib_get(uint32_t, uint64_t *);
+    int32_t rtl8367c_setAsicTrunkingGroup(uint32_t, uint32_t);
+    int32_t rtl8367c_getAsicTrunkingGroup(uint32_t, uint32_t *);
+    int32_t rtl8367c_setAsicTrunkingHashTable(uint32_t, uint8_t *);
+    int32_t rtl8367c_getAsicTrunkingHashTable(uint32_t, uint8_t *);
+    int32_t rtl8367c_setAsicMaxLengthCfg(uint32_t, uint32_t);
+    int32_t rtl8367c_getAsicMaxLengthCfg(uint32_t, uint32_t *);
+    int32_t rtl8367c_setAsicMaxLength(uint32_t, uint32_t, uint32_t);
+    int32_t rtl8367c_getAsicMaxLength(uint32_t, uint32_t, uint32_t *);
+    void _rtk_stat_port_decode(uint16_t *, rtk_stat_port_cntr_t *);
     int32_t rtl8367c_setAsicMIBsCounterReset(uint32_t, uint32_t, uint32_t);
     int32_t rtl8367c_setAsicPortEnableAll(uint32_t);
     int32_t _rtk_port_phyReg_get(rtk_port_t, rtk_port_phy_reg_t, uint32_t *);
     int32_t _rtk_port_phyReg_set(rtk_port_t, rtk_port_phy_reg_t, uint32_t);
     int32_t rtl8367c_setAsicPHYReg(uint32_t, uint32_t, uint32_t);
     int32_t rtl8367c_setAsicPHYOCPReg(uint32_t, uint32_t, uint32_t);
+    int32_t _rtl8367c_setAsicPHYOCPReg(uint32_t, uint32_t, uint32_t);
+    int32_t rtl8367c_setAsicPHYRegs(uint32_t, const uint32_t *, const uint32_t *, uint32_t);
     int32_t rtk_switch_isComboPort(rtk_port_t);
     int32_t _rtk_port_phyComboPortMedia_get(rtk_port_t, rtk_port_media_t *);
     int32_t _rtk_port_FiberModeAbility_set(rtk_port_t, rtk_port_phy_ability_t *);
@@ -366,6 +723,13 @@ private:
     int32_t rtl8367c_setAsicVlanFilter(uint32_t);
     int32_t rtk_switch_portmask_L2P_get(rtk_portmask_t *, uint32_t *);
     int32_t rtl8367c_getAsicVlan4kEntry(rtl8367c_user_vlan4kentry *);
+    int32_t rtl8367c_setAsicVlan4kEntryBulk(uint32_t, const uint16_t *);
+    int32_t vlanCfgCheck(uint32_t, rtk_vlan_cfg_t *);
+    int32_t vlanCfgTo4k(uint32_t, rtk_vlan_cfg_t *, rtl8367c_user_vlan4kentry *);
+    int32_t vlanMbrCfgSync(rtl8367c_user_vlan4kentry *);
+    int32_t vlanBulkBegin();
+    int32_t vlanBulkApply(uint32_t, rtk_vlan_cfg_t *, uint32_t *);
+    int32_t vlanInitReg(uint32_t, uint32_t, uint32_t, rtk_vlan_initMode_t);
     void _rtl8367c_Vlan4kStSmi2User(uint16_t *, rtl8367c_user_vlan4kentry *);
     int32_t rtk_switch_portmask_P2L_get(uint32_t, rtk_portmask_t *);
     int32_t rtl8367c_getAsicVlanMemberConfig(uint32_t, rtl8367c_vlanconfiguser *);
@@ -416,6 +780,18 @@ private:
     int32_t rtl8367c_setAsicLutLearnLimitNo(uint32_t port, uint32_t number);
     int32_t rtl8367c_getAsicLutLearnLimitNo(uint32_t port, uint32_t *pNumber);
     int32_t rtl8367c_getAsicLutLearnNo(uint32_t port, uint32_t *pNumber);
+    int32_t rtl8367c_setAsicLutLearnOverAct(uint32_t action);
+    int32_t rtl8367c_getAsicLutLearnOverAct(uint32_t *pAction);
+    int32_t rtl8367c_setAsicSystemLutLearnLimitNo(uint32_t number);
+    int32_t rtl8367c_getAsicSystemLutLearnLimitNo(uint32_t *pNumber);
+    int32_t rtl8367c_setAsicSystemLutLearnOverAct(uint32_t action);
+    int32_t rtl8367c_getAsicSystemLutLearnOverAct(uint32_t *pAction);
+    int32_t rtl8367c_setAsicSystemLutLearnPortMask(uint32_t portmask);
+    int32_t rtl8367c_getAsicSystemLutLearnPortMask(uint32_t *pPortmask);
+    int32_t rtl8367c_setAsicLutAgeTimerSpeed(uint32_t timer, uint32_t speed);
+    int32_t rtl8367c_getAsicLutAgeTimerSpeed(uint32_t *pTimer, uint32_t *pSpeed);
+    int32_t rtl8367c_setAsicLutDisableAging(uint32_t port, uint32_t disabled);
+    int32_t rtl8367c_getAsicLutDisableAging(uint32_t port, uint32_t *pDisabled);
     int32_t _rtk_filter_igrAcl_cfg_delAll();
     int32_t rtl8367c_setAsicAclActCtrl(uint32_t index, uint32_t aclActCtrl);
     int32_t rtl8367c_setAsicAclNot(uint32_t index, uint32_t nott);
@@ -451,6 +827,14 @@ private:
     int32_t rtl8367c_getAsicShareMeterType(uint32_t index, uint32_t *pType);
     int32_t rtl8367c_setAsicShareMeterBucketSize(uint32_t index, uint32_t lbthreshold);
     int32_t rtl8367c_getAsicShareMeterBucketSize(uint32_t index, uint32_t *pLbthreshold);
+    int32_t rtl8367c_setAsicPortIngressBandwidth(uint32_t port, uint32_t bandwidth, uint32_t preifg, uint32_t enableFC);
+    int32_t rtl8367c_getAsicPortIngressBandwidth(uint32_t port, uint32_t *pBandwidth, uint32_t *pPreifg, uint32_t *pEnableFC);
+    int32_t rtl8367c_setAsicPortEgressRate(uint32_t port, uint32_t rate);
+    int32_t rtl8367c_getAsicPortEgressRate(uint32_t port, uint32_t *pRate);
+    int32_t rtl8367c_setAsicAprEnable(uint32_t port, uint32_t aprEnable);
+    int32_t rtl8367c_getAsicAprEnable(uint32_t port, uint32_t *pAprEnable);
+    int32_t rtl8367c_setAsicAprMeter(uint32_t port, uint32_t qid, uint32_t apridx);
+    int32_t rtl8367c_getAsicAprMeter(uint32_t port, uint32_t qid, uint32_t *pApridx);
     int32_t rtl8367c_setAsicLutIpMulticastLookup(uint32_t enabled);
     int32_t rtl8367c_setAsicLutIpLookupMethod(uint32_t type);
     int32_t rtl8367c_setAsicIGMPv1Opeartion(uint32_t port, uint32_t igmpv1_op);
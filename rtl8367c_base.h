@@ -250,6 +250,10 @@
 
 #define    RTL8367C_PORT_TRUNK_FLOWCTRL_REG                        RTL8367C_REG_PORT_TRUNK_FLOWCTRL
 
+#define    RTL8367C_PORT_TRUNK_HASH_MAPPING_REG(group, hash)    (((group == 0) ? RTL8367C_REG_PORT_TRUNK_HASH_MAPPING_CTRL0 : RTL8367C_REG_PORT_TRUNK_HASH_MAPPING_CTRL2) + (hash >> 3))
+#define    RTL8367C_PORT_TRUNK_HASH_MAPPING_OFFSET(hash)    ((hash & 0x7) << 1)
+#define    RTL8367C_PORT_TRUNK_HASH_MAPPING_MASK(hash)    (RTL8367C_PORT_TRUNK_HASH_MAPPING_CTRL0_HASH0_MASK << RTL8367C_PORT_TRUNK_HASH_MAPPING_OFFSET(hash))
+
 #define    RTL8367C_QOS_PORT_QUEUE_NUMBER_BASE                    RTL8367C_REG_QOS_PORT_QUEUE_NUMBER_CTRL0
 #define    RTL8367C_QOS_PORT_QUEUE_NUMBER_REG(port)                (RTL8367C_QOS_PORT_QUEUE_NUMBER_BASE + (port >> 2))
 #define    RTL8367C_QOS_PORT_QUEUE_NUMBER_OFFSET(port)            ((port & 0x3) << 2)
@@ -9,6 +9,7 @@
 #define RTL8367C_LUT_IPMCGRP_TABLE_MAX (0x3F)
 #define RTL8367C_LUT_ENTRY_SIZE (6)
 #define RTL8367C_LUT_BUSY_CHECK_NO (10)
+#define RTL8367C_LUT_FLUSH_BUSY_CHECK_NO (1000)
 #define RTL8367C_C2SIDXNO 128
 #define RTL8367C_C2SIDXMAX (RTL8367C_C2SIDXNO - 1)
 #define RTL8367C_MC2SIDXNO 32
@@ -42,6 +43,7 @@
 #define RTL8367C_PHY_REGNOMAX 0x1F
 #define RTL8367C_PHY_BASE 0x2000
 #define RTL8367C_PHY_OFFSET 5
+#define RTL8367C_PHY_OCP_PREFIX_NONE 0xFFFF
 #define PHY_RESOLVED_REG 26
 #define RTK_SWITCH_PORT_NUM (32)
 #define UNDEFINE_PHY_PORT (0xFF)
@@ -77,6 +79,7 @@
 #define QOS_WEIGHT_MAX 127
 #define RTL8367C_QWEIGHTMAX 0x7F
 #define RTL8367C_PORT_QUEUE_METER_INDEX_MAX 7
+#define RTL8367C_PORT_QUEUE_METER_NO (RTL8367C_PORT_QUEUE_METER_INDEX_MAX + 1)
 
 #define RTK_MAC_ADDR_LEN 6
 #define RTL8367C_EFIDMAX 0x7
@@ -1386,6 +1389,14 @@ typedef enum rtk_port_speed_e
     PORT_SPEED_END
 } rtk_port_speed_t;
 
+/* link state of every port, see rtk_port_phyStatus_getAll */
+typedef struct rtk_port_status_all_s
+{
+    rtk_portmask_t linkUp;               /* logical ports with link */
+    uint8_t speed[RTK_SWITCH_PORT_NUM];  /* rtk_port_speed_t per logical port, 0 without link */
+    uint8_t duplex[RTK_SWITCH_PORT_NUM]; /* rtk_port_duplex_t per logical port, 0 without link */
+} rtk_port_status_all_t;
+
 typedef struct rtk_rtctResult_s
 {
     rtk_port_speed_t linkType;
@@ -1852,6 +1863,22 @@ typedef struct rtk_vlan_cfg_s
     uint16_t vbpri;
 } rtk_vlan_cfg_t;
 
+/* how rtk_vlan_init brings the VLAN registers to their defaults */
+typedef enum rtk_vlan_initMode_e
+{
+    VLAN_INIT_MODE_FULL = 0,
+    VLAN_INIT_MODE_DIFF,
+    VLAN_INIT_MODE_FRESH,
+    VLAN_INIT_MODE_END
+} rtk_vlan_initMode_t;
+
+/* one VLAN of rtk_vlan_bulk_set */
+typedef struct rtk_vlan_entry_s
+{
+    uint32_t vid;
+    rtk_vlan_cfg_t cfg;
+} rtk_vlan_entry_t;
+
 typedef struct rtl8367c_svlan_memconf_s
 {
 
@@ -1944,6 +1971,104 @@ typedef struct rtk_l2_ucastAddr_s
     uint32_t address;
 } rtk_l2_ucastAddr_t;
 
+/* l2 address table - compact unicast entry (12 bytes), see rtk_l2_table_dump */
+#define RTK_L2_ENTRY_IVL 0x01      /* cvid_fid holds a VID, else FID (bits 0~3) and EFID (bits 4~6) */
+#define RTK_L2_ENTRY_STATIC 0x02   /* not aged out */
+#define RTK_L2_ENTRY_AUTH 0x04
+#define RTK_L2_ENTRY_SA_BLOCK 0x08
+#define RTK_L2_ENTRY_DA_BLOCK 0x10
+#define RTK_L2_ENTRY_AGE_OFFSET 5  /* age timer, 0 for aged out dynamic entries */
+#define RTK_L2_ENTRY_AGE_MASK 0xE0
+
+typedef struct rtk_l2_entry_s
+{
+    rtk_mac_t mac;
+    uint16_t address;  /* LUT index */
+    uint16_t cvid_fid; /* VID (IVL) or FID | EFID << 4 (SVL) */
+    uint8_t port;      /* logical port */
+    uint8_t flags;     /* RTK_L2_ENTRY_xxx */
+} rtk_l2_entry_t;
+
+/*
+ * Host side MAC index, build with -DRTL8367_L2_INDEX to enable.
+ * A RAM copy of the unicast LUT entries keyed by MAC and VID/FID, filled by
+ * rtk_l2_table_dump and kept in step by rtk_l2_addr_add/del/get, so
+ * rtk_l2_index_get answers without SMI traffic. The default size keeps the
+ * load under 55% with every one of the 2112 LUT entries indexed (49 KB);
+ * smaller tables work but fall back to the chip once they overflow.
+ */
+#ifdef RTL8367_L2_INDEX
+#ifndef RTL8367_L2_INDEX_SIZE
+#define RTL8367_L2_INDEX_SIZE 4096
+#endif
+#if (RTL8367_L2_INDEX_SIZE < 8) || (RTL8367_L2_INDEX_SIZE > 65536) || ((RTL8367_L2_INDEX_SIZE & (RTL8367_L2_INDEX_SIZE - 1)) != 0)
+#error "RTL8367_L2_INDEX_SIZE must be a power of two, 8~65536"
+#endif
+#endif
+
+/* l2 flush, see rtk_l2_ucastAddr_flush */
+enum RTL8367C_FLUSHMODE
+{
+    FLUSHMDOE_PORT = 0,
+    FLUSHMDOE_VID,
+    FLUSHMDOE_FID,
+    FLUSHMDOE_END,
+};
+
+enum RTL8367C_FLUSHTYPE
+{
+    FLUSHTYPE_DYNAMIC = 0,
+    FLUSHTYPE_BOTH,
+    FLUSHTYPE_END,
+};
+
+typedef struct rtk_l2_flushCfg_s
+{
+    rtk_enable_t flushByVid;
+    uint32_t vid;
+    rtk_enable_t flushByFid;
+    uint32_t fid;
+    rtk_enable_t flushByPort;
+    rtk_port_t port;
+    rtk_enable_t flushStaticAddr;
+    rtk_enable_t flushAddrOnAllPorts; /* with flushByVid or flushByFid, else only port */
+} rtk_l2_flushCfg_t;
+
+/* action on a frame whose source MAC is over the learn limit */
+typedef enum rtk_l2_limitLearnCntAction_e
+{
+    LIMIT_LEARN_CNT_ACTION_DROP = 0,
+    LIMIT_LEARN_CNT_ACTION_FORWARD,
+    LIMIT_LEARN_CNT_ACTION_TO_CPU,
+    LIMIT_LEARN_CNT_ACTION_END
+} rtk_l2_limitLearnCntAction_t;
+
+enum RTL8367C_LRNOVERACT
+{
+    LRNOVERACT_FORWARD = 0,
+    LRNOVERACT_DROP,
+    LRNOVERACT_TRAP,
+    LRNOVERACT_END,
+};
+
+/* longest aging time of rtk_l2_aging_set, in seconds */
+#define RTK_L2_AGING_TIME_MAX 1374
+
+/*
+ * MAC learning rate, build with -DRTL8367_L2_LEARN_RATE to enable.
+ * rtk_l2_learnRate_sample reads the learned entry counters of ports and
+ * keeps how fast each one grew since the previous sample, so a port that
+ * sees a flood of new source MACs stands out before the LUT fills up.
+ * 20 bytes per port.
+ */
+typedef struct rtk_l2_learn_rate_s
+{
+    uint32_t ms;        /* time covered by the last sample, 0 after the first one */
+    uint16_t count;     /* learned entries at the last sample */
+    uint32_t perSec;    /* new entries per second over ms, 0 when the count went down */
+    uint32_t perSecMax; /* highest perSec since rtk_l2_learnRate_clear */
+} rtk_l2_learn_rate_t;
+
 typedef struct ether_addr_s
 {
     uint8_t octet[ETHER_ADDR_LEN];
@@ -2170,6 +2295,43 @@ typedef struct rtk_int_info_s
     uint32_t systemLearnOver;
 } rtk_int_info_t;
 
+/*
+ * Interrupt events, build with -DRTL8367_INT_EVENT to enable.
+ * The handler attached to the switch INT pin only queues its millis() stamp
+ * in a ring of RTL8367_INT_QUEUE_SIZE entries, rtk_int_event_service reads
+ * and clears the interrupt status and runs the callbacks of the fired types.
+ * A full ring only drops stamps, the status read covers every edge.
+ */
+#ifdef RTL8367_INT_EVENT
+#ifndef RTL8367_INT_QUEUE_SIZE
+#define RTL8367_INT_QUEUE_SIZE 8
+#endif
+#if (RTL8367_INT_QUEUE_SIZE < 2) || (RTL8367_INT_QUEUE_SIZE > 128) || ((RTL8367_INT_QUEUE_SIZE & (RTL8367_INT_QUEUE_SIZE - 1)) != 0)
+#error "RTL8367_INT_QUEUE_SIZE must be a power of two, 2~128"
+#endif
+/* status reads per service call while the INT line stays asserted */
+#ifndef RTL8367_INT_SERVICE_ROUNDS
+#define RTL8367_INT_SERVICE_ROUNDS 4
+#endif
+#endif
+
+typedef struct rtk_int_event_s
+{
+    uint32_t ms;                /* millis() of the oldest queued edge, or of the service call */
+    uint32_t status;            /* fired rtk_int_type_t bits */
+    rtk_portmask_t linkUp;      /* INT_TYPE_LINK_STATUS */
+    rtk_portmask_t linkDown;    /* INT_TYPE_LINK_STATUS */
+    rtk_portmask_t speedChange; /* INT_TYPE_LINK_SPEED */
+    rtk_portmask_t learnOver;   /* INT_TYPE_LEARN_LIMIT */
+    uint32_t systemLearnOver;   /* INT_TYPE_LEARN_LIMIT */
+    rtk_portmask_t congest;     /* INT_TYPE_CONGEST */
+    uint32_t meterMask;         /* INT_TYPE_METER_EXCEED */
+    rtk_portmask_t looped;      /* INT_TYPE_LOOP_DETECT */
+    rtk_portmask_t released;    /* INT_TYPE_LOOP_DETECT */
+} rtk_int_event_t;
+
+typedef void (*rtk_int_callback_t)(const rtk_int_event_t *pEvent, void *pArg);
+
 typedef enum RTL8367C_INTR_INDICATOR_E
 {
     INTRST_L2_LEARN = 0,
@@ -2253,6 +2415,155 @@ typedef enum rtk_stat_port_type_e
     STAT_PORT_CNTR_END
 } rtk_stat_port_type_t;
 
+/* every counter of a port, indexed by rtk_stat_port_type_t */
+typedef struct rtk_stat_port_cntr_s
+{
+    uint64_t cntr[STAT_PORT_CNTR_END];
+} rtk_stat_port_cntr_t;
+
+/*
+ * Counter deltas and rates, build with -DRTL8367_STAT_RATE to enable.
+ * rtk_stat_port_rate_get keeps the previous MIB snapshot of every port
+ * (248 bytes each) and reports the increase since then, handling the wrap
+ * of the 32-bit counters and counter resets.
+ */
+typedef struct rtk_stat_port_rate_s
+{
+    uint32_t ms;                /* time covered by delta, 0 for the first sample of a port */
+    rtk_stat_port_cntr_t delta; /* increase of every counter, indexed by rtk_stat_port_type_t */
+    uint64_t inBytesPerSec;
+    uint64_t outBytesPerSec;
+    uint32_t inPktsPerSec;  /* unicast, multicast and broadcast */
+    uint32_t outPktsPerSec;
+    uint32_t inErrorsPerSec;  /* FCS, symbol, fragment, jabber, undersize, oversize and drop events */
+    uint32_t outErrorsPerSec; /* late and excessive collisions, discards */
+} rtk_stat_port_rate_t;
+
+/* packet buffer pages (0~2047) held by a port and its egress queues */
+typedef struct rtk_buf_port_page_s
+{
+    uint16_t page;    /* now */
+    uint16_t pageMax; /* peak since the last rtk_buf_pageMax_clear */
+    uint16_t queuePage[RTK_MAX_NUM_OF_QUEUE];
+    uint16_t queuePageMax[RTK_MAX_NUM_OF_QUEUE];
+} rtk_buf_port_page_t;
+
+/* pages in use in the whole buffer and in its shared (public) part */
+typedef struct rtk_buf_system_page_s
+{
+    uint16_t total;
+    uint16_t publicPage;
+    uint16_t totalMax;
+    uint16_t publicMax;
+} rtk_buf_system_page_t;
+
+/*
+ * Buffer occupancy histogram, build with -DRTL8367_BUF_HIST to enable.
+ * rtk_buf_sample adds the current pages and the peak since the previous
+ * sample of each port to log2 buckets: bucket 0 counts empty samples,
+ * bucket n (1~11) samples of 2^(n-1)~2^n-1 pages. 104 bytes per port.
+ */
+#define RTK_BUF_HIST_BUCKETS 12
+
+typedef struct rtk_buf_hist_s
+{
+    uint32_t samples;
+    uint16_t pageMax; /* highest peak seen by any sample */
+    uint32_t page[RTK_BUF_HIST_BUCKETS];
+    uint32_t peak[RTK_BUF_HIST_BUCKETS];
+} rtk_buf_hist_t;
+
+/* packet generator, physical ports 0~7 only */
+#define RTL8367C_PKTGEN_PORTIDMAX 7
+#define RTL8367C_PKTGEN_CTRL_REG(port) (RTL8367C_REG_PKTGEN_PORT0_CTRL + ((port) << 5))
+#define RTL8367C_PKTGEN_DA_REG(port) (RTL8367C_REG_PKTGEN_PORT0_DA0 + ((port) << 5))
+#define RTL8367C_PKTGEN_SA_REG(port) (RTL8367C_REG_PKTGEN_PORT0_SA0 + ((port) << 5))
+#define RTL8367C_PKTGEN_COUNTER_REG(port) (RTL8367C_REG_PKTGEN_PORT0_COUNTER0 + ((port) << 5))
+#define RTL8367C_PKTGEN_LENGTH_REG(port) (RTL8367C_REG_PKTGEN_PORT0_TX_LENGTH + ((port) << 5))
+
+#define RTK_PKTGEN_LENGTH_MIN 64
+#define RTK_PKTGEN_LENGTH_MAX RTL8367C_PKTGEN_PORT0_TX_LENGTH_MASK
+#define RTK_PKTGEN_COUNT_MAX 0xFFFFFF
+
+typedef enum rtk_pktgen_crc_e
+{
+    PKTGEN_CRC_BAD = 0,
+    PKTGEN_CRC_GOOD,
+    PKTGEN_CRC_END
+} rtk_pktgen_crc_t;
+
+typedef struct rtk_pktgen_cfg_s
+{
+    rtk_mac_t dmac;
+    rtk_mac_t smac;
+    uint32_t length; /* frame bytes with CRC, RTK_PKTGEN_LENGTH_MIN~RTK_PKTGEN_LENGTH_MAX */
+    uint32_t count;  /* frames to send, 1~RTK_PKTGEN_COUNT_MAX */
+    rtk_pktgen_crc_t crc;
+} rtk_pktgen_cfg_t;
+
+/* MIB counter increase over one rtk_pktgen_test run */
+typedef struct rtk_pktgen_result_s
+{
+    uint32_t ms;
+    uint32_t done; /* 1 when the generator finished before the time limit */
+    uint32_t txPkts;
+    uint32_t txPktsPerSec;
+    uint32_t txDiscards;
+    uint32_t rxPkts; /* non zero with a loopback plug or an echoing link partner */
+    uint32_t rxPktsPerSec;
+    uint32_t rxErrors; /* FCS and symbol errors */
+} rtk_pktgen_result_t;
+
+/* trunking, groups 0~1 of four physical ports each (0~3, 4~7) */
+#define RTK_WHOLE_SYSTEM 0xFF
+#define RTK_MAX_NUM_OF_TRUNK_HASH_VAL 16
+#define RTL8367C_TRUNKING_PORTNO 4
+
+#define TRUNK_DISTRIBUTION_ALGO_SPA_BIT 0x01
+#define TRUNK_DISTRIBUTION_ALGO_SMAC_BIT 0x02
+#define TRUNK_DISTRIBUTION_ALGO_DMAC_BIT 0x04
+#define TRUNK_DISTRIBUTION_ALGO_SIP_BIT 0x08
+#define TRUNK_DISTRIBUTION_ALGO_DIP_BIT 0x10
+#define TRUNK_DISTRIBUTION_ALGO_SRC_L4PORT_BIT 0x20
+#define TRUNK_DISTRIBUTION_ALGO_DST_L4PORT_BIT 0x40
+#define TRUNK_DISTRIBUTION_ALGO_MASKALL 0x7F
+
+typedef enum rtk_trunk_group_e
+{
+    TRUNK_GROUP0 = 0,
+    TRUNK_GROUP1,
+    TRUNK_GROUP2,
+    TRUNK_GROUP3,
+    TRUNK_GROUP_END
+} rtk_trunk_group_t;
+
+/* member (logical port) of each hash value */
+typedef struct rtk_trunk_hashVal2Port_s
+{
+    uint8_t value[RTK_MAX_NUM_OF_TRUNK_HASH_VAL];
+} rtk_trunk_hashVal2Port_t;
+
+/* max packet length, two lengths (configurations 0~1) picked per port and link speed */
+#define RTK_SWITCH_MAX_PKTLEN RTL8367C_MAX_LEN_RX_TX_CFG0_MASK
+#define MAXPKTLENCFG_ID_MAX 1
+
+typedef enum rtk_switch_maxPktLen_linkSpeed_e
+{
+    MAXPKTLEN_LINK_SPEED_FE = 0,
+    MAXPKTLEN_LINK_SPEED_GE,
+    MAXPKTLEN_LINK_SPEED_END,
+} rtk_switch_maxPktLen_linkSpeed_t;
+
+typedef enum rtk_switch_len_e
+{
+    MAXPKTLEN_1522B = 0,
+    MAXPKTLEN_1536B,
+    MAXPKTLEN_1552B,
+    MAXPKTLEN_16000B,
+    MAXPKTLEN_9216B,
+    MAXPKTLEN_END
+} rtk_switch_len_t;
+
 typedef enum RTL8367C_MIBCOUNTER_E
 {
 
@@ -0,0 +1,39 @@
+#ifndef rtl8367c_field_h
+#define rtl8367c_field_h
+#include <stdint.h>
+
+/*
+ * Register field descriptors.
+ *
+ * rtl8367c_field<Reg, Mask> turns a register address and one of the *_MASK
+ * macros of rtl8367c_reg.h into compile-time constants (shift, width, max),
+ * so the field helpers of rtl8367 need no bit scanning and a constant value
+ * that does not fit the field fails to compile. RTL8367C_FIELD pastes the
+ * macro names, e.g. RTL8367C_FIELD(CPU_CTRL, CPU_INSERTMODE) for
+ * RTL8367C_REG_CPU_CTRL / RTL8367C_CPU_INSERTMODE_MASK.
+ * Include after rtl8367c_def_types.h.
+ */
+
+/* position of the lowest bit of mask, RTL8367C_REGBITLENGTH if there is none */
+constexpr uint32_t rtl8367c_fieldShift(uint32_t mask)
+{
+    return (mask == 0) ? RTL8367C_REGBITLENGTH : (uint32_t)__builtin_ctzl(mask);
+}
+
+template <uint32_t Reg, uint32_t Mask>
+struct rtl8367c_field
+{
+    static_assert((Mask != 0) && (Mask <= RTL8367C_REGDATAMAX), "field mask must fit a 16-bit register");
+    static_assert((((Mask >> rtl8367c_fieldShift(Mask)) + 1) & (Mask >> rtl8367c_fieldShift(Mask))) == 0,
+                  "field mask must be contiguous");
+
+    static const uint32_t reg = Reg;
+    static const uint32_t mask = Mask;
+    static const uint32_t shift = rtl8367c_fieldShift(Mask);
+    static const uint32_t width = __builtin_popcountl(Mask);
+    static const uint32_t max = Mask >> shift;
+};
+
+#define RTL8367C_FIELD(reg, field) rtl8367c_field<RTL8367C_REG_##reg, RTL8367C_##field##_MASK>
+
+#endif
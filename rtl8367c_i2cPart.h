@@ -2,12 +2,16 @@
 #define i2cPart_h
 #include "Arduino.h"
 #include "rtl8367.h"
+#if defined(ARDUINO_ARCH_ESP32)
+#include "driver/gpio.h"
+#include "soc/gpio_reg.h"
+#endif
 
 #define CLK_DURATION(x) delayMicroseconds(x)
 
 #define ack_timer 10
 
-void rtl8367::_smi_start()
+void rtl8367_smi_arduino::start()
 {
     /* change GPIO pin to Output only */
     pinMode(sckPin, OUTPUT);
@@ -16,25 +20,25 @@ void rtl8367::_smi_start()
     /* Initial state: SCK: 0, SDA: 1 */
     digitalWrite(sckPin, 0);
     digitalWrite(sdaPin, 1);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
 
     /* CLK 1: 0 -> 1, 1 -> 0 */
     digitalWrite(sckPin, 1);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sckPin, 0);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
 
     /* CLK 2: */
     digitalWrite(sckPin, 1);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sdaPin, 0);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sckPin, 0);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sdaPin, 1);
 }
 
-void rtl8367::_smi_writeBit(uint16_t signal, uint32_t bitLen)
+void rtl8367_smi_arduino::writeBit(uint16_t signal, uint32_t bitLen)
 {
 
     /* change GPIO pin to Output only */
@@ -42,7 +46,7 @@ void rtl8367::_smi_writeBit(uint16_t signal, uint32_t bitLen)
 
     for (; bitLen > 0; bitLen--)
     {
-        CLK_DURATION(usTransmissionDelay);
+        CLK_DURATION(usDelay);
 
         /* prepare data */
         if (signal & (1 << (bitLen - 1)))
@@ -53,16 +57,16 @@ void rtl8367::_smi_writeBit(uint16_t signal, uint32_t bitLen)
         {
             digitalWrite(sdaPin, 0);
         }
-        CLK_DURATION(usTransmissionDelay);
+        CLK_DURATION(usDelay);
 
         /* clocking */
         digitalWrite(sckPin, 1);
-        CLK_DURATION(usTransmissionDelay);
+        CLK_DURATION(usDelay);
         digitalWrite(sckPin, 0);
     }
 }
 
-void rtl8367::_smi_readBit(uint32_t bitLen, uint32_t *rData)
+void rtl8367_smi_arduino::readBit(uint32_t bitLen, uint32_t *rData)
 {
     uint32_t u = 0;
 
@@ -71,11 +75,11 @@ void rtl8367::_smi_readBit(uint32_t bitLen, uint32_t *rData)
 
     for (*rData = 0; bitLen > 0; bitLen--)
     {
-        CLK_DURATION(usTransmissionDelay);
+        CLK_DURATION(usDelay);
 
         /* clocking */
         digitalWrite(sckPin, 1);
-        CLK_DURATION(usTransmissionDelay);
+        CLK_DURATION(usDelay);
         u = digitalRead(sdaPin);
         digitalWrite(sckPin, 0);
 
@@ -83,27 +87,27 @@ void rtl8367::_smi_readBit(uint32_t bitLen, uint32_t *rData)
     }
 }
 
-void rtl8367::_smi_stop()
+void rtl8367_smi_arduino::stop()
 {
 
     /* change GPIO pin to Output only */
     pinMode(sdaPin, OUTPUT);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sdaPin, 0);
     digitalWrite(sckPin, 1);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sdaPin, 1);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sckPin, 1);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sckPin, 0);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sckPin, 1);
 
     /* add a click */
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sckPin, 0);
-    CLK_DURATION(usTransmissionDelay);
+    CLK_DURATION(usDelay);
     digitalWrite(sckPin, 1);
 
     /* change GPIO pin to Input only */
@@ -111,6 +115,265 @@ void rtl8367::_smi_stop()
     pinMode(sckPin, INPUT);
 }
 
+#ifdef RTL8367_SMI_GPIO_SUPPORTED
+
+#if defined(ARDUINO_ARCH_ESP32)
+
+#ifdef GPIO_OUT1_W1TS_REG
+#define SMI_GPIO_REG(bank, reg0, reg1) ((bank) ? (reg1) : (reg0))
+#else
+#define SMI_GPIO_REG(bank, reg0, reg1) (reg0)
+#endif
+
+void rtl8367_smi_gpio::begin(uint8_t sckPin, uint8_t sdaPin, uint16_t usDelay)
+{
+    rtl8367_smi_transport::begin(sckPin, sdaPin, usDelay);
+
+    /* route the pads to GPIO once, keep the input buffer on to sample SDA */
+    pinMode(sckPin, OUTPUT);
+    pinMode(sdaPin, OUTPUT);
+    gpio_set_direction((gpio_num_t)sckPin, GPIO_MODE_INPUT_OUTPUT);
+    gpio_set_direction((gpio_num_t)sdaPin, GPIO_MODE_INPUT_OUTPUT);
+
+    sckHigh = sckPin >> 5;
+    sckMask = 1UL << (sckPin & 0x1F);
+    sdaHigh = sdaPin >> 5;
+    sdaMask = 1UL << (sdaPin & 0x1F);
+}
+
+inline void rtl8367_smi_gpio::sck(uint8_t level)
+{
+    if (level)
+        REG_WRITE(SMI_GPIO_REG(sckHigh, GPIO_OUT_W1TS_REG, GPIO_OUT1_W1TS_REG), sckMask);
+    else
+        REG_WRITE(SMI_GPIO_REG(sckHigh, GPIO_OUT_W1TC_REG, GPIO_OUT1_W1TC_REG), sckMask);
+}
+
+inline void rtl8367_smi_gpio::sda(uint8_t level)
+{
+    if (level)
+        REG_WRITE(SMI_GPIO_REG(sdaHigh, GPIO_OUT_W1TS_REG, GPIO_OUT1_W1TS_REG), sdaMask);
+    else
+        REG_WRITE(SMI_GPIO_REG(sdaHigh, GPIO_OUT_W1TC_REG, GPIO_OUT1_W1TC_REG), sdaMask);
+}
+
+inline uint32_t rtl8367_smi_gpio::sdaRead()
+{
+    return (REG_READ(SMI_GPIO_REG(sdaHigh, GPIO_IN_REG, GPIO_IN1_REG)) & sdaMask) ? 1 : 0;
+}
+
+inline void rtl8367_smi_gpio::sdaOutput()
+{
+    REG_WRITE(SMI_GPIO_REG(sdaHigh, GPIO_ENABLE_W1TS_REG, GPIO_ENABLE1_W1TS_REG), sdaMask);
+}
+
+inline void rtl8367_smi_gpio::sdaInput()
+{
+    REG_WRITE(SMI_GPIO_REG(sdaHigh, GPIO_ENABLE_W1TC_REG, GPIO_ENABLE1_W1TC_REG), sdaMask);
+}
+
+inline void rtl8367_smi_gpio::sckOutput()
+{
+    REG_WRITE(SMI_GPIO_REG(sckHigh, GPIO_ENABLE_W1TS_REG, GPIO_ENABLE1_W1TS_REG), sckMask);
+}
+
+inline void rtl8367_smi_gpio::sckInput()
+{
+    REG_WRITE(SMI_GPIO_REG(sckHigh, GPIO_ENABLE_W1TC_REG, GPIO_ENABLE1_W1TC_REG), sckMask);
+}
+
+#else /* __AVR__ */
+
+void rtl8367_smi_gpio::begin(uint8_t sckPin, uint8_t sdaPin, uint16_t usDelay)
+{
+    rtl8367_smi_transport::begin(sckPin, sdaPin, usDelay);
+
+    /* digitalWrite also detaches any PWM timer from the pins */
+    pinMode(sckPin, OUTPUT);
+    pinMode(sdaPin, OUTPUT);
+    digitalWrite(sckPin, 0);
+    digitalWrite(sdaPin, 1);
+
+    sckOut = portOutputRegister(digitalPinToPort(sckPin));
+    sckDdr = portModeRegister(digitalPinToPort(sckPin));
+    sckMask = digitalPinToBitMask(sckPin);
+    sdaOut = portOutputRegister(digitalPinToPort(sdaPin));
+    sdaDdr = portModeRegister(digitalPinToPort(sdaPin));
+    sdaIn = portInputRegister(digitalPinToPort(sdaPin));
+    sdaMask = digitalPinToBitMask(sdaPin);
+}
+
+/* port registers may be shared with pins touched from ISRs, keep the RMW atomic */
+#define SMI_GPIO_RMW(reg, mask, level) \
+    do                                 \
+    {                                  \
+        uint8_t oldSREG = SREG;        \
+        cli();                         \
+        if (level)                     \
+            *(reg) |= (mask);          \
+        else                           \
+            *(reg) &= ~(mask);         \
+        SREG = oldSREG;                \
+    } while (0)
+
+inline void rtl8367_smi_gpio::sck(uint8_t level)
+{
+    SMI_GPIO_RMW(sckOut, sckMask, level);
+}
+
+inline void rtl8367_smi_gpio::sda(uint8_t level)
+{
+    SMI_GPIO_RMW(sdaOut, sdaMask, level);
+}
+
+inline uint32_t rtl8367_smi_gpio::sdaRead()
+{
+    return (*sdaIn & sdaMask) ? 1 : 0;
+}
+
+inline void rtl8367_smi_gpio::sdaOutput()
+{
+    SMI_GPIO_RMW(sdaDdr, sdaMask, 1);
+}
+
+inline void rtl8367_smi_gpio::sdaInput()
+{
+    SMI_GPIO_RMW(sdaDdr, sdaMask, 0);
+    SMI_GPIO_RMW(sdaOut, sdaMask, 0); /* no pull-up, same as pinMode(INPUT) */
+}
+
+inline void rtl8367_smi_gpio::sckOutput()
+{
+    SMI_GPIO_RMW(sckDdr, sckMask, 1);
+}
+
+inline void rtl8367_smi_gpio::sckInput()
+{
+    SMI_GPIO_RMW(sckDdr, sckMask, 0);
+    SMI_GPIO_RMW(sckOut, sckMask, 0);
+}
+
+#endif
+
+inline void rtl8367_smi_gpio::clk()
+{
+    if (usDelay)
+        CLK_DURATION(usDelay);
+}
+
+void rtl8367_smi_gpio::start()
+{
+    /* change GPIO pin to Output only */
+    sckOutput();
+    sdaOutput();
+
+    /* Initial state: SCK: 0, SDA: 1 */
+    sck(0);
+    sda(1);
+    clk();
+
+    /* CLK 1: 0 -> 1, 1 -> 0 */
+    sck(1);
+    clk();
+    sck(0);
+    clk();
+
+    /* CLK 2: */
+    sck(1);
+    clk();
+    sda(0);
+    clk();
+    sck(0);
+    clk();
+    sda(1);
+}
+
+void rtl8367_smi_gpio::writeBit(uint16_t signal, uint32_t bitLen)
+{
+    /* change GPIO pin to Output only */
+    sdaOutput();
+
+    for (; bitLen > 0; bitLen--)
+    {
+        clk();
+
+        /* prepare data */
+        sda((signal >> (bitLen - 1)) & 1);
+        clk();
+
+        /* clocking */
+        sck(1);
+        clk();
+        sck(0);
+    }
+}
+
+void rtl8367_smi_gpio::readBit(uint32_t bitLen, uint32_t *rData)
+{
+    /* change GPIO pin to Input only */
+    sdaInput();
+
+    for (*rData = 0; bitLen > 0; bitLen--)
+    {
+        clk();
+
+        /* clocking */
+        sck(1);
+        clk();
+        *rData |= (sdaRead() << (bitLen - 1));
+        sck(0);
+    }
+}
+
+void rtl8367_smi_gpio::stop()
+{
+    /* change GPIO pin to Output only */
+    sdaOutput();
+    clk();
+    sda(0);
+    sck(1);
+    clk();
+    sda(1);
+    clk();
+    sck(1);
+    clk();
+    sck(0);
+    clk();
+    sck(1);
+
+    /* add a click */
+    clk();
+    sck(0);
+    clk();
+    sck(1);
+
+    /* change GPIO pin to Input only */
+    sdaInput();
+    sckInput();
+}
+
+#endif
+
+void rtl8367::_smi_start()
+{
+    smiTransport->start();
+}
+
+void rtl8367::_smi_writeBit(uint16_t signal, uint32_t bitLen)
+{
+    smiTransport->writeBit(signal, bitLen);
+}
+
+void rtl8367::_smi_readBit(uint32_t bitLen, uint32_t *rData)
+{
+    smiTransport->readBit(bitLen, rData);
+}
+
+void rtl8367::_smi_stop()
+{
+    smiTransport->stop();
+}
+
 int32_t rtl8367::smi_read(uint32_t mAddrs, uint32_t *rData)
 {
     uint32_t rawData = 0, ACK;
@@ -176,6 +439,10 @@ int32_t rtl8367::smi_read(uint32_t mAddrs, uint32_t *rData)
 
     _smi_stop();
 
+#ifdef RTL8367_SMI_STATS
+    smiStatsCount(1, mAddrs, ret);
+#endif
+
     return ret;
 }
 
@@ -254,17 +521,578 @@ int32_t rtl8367::smi_write(uint32_t mAddrs, uint32_t rData)
 
     _smi_stop();
 
+#ifdef RTL8367_SMI_STATS
+    smiStatsCount(0, mAddrs, ret);
+#endif
+
     return ret;
 }
 
+#ifdef RTL8367_SMI_STATS
+rtl8367_smi_stats_t *rtl8367::smiStatsEnter(const char *api)
+{
+    uint32_t i;
+
+    /* nested call, keep charging the outer API */
+    if (smiStatsCur != NULL)
+        return smiStatsCur;
+
+    smiStatsCur = &smiStats[RTL8367_SMI_STATS_OVERFLOW];
+    for (i = RTL8367_SMI_STATS_OVERFLOW + 1; i < RTL8367_SMI_STATS_SLOTS; i++)
+    {
+        if (smiStats[i].api == NULL)
+            smiStats[i].api = api;
+
+        if (smiStats[i].api == api)
+        {
+            smiStatsCur = &smiStats[i];
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+void rtl8367::smiStatsLeave(rtl8367_smi_stats_t *prev, uint32_t us)
+{
+    if (prev != NULL)
+        return;
+
+    smiStatsCur->calls++;
+    smiStatsCur->us += us;
+    smiStatsCur = NULL;
+}
+
+void rtl8367::smiStatsCount(uint32_t isRead, uint32_t mAddrs, int32_t ret)
+{
+    rtl8367_smi_stats_t *pStats = (smiStatsCur != NULL) ? smiStatsCur : &smiStats[0];
+
+    if (isRead)
+    {
+        pStats->reads++;
+
+        switch (mAddrs)
+        {
+        case RTL8367C_TABLE_ACCESS_STATUS_REG:
+        case RTL8367C_REG_INDRECT_ACCESS_STATUS:
+        case RTL8367C_MIB_CTRL_REG:
+        case RTL8367C_REG_FORCE_FLUSH:
+        case RTL8367C_REG_FORCE_FLUSH1:
+        case RTL8367C_REG_L2_FLUSH_CTRL3:
+            pStats->busyPolls++;
+            break;
+        default:
+            break;
+        }
+    }
+    else
+    {
+        pStats->writes++;
+    }
+
+    if (ret != RT_ERR_OK)
+        pStats->ackFails++;
+}
+
+/* Function Name:
+ *      getSmiStats
+ * Description:
+ *      Get the per-API SMI cost counters
+ * Input:
+ *      None
+ * Output:
+ *      pNum - number of slots in use
+ * Return:
+ *      Pointer to the counter slots, slot 0 holds untagged traffic and
+ *      slot RTL8367_SMI_STATS_OVERFLOW the APIs that found the table full
+ * Note:
+ *      Counters keep running, copy them if a stable snapshot is needed.
+ */
+const rtl8367_smi_stats_t *rtl8367::getSmiStats(uint32_t *pNum)
+{
+    uint32_t i;
+
+    if (pNum != NULL)
+    {
+        for (i = RTL8367_SMI_STATS_OVERFLOW + 1; i < RTL8367_SMI_STATS_SLOTS; i++)
+            if (smiStats[i].api == NULL)
+                break;
+
+        *pNum = i;
+    }
+
+    return smiStats;
+}
+
+void rtl8367::clearSmiStats()
+{
+    memset(smiStats, 0, sizeof(smiStats));
+    smiStatsCur = NULL;
+}
+
+void rtl8367::dumpSmiStats()
+{
+    uint32_t i, num;
+
+    getSmiStats(&num);
+
+    Serial.println("api calls reads writes ackFails busyPolls us");
+    for (i = 0; i < num; i++)
+    {
+        if (smiStats[i].api != NULL)
+            Serial.print(smiStats[i].api);
+        else
+            Serial.print((i == RTL8367_SMI_STATS_OVERFLOW) ? "(overflow)" : "(untagged)");
+        Serial.print(' ');
+        Serial.print((unsigned long)smiStats[i].calls);
+        Serial.print(' ');
+        Serial.print((unsigned long)smiStats[i].reads);
+        Serial.print(' ');
+        Serial.print((unsigned long)smiStats[i].writes);
+        Serial.print(' ');
+        Serial.print((unsigned long)smiStats[i].ackFails);
+        Serial.print(' ');
+        Serial.print((unsigned long)smiStats[i].busyPolls);
+        Serial.print(' ');
+        Serial.println((unsigned long)smiStats[i].us);
+    }
+}
+#endif
+
+#if defined(RTL8367_REG_CACHE) || defined(RTL8367_REG_BATCH)
+/* registers the chip changes on its own or that trigger an action when written */
+uint32_t rtl8367::regVolatile(uint32_t reg)
+{
+    const uint16_t volatileRange[][2] = {
+        {RTL8367C_REG_FLOWCTRL_DEBUG_CTRL0, RTL8367C_REG_FLOWCTRL_DEBUG_CTRL1}, /* queue select, QMAX clear pulse */
+        {RTL8367C_REG_FLOWCTRL_QUEUE0_PAGE_COUNT, RTL8367C_REG_FLOWCTRL_PORT_MAX_PAGE_COUNT},
+        {RTL8367C_REG_Q_TXPKT_CNT_CTL, RTL8367C_REG_Q7_TXPKT_CNT_H},
+        {RTL8367C_REG_TABLE_ACCESS_CTRL, RTL8367C_REG_TABLE_READ_DATA9},
+        {RTL8367C_REG_ACL_RESET_CFG, RTL8367C_REG_ACL_RESET_CFG},
+        {RTL8367C_REG_FORCE_FLUSH1, RTL8367C_REG_L2_FLUSH_CTRL3},
+        {RTL8367C_REG_FLUSH_STATUS, RTL8367C_REG_FLUSH_STATUS},
+        {RTL8367C_REG_L2_LRN_CNT_CTRL0, RTL8367C_REG_L2_LRN_CNT_CTRL10},
+        {RTL8367C_REG_MIB_COUNTER0, RTL8367C_REG_MIB_CTRL0},
+        {RTL8367C_REG_INTR_IMS, RTL8367C_REG_SYSTEM_LEARN_OVER_INDICATOR},
+        {RTL8367C_REG_INTR_IMS_8051, RTL8367C_REG_PORT_LINKUP_INDICATOR_8051},
+        {RTL8367C_REG_INTR_IMS_BUFFER_RESET, RTL8367C_REG_THERMAL_INTRPT_8051},
+        {RTL8367C_REG_PKTGEN_COMMAND, RTL8367C_REG_PKTGEN_COMMAND},
+        {RTL8367C_REG_FLOWCTRL_TOTAL_PAGE_COUNTER, RTL8367C_REG_FLOWCTRL_PORT10_PAGE_COUNTER},
+        {RTL8367C_REG_STS_BIST_DONE, RTL8367C_REG_STS_DRF_BIST_RLT4},
+        {RTL8367C_REG_HWPKT_GEN_MISC, RTL8367C_REG_CHIP_VER},
+        {RTL8367C_REG_MISCELLANEOUS_CONFIGURE1, RTL8367C_REG_MISCELLANEOUS_CONFIGURE1}, /* EEPROM download status */
+        {RTL8367C_REG_CHIP_RESET, RTL8367C_REG_CHIP_RESET},
+        {RTL8367C_REG_PORT0_STATUS, RTL8367C_REG_PORT10_STATUS},
+        {RTL8367C_REG_EFUSE_CMD, RTL8367C_REG_EFUSE_RDAT},
+        {0x13C2, 0x13C2}, /* chip ID access key, see rtk_switch_probe */
+        {RTL8367C_REG_STATUS_GPIO, RTL8367C_REG_STATUS_GPIO},
+        {RTL8367C_REG_SERDES_RESULT, RTL8367C_REG_SERDES_RESULT},
+        {RTL8367C_REG_METER_OVERRATE_INDICATOR0, RTL8367C_REG_METER_OVERRATE_INDICATOR1_8051},
+        {RTL8367C_REG_METER_OVERRATE_INDICATOR2, RTL8367C_REG_METER_OVERRATE_INDICATOR3_8051},
+        {RTL8367C_REG_RLDP_LOOPED_INDICATOR, RTL8367C_REG_RLDP_LOOPED_INDICATOR},
+        {RTL8367C_REG_RLDP_RELEASED_INDICATOR, RTL8367C_REG_RLDP_LOOPSTATUS_INDICATOR},
+        {RTL8367C_REG_NIC_IMS, RTL8367C_REG_NIC_IMS},
+        {RTL8367C_REG_RTCT_RESULTS_CFG, RTL8367C_REG_RTCT_RESULTS_CFG},
+        {RTL8367C_REG_EF_SLV_CTRL_0, RTL8367C_REG_EF_SLV_CTRL_0},
+        {RTL8367C_REG_SSC_STS0, RTL8367C_REG_SSC_STS0},
+        {RTL8367C_REG_SSC_STS1, RTL8367C_REG_SSC_STS1},
+        {RTL8367C_REG_SSC_STS2, RTL8367C_REG_SSC_STS2},
+        {RTL8367C_REG_SSC_STS3, RTL8367C_REG_SSC_STS3},
+        {RTL8367C_REG_SDS_STAT_0, RTL8367C_REG_MAC_LINK_STAT_1},
+        {RTL8367C_REG_PHY_DEBUG_CNT_CTRL, RTL8367C_REG_RXPKT_CNT_H_7},
+        {RTL8367C_REG_INDRECT_ACCESS_CTRL, RTL8367C_REG_INDRECT_ACCESS_READ_DATA},
+        {RTL8367C_REG_SDS_INDACS_CMD, RTL8367C_REG_SDS_INDACS_DATA}};
+    uint32_t i;
+
+    /* per port blocks of 0x20: packet generator control/counters, TX error
+       counter, current rate and page counter */
+    if (reg <= RTL8367C_REG_P10_MSIC1)
+    {
+        switch (reg & 0x1F)
+        {
+        case RTL8367C_REG_PKTGEN_PORT0_CTRL:
+        case RTL8367C_REG_TX_ERR_CNT_PORT0:
+        case RTL8367C_REG_PKTGEN_PORT0_COUNTER0:
+        case RTL8367C_REG_PKTGEN_PORT0_COUNTER1:
+        case RTL8367C_REG_PORT0_CURENT_RATE0:
+        case RTL8367C_REG_PORT0_CURENT_RATE1:
+        case RTL8367C_REG_PORT0_PAGE_COUNTER:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    for (i = 0; i < sizeof(volatileRange) / sizeof(volatileRange[0]); i++)
+    {
+        if (reg < volatileRange[i][0])
+            break;
+
+        if (reg <= volatileRange[i][1])
+            return 1;
+    }
+
+    return 0;
+}
+#endif
+
+#ifdef RTL8367_REG_CACHE
+/* slot owned by reg, or the free slot it would take, or RTL8367_REG_CACHE_SIZE if full */
+uint32_t rtl8367::regCacheFind(uint32_t reg)
+{
+    uint32_t idx, probe;
+
+    idx = ((reg * 40503UL) >> 4) & (RTL8367_REG_CACHE_SIZE - 1);
+    for (probe = 0; probe < RTL8367_REG_CACHE_SIZE; probe++)
+    {
+        if (!(regCacheUsed[idx >> 3] & (1 << (idx & 7))) || (regCacheReg[idx] == reg))
+            return idx;
+
+        idx = (idx + 1) & (RTL8367_REG_CACHE_SIZE - 1);
+    }
+
+    return RTL8367_REG_CACHE_SIZE;
+}
+
+int32_t rtl8367::regCacheGet(uint32_t reg, uint32_t *pValue)
+{
+    uint32_t idx;
+
+    if (regCacheMode != REG_CACHE_ENABLE)
+        return RT_ERR_FAILED;
+
+    idx = regCacheFind(reg);
+    if ((idx == RTL8367_REG_CACHE_SIZE) || !(regCacheValid[idx >> 3] & (1 << (idx & 7))) || (regCacheReg[idx] != reg))
+    {
+        regCacheStats.misses++;
+        return RT_ERR_FAILED;
+    }
+
+    regCacheStats.hits++;
+    *pValue = regCacheValue[idx];
+
+    return RT_ERR_OK;
+}
+
+/* record the chip's value of reg, isRead tells it was just read back (checked in verify mode) */
+void rtl8367::regCacheFill(uint32_t reg, uint32_t value, uint32_t isRead)
+{
+    uint32_t idx;
+
+    if ((regCacheMode == REG_CACHE_DISABLE) || regVolatile(reg))
+        return;
+
+    idx = regCacheFind(reg);
+    if (idx == RTL8367_REG_CACHE_SIZE)
+    {
+        regCacheStats.overflows++;
+        return;
+    }
+
+    if (regCacheValid[idx >> 3] & (1 << (idx & 7)))
+    {
+        if (isRead && (regCacheValue[idx] != value))
+            regCacheStats.mismatches++;
+    }
+    else
+    {
+        regCacheStats.entries++;
+    }
+
+    regCacheReg[idx] = reg;
+    regCacheValue[idx] = value;
+    regCacheUsed[idx >> 3] |= (1 << (idx & 7));
+    regCacheValid[idx >> 3] |= (1 << (idx & 7));
+}
+
+/* forget the value of reg, e.g. after a failed write */
+void rtl8367::regCacheDrop(uint32_t reg)
+{
+    uint32_t idx;
+
+    idx = regCacheFind(reg);
+    if ((idx == RTL8367_REG_CACHE_SIZE) || (regCacheReg[idx] != reg) || !(regCacheValid[idx >> 3] & (1 << (idx & 7))))
+        return;
+
+    regCacheValid[idx >> 3] &= ~(1 << (idx & 7));
+    regCacheStats.entries--;
+}
+
+/* Function Name:
+ *      setRegCacheMode
+ * Description:
+ *      Select how the register shadow cache is used
+ * Input:
+ *      mode - REG_CACHE_DISABLE, REG_CACHE_ENABLE or REG_CACHE_VERIFY
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - OK
+ *      RT_ERR_INPUT    - Invalid input parameter
+ * Note:
+ *      REG_CACHE_VERIFY keeps the shadow up to date but reads every register
+ *      from the chip, counting the shadow values that turn out stale.
+ *      Disabling the cache drops its content.
+ */
+int32_t rtl8367::setRegCacheMode(rtl8367_reg_cache_mode_t mode)
+{
+    if (mode >= REG_CACHE_MODE_END)
+        return RT_ERR_INPUT;
+
+    if (mode == REG_CACHE_DISABLE)
+        invalidateRegCache();
+
+    regCacheMode = mode;
+
+    return RT_ERR_OK;
+}
+
+/* Function Name:
+ *      invalidateRegCache
+ * Description:
+ *      Drop all shadowed register values
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      None
+ * Note:
+ *      reset() calls this, call it too if anything else than this instance
+ *      (EEPROM, embedded 8051, another master) changes the configuration.
+ *      The remembered PHY OCP page is dropped as well.
+ */
+void rtl8367::invalidateRegCache()
+{
+    memset(regCacheUsed, 0, sizeof(regCacheUsed));
+    memset(regCacheValid, 0, sizeof(regCacheValid));
+    regCacheStats.entries = 0;
+    phyOcpPrefix = RTL8367C_PHY_OCP_PREFIX_NONE;
+}
+
+/* Function Name:
+ *      verifyRegCache
+ * Description:
+ *      Compare every shadowed register with the chip
+ * Input:
+ *      None
+ * Output:
+ *      pMismatch - number of stale shadow values
+ * Return:
+ *      RT_ERR_OK           - OK
+ *      RT_ERR_SMI          - SMI access error
+ *      RT_ERR_NULL_POINTER - input parameter may be null pointer
+ * Note:
+ *      Stale values are replaced by the chip's value.
+ */
+int32_t rtl8367::verifyRegCache(uint32_t *pMismatch)
+{
+    RTK_SMI_STATS_SCOPE();
+    uint32_t idx, regData;
+    int32_t retVal;
+
+    if (pMismatch == NULL)
+        return RT_ERR_NULL_POINTER;
+
+    *pMismatch = 0;
+    for (idx = 0; idx < RTL8367_REG_CACHE_SIZE; idx++)
+    {
+        if (!(regCacheValid[idx >> 3] & (1 << (idx & 7))))
+            continue;
+
+        retVal = smi_read(regCacheReg[idx], &regData);
+        if (retVal != RT_ERR_OK)
+            return RT_ERR_SMI;
+
+        if (regCacheValue[idx] != regData)
+        {
+            regCacheValue[idx] = regData;
+            regCacheStats.mismatches++;
+            (*pMismatch)++;
+        }
+    }
+
+    return RT_ERR_OK;
+}
+
+void rtl8367::getRegCacheStats(rtl8367_reg_cache_stats_t *pStats)
+{
+    if (pStats != NULL)
+        *pStats = regCacheStats;
+}
+#endif
+
+#ifdef RTL8367_REG_BATCH
+uint32_t rtl8367::regBatchFind(uint32_t reg)
+{
+    uint32_t i;
+
+    for (i = 0; i < regBatchNum; i++)
+    {
+        if (regBatchReg[i] == reg)
+            return i;
+    }
+
+    return RTL8367_REG_BATCH_SIZE;
+}
+
+/* merge the bits of value selected by mask into the pending update of reg */
+int32_t rtl8367::regBatchPut(uint32_t reg, uint32_t mask, uint32_t value)
+{
+    uint32_t i;
+    int32_t retVal;
+
+    if (value > RTL8367C_REGDATAMAX)
+        return RT_ERR_INPUT;
+
+    i = regBatchFind(reg);
+    if (i == RTL8367_REG_BATCH_SIZE)
+    {
+        if (regBatchNum == RTL8367_REG_BATCH_SIZE)
+        {
+            retVal = regBatchFlush();
+            if (retVal != RT_ERR_OK)
+                return retVal;
+        }
+
+        i = regBatchNum++;
+        regBatchReg[i] = reg;
+        regBatchMask[i] = 0;
+        regBatchValue[i] = 0;
+    }
+
+    regBatchMask[i] |= mask;
+    regBatchValue[i] = (regBatchValue[i] & ~mask) | (value & mask);
+
+    return RT_ERR_OK;
+}
+
+/* write the pending updates out, partial ones are merged with the chip's value;
+ * a failed access does not stop the others, the first error is returned */
+int32_t rtl8367::regBatchFlush()
+{
+    uint32_t i, num, depth;
+    uint32_t regData, oldData;
+    int32_t retVal;
+    int32_t firstErr = RT_ERR_OK;
+
+    /* plain accesses from here on */
+    num = regBatchNum;
+    depth = regBatchDepth;
+    regBatchNum = 0;
+    regBatchDepth = 0;
+
+    for (i = 0; i < num; i++)
+    {
+        regData = regBatchValue[i];
+        if (regBatchMask[i] != RTL8367C_REGDATAMAX)
+        {
+            retVal = rtl8367c_getAsicReg(regBatchReg[i], &oldData);
+            if (retVal != RT_ERR_OK)
+            {
+                if (firstErr == RT_ERR_OK)
+                    firstErr = retVal;
+                continue;
+            }
+
+            regData |= oldData & ~regBatchMask[i];
+            if (regData == oldData)
+                continue;
+        }
+
+        retVal = rtl8367c_setAsicReg(regBatchReg[i], regData);
+        if ((retVal != RT_ERR_OK) && (firstErr == RT_ERR_OK))
+            firstErr = retVal;
+    }
+
+    regBatchDepth = depth;
+
+    return firstErr;
+}
+
+/* Function Name:
+ *      beginRegBatch
+ * Description:
+ *      Start collecting register updates
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      None
+ * Note:
+ *      Calls nest, the updates are written by the outermost commitRegBatch().
+ *      Up to RTL8367_REG_BATCH_SIZE registers are held, the batch is written
+ *      out early when more are touched.
+ */
+void rtl8367::beginRegBatch()
+{
+    if (regBatchDepth < 0xFF)
+        regBatchDepth++;
+}
+
+/* Function Name:
+ *      commitRegBatch
+ * Description:
+ *      Write the collected register updates
+ * Input:
+ *      None
+ * Output:
+ *      None
+ * Return:
+ *      RT_ERR_OK       - OK
+ *      RT_ERR_FAILED   - No batch started
+ *      RT_ERR_SMI      - SMI access error
+ * Note:
+ *      Each register is written once, a register only partially updated is
+ *      read first and left alone if nothing changes.
+ *      The batch is always emptied: on an SMI error the remaining registers
+ *      are still written and the first error is returned, the register that
+ *      failed keeps whatever value the chip holds.
+ */
+int32_t rtl8367::commitRegBatch()
+{
+    RTK_SMI_STATS_SCOPE();
+
+    if (regBatchDepth == 0)
+        return RT_ERR_FAILED;
+
+    if (--regBatchDepth > 0)
+        return RT_ERR_OK;
+
+    return regBatchFlush();
+}
+#endif
+
 int32_t rtl8367::rtl8367c_setAsicReg(uint32_t reg, uint32_t value)
 {
     int32_t retVal;
 
+#ifdef RTL8367_REG_BATCH
+    if (regBatchDepth > 0)
+    {
+        if (!regVolatile(reg))
+            return regBatchPut(reg, RTL8367C_REGDATAMAX, value);
+
+        retVal = regBatchFlush();
+        if (retVal != RT_ERR_OK)
+            return retVal;
+    }
+#endif
+
     retVal = smi_write(reg, value);
 
     if (retVal != RT_ERR_OK)
+    {
+#ifdef RTL8367_REG_CACHE
+        regCacheDrop(reg);
+#endif
         return RT_ERR_SMI;
+    }
+
+#ifdef RTL8367_REG_CACHE
+    regCacheFill(reg, value, 0);
+#endif
 
     return RT_ERR_OK;
 }
@@ -273,10 +1101,47 @@ int32_t rtl8367::rtl8367c_getAsicReg(uint32_t reg, uint32_t *pValue)
 {
     uint32_t regData;
     int32_t retVal;
+#ifdef RTL8367_REG_BATCH
+    uint32_t idx = RTL8367_REG_BATCH_SIZE;
 
-    retVal = smi_read(reg, &regData);
-    if (retVal != RT_ERR_OK)
-        return RT_ERR_SMI;
+    if (regBatchDepth > 0)
+    {
+        if (regVolatile(reg))
+        {
+            retVal = regBatchFlush();
+            if (retVal != RT_ERR_OK)
+                return retVal;
+        }
+        else
+        {
+            idx = regBatchFind(reg);
+            if ((idx != RTL8367_REG_BATCH_SIZE) && (regBatchMask[idx] == RTL8367C_REGDATAMAX))
+            {
+                *pValue = regBatchValue[idx];
+                return RT_ERR_OK;
+            }
+        }
+    }
+#endif
+
+#ifdef RTL8367_REG_CACHE
+    if (regCacheGet(reg, &regData) != RT_ERR_OK)
+#endif
+    {
+        retVal = smi_read(reg, &regData);
+        if (retVal != RT_ERR_OK)
+            return RT_ERR_SMI;
+
+#ifdef RTL8367_REG_CACHE
+        regCacheFill(reg, regData, 1);
+#endif
+    }
+
+#ifdef RTL8367_REG_BATCH
+    /* pending updates not written yet */
+    if (idx != RTL8367_REG_BATCH_SIZE)
+        regData = (regData & ~regBatchMask[idx]) | regBatchValue[idx];
+#endif
 
     *pValue = regData;
 
@@ -300,38 +1165,43 @@ int32_t rtl8367::rtl8367c_getAsicReg(uint32_t reg, uint32_t *pValue)
  * Note:
  *      Set bits of a specified register to value. Both bits and value are be treated as bit-mask
  */
-int32_t rtl8367::rtl8367c_setAsicRegBits(uint32_t reg, uint32_t bits, uint32_t value)
+inline int32_t rtl8367::rtl8367c_setAsicRegBits(uint32_t reg, uint32_t bits, uint32_t value)
 {
-    uint32_t regData;
-    int32_t retVal;
-    uint32_t bitsShift;
     uint32_t valueShifted;
 
-    if (bits >= (1 << RTL8367C_REGBITLENGTH))
+    if ((bits == 0) || (bits >= (1 << RTL8367C_REGBITLENGTH)))
         return RT_ERR_INPUT;
 
-    bitsShift = 0;
-    while (!(bits & (1 << bitsShift)))
-    {
-        bitsShift++;
-        if (bitsShift >= RTL8367C_REGBITLENGTH)
-            return RT_ERR_INPUT;
-    }
-    valueShifted = value << bitsShift;
+    /* folds to a constant for the usual *_MASK argument */
+    valueShifted = value << rtl8367c_fieldShift(bits);
 
     if (valueShifted > RTL8367C_REGDATAMAX)
         return RT_ERR_INPUT;
 
-    retVal = smi_read(reg, &regData);
+    return rtl8367c_setAsicRegMasked(reg, bits, valueShifted);
+}
+
+/* read-modify-write of the bits set in mask, value already in place */
+int32_t rtl8367::rtl8367c_setAsicRegMasked(uint32_t reg, uint32_t mask, uint32_t valueShifted)
+{
+    uint32_t regData;
+    int32_t retVal;
+
+#ifdef RTL8367_REG_BATCH
+    if ((regBatchDepth > 0) && !regVolatile(reg))
+        return regBatchPut(reg, mask, valueShifted);
+#endif
+
+    retVal = rtl8367c_getAsicReg(reg, &regData);
     if (retVal != RT_ERR_OK)
-        return RT_ERR_SMI;
+        return retVal;
 
-    regData = regData & (~bits);
-    regData = regData | (valueShifted & bits);
+    regData = regData & (~mask);
+    regData = regData | (valueShifted & mask);
 
-    retVal = smi_write(reg, regData);
+    retVal = rtl8367c_setAsicReg(reg, regData);
     if (retVal != RT_ERR_OK)
-        return RT_ERR_SMI;
+        return retVal;
 
     return RT_ERR_OK;
 }
@@ -361,18 +1231,23 @@ int32_t rtl8367::rtl8367c_setAsicRegBit(uint32_t reg, uint32_t bit, uint32_t val
     if (bit >= RTL8367C_REGBITLENGTH)
         return RT_ERR_INPUT;
 
-    retVal = smi_read(reg, &regData);
+#ifdef RTL8367_REG_BATCH
+    if ((regBatchDepth > 0) && !regVolatile(reg))
+        return regBatchPut(reg, 1 << bit, value ? (1 << bit) : 0);
+#endif
+
+    retVal = rtl8367c_getAsicReg(reg, &regData);
     if (retVal != RT_ERR_OK)
-        return RT_ERR_SMI;
+        return retVal;
 
     if (value)
         regData = regData | (1 << bit);
     else
         regData = regData & (~(1 << bit));
 
-    retVal = smi_write(reg, regData);
+    retVal = rtl8367c_setAsicReg(reg, regData);
     if (retVal != RT_ERR_OK)
-        return RT_ERR_SMI;
+        return retVal;
 
     return RT_ERR_OK;
 }
@@ -399,9 +1274,9 @@ int32_t rtl8367::rtl8367c_getAsicRegBit(uint32_t reg, uint32_t bit, uint32_t *pV
     uint32_t regData;
     int32_t retVal;
 
-    retVal = smi_read(reg, &regData);
+    retVal = rtl8367c_getAsicReg(reg, &regData);
     if (retVal != RT_ERR_OK)
-        return RT_ERR_SMI;
+        return retVal;
 
     *pValue = (regData & (0x1 << bit)) >> bit;
 
@@ -425,30 +1300,20 @@ int32_t rtl8367::rtl8367c_getAsicRegBit(uint32_t reg, uint32_t bit, uint32_t *pV
  * Note:
  *      None
  */
-int32_t rtl8367::rtl8367c_getAsicRegBits(uint32_t reg, uint32_t bits, uint32_t *pValue)
+inline int32_t rtl8367::rtl8367c_getAsicRegBits(uint32_t reg, uint32_t bits, uint32_t *pValue)
 {
-
     uint32_t regData;
     int32_t retVal;
-    uint32_t bitsShift;
 
-    if (bits >= (1 << RTL8367C_REGBITLENGTH))
+    if ((bits == 0) || (bits >= (1 << RTL8367C_REGBITLENGTH)))
         return RT_ERR_INPUT;
 
-    bitsShift = 0;
-    while (!(bits & (1 << bitsShift)))
-    {
-        bitsShift++;
-        if (bitsShift >= RTL8367C_REGBITLENGTH)
-            return RT_ERR_INPUT;
-    }
-
-    retVal = smi_read(reg, &regData);
+    retVal = rtl8367c_getAsicReg(reg, &regData);
     if (retVal != RT_ERR_OK)
-        return RT_ERR_SMI;
+        return retVal;
 
-    *pValue = (regData & bits) >> bitsShift;
+    *pValue = (regData & bits) >> rtl8367c_fieldShift(bits);
 
     return RT_ERR_OK;
 }
-#endif
\ No newline at end of file
+#endif
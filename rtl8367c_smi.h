@@ -0,0 +1,161 @@
+#ifndef rtl8367c_smi_h
+#define rtl8367c_smi_h
+#include <Arduino.h>
+
+/*
+ * SMI bit-level transport.
+ *
+ * smi_read/smi_write build the SMI frames out of start/writeBit/readBit/stop
+ * primitives; a transport supplies those primitives for a given GPIO backend.
+ * rtl8367 uses rtl8367_smi_arduino (digitalWrite/digitalRead/pinMode) unless
+ * another transport is installed with rtl8367::setTransport().
+ */
+class rtl8367_smi_transport
+{
+public:
+    virtual ~rtl8367_smi_transport() {}
+
+    /* called whenever pins or clock delay change, configure the GPIOs here */
+    virtual void begin(uint8_t sckPin, uint8_t sdaPin, uint16_t usDelay)
+    {
+        this->sckPin = sckPin;
+        this->sdaPin = sdaPin;
+        this->usDelay = usDelay;
+    }
+
+    virtual void start() = 0;
+    virtual void writeBit(uint16_t signal, uint32_t bitLen) = 0;
+    virtual void readBit(uint32_t bitLen, uint32_t *rData) = 0;
+    virtual void stop() = 0;
+
+protected:
+    uint8_t
+        sckPin = 0,
+        sdaPin = 0;
+    uint16_t usDelay = 1;
+};
+
+/* Default transport, portable Arduino HAL calls */
+class rtl8367_smi_arduino : public rtl8367_smi_transport
+{
+public:
+    void start();
+    void writeBit(uint16_t signal, uint32_t bitLen);
+    void readBit(uint32_t bitLen, uint32_t *rData);
+    void stop();
+};
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(__AVR__)
+#define RTL8367_SMI_GPIO_SUPPORTED
+
+/*
+ * Direct port-register transport for ESP32 and AVR.
+ * Pins are resolved to register/bitmask pairs once in begin(), every clock
+ * edge afterwards is a single register store. A clock delay of 0 removes the
+ * delayMicroseconds() calls entirely, only use it if the wiring allows it.
+ */
+class rtl8367_smi_gpio : public rtl8367_smi_transport
+{
+public:
+    void begin(uint8_t sckPin, uint8_t sdaPin, uint16_t usDelay);
+    void start();
+    void writeBit(uint16_t signal, uint32_t bitLen);
+    void readBit(uint32_t bitLen, uint32_t *rData);
+    void stop();
+
+private:
+    inline void sck(uint8_t level);
+    inline void sda(uint8_t level);
+    inline uint32_t sdaRead();
+    inline void sdaOutput();
+    inline void sdaInput();
+    inline void sckOutput();
+    inline void sckInput();
+    inline void clk();
+
+#if defined(ARDUINO_ARCH_ESP32)
+    uint32_t sckMask = 0, sdaMask = 0;
+    uint8_t sckHigh = 0, sdaHigh = 0;
+#else
+    volatile uint8_t *sckOut = NULL, *sckDdr = NULL;
+    volatile uint8_t *sdaOut = NULL, *sdaDdr = NULL, *sdaIn = NULL;
+    uint8_t sckMask = 0, sdaMask = 0;
+#endif
+};
+#endif
+
+/*
+ * SMI cost accounting, build with -DRTL8367_SMI_STATS to enable.
+ * Traffic is attributed to the outermost public API call that caused it,
+ * slot 0 collects traffic issued outside of any tagged call and slot 1 the
+ * calls of APIs that found the table full.
+ */
+#ifdef RTL8367_SMI_STATS
+#ifndef RTL8367_SMI_STATS_SLOTS
+#define RTL8367_SMI_STATS_SLOTS 96
+#endif
+#define RTL8367_SMI_STATS_OVERFLOW 1
+
+typedef struct rtl8367_smi_stats_s
+{
+    const char *api;    /* entry point name, NULL for slots 0 and 1 */
+    uint32_t calls;     /* completed calls */
+    uint32_t reads;     /* SMI read frames */
+    uint32_t writes;    /* SMI write frames */
+    uint32_t ackFails;  /* frames with a missing ACK */
+    uint32_t busyPolls; /* reads of busy/status registers */
+    uint32_t us;        /* time spent in the call */
+} rtl8367_smi_stats_t;
+#endif
+
+/*
+ * Register shadow cache, build with -DRTL8367_REG_CACHE to enable.
+ * Configuration registers read or written through the rtl8367c_*AsicReg*
+ * helpers are remembered, so field updates cost a single write and reads of
+ * known configuration cost no bus traffic. Status, counter, busy and indirect
+ * access registers are never shadowed.
+ */
+#ifdef RTL8367_REG_CACHE
+#ifndef RTL8367_REG_CACHE_SIZE
+#define RTL8367_REG_CACHE_SIZE 256
+#endif
+#if (RTL8367_REG_CACHE_SIZE < 8) || ((RTL8367_REG_CACHE_SIZE & (RTL8367_REG_CACHE_SIZE - 1)) != 0)
+#error "RTL8367_REG_CACHE_SIZE must be a power of two, 8 or more"
+#endif
+
+typedef enum rtl8367_reg_cache_mode_e
+{
+    REG_CACHE_DISABLE = 0,
+    REG_CACHE_ENABLE, /* shadowed registers are read from RAM */
+    REG_CACHE_VERIFY, /* reads go to the chip and are compared with the shadow */
+    REG_CACHE_MODE_END
+} rtl8367_reg_cache_mode_t;
+
+typedef struct rtl8367_reg_cache_stats_s
+{
+    uint32_t entries;    /* registers currently shadowed */
+    uint32_t hits;       /* reads served from the shadow */
+    uint32_t misses;     /* reads that went to the chip */
+    uint32_t mismatches; /* stale shadow values found in verify mode */
+    uint32_t overflows;  /* registers left out because the table was full */
+} rtl8367_reg_cache_stats_t;
+#endif
+
+/*
+ * Write-combining register batch, build with -DRTL8367_REG_BATCH to enable.
+ * Between beginRegBatch() and commitRegBatch() writes and field updates of
+ * configuration registers are merged per register and written once on
+ * commit. Any access to a volatile register (see RTL8367_REG_CACHE) writes
+ * the pending updates out first, so table and indirect accesses still see
+ * the configuration in the order it was issued.
+ */
+#ifdef RTL8367_REG_BATCH
+#ifndef RTL8367_REG_BATCH_SIZE
+#define RTL8367_REG_BATCH_SIZE 32
+#endif
+#if (RTL8367_REG_BATCH_SIZE < 1) || (RTL8367_REG_BATCH_SIZE > 255)
+#error "RTL8367_REG_BATCH_SIZE must be 1~255"
+#endif
+#endif
+
+#endif